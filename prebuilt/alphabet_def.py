@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Compile the XML descriptions of an alphabet (e.g. res/cyrillic) into a C++
+# source file (e.g. src/res/alphabet/cyrillic.def.cpp), thus the alphabet is
+# registered from the tables compiled into the library instead of parsing the
+# XML files at runtime.
+#
+# Usage:
+#
+#     alphabet_def.py <res-dir> <alphabet> <output>
+#
+# e.g. alphabet_def.py res cyrillic src/res/alphabet/cyrillic.def.cpp
+#
+# Run it again once the XML files have changed, the output must be generated
+# with the same version of the format (ALPHABET_DEF_VERSION) as the library.
+
+import os
+import sys
+import xml.etree.ElementTree as ET
+
+# keep it in sync with ALPHABET_DEF_VERSION in src/res/alphabet_def.res.h
+VERSION = 1
+
+# the symbol types to the members of tex::AtomType
+SYMBOL_TYPES = {
+    'ord': 'ordinary',
+    'op': 'bigOperator',
+    'bin': 'binaryOperator',
+    'rel': 'relation',
+    'open': 'opening',
+    'close': 'closing',
+    'punct': 'punctuation',
+    'acc': 'accent',
+}
+
+
+def c_str(s):
+    """Quote the string as a C string literal, the non-ASCII characters are
+    escaped as UTF-8 bytes"""
+    out = '"'
+    escaped = False
+    for b in s.encode('utf-8'):
+        c = chr(b)
+        if b >= 0x80:
+            out += '\\x%02x' % b
+            escaped = True
+            continue
+        # a hex digit would continue the previous escape
+        if escaped and c in '0123456789abcdefABCDEF':
+            out += '" "'
+        escaped = False
+        if c in '\\"':
+            out += '\\' + c
+        elif c == '\n':
+            out += '\\n'
+        else:
+            out += c
+    return out + '"'
+
+
+def num(v):
+    """Format the number as it is written in the XML files"""
+    return v if v is not None else '0'
+
+
+def table(name, rows):
+    if not rows:
+        return []
+    lines = [name + '_START']
+    for i, r in enumerate(rows):
+        lines.append(', '.join(r) + (',' if i < len(rows) - 1 else ''))
+    lines.append(name + '_END')
+    lines.append('')
+    return lines
+
+
+def compile_font(res, base, include):
+    font = ET.parse(os.path.join(base, include)).getroot()
+    fid = font.get('id')
+    path = os.path.relpath(os.path.join(base, font.get('name')), res).replace(os.sep, '/')
+    lines = ['DEF_FONT(%s, %s, %s)' % (fid, path, font.get('unicode', '0')), '']
+    lines.append('xHeight(%s) quad(%s) space(%s)' % (font.get('xHeight'), font.get('quad'), font.get('space')))
+    if font.get('skewChar') is not None:
+        lines.append('skew(%s)' % font.get('skewChar'))
+    versions = []
+    for attr, macro in [('boldVersion', 'bold'), ('romanVersion', 'roman'),
+                        ('ssVersion', 'ss'), ('ttVersion', 'tt'), ('itVersion', 'it')]:
+        if font.get(attr):
+            versions.append('%s(%s)' % (macro, font.get(attr)))
+    if versions:
+        lines += ['', ' '.join(versions)]
+    lines.append('')
+
+    metrics, exts, largers, ligs, kerns = [], [], [], [], []
+    for c in font.findall('Char'):
+        code = int(c.get('code'))
+        metrics.append((code, [str(code), num(c.get('width')), num(c.get('height')),
+                               num(c.get('depth')), num(c.get('italic'))]))
+        for x in c:
+            if x.tag == 'Kern':
+                kerns.append(((code, int(x.get('code'))), [str(code), x.get('code'), x.get('val')]))
+            elif x.tag == 'Lig':
+                ligs.append(((code, int(x.get('code'))), [str(code), x.get('code'), x.get('ligCode')]))
+            elif x.tag == 'Extension':
+                exts.append((code, [str(code), x.get('top', '-1'), x.get('mid', '-1'),
+                                    x.get('rep'), x.get('bot', '-1')]))
+            elif x.tag == 'NextLarger':
+                # the font ids are resolved at registration
+                largers.append((code, [str(code), x.get('code'), 'tex::FontInfo::__id("%s")' % x.get('fontId')]))
+            else:
+                raise ValueError('%s: unknown element <%s> in <Char>' % (include, x.tag))
+
+    # the tables are searched by the keys, sorted as DefaultTeXFontParser does
+    def rows(items):
+        return [r for _, r in sorted(items, key=lambda i: i[0])]
+
+    lines += table('METRICS', rows(metrics))
+    lines += table('EXTENSIONS', rows(exts))
+    lines += table('LARGERS', rows(largers))
+    lines += table('LIGTURES', rows(ligs))
+    lines += table('KERNS', rows(kerns))
+    lines += ['END', '']
+    return fid, lines
+
+
+def compile_alphabet(res, name):
+    base = os.path.join(res, name)
+    lang = ET.parse(os.path.join(base, 'language_%s.xml' % name)).getroot()
+    set_name = name.capitalize()
+    out = [
+        '// Generated by prebuilt/alphabet_def.py from %s/%s, do not edit' % (os.path.basename(res), name),
+        '#include "res/alphabet_def.res.h"',
+        '',
+        'CHECK_ALPHABET_DEF_VERSION(%d)' % VERSION,
+        '',
+    ]
+
+    # fonts
+    fonts = []
+    des = lang.find('FontDescriptions')
+    for m in (des.findall('Metrics') if des is not None else []):
+        fid, lines = compile_font(res, base, m.get('include'))
+        fonts.append(fid)
+        out += lines
+    out += ['DECL_FONT_SET(%s)' % set_name, '', 'DEF_FONT_SET(%s)' % set_name, '']
+    out += ['REG_FONT(%s)' % f for f in fonts]
+    out += ['', 'END_DEF_FONT_SET', '', 'DEF_ALPHABET(%s)' % set_name, '']
+
+    # symbol types
+    syms = lang.find('TeXSymbols')
+    if syms is not None:
+        root = ET.parse(os.path.join(base, syms.get('include'))).getroot()
+        out.append('SYMBOLS_START')
+        for s in root.findall('Symbol'):
+            if s.get('type') not in SYMBOL_TYPES:
+                raise ValueError('unknown type of the symbol ' + s.get('name'))
+            macro = 'del' if s.get('del') == 'true' else 'sym'
+            out.append('%s(%s, %s)' % (macro, SYMBOL_TYPES[s.get('type')], c_str(s.get('name'))))
+        out += ['SYMBOLS_END', '']
+
+    # character-to-symbol and character-to-formula mappings
+    settings = lang.find('FormulaSettings')
+    if settings is not None:
+        root = ET.parse(os.path.join(base, settings.get('include'))).getroot()
+        for tag, attr, macro in [('CharacterToSymbolMappings', 'symbol', 'SYMBOL_MAPPINGS'),
+                                 ('CharacterToFormulaMappings', 'formula', 'FORMULA_MAPPINGS')]:
+            e = root.find(tag)
+            maps = e.findall('Map') if e is not None else []
+            if not maps:
+                continue
+            out.append(macro + '_START')
+            for m in maps:
+                text = m.get('text')
+                out.append('M(%d, %s, %s)' % (
+                    ord(m.get('char')), c_str(m.get(attr)), 'nullptr' if text is None else c_str(text)))
+            out += [macro + '_END', '']
+
+    # symbol-to-character mappings
+    mappings = lang.find('SymbolMappings')
+    chars = []
+    for mapping in (mappings.findall('Mapping') if mappings is not None else []):
+        root = ET.parse(os.path.join(base, mapping.get('include'))).getroot()
+        for s in root.findall('SymbolMapping'):
+            if s.get('boldId'):
+                raise ValueError('the bold version of the symbol %s is not supported' % s.get('name'))
+            chars.append((s.get('fontId'), s.get('ch'), s.get('name')))
+    if chars:
+        for f in sorted(set(c[0] for c in chars), key=lambda f: fonts.index(f) if f in fonts else len(fonts)):
+            out.append('FONT_ID(%s)' % f)
+        out += ['', 'CHARS_START']
+        out += ['E(%s, %s, %s)' % (f, ch, c_str(name)) for f, ch, name in chars]
+        out += ['CHARS_END', '']
+
+    out += ['END_DEF_ALPHABET', '']
+    return '\n'.join(out)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 4:
+        print('usage: %s <res-dir> <alphabet> <output>' % sys.argv[0])
+        sys.exit(1)
+    code = compile_alphabet(sys.argv[1], sys.argv[2])
+    with open(sys.argv[3], 'w', encoding='utf-8', newline='\n') as f:
+        f.write(code)
@@ -32,7 +32,7 @@ public:
   /** The alignment type of the atom (default value: none) */
   Alignment _alignment = Alignment::none;
 
-  Atom() = default;
+  Atom() { profile_count(_atoms); }
 
   /**
    * Get the type of the leftermost child atom. Most atoms have no child
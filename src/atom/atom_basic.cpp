@@ -4,6 +4,7 @@
 
 #include "box/box_group.h"
 #include "box/box_factory.h"
+#include "context.h"
 #include "core/core.h"
 #include "core/formula.h"
 #include "fonts/fonts.h"
@@ -222,7 +223,11 @@ ColorAtom::ColorAtom(const sptr<Atom>& atom, color bg, color c)
 }
 
 void ColorAtom::defineColor(const string& name, color c) {
-  _colors[name] = c;
+  auto& ctx = Context::current();
+  auto& color = ctx._colors[name];
+  if (color == c) return;
+  color = c;
+  ctx.invalidate();
 }
 
 sptr<Box> ColorAtom::createBox(Environment& env) {
@@ -326,7 +331,7 @@ sptr<Box> AccentedAtom::createBox(Environment& env) {
   float u = b->_width;
   float s = 0;
   auto* sym = dynamic_cast<CharSymbol*>(_underbase.get());
-  if (sym != nullptr) s = tf->getSkew(*(sym->getCharFont(*tf)), style);
+  if (sym != nullptr) s = tf->getSkew(sym->getCharFont(*tf), style);
 
   // retrieve best char from the accent symbol
   auto* acc = (SymbolAtom*) _accent.get();
@@ -501,8 +506,7 @@ sptr<Box> ScriptsAtom::createBox(Environment& env) {
     shiftDown = hor->_depth + tf->getSubDrop(subStyle.getStyle());
   } else if (cs != nullptr) {
     shiftUp = shiftDown = 0;
-    sptr<CharFont> pcf = cs->getCharFont(*tf);
-    CharFont& cf = *pcf;
+    const CharFont cf = cs->getCharFont(*tf);
     if (!cs->isMarkedAsTextSymbol() || !tf->hasSpace(cf.fontId)) {
       delta = tf->getChar(cf, style).getItalic();
     }
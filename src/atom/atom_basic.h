@@ -272,6 +272,7 @@ public:
 /** An atom representing the foreground and background color of an other atom */
 class ColorAtom : public Atom, public Row {
 private:
+  // predefined colors, the user defined ones are held by the context
   static std::map<std::string, color> _colors;
   static const color _default;
 
@@ -305,7 +306,7 @@ public:
    */
   static color getColor(std::string name);
 
-  /** Define a color with given name */
+  /** Define a color with given name in the current context */
   static void defineColor(const std::string& name, color c);
 
   __decl_clone(ColorAtom)
@@ -376,7 +377,9 @@ public:
   }
 
   sptr<Atom> getBase() {
-    _atom->_limitsType = _limitsType;
+    // the atom may be shared (e.g. by a predefined formula), do not write it
+    // if unchanged
+    if (_atom->_limitsType != _limitsType) _atom->_limitsType = _limitsType;
     return _atom;
   }
 
@@ -12,7 +12,7 @@ using namespace std;
 sptr<Box> FixedCharAtom::createBox(Environment& env) {
   const auto& i = env.getTeXFont();
   TeXFont& tf = *i;
-  Char c = tf.getChar(*_cf, env.getStyle());
+  Char c = tf.getChar(_cf, env.getStyle());
   return sptrOf<CharBox>(c);
 }
 
@@ -65,9 +65,13 @@ void SymbolAtom::addSymbolAtom(const sptr<SymbolAtom>& sym) {
 }
 
 sptr<SymbolAtom> SymbolAtom::get(const string& name) {
-  auto it = _symbols.find(name);
-  if (it == _symbols.end()) throw ex_symbol_not_found(name);
-  return it->second;
+  if (!_symbols.empty()) {
+    const auto it = _symbols.find(name);
+    if (it != _symbols.end()) return it->second;
+  }
+  auto sym = __builtin(name);
+  if (sym == nullptr) throw ex_symbol_not_found(name);
+  return sym;
 }
 
 Char CharAtom::getChar(TeXFont& tf, TexStyle style, bool smallCap) {
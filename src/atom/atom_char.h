@@ -7,6 +7,8 @@
 #include "fonts/font_basic.h"
 #include "fonts/tex_font.h"
 
+#include <string_view>
+
 namespace tex {
 
 struct CharFont;
@@ -56,23 +58,23 @@ public:
    * @param tf the TeXFont containing all font related information
    * @return a CharFont
    */
-  virtual sptr<CharFont> getCharFont(TeXFont& tf) = 0;
+  virtual CharFont getCharFont(TeXFont& tf) = 0;
 };
 
 /** An atom representing a fixed character (not depending on a text style). */
 class FixedCharAtom : public CharSymbol {
 private:
-  const sptr<CharFont> _cf;
+  const CharFont _cf;
 
 public:
   FixedCharAtom() = delete;
 
-  explicit FixedCharAtom(const sptr<CharFont>& c) : _cf(c) {}
+  explicit FixedCharAtom(const CharFont& c) : _cf(c) {}
 
   // FIXME
   // workaround for the MSVS's LNK2019 error
   // it should be implemented in the atom_char.cpp file
-  sptr<CharFont> getCharFont(TeXFont& tf) override {
+  CharFont getCharFont(TeXFont& tf) override {
     return _cf;
   }
 
@@ -89,9 +91,15 @@ private:
   wchar_t _unicode;
 
 public:
-  // contains all defined symbols
+  // the symbols added at runtime, shadow the builtin ones
   static std::map<std::string, sptr<SymbolAtom>> _symbols;
 
+  /**
+   * INTERNAL USE: get the builtin symbol with given name from the table
+   * generated at compile time, return nullptr if not found.
+   */
+  static sptr<SymbolAtom> __builtin(std::string_view name);
+
   SymbolAtom() = delete;
 
   /**
@@ -122,7 +130,7 @@ public:
   // FIXME
   // workaround for the MSVS's LNK2019 error
   // it should be implemented in the atom_char.cpp file
-  sptr<CharFont> getCharFont(TeXFont& tf) override {
+  CharFont getCharFont(TeXFont& tf) override {
     return tf.getChar(_name, TexStyle::display).getCharFont();
   }
 
@@ -191,7 +199,7 @@ public:
   // FIXME
   // workaround for the MSVS's LNK2019 error
   // it should be implemented in the atom_char.cpp file
-  sptr<CharFont> getCharFont(TeXFont& tf) override {
+  CharFont getCharFont(TeXFont& tf) override {
     return getChar(tf, TexStyle::display, false).getCharFont();
   }
 
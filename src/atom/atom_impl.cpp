@@ -8,8 +8,6 @@ using namespace tex;
 /**************************************** small atoms *********************************************/
 
 const float FBoxAtom::INTERSPACE = 0.65f;
-float OvalAtom::_multiplier = 0.5f;
-float OvalAtom::_diameter = 0.f;
 
 const int FencedAtom::DELIMITER_FACTOR = 901;
 const float FencedAtom::DELIMITER_SHORTFALL = 5.f;
@@ -200,9 +200,6 @@ public:
  */
 class OvalAtom : public FBoxAtom {
 public:
-  static float _multiplier;
-  static float _diameter;
-
   OvalAtom() = delete;
 
   explicit OvalAtom(const sptr<Atom>& base) : FBoxAtom(base) {}
@@ -210,7 +207,8 @@ public:
   sptr<Box> createBox(Environment& env) override {
     auto x = FBoxAtom::createBox(env);
     auto box = std::dynamic_pointer_cast<FramedBox>(x);
-    return sptrOf<OvalBox>(box, _multiplier, _diameter);
+    const auto& ctx = Context::current();
+    return sptrOf<OvalBox>(box, ctx._ovalMultiplier, ctx._ovalDiameter);
   }
 
   __decl_clone(OvalAtom)
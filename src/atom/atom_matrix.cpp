@@ -1,13 +1,16 @@
+#include <exception>
 #include <memory>
+#include <mutex>
 
 #include "atom/atom_impl.h"
+#include "utils/thread_pool.h"
 
 using namespace std;
 using namespace tex;
 
-color MatrixAtom::LINE_COLOR = transparent;
-
-map<wstring, wstring> MatrixAtom::_colspeReplacement;
+// if the cells of a matrix are being laid out on this thread, the nested
+// matrices are laid out serially
+static thread_local bool cellsInProgress = false;
 
 SpaceAtom MatrixAtom::_hsep(UnitType::em, 1.f, 0.f, 0.f);
 SpaceAtom MatrixAtom::_semihsep(UnitType::em, 0.5f, 0.f, 0.f);
@@ -19,7 +22,11 @@ SpaceAtom MatrixAtom::_align(SpaceType::medMuSkip);
 sptr<Box> MatrixAtom::_nullbox(new StrutBox(0.f, 0.f, 0.f, 0.f));
 
 void MatrixAtom::defineColumnSpecifier(const wstring& rep, const wstring& spe) {
-  _colspeReplacement[rep] = spe;
+  auto& ctx = Context::current();
+  auto& specifier = ctx._columnSpecifiers[rep];
+  if (specifier == spe) return;
+  specifier = spe;
+  ctx.invalidate();
 }
 
 void MatrixAtom::parsePositions(wstring opt, vector<Alignment>& lpos) {
@@ -28,6 +35,7 @@ void MatrixAtom::parsePositions(wstring opt, vector<Alignment>& lpos) {
   wchar_t ch;
   sptr<Formula> tf;
   sptr<TeXParser> tp;
+  const auto& specifiers = Context::current()._columnSpecifiers;
   // clear first
   lpos.clear();
   while (pos < len) {
@@ -103,8 +111,8 @@ void MatrixAtom::parsePositions(wstring opt, vector<Alignment>& lpos) {
         int spos = len + 1;
         bool hasrep = false;
         while (--spos > pos) {
-          auto it = _colspeReplacement.find(opt.substr(pos, spos - pos));
-          if (it != _colspeReplacement.end()) {
+          auto it = specifiers.find(opt.substr(pos, spos - pos));
+          if (it != specifiers.end()) {
             hasrep = true;
             opt.insert(spos, it->second);
             len = opt.length();
@@ -234,7 +242,8 @@ float* MatrixAtom::getColumnSep(Environment& env, float width) {
 
 void MatrixAtom::recalculateLine(
   const int rows,
-  sptr<Box>** boxarr,
+  const int cols,
+  vector<sptr<Box>>& boxes,
   vector<sptr<Atom>>& multiRows,
   float* height,
   float* depth,
@@ -253,7 +262,7 @@ void MatrixAtom::recalculateLine(
       // Across from bottom to top
       int j = r;
       for (; j >= 0 && j > r + n; j--) {
-        if (boxarr[j][0]->_type == AtomType::hline) {
+        if (boxes[j * cols]->_type == AtomType::hline) {
           if (j == 0) break;
           h += drt;
           n--;
@@ -263,13 +272,11 @@ void MatrixAtom::recalculateLine(
         }
       }
       m->_i = ++j;
-      auto tmp = boxarr[r][c];
-      boxarr[r][c] = boxarr[j][c];
-      boxarr[j][c] = tmp;
+      swap(boxes[r * cols + c], boxes[j * cols + c]);
     } else {
       // Across from top to bottom
       for (int j = r; j < r + n && j < rows; j++) {
-        if (boxarr[j][0]->_type == AtomType::hline) {
+        if (boxes[j * cols]->_type == AtomType::hline) {
           if (j == rows - 1) break;
           h += drt;
           n++;
@@ -279,16 +286,17 @@ void MatrixAtom::recalculateLine(
         }
       }
     }
-    m->_n = abs(n);
-    auto b = boxarr[m->_i][m->_j];
+    // the span is kept unchanged, the matrix may be laid out again
+    const int span = abs(n);
+    auto b = boxes[m->_i * cols + m->_j];
     const float bh = b->_height + b->_depth + vspace;
     if (h > bh) {
       b->_height = (h - bh + vspace) / 2.f;
     } else if (h < bh) {
       const float ex = (bh - h) / skipped / 2.f;
-      const int mr = m->_i + m->_n;
+      const int mr = m->_i + span;
       for (int j = m->_i; j < mr; j++) {
-        if (boxarr[j][0]->_type != AtomType::hline) {
+        if (boxes[j * cols]->_type != AtomType::hline) {
           height[j] += ex;
           depth[j] += ex;
         }
@@ -296,7 +304,7 @@ void MatrixAtom::recalculateLine(
       b->_height = height[m->_i];
       b->_depth = bh - b->_height - vspace;
     }
-    boxarr[m->_i][m->_j]->_type = AtomType::none;
+    boxes[m->_i * cols + m->_j]->_type = AtomType::none;
   }
 }
 
@@ -397,16 +405,110 @@ void MatrixAtom::applyCell(WrapperBox& box, int i, int j) {
   }
 }
 
+sptr<Box> MatrixAtom::createCell(Environment& env, int i, int j) {
+  const auto& row = _matrix->_array[i];
+  if ((size_t) j >= row.size() || row[j] == nullptr) return _nullbox;
+  const auto& atom = row[j];
+  auto box = atom->createBox(env);
+  if (atom->_type == AtomType::interText) box->_type = AtomType::interText;
+  return box;
+}
+
+void MatrixAtom::createCells(Environment& env, vector<sptr<Box>>& boxes) {
+  const int rows = _matrix->rows();
+  const int cols = _matrix->cols();
+  const size_t count = boxes.size();
+  // the last cell that is not empty
+  size_t last = count;
+  for (int i = 0; i < rows; i++) {
+    const auto& row = _matrix->_array[i];
+    for (int j = 0; j < cols && (size_t) j < row.size(); j++) {
+      // the widths of the rules and the dots are taken from the columns by the
+      // last layout, clear them to measure the columns again
+      auto* fill = dynamic_cast<MulticolumnAtom*>(row[j].get());
+      if (fill != nullptr && fill->isNeedWidth()) fill->setColWidth(0);
+      auto* rule = dynamic_cast<HlineAtom*>(row[j].get());
+      if (rule != nullptr) rule->setWidth(0);
+      if (row[j] != nullptr) last = (size_t) i * cols + j;
+    }
+  }
+
+  // the layout of a cell may change its environment (e.g. the last used
+  // font), every cell starts from a copy of the given one thus the result
+  // does not depend on the order of the layouts
+  int lastFontId = TeXFont::NO_FONT;
+  const auto layout = [&](Environment& e, const Environment& from, size_t k) {
+    e = from;
+    boxes[k] = createCell(e, k / cols, k % cols);
+    if (k == last) lastFontId = e.getLastFontId();
+  };
+
+  // the nested matrices are laid out serially, and so are the matrices of the
+  // incremental formulas since the atoms of the cached groups are shared by
+  // their clones, and the matrices laid out by the workers of another pool
+  // (e.g. RenderBatch) that keep the hardware threads busy already
+  auto& ctx = Context::current();
+  WorkStealingPool pool(ctx._cellThreads);
+  if (pool.size() < 2
+      || ctx._parallelCells == 0
+      || count < ctx._parallelCells
+      || cellsInProgress
+      || ctx.isIncremental()
+      || WorkStealingPool::inWorker()
+    ) {
+    Environment e(env);
+    for (size_t k = 0; k < count; k++) layout(e, env, k);
+  } else {
+    // some atoms change the font in place (e.g. \mathsf), every worker has its own
+    vector<Environment> from(pool.size(), env);
+    for (auto& e : from) e.setTeXFont(env.getTeXFont()->copy());
+    vector<Environment> envs(from);
+    // an arena is not thread-safe, the workers other than the calling thread
+    // allocate from their own arenas if the calling thread has one
+    Arena* const arena = Arena::current();
+    vector<sptr<Arena>> arenas(pool.size());
+    // the layout may parse and cache a predefined formula (e.g. the dots of
+    // \ddots) in the context, the workers other than the calling thread use
+    // their own contexts forked from the current one
+    vector<sptr<Context>> contexts(pool.size());
+    {
+      ArenaScope scope(nullptr);
+      for (size_t i = 1; i < contexts.size(); i++) contexts[i] = ctx.fork();
+    }
+    mutex errorMutex;
+    size_t failed = count;
+    exception_ptr error;
+    pool.run(count, [&](size_t worker, size_t k) {
+      ContextScope ctxScope(worker == 0 ? ctx : *contexts[worker]);
+      if (arena != nullptr && worker != 0 && arenas[worker] == nullptr) {
+        arenas[worker] = std::make_shared<Arena>();
+      }
+      ArenaScope arenaScope(worker == 0 ? arena : arenas[worker].get());
+      const bool nested = cellsInProgress;
+      cellsInProgress = true;
+      try {
+        layout(envs[worker], from[worker], k);
+      } catch (...) {
+        // rethrow the error of the first cell as the serial layout does
+        lock_guard<mutex> lock(errorMutex);
+        if (k < failed) {
+          failed = k;
+          error = current_exception();
+        }
+      }
+      cellsInProgress = nested;
+    });
+    if (error != nullptr) rethrow_exception(error);
+  }
+  if (lastFontId != TeXFont::NO_FONT) env.setLastFontId(lastFontId);
+}
+
 sptr<Box> MatrixAtom::createBox(Environment& e) {
   Environment& env = e;
   const int rows = _matrix->rows();
   const int cols = _matrix->cols();
 
-  auto* lineDepth = new float[rows]();
-  auto* lineHeight = new float[rows]();
-  auto* colWidth = new float[cols]();
-  auto** boxarr = new sptr<Box>* [rows]();
-  for (int i = 0; i < rows; i++) boxarr[i] = new sptr<Box>[cols]();
+  vector<float> lineDepth(rows), lineHeight(rows), colWidth(cols);
 
   float matW = 0;
   float drt = env.getTeXFont()->getDefaultRuleThickness(env.getStyle());
@@ -419,40 +521,34 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
     env.setStyle(STYLE_TEXT);
   }*/
 
+  // the cells in row-major order
+  vector<sptr<Box>> boxes((size_t) rows * cols);
+  createCells(env, boxes);
+  const auto cell = [&](int i, int j) -> sptr<Box>& { return boxes[(size_t) i * cols + j]; };
+
   // multi-column & multi-row atoms
   vector<sptr<Atom>> listMultiCol;
   vector<sptr<Atom>> listMultiRow;
   for (int i = 0; i < rows; i++) {
-    lineDepth[i] = 0;
-    lineHeight[i] = 0;
     const int size = _matrix->_array[i].size();
-    for (int j = 0; j < cols; j++) {
-      if (j >= size) {
-        // If current row is not full-filled, fill the row with _nullbox
-        for (int k = j; k < cols; k++) boxarr[i][k] = _nullbox;
-        break;
-      }
-
-      sptr<Atom> atom = _matrix->_array[i][j];
-      boxarr[i][j] = (atom == nullptr) ? _nullbox : atom->createBox(env);
-      if (atom != nullptr && atom->_type == AtomType::interText) {
-        boxarr[i][j]->_type = AtomType::interText;
-      }
-
-      if (boxarr[i][j]->_type != AtomType::multiRow) {
+    for (int j = 0; j < cols && j < size; j++) {
+      const auto& box = cell(i, j);
+      if (box->_type != AtomType::multiRow) {
         // Find the highest line (row)
-        lineDepth[i] = max(boxarr[i][j]->_depth, lineDepth[i]);
-        lineHeight[i] = max(boxarr[i][j]->_height, lineHeight[i]);
+        lineDepth[i] = max(box->_depth, lineDepth[i]);
+        lineHeight[i] = max(box->_height, lineHeight[i]);
       } else {
+        const auto& atom = _matrix->_array[i][j];
         auto* mra = (MultiRowAtom*) atom.get();
         mra->setRowColumn(i, j);
         listMultiRow.push_back(atom);
       }
 
-      if (boxarr[i][j]->_type != AtomType::multiColumn) {
+      if (box->_type != AtomType::multiColumn) {
         // Find the widest column
-        colWidth[j] = max(boxarr[i][j]->_width, colWidth[j]);
+        colWidth[j] = max(box->_width, colWidth[j]);
       } else {
+        const auto& atom = _matrix->_array[i][j];
         auto* mca = (MulticolumnAtom*) atom.get();
         mca->setRowColumn(i, j);
         listMultiCol.push_back(atom);
@@ -472,11 +568,11 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
     int j = 0;
     for (j = c; j < c + n - 1; j++) w += colWidth[j] + Hsep[j + 1];
     w += colWidth[j];
-    if (boxarr[r][c]->_width > w) {
+    if (cell(r, c)->_width > w) {
       // If the multi-column's width > the total width of the acrossed columns,
       // add an extra-space to each column
-      matW += boxarr[r][c]->_width - w;
-      const float extraW = (boxarr[r][c]->_width - w) / n;
+      matW += cell(r, c)->_width - w;
+      const float extraW = (cell(r, c)->_width - w) / n;
       for (int k = c; k < c + n; k++) colWidth[k] += extraW;
     }
   }
@@ -490,7 +586,7 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
 
   auto Vsep = _vsep_in.createBox(env);
   // Recalculate the height of the row
-  recalculateLine(rows, boxarr, listMultiRow, lineHeight, lineDepth, drt, Vsep->_height);
+  recalculateLine(rows, cols, boxes, listMultiRow, lineHeight.data(), lineDepth.data(), drt, Vsep->_height);
 
   auto* vb = new VBox();
   float totalHeight = 0;
@@ -499,7 +595,7 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
   for (int i = 0; i < rows; i++) {
     auto hb = sptrOf<HBox>();
     for (int j = 0; j < cols; j++) {
-      switch (boxarr[i][j]->_type) {
+      switch (cell(i, j)->_type) {
         case AtomType::none:
         case AtomType::multiColumn: {
           if (j == 0) {
@@ -518,12 +614,12 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
           WrapperBox* wb = nullptr;
           int tj = j;
           float l = j == 0 ? Hsep[j] : Hsep[j] / 2;
-          if (boxarr[i][j]->_type == AtomType::none) {
+          if (cell(i, j)->_type == AtomType::none) {
             wb = new WrapperBox(
-              boxarr[i][j], colWidth[j], lineHeight[i], lineDepth[i], _position[j]  //
+              cell(i, j), colWidth[j], lineHeight[i], lineDepth[i], _position[j]  //
             );
           } else {
-            auto b = generateMulticolumn(env, boxarr[i][j], Hsep, colWidth, i, j);
+            auto b = generateMulticolumn(env, cell(i, j), Hsep, colWidth.data(), i, j);
             auto* matom = (MulticolumnAtom*) _matrix->_array[i][j].get();
             j += matom->skipped() - 1;
             wb = new WrapperBox(b, b->_width, lineHeight[i], lineDepth[i], Alignment::left);
@@ -533,7 +629,7 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
           wb->addInsets(l, Vspace, r, Vspace);
           applyCell(*wb, i, j);
           sptr<Box> swb(wb);
-          boxarr[i][tj] = swb;
+          cell(i, tj) = swb;
           hb->add(swb);
 
           auto it = _vlines.find(j + 1);
@@ -550,14 +646,14 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
         case AtomType::interText: {
           float f = env.getTextWidth();
           f = f == POS_INF ? colWidth[j] : f;
-          hb = sptrOf<HBox>(boxarr[i][j], f, Alignment::left);
+          hb = sptrOf<HBox>(cell(i, j), f, Alignment::left);
           j = cols;
         }
           break;
 
         case AtomType::hline: {
           auto* at = (HlineAtom*) _matrix->_array[i][j].get();
-          at->setColor(LINE_COLOR);
+          at->setColor(Context::current()._arrayRuleColor);
           at->setWidth(matW);
           if (i >= 1 && dynamic_cast<HlineAtom*>(_matrix->_array[i - 1][j].get()) != nullptr) {
             hb->add(sptrOf<StrutBox>(0.f, 2 * drt, 0.f, 0.f));
@@ -570,7 +666,7 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
       }
     }
 
-    if (boxarr[i][0]->_type != AtomType::hline) {
+    if (cell(i, 0)->_type != AtomType::hline) {
       hb->_height = lineHeight[i] + Vspace;
       hb->_depth = lineDepth[i] + Vspace;
     }
@@ -584,11 +680,6 @@ sptr<Box> MatrixAtom::createBox(Environment& e) {
   vb->_depth = totalHeight / 2 - axis;
 
   delete[] Hsep;
-  delete[] lineDepth;
-  delete[] lineHeight;
-  delete[] colWidth;
-  for (int i = 0; i < rows; i++) delete[] boxarr[i];
-  delete[] boxarr;
 
   return sptr<Box>(vb);
 }
@@ -2,6 +2,7 @@
 #define LATEX_ATOM_MATRIX_H
 
 #include "atom/atom.h"
+#include "context.h"
 #include "box/box_group.h"
 #include "core/core.h"
 #include "graphic/graphic.h"
@@ -68,8 +69,6 @@ enum class MatrixType : i8 {
 /** Atom represents matrix */
 class MatrixAtom : public Atom {
 private:
-  static std::map<std::wstring, std::wstring> _colspeReplacement;
-
   static SpaceAtom _align;
 
   sptr<ArrayFormula> _matrix;
@@ -94,7 +93,8 @@ private:
 
   static void recalculateLine(
     int rows,
-    sptr<Box>** boxarr,
+    int cols,
+    std::vector<sptr<Box>>& boxes,
     std::vector<sptr<Atom>>& multiRows,
     float* height,
     float* depth,
@@ -106,10 +106,17 @@ private:
 
   void applyCell(WrapperBox& box, int i, int j);
 
-public:
-  // The color to draw the rule of the matrix
-  static color LINE_COLOR;
+  /** Lay out the cell at the given row and column, _nullbox if it is empty */
+  sptr<Box> createCell(Environment& env, int i, int j);
 
+  /**
+   * Lay out all the cells into the given row-major array. Every cell is laid
+   * out from the given environment, concurrently if the matrix has at least
+   * Context::_parallelCells cells.
+   */
+  void createCells(Environment& env, std::vector<sptr<Box>>& boxes);
+
+public:
   static SpaceAtom _hsep, _semihsep, _vsep_in, _vsep_ext_top, _vsep_ext_bot;
 
   static sptr<Box> _nullbox;
@@ -167,7 +174,7 @@ public:
     if (_n == 0) return sptrOf<StrutBox>(0.f, 0.f, 0.f, 0.f);
 
     float drt = env.getTeXFont()->getDefaultRuleThickness(env.getStyle());
-    auto b = sptrOf<RuleBox>(_height, drt, _shift, MatrixAtom::LINE_COLOR, true);
+    auto b = sptrOf<RuleBox>(_height, drt, _shift, Context::current()._arrayRuleColor, true);
     auto sep = sptrOf<StrutBox>(2 * drt, 0.f, 0.f, 0.f);
     auto* hb = new HBox();
     for (int i = 0; i < _n - 1; i++) {
@@ -1,7 +1,9 @@
 #include "atom/atom_row.h"
 
+#include <algorithm>
 #include <memory>
 #include "atom/atom_basic.h"
+#include "context.h"
 #include "core/core.h"
 
 using namespace std;
@@ -17,7 +19,7 @@ inline bool Dummy::isCharInMathMode() const {
   return at != nullptr && at->isMathMode();
 }
 
-inline sptr<CharFont> Dummy::getCharFont(TeXFont& tf) const {
+inline CharFont Dummy::getCharFont(TeXFont& tf) const {
   return ((CharSymbol*) _atom.get())->getCharFont(tf);
 }
 
@@ -28,10 +30,10 @@ void Dummy::changeAtom(const sptr<FixedCharAtom>& atom) {
 }
 
 sptr<Box> Dummy::createBox(Environment& env) {
-  if (_textSymbol) ((CharSymbol*) _atom.get())->markAsTextSymbol();
-  auto box = _atom->createBox(env);
-  if (_textSymbol) ((CharSymbol*) _atom.get())->removeMark();
-  return box;
+  // The mark is not pushed down to the atom, it may be a builtin symbol that is
+  // shared by all the contexts. The box of a char-symbol does not depend on the
+  // mark anyway.
+  return _atom->createBox(env);
 }
 
 inline bool Dummy::isKern() const {
@@ -44,8 +46,6 @@ void Dummy::setPreviousAtom(const sptr<Dummy>& prev) {
   if (row != nullptr) row->setPreviousAtom(prev);
 }
 
-bool RowAtom::_breakEveywhere = false;
-
 bitset<16> RowAtom::_binSet = bitset<16>()
   .set(static_cast<i8>(AtomType::binaryOperator))
   .set(static_cast<i8>(AtomType::bigOperator))
@@ -123,10 +123,76 @@ AtomType RowAtom::rightType() const {
   return _elements.back()->rightType();
 }
 
+bool RowBoxCache::Key::operator==(const Key& k) const {
+  return _size == k._size
+         && _fontScale == k._fontScale
+         && _scaleFactor == k._scaleFactor
+         && _textWidth == k._textWidth
+         && _interline == k._interline
+         && _pixelsPerPoint == k._pixelsPerPoint
+         && _generation == k._generation
+         && _lastFontId == k._lastFontId
+         && _style == k._style
+         && _prevType == k._prevType
+         && _flags == k._flags
+         && _textStyle == k._textStyle;
+}
+
+RowBoxCache::Key RowAtom::layoutKey(const Environment& env) const {
+  const auto& ctx = Context::current();
+  TeXFont& tf = *env.getTeXFont();
+  const u16 flags = (tf.isBold() ? 1 : 0)
+                    | (tf.isRoman() ? 2 : 0)
+                    | (tf.isSs() ? 4 : 0)
+                    | (tf.isTt() ? 8 : 0)
+                    | (tf.isIt() ? 16 : 0)
+                    | (env.getSmallCap() ? 32 : 0)
+                    | (_breakable ? 64 : 0)
+                    | (ctx._breakEverywhere ? 128 : 0)
+                    | (Box::DEBUG ? 256 : 0)
+                    | (_previousAtom != nullptr && _previousAtom->isKern() ? 512 : 0);
+  return {
+    env.getTextStyle(),
+    tf.getSize(), tf.getScaleFactor(), env.getScaleFactor(), env.getTextWidth(), env.getInterline(),
+    ctx.getPixelsPerPoint(),
+    ctx.getGeneration(),
+    env.getLastFontId(),
+    env.getStyle(),
+    _previousAtom == nullptr ? AtomType::none : _previousAtom->rightType(),
+    flags
+  };
+}
+
 sptr<Box> RowAtom::createBox(Environment& env) {
+  if (_boxCache == nullptr) return createHBox(env);
+  RowBoxCache& cache = *_boxCache;
+  auto key = layoutKey(env);
+  const bool hit = cache._box != nullptr
+                   && cache._key == key
+                   && cache._elements == _elements;
+  if (hit) {
+    env.setLastFontId(cache._lastFontId);
+    _previousAtom = nullptr;
+  } else {
+    cache._box = createHBox(env);
+    cache._key = std::move(key);
+    cache._elements = _elements;
+    cache._lastFontId = env.getLastFontId();
+  }
+  // the parent may change the metrics of the box, return a copy
+  return sptrOf<HBox>(*cache._box);
+}
+
+sptr<HBox> RowAtom::createHBox(Environment& env) {
   auto x = env.getTeXFont();
   TeXFont& tf = *x;
   auto* hbox = new HBox();
+  const bool breakEverywhere = Context::current()._breakEverywhere;
+  // the previous atom is only written if it was given by the parent, since the
+  // row may be shared by the formulas laid out concurrently (e.g. predefined
+  // formulas used in the cells of a matrix, see MatrixAtom)
+  sptr<Dummy> prev;
+  if (_previousAtom != nullptr) prev = std::move(_previousAtom);
 
   // convert atoms to boxes and add to the horizontal box
   const int end = _elements.size() - 1;
@@ -149,7 +215,7 @@ sptr<Box> RowAtom::createBox(Environment& env) {
     // i.e. for formula: $+ e - f$, the plus sign should be treat as an ordinary type
     sptr<Atom> nextAtom(nullptr);
     if (i < end) nextAtom = _elements[i + 1];
-    changeToOrd(atom.get(), _previousAtom.get(), nextAtom.get());
+    changeToOrd(atom.get(), prev.get(), nextAtom.get());
 
     // check for ligature or kerning
     float kern = 0;
@@ -160,14 +226,14 @@ sptr<Box> RowAtom::createBox(Environment& env) {
         atom->markAsTextSymbol();
         auto l = atom->getCharFont(tf);
         auto r = c->getCharFont(tf);
-        auto lig = tf.getLigature(*l, *r);
-        if (lig == nullptr) {
-          kern = tf.getKern(*l, *r, env.getStyle());
+        const auto lig = tf.getLigature(l, r);
+        if (!lig.has_value()) {
+          kern = tf.getKern(l, r, env.getStyle());
           i--;
           break;  // iterator remains unchanged (no ligature!)
         } else {
           // fixed with ligature
-          atom->changeAtom(std::make_shared<FixedCharAtom>(lig));
+          atom->changeAtom(sptrOf<FixedCharAtom>(*lig));
         }
       } else {
         i--;
@@ -178,15 +244,15 @@ sptr<Box> RowAtom::createBox(Environment& env) {
     // insert glue, unless it's the first element of the row
     // or this element or the next is a kerning
     if (i != 0
-        && _previousAtom != nullptr
-        && !_previousAtom->isKern()
+        && prev != nullptr
+        && !prev->isKern()
         && !atom->isKern()
       ) {
-      hbox->add(Glue::get(_previousAtom->rightType(), atom->leftType(), env));
+      hbox->add(Glue::get(prev->rightType(), atom->leftType(), env));
     }
 
     // insert atom's box
-    atom->setPreviousAtom(_previousAtom);
+    atom->setPreviousAtom(prev);
     auto b = atom->createBox(env);
     auto* cb = dynamic_cast<CharBox*>(b.get());
     if (cb != nullptr
@@ -199,7 +265,7 @@ sptr<Box> RowAtom::createBox(Environment& env) {
     }
 
     if (_breakable) {
-      if (_breakEveywhere) {
+      if (breakEverywhere) {
         hbox->addBreakPosition(hbox->_children.size());
       } else {
         auto ca = dynamic_cast<CharAtom*>(at.get());
@@ -218,11 +284,9 @@ sptr<Box> RowAtom::createBox(Environment& env) {
     if (abs(kern) > PREC) hbox->add(sptrOf<StrutBox>(kern, 0.f, 0.f, 0.f));
 
     // kerning do not interfere with the normal glue-rules without kerning
-    if (!atom->isKern()) _previousAtom = atom;
+    if (!atom->isKern()) prev = atom;
   }
-  // reset previous atom
-  _previousAtom = nullptr;
-  return sptr<Box>(hbox);
+  return sptr<HBox>(hbox);
 }
 
 void RowAtom::setPreviousAtom(const sptr<Dummy>& prev) {
@@ -2,6 +2,8 @@
 #define LATEX_ATOM_ROW_H
 
 #include <bitset>
+#include <string>
+#include <vector>
 
 #include "common.h"
 #include "utils/utils.h"
@@ -86,7 +88,7 @@ public:
   bool isCharInMathMode() const;
 
   /** This method will only be called if isCharSymbol returns true. */
-  sptr<CharFont> getCharFont(TeXFont& tf) const;
+  CharFont getCharFont(TeXFont& tf) const;
 
   /**
    * Changes this atom into the given "ligature atom".
@@ -108,6 +110,37 @@ public:
   void setPreviousAtom(const sptr<Dummy>& prev);
 };
 
+/**
+ * The box of a row taken from the group cache (see GroupCache), shared by the
+ * row and its clones. The box is reused as long as the row is laid out with
+ * the same elements and the same parameters.
+ */
+struct RowBoxCache {
+  /** The parameters that take effect on the layout of a row */
+  struct Key {
+    std::string _textStyle;
+    float _size, _fontScale, _scaleFactor, _textWidth, _interline, _pixelsPerPoint;
+    // generation of the user definitions and the settings of the context
+    u32 _generation;
+    int _lastFontId;
+    TexStyle _style;
+    // right type of the previous atom, none if no previous atom
+    AtomType _prevType;
+    // the font flags, see RowAtom::layoutKey
+    u16 _flags;
+
+    bool operator==(const Key& k) const;
+  };
+
+  Key _key;
+  // the elements laid out, held to keep their addresses from being reused by
+  // the atoms of the later parses
+  std::vector<sptr<Atom>> _elements;
+  sptr<HBox> _box;
+  // the last used font id once the row is laid out
+  int _lastFontId;
+};
+
 /**
  * An atom representing a horizontal row of other atoms, to be separated by
  * glue. It's also responsible for inserting kerns and ligature.
@@ -126,6 +159,14 @@ private:
   std::vector<sptr<Atom>> _elements;
   // previous atom (for nested Row atoms)
   sptr<Dummy> _previousAtom;
+  // the box cached for the row and its clones, nullptr if not cached
+  sptr<RowBoxCache> _boxCache;
+
+  /** Get the parameters of the layout within the given environment */
+  RowBoxCache::Key layoutKey(const Environment& env) const;
+
+  /** Lay out the elements into a horizontal box */
+  sptr<HBox> createHBox(Environment& env);
 
   /**
    * Change the atom-type to ORD if necessary
@@ -136,7 +177,6 @@ private:
   static void changeToOrd(Dummy* cur, Dummy* prev, Atom* next);
 
 public:
-  static bool _breakEveywhere;
 
   bool _lookAtLastAtom;
 
@@ -174,6 +214,16 @@ public:
   /** Push an atom to back */
   void add(const sptr<Atom>& atom);
 
+  /**
+   * Cache the box of this row, the box is shared with the clones of this row
+   * and reused as long as they are laid out with the same parameters, see
+   * GroupCache. The box returned to the caller is a shallow copy, its children
+   * are shared and must not be modified.
+   */
+  inline void cacheBox() {
+    if (_boxCache == nullptr) _boxCache = sptrOf<RowBoxCache>();
+  }
+
   sptr<Box> createBox(Environment& env) override;
 
   void setPreviousAtom(const sptr<Dummy>& prev) override;
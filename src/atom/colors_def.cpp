@@ -1,4 +1,5 @@
 #include "atom_basic.h"
+#include "context.h"
 
 #define c(name, c, m, y, k) \
   { name, cmyk(c, m, y, k) }
@@ -85,8 +86,12 @@ color ColorAtom::getColor(std::string name) {
   // #AARRGGBB formatted color
   if (name[0] == '#') return decode(name);
   if (name.find(',') == string::npos) {
-    // find from predefined colors
-    auto it = _colors.find(tolower(name));
+    // find from the colors defined in the current context, then the predefined colors
+    const string key = tolower(name);
+    const auto& defined = Context::current()._colors;
+    auto dit = defined.find(key);
+    if (dit != defined.end()) return dit->second;
+    auto it = _colors.find(key);
     if (it != _colors.end()) return it->second;
     // AARRGGBB formatted color
     if (name.find('.') == string::npos) return decode("#" + name);
@@ -1,4 +1,5 @@
 #include "atom/atom_basic.h"
+#include "context.h"
 #include "core/core.h"
 #include "core/formula.h"
 
@@ -39,15 +40,15 @@ const function<float(const Environment&)> SpaceAtom::_unitConversions[]{
   },
   //PIXEL
   [](const Environment& env) -> float {
-    return 1.f / env.getSize();
+    return 1.f / (env.getSize() * Context::current().getPixelsPerPoint());
   },
   // BP
   [](const Environment& env) -> float {
-    return Formula::PIXELS_PER_POINT / env.getSize();
+    return 1.f / env.getSize();
   },
   // PICA
   [](const Environment& env) -> float {
-    return (12 * Formula::PIXELS_PER_POINT) / env.getSize();
+    return 12.f / env.getSize();
   },
   // MU
   [](const Environment& env) -> float {
@@ -56,31 +57,31 @@ const function<float(const Environment&)> SpaceAtom::_unitConversions[]{
   },
   // CM
   [](const Environment& env) -> float {
-    return (28.346456693f * Formula::PIXELS_PER_POINT) / env.getSize();
+    return 28.346456693f / env.getSize();
   },
   // MM
   [](const Environment& env) -> float {
-    return (2.8346456693f * Formula::PIXELS_PER_POINT) / env.getSize();
+    return 2.8346456693f / env.getSize();
   },
   // IN
   [](const Environment& env) -> float {
-    return (72.f * Formula::PIXELS_PER_POINT) / env.getSize();
+    return 72.f / env.getSize();
   },
   // SP
   [](const Environment& env) -> float {
-    return (65536 * Formula::PIXELS_PER_POINT) / env.getSize();
+    return 65536.f / env.getSize();
   },
   // PT
   [](const Environment& env) -> float {
-    return (.9962640099f * Formula::PIXELS_PER_POINT) / env.getSize();
+    return .9962640099f / env.getSize();
   },
   // DD
   [](const Environment& env) -> float {
-    return (1.0660349422f * Formula::PIXELS_PER_POINT) / env.getSize();
+    return 1.0660349422f / env.getSize();
   },
   // CC
   [](const Environment& env) -> float {
-    return (12.7924193070f * Formula::PIXELS_PER_POINT) / env.getSize();
+    return 12.7924193070f / env.getSize();
   },
   // X8
   [](const Environment& env) -> float {
@@ -0,0 +1,35 @@
+#include "batch.h"
+
+using namespace std;
+using namespace tex;
+
+RenderBatch::RenderBatch(size_t threads) : _pool(threads) {
+  const Context& parent = Context::current();
+  _contexts.reserve(_pool.size());
+  for (size_t i = 0; i < _pool.size(); i++) _contexts.push_back(parent.fork());
+}
+
+vector<BatchResult> RenderBatch::run(const vector<BatchJob>& jobs) {
+  vector<BatchResult> results(jobs.size());
+  _pool.run(jobs.size(), [&](size_t worker, size_t i) {
+    Context& ctx = *_contexts[worker];
+    const BatchJob& job = jobs[i];
+    BatchResult& result = results[i];
+    TeXRender* render = nullptr;
+    try {
+      render = ctx.parse(job._tex, job._width, job._textSize, job._lineSpace, job._fg);
+      if (_drawer) {
+        ContextScope scope(ctx);
+        _drawer(i, *render);
+      }
+      result._render = render;
+    } catch (exception& e) {
+      delete render;
+      result._error = e.what();
+    } catch (...) {
+      delete render;
+      result._error = "unknown error";
+    }
+  });
+  return results;
+}
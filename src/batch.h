@@ -0,0 +1,94 @@
+#ifndef BATCH_H_INCLUDED
+#define BATCH_H_INCLUDED
+
+#include "common.h"
+#include "context.h"
+#include "graphic/graphic_basic.h"
+#include "render.h"
+#include "utils/thread_pool.h"
+
+#include <functional>
+#include <utility>
+#include <string>
+#include <vector>
+
+namespace tex {
+
+/** A formula to render in a batch, see LaTeX::parse for the parameters */
+struct BatchJob {
+  std::wstring _tex;
+  int _width;
+  float _textSize;
+  float _lineSpace;
+  color _fg;
+
+  BatchJob(std::wstring tex, int width, float textSize, float lineSpace, color fg)
+    : _tex(std::move(tex)), _width(width), _textSize(textSize), _lineSpace(lineSpace), _fg(fg) {}
+};
+
+/**
+ * The result of a BatchJob, the render is nullptr and the error holds the
+ * message of the exception if the job failed. The caller takes the ownership
+ * of the render.
+ */
+struct BatchResult {
+  TeXRender* _render = nullptr;
+  std::string _error;
+
+  inline bool ok() const { return _render != nullptr; }
+};
+
+/**
+ * Render a batch of independent formulas concurrently.
+ * <p>
+ * Every worker parses and builds the formulas with its own context forked from
+ * the context that is current when the batch is created, so the commands,
+ * colors etc. defined in that context are available to the formulas. The
+ * contexts (and the parser and builder they hold) are reused by the following
+ * jobs and calls of run, thus a formula should not rely on the definitions
+ * made by the other formulas of the batch. The threads of the workers are
+ * started by the first run and live as long as the batch.
+ */
+class RenderBatch {
+public:
+  /**
+   * Function to draw a render after it is built, called on the worker thread
+   * with the index of the job
+   */
+  using Drawer = std::function<void(size_t, TeXRender&)>;
+
+private:
+  WorkStealingPool _pool;
+  // a context per worker of the pool
+  std::vector<sptr<Context>> _contexts;
+  Drawer _drawer;
+
+public:
+  no_copy_assign(RenderBatch);
+
+  /**
+   * Create a batch with given number of workers
+   *
+   * @param threads the number of workers, 0 means the number of the hardware
+   * threads
+   */
+  explicit RenderBatch(size_t threads = 0);
+
+  /** Set the function to draw the renders, nullptr means do not draw */
+  inline RenderBatch& setDrawer(Drawer drawer) {
+    _drawer = std::move(drawer);
+    return *this;
+  }
+
+  /**
+   * Parse, build and optionally draw the given jobs, the failure of a job
+   * (parse, build or draw) does not abort the others.
+   *
+   * @return the results in the order of the jobs
+   */
+  std::vector<BatchResult> run(const std::vector<BatchJob>& jobs);
+};
+
+}  // namespace tex
+
+#endif  // BATCH_H_INCLUDED
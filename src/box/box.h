@@ -59,7 +59,10 @@ public:
   AtomType _type = AtomType::none;
 
   /** Create a new box with default options */
-  Box() { init(); }
+  Box() {
+    init();
+    profile_count(_boxes);
+  }
 
   /** Copy the metrics from another box */
   void copyMetrics(const sptr<Box>& box);
@@ -93,6 +96,9 @@ public:
   /** Test if this box represents a space that only has metrics and has no visual effect. */
   virtual bool isSpace() const { return false; }
 
+  /** Test if this box is a CharBox, that can be drawn in a glyph run. */
+  virtual bool isChar() const { return false; }
+
   virtual ~Box() = default;
 };
 
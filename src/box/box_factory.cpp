@@ -1,93 +1,160 @@
 #include "common.h"
 #include "box/box_factory.h"
 #include "atom/atom_basic.h"
+#include "context.h"
 #include "core/core.h"
 #include "utils/utils.h"
 
+#include <optional>
+#include <unordered_map>
+
 using namespace std;
 using namespace tex;
 
+namespace {
+
+/**
+ * Key of the variants of a delimiter, the variants depend on the smallest one,
+ * the style and the sizes
+ */
+struct VariantsKey {
+  TexStyle _style;
+  // the smallest variant
+  CharFont _cf;
+  float _size;
+  // size factor of the style, the larger variants are scaled by it
+  float _scale;
+
+  bool operator==(const VariantsKey& k) const {
+    return _style == k._style
+           && _cf.chr == k._cf.chr
+           && _cf.fontId == k._cf.fontId
+           && _size == k._size
+           && _scale == k._scale;
+  }
+};
+
+struct VariantsKeyHash {
+  size_t operator()(const VariantsKey& k) const {
+    size_t h = hash<wchar_t>()(k._cf.chr);
+    const auto combine = [&h](size_t v) { h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2); };
+    combine(hash<int>()(static_cast<int>(k._style)));
+    combine(hash<int>()(k._cf.fontId));
+    combine(hash<float>()(k._size));
+    combine(hash<float>()(k._scale));
+    return h;
+  }
+};
+
+/** The variants of a delimiter from the smallest to the largest */
+struct Variants {
+  std::vector<Char> _chars;
+  // the extension of the largest variant, if any
+  std::optional<Extension> _ext;
+};
+
+}  // namespace
+
+/** The max count of the delimiters memoized by a thread */
+static const size_t MAX_MEMOIZED_DELIMITERS = 1024;
+
+/**
+ * Get the variants of the given delimiter, the chain of the larger variants is
+ * walked once for a delimiter in a style and memoized by the calling thread.
+ */
+static const Variants& variantsOf(const string& symbol, TeXFont& tf, TexStyle style) {
+  static thread_local unordered_map<VariantsKey, Variants, VariantsKeyHash> memo;
+  const Char c = tf.getChar(symbol, style);
+  const auto& ctx = Context::current();
+  const VariantsKey key{
+    style, c.getCharFont(), c.getSize(), ctx.getSizeFactor(style)
+  };
+  const auto it = memo.find(key);
+  if (it != memo.end()) return it->second;
+
+  if (memo.size() >= MAX_MEMOIZED_DELIMITERS) memo.clear();
+  Variants v;
+  v._chars.push_back(c);
+  while (tf.hasNextLarger(v._chars.back())) {
+    v._chars.push_back(tf.getNextLarger(v._chars.back(), style));
+  }
+  if (tf.isExtensionChar(v._chars.back())) {
+    v._ext.emplace(tf.getExtension(v._chars.back(), style));
+  }
+  return memo.emplace(key, std::move(v)).first->second;
+}
+
+/** Stack the parts of the given extension to a box taller than the given height */
+static sptr<Box> stackExtension(const Extension& ext, float minHeight) {
+  const auto total = [](const Char& c) { return c.getHeight() + c.getDepth(); };
+  float fixed = 0;
+  if (ext.hasTop()) fixed += total(ext.getTop());
+  if (ext.hasMiddle()) fixed += total(ext.getMiddle());
+  if (ext.hasBottom()) fixed += total(ext.getBottom());
+
+  // the repeatable part is inserted on both sides of the middle part if the
+  // delimiter has a top, a middle and a bottom part
+  const bool twoSides = ext.hasTop() && ext.hasBottom() && ext.hasMiddle();
+  const float step = ext.hasRepeat() ? (twoSides ? 2 : 1) * total(ext.getRepeat()) : 0;
+  // count of the repeatable parts (on one side) to exceed the min height
+  const int n = fixed <= minHeight && step > 0 ? (int) ((minHeight - fixed) / step) + 1 : 0;
+
+  auto vbox = sptrOf<VBox>();
+  vbox->_children.reserve(3 + (twoSides ? 2 * n : n));
+  const auto rep = n > 0 ? sptrOf<CharBox>(ext.getRepeat()) : nullptr;
+  const auto repeat = [&]() {
+    for (int i = 0; i < n; i++) vbox->add(rep);
+  };
+  if (ext.hasTop() && ext.hasBottom()) {
+    vbox->add(sptrOf<CharBox>(ext.getTop()));
+    repeat();
+    if (ext.hasMiddle()) {
+      vbox->add(sptrOf<CharBox>(ext.getMiddle()));
+      repeat();
+    }
+    vbox->add(sptrOf<CharBox>(ext.getBottom()));
+  } else if (ext.hasBottom()) {
+    repeat();
+    if (ext.hasMiddle()) vbox->add(sptrOf<CharBox>(ext.getMiddle()));
+    vbox->add(sptrOf<CharBox>(ext.getBottom()));
+  } else {
+    if (ext.hasTop()) vbox->add(sptrOf<CharBox>(ext.getTop()));
+    if (ext.hasMiddle()) vbox->add(sptrOf<CharBox>(ext.getMiddle()));
+    repeat();
+  }
+  return vbox;
+}
+
 sptr<Box> DelimiterFactory::create(SymbolAtom& symbol, Environment& env, int size) {
   if (size > 4) return symbol.createBox(env);
 
   TeXFont& tf = *(env.getTeXFont());
   const TexStyle style = env.getStyle();
-  Char c = tf.getChar(symbol.getName(), style);
-  int i = 0;
-
-  for (int i = 1; i <= size && tf.hasNextLarger(c); i++) c = tf.getNextLarger(c, style);
+  const auto& chars = variantsOf(symbol.getName(), tf, style)._chars;
+  const size_t i = min((size_t) max(size, 0), chars.size() - 1);
 
-  if (i <= size && !tf.hasNextLarger(c)) {
+  // no larger variant, build one with the required height
+  if (i == chars.size() - 1) {
     CharBox A(tf.getChar(L'A', "mathnormal", style));
-    auto b = create(symbol.getName(), env, size * (A._height + A._depth));
-    return b;
+    return create(symbol.getName(), env, size * (A._height + A._depth));
   }
 
-  return sptrOf<CharBox>(c);
+  return sptrOf<CharBox>(chars[i]);
 }
 
 sptr<Box> DelimiterFactory::create(const string& symbol, Environment& env, float minHeight) {
   TeXFont& tf = *(env.getTeXFont());
   const TexStyle style = env.getStyle();
-  Char c = tf.getChar(symbol, style);
-
-  // start with smallest character
-  float total = c.getHeight() + c.getDepth();
-
-  // try larger versions of the same char until min-height has been reached
-  while (total < minHeight && tf.hasNextLarger(c)) {
-    c = tf.getNextLarger(c, style);
-    total = c.getHeight() + c.getDepth();
-  }
-  // tall enough char found
-  if (total >= minHeight) {
-    /**if (total > minHeight) {
-            auto cb = sptrOf<CharBox>(c);
-            float scale = minHeight / total;
-            return sptrOf<ScaleBox>(cb, scale);
-        }*/
-    return sptrOf<CharBox>(c);
-  } else if (tf.isExtensionChar(c)) {
-    // construct vertical box
-    auto* vBox = new VBox();
-    Extension* ext = tf.getExtension(c, style);
-
-    // insert top part
-    if (ext->hasTop()) {
-      c = ext->getTop();
-      vBox->add(sptrOf<CharBox>(c));
-    }
+  const Variants& v = variantsOf(symbol, tf, style);
 
-    if (ext->hasMiddle()) {
-      c = ext->getMiddle();
-      vBox->add(sptrOf<CharBox>(c));
-    }
-
-    if (ext->hasBottom()) {
-      c = ext->getBottom();
-      vBox->add(sptrOf<CharBox>(c));
-    }
-
-    // insert repeatable part until tall enough
-    c = ext->getRepeat();
-    auto rep = sptrOf<CharBox>(c);
-    while (vBox->_height + vBox->_depth <= minHeight) {
-      if (ext->hasTop() && ext->hasBottom()) {
-        vBox->add(1, rep);
-        if (ext->hasMiddle()) {
-          vBox->add(vBox->size() - 1, rep);
-        }
-      } else if (ext->hasBottom()) {
-        vBox->add(0, rep);
-      } else {
-        vBox->add(rep);
-      }
-    }
-    delete ext;
-    return sptr<Box>(vBox);
+  // the smallest variant tall enough
+  for (const Char& c : v._chars) {
+    if (c.getHeight() + c.getDepth() >= minHeight) return sptrOf<CharBox>(c);
   }
+  // construct vertical box
+  if (v._ext.has_value()) return stackExtension(*v._ext, minHeight);
   // no extensions, so return the tallest possible character
-  return sptrOf<CharBox>(c);
+  return sptrOf<CharBox>(v._chars.back());
 }
 
 sptr<Atom> XLeftRightArrowFactory::MINUS;
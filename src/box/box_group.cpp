@@ -94,9 +94,17 @@ pair<sptr<HBox>, sptr<HBox>> HBox::split(int pos, int shift) {
 
 void HBox::draw(Graphics2D& g2, float x, float y) {
   float xPos = x;
-  for (const auto& box : _children) {
-    box->draw(g2, xPos, y + box->_shift);
-    xPos += box->_width;
+  for (size_t i = 0; i < _children.size();) {
+    const auto& box = _children[i];
+    if (!box->isChar()) {
+      box->draw(g2, xPos, y + box->_shift);
+      xPos += box->_width;
+      i++;
+      continue;
+    }
+    // the consecutive chars with the same font are drawn in a run
+    const size_t end = i + CharBox::drawRun(g2, _children, i, xPos, y);
+    for (; i < end; i++) xPos += _children[i]->_width;
   }
 }
 
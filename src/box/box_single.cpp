@@ -1,5 +1,10 @@
 #include "box_single.h"
+#include "context.h"
 #include "fonts/fonts.h"
+#include "graphic/display_list.h"
+
+#include <atomic>
+#include <mutex>
 
 using namespace std;
 using namespace tex;
@@ -20,33 +25,91 @@ void CharBox::addItalicCorrectionToWidth() {
 
 void CharBox::draw(Graphics2D& g2, float x, float y) {
   g2.translate(x, y);
-  const Font* font = FontInfo::getFont(_cf->fontId);
+  const Font* font = FontInfo::getFont(_cf.fontId);
   if (_size != 1) g2.scale(_size, _size);
   if (g2.getFont() != font) g2.setFont(font);
-  g2.drawChar(_cf->chr, 0, 0);
+  g2.drawChar(_cf.chr, 0, 0);
   // reset
   if (_size != 1) g2.scale(1.f / _size, 1.f / _size);
   g2.translate(-x, -y);
 }
 
 int CharBox::lastFontId() {
-  return _cf->fontId;
+  return _cf.fontId;
 }
 
-sptr<Font> TextRenderingBox::_font(nullptr);
+size_t CharBox::drawRun(
+  Graphics2D& g2,
+  const vector<sptr<Box>>& boxes,
+  size_t start,
+  float x, float y
+) {
+  // the glyphs are flushed to the graphics every RUN_SIZE glyphs
+  static const size_t RUN_SIZE = 32;
+  wchar_t glyphs[RUN_SIZE];
+  Point positions[RUN_SIZE];
+
+  const auto* first = static_cast<const CharBox*>(boxes[start].get());
+  const Font* font = FontInfo::getFont(first->_cf.fontId);
+  size_t i = start, n = 0;
+  for (; i < boxes.size(); i++) {
+    const auto& box = boxes[i];
+    // the spaces have no visual effect, the run continues after them
+    if (box->isSpace()) {
+      x += box->_width;
+      continue;
+    }
+    if (!box->isChar()) break;
+    const auto* b = static_cast<const CharBox*>(box.get());
+    if (b->_cf.fontId != first->_cf.fontId || b->_size != first->_size) break;
+    if (n == RUN_SIZE) {
+      g2.drawGlyphRun(font, glyphs, positions, n, first->_size);
+      n = 0;
+    }
+    glyphs[n] = b->_cf.chr;
+    positions[n] = Point(x, y + b->_shift);
+    n++;
+    x += b->_width;
+  }
+  g2.drawGlyphRun(font, glyphs, positions, n, first->_size);
+  return i - start;
+}
 
-void TextRenderingBox::_init_() {
-  _font = Font::_create("Serif", PLAIN, 10);
+sptr<Font> TextRenderingBox::_font(nullptr);
+static atomic<bool> defaultFontCreated(false);
+static mutex defaultFontMutex;
+
+const sptr<Font>& TextRenderingBox::defaultFont() {
+  if (defaultFontCreated.load(memory_order_acquire)) return _font;
+  // the platform font is created when a text is rendered first time rather
+  // than by LaTeX::init, many formulas have no text at all
+  lock_guard<mutex> lock(defaultFontMutex);
+  if (!defaultFontCreated.load(memory_order_relaxed)) {
+    ArenaScope scope(nullptr);
+    _font = Font::_create("Serif", PLAIN, 10);
+    defaultFontCreated.store(true, memory_order_release);
+  }
+  return _font;
 }
 
 void TextRenderingBox::_free_() {
   // For memory check purpose
   // to check if has memory leak
   _font = nullptr;
+  defaultFontCreated = false;
 }
 
 void TextRenderingBox::setFont(const string& name) {
-  _font = Font::_create(name, PLAIN, 10);
+  auto& ctx = Context::current();
+  // the font lives as long as the context, do not allocate it from an arena
+  ArenaScope scope(nullptr);
+  ctx._textFont = Font::_create(name, PLAIN, 10);
+  ctx.invalidate();
+}
+
+TextRenderingBox::TextRenderingBox(const wstring& str, int type, float size) {
+  const auto& font = Context::current()._textFont;
+  init(str, type, size, font == nullptr ? defaultFont() : font, true);
 }
 
 void TextRenderingBox::init(
@@ -64,7 +127,13 @@ void TextRenderingBox::init(
 void TextRenderingBox::draw(Graphics2D& g2, float x, float y) {
   g2.translate(x, y);
   g2.scale(0.1f * _size, 0.1f * _size);
-  _layout->draw(g2, 0, 0);
+  // the layout is drawn by the platform graphics, record it as a whole
+  auto* recorder = dynamic_cast<Graphics2D_recorder*>(&g2);
+  if (recorder != nullptr) {
+    recorder->drawLayout(_layout, 0, 0);
+  } else {
+    _layout->draw(g2, 0, 0);
+  }
   g2.scale(10 / _size, 10 / _size);
   g2.translate(-x, -y);
 }
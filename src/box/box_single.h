@@ -2,13 +2,10 @@
 #define LATEX_BOX_SINGLE_H
 
 #include "atom/atom.h"
+#include "fonts/font_basic.h"
 
 namespace tex {
 
-class Char;
-
-class CharFont;
-
 /** A box representing whitespace */
 class StrutBox : public Box {
 public:
@@ -56,7 +53,7 @@ public:
 /** A box representing a single character */
 class CharBox : public Box {
 private:
-  sptr<CharFont> _cf;
+  CharFont _cf;
   float _size;
   float _italic;
 
@@ -76,17 +73,38 @@ public:
   void draw(Graphics2D& g2, float x, float y) override;
 
   int lastFontId() override;
+
+  bool isChar() const override { return true; }
+
+  /**
+   * Draw the consecutive CharBoxes with the same font and size starting from
+   * the given index of the given boxes (must be a CharBox) in glyph runs, the
+   * spaces between them are skipped. The boxes are laid out horizontally from
+   * (x, y) as in a HBox.
+   *
+   * @return the count of the drawn boxes
+   */
+  static size_t drawRun(
+    Graphics2D& g2,
+    const std::vector<sptr<Box>>& boxes,
+    size_t start,
+    float x, float y
+  );
 };
 
 /** A box representing a text rendering box */
 class TextRenderingBox : public Box {
 private:
+  // builtin font, used if no font was specified by the context
   static sptr<Font> _font;
   sptr<TextLayout> _layout;
   float _size{};
 
   void init(const std::wstring& str, int type, float size, const sptr<Font>& font, bool kerning);
 
+  /** Get the builtin font, it is created on first use */
+  static const sptr<Font>& defaultFont();
+
 public:
   TextRenderingBox() = delete;
 
@@ -97,16 +115,13 @@ public:
     init(str, type, size, font, kerning);
   }
 
-  TextRenderingBox(const std::wstring& str, int type, float size) {
-    init(str, type, size, sptr<Font>(_font), true);
-  }
+  TextRenderingBox(const std::wstring& str, int type, float size);
 
   void draw(Graphics2D& g2, float x, float y) override;
 
+  /** Set the font to render text in the current context */
   static void setFont(const std::string& name);
 
-  static void _init_();
-
   static void _free_();
 };
 
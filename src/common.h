@@ -28,6 +28,7 @@
 #include "utils/exceptions.h"
 #include "utils/log.h"
 #include "utils/nums.h"
+#include "utils/profile.h"
 #include "utils/string_utils.h"
 #include "utils/utf.h"
 #include "utils/utils.h"
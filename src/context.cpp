@@ -0,0 +1,165 @@
+#include "context.h"
+
+#include "box/box.h"
+#include "core/formula.h"
+#include "core/macro.h"
+#include "fonts/fonts.h"
+#include "render.h"
+#include "utils/profile.h"
+
+using namespace std;
+using namespace tex;
+
+Context* Context::_default = nullptr;
+thread_local Context* Context::_current = nullptr;
+atomic<u32> Context::_fontGeneration(0);
+
+Context::Context() {
+  _textFactor = DefaultTeXFont::getGeneralSetting("textfactor");
+  _scriptFactor = DefaultTeXFont::getGeneralSetting("scriptfactor");
+  _scriptScriptFactor = DefaultTeXFont::getGeneralSetting("scriptscriptfactor");
+  updateStyleParams();
+  _formula = new Formula();
+  _builder = new TeXRenderBuilder();
+}
+
+sptr<Context> Context::fork() const {
+  auto ctx = sptrOf<Context>();
+  ctx->_pixelsPerPoint = _pixelsPerPoint;
+  ctx->_defaultSize = _defaultSize;
+  ctx->_textFactor = _textFactor;
+  ctx->_scriptFactor = _scriptFactor;
+  ctx->_scriptScriptFactor = _scriptScriptFactor;
+  ctx->updateStyleParams();
+  ctx->_magFactor = _magFactor;
+  ctx->_magnificationEnable = _magnificationEnable;
+  ctx->_arenaEnabled = _arenaEnabled;
+  ctx->_errIfConflict = _errIfConflict;
+  ctx->_breakEverywhere = _breakEverywhere;
+  ctx->_textFont = _textFont;
+  ctx->_arrayRuleColor = _arrayRuleColor;
+  ctx->_ovalMultiplier = _ovalMultiplier;
+  ctx->_ovalDiameter = _ovalDiameter;
+  ctx->_parallelCells = _parallelCells;
+  ctx->_cellThreads = _cellThreads;
+  ctx->_columnSpecifiers = _columnSpecifiers;
+  ctx->_macroCodes = _macroCodes;
+  ctx->_macroReplacements = _macroReplacements;
+  ctx->_macros = _macros;
+  ctx->_colors = _colors;
+  for (const auto& i : _externalFonts) {
+    ctx->_externalFonts[i.first] = new FontInfos(*i.second);
+  }
+  return ctx;
+}
+
+void Context::updateStyleParams() {
+  for (int i = 0; i < TEX_STYLE_COUNT; i++) {
+    const float em = getSizeFactor(static_cast<TexStyle>(i));
+    _em[i] = em;
+    for (int j = 0; j < TEX_PARAM_COUNT; j++) {
+      _styleParams[i][j] = DefaultTeXFont::getParameter(static_cast<TeXParam>(j)) * em;
+    }
+  }
+}
+
+void Context::setDPITarget(float dpi) {
+  // the layout is in points, only the lengths in pixels depend on it, the
+  // caches of the renders and the rows take it as a part of their keys
+  _pixelsPerPoint = dpi / 72.f;
+}
+
+TeXRender* Context::parse(const wstring& latex, int width, float textSize, float lineSpace, color fg) {
+  ContextScope scope(*this);
+#ifdef HAVE_PROFILE
+  ProfileScope profile;
+#endif
+  // the debug boxes are not cached
+  const bool cacheable = !Box::DEBUG;
+  const RenderCache::Key key{
+    latex, width, textSize, lineSpace, fg, TexStyle::display, _pixelsPerPoint, getGeneration()
+  };
+  if (cacheable) {
+    TeXRender* cached = _cache.get(key);
+    if (cached != nullptr) {
+#ifdef HAVE_PROFILE
+      profile.stats()._cacheHit = true;
+      cached->_stats = profile.stats();
+      if (profile.isOutermost()) Profiler::report(cached->_stats);
+#endif
+      return cached;
+    }
+  }
+  // the arena lives until the render and the atoms parsed are all released
+  const auto arena = _arenaEnabled && !isIncremental() ? std::make_shared<Arena>() : nullptr;
+  ArenaScope arenaScope(arena.get());
+  _lastArena = arena;
+  TeXRender* render = prepare(latex, width, textSize, lineSpace).setForeground(fg).build(*_formula);
+  // do not cache the formulas that modify the context (e.g. \newcommand),
+  // parsing them again may have different results
+  if (cacheable && key._generation == getGeneration()) _cache.put(key, *render, arena);
+#ifdef HAVE_PROFILE
+  render->_stats = profile.stats();
+  if (profile.isOutermost()) Profiler::report(render->_stats);
+#endif
+  return render;
+}
+
+TeXMetrics Context::measure(const wstring& latex, int width, float textSize, float lineSpace) {
+  ContextScope scope(*this);
+  // the boxes are dropped once measured, the arena is released with the atoms
+  const auto arena = _arenaEnabled && !isIncremental() ? std::make_shared<Arena>() : nullptr;
+  ArenaScope arenaScope(arena.get());
+  _lastArena = arena;
+  return prepare(latex, width, textSize, lineSpace).measure(*_formula);
+}
+
+TeXRenderBuilder& Context::prepare(const wstring& latex, int width, float textSize, float lineSpace) {
+  bool lined = true;
+  if (startswith(latex, L"$$") || startswith(latex, L"\\[")) {
+    lined = false;
+  }
+  Alignment align = lined ? Alignment::left : Alignment::center;
+  {
+    profile_phase(parse);
+    _formula->setLaTeX(latex);
+  }
+  return _builder->setStyle(TexStyle::display)
+    .setTextSize(textSize)
+    .setWidth(UnitType::pixel, width, align)
+    .setIsMaxWidth(lined)
+    .setLineSpace(UnitType::pixel, lineSpace);
+}
+
+void Context::enableIncremental(bool b) {
+  _formula->setIncremental(b);
+}
+
+bool Context::isIncremental() const {
+  return _formula->isIncremental();
+}
+
+void Context::setMathSizes(float ds, float ts, float ss, float sss) {
+  if (!_magnificationEnable) return;
+  _scriptFactor = abs(ss / ds);
+  _scriptScriptFactor = abs(sss / ds);
+  _textFactor = abs(ts / ds);
+  _defaultSize = abs(ds);
+  updateStyleParams();
+  invalidate();
+}
+
+void Context::setMagnification(float mag) {
+  if (!_magnificationEnable) return;
+  _magFactor = mag / 1000.f;
+  invalidate();
+}
+
+Context::~Context() {
+  // the atoms may refer to the external fonts, release them first
+  _cache.clear();
+  delete _formula;
+  delete _builder;
+  _predefinedFormulas.clear();
+  for (auto i : _externalFonts) delete i.second;
+}
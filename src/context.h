@@ -0,0 +1,306 @@
+#ifndef CONTEXT_H_INCLUDED
+#define CONTEXT_H_INCLUDED
+
+#include "common.h"
+#include "fonts/alphabet.h"
+#include "graphic/graphic.h"
+#include "graphic/graphic_basic.h"
+#include "render_cache.h"
+#include "utils/enums.h"
+
+#include <atomic>
+#include <map>
+#include <string>
+
+namespace tex {
+
+class Formula;
+
+struct FontInfos;
+
+class MacroInfo;
+
+class TeXRender;
+
+class TeXRenderBuilder;
+
+struct TeXMetrics;
+
+/**
+ * Holds the mutable state of a TeX session: the target DPI, the math sizes, the
+ * magnification and all the user definitions (commands, environments, colors...).
+ * <p>
+ * The builtin tables (fonts, symbols, predefined macros...) are loaded once by
+ * LaTeX::init and are shared read-only by all the contexts, thus different threads
+ * can parse, layout and draw concurrently as long as every thread works with its
+ * own context.
+ * <p>
+ * The context that takes effect is the one made current on the calling thread
+ * (see ContextScope), or the default context created by LaTeX::init if no context
+ * is current.
+ */
+class Context {
+private:
+  static Context* _default;
+  static thread_local Context* _current;
+  // generation of the fonts and the alphabets registered, shared by all the
+  // contexts, see invalidateFonts
+  static std::atomic<u32> _fontGeneration;
+
+  // point-to-pixel conversion
+  float _pixelsPerPoint = 1.f;
+  // math sizes, see DeclareMathSizes
+  float _defaultSize = -1;
+  float _textFactor, _scriptFactor, _scriptScriptFactor;
+  // size factor multiplied by the point-to-pixel conversion, indexed by TexStyle
+  float _em[TEX_STYLE_COUNT];
+  // TeX parameters scaled by _em, indexed by TexStyle and TeXParam
+  float _styleParams[TEX_STYLE_COUNT][TEX_PARAM_COUNT];
+  // magnification, see magnification
+  float _magFactor = 0;
+  bool _magnificationEnable = true;
+  // generation of the user definitions and settings, see invalidate
+  u32 _generation = 0;
+  // if allocate the atoms and boxes of a parse from an arena
+  bool _arenaEnabled = true;
+  std::weak_ptr<Arena> _lastArena;
+
+  Formula* _formula;
+  TeXRenderBuilder* _builder;
+  RenderCache _cache;
+
+  /** Parse the given string and setup the builder to layout it */
+  TeXRenderBuilder& prepare(const std::wstring& tex, int width, float textSize, float lineSpace);
+
+  /** Recompute the scaled parameters, must be called once the sizes changed */
+  void updateStyleParams();
+
+  friend class LaTeX;
+
+  friend class ContextScope;
+
+public:
+  /**
+   * If notify a fatal error when defining a new command but it has been
+   * defined already or redefine a command but it has not been defined,
+   * default is true.
+   */
+  bool _errIfConflict = true;
+  /** If a line break is allowed after every atom of a row, default is false */
+  bool _breakEverywhere = false;
+  /** Font to render text with TextRenderingBox, nullptr means the builtin one */
+  sptr<Font> _textFont;
+  /** Color of the rules of arrays, see arrayrulecolor */
+  color _arrayRuleColor = transparent;
+  /** Corner size of the oval boxes, see cornersize */
+  float _ovalMultiplier = 0.5f, _ovalDiameter = 0.f;
+  /**
+   * Minimum count of the cells of a matrix to lay them out concurrently, 0
+   * means always serially, default is 1024. The matrices are always laid out
+   * serially in the incremental mode and on the workers of a pool (e.g. the
+   * ones of RenderBatch). See MatrixAtom.
+   */
+  size_t _parallelCells = 1024;
+  /**
+   * Count of the workers to lay out the cells of a matrix concurrently, 0
+   * means the count of the hardware threads. See _parallelCells.
+   */
+  size_t _cellThreads = 0;
+
+  // user defined column specifiers of arrays, see newcolumntype
+  std::map<std::wstring, std::wstring> _columnSpecifiers;
+
+  // user defined commands and environments, they shadow the builtin ones
+  std::map<std::wstring, std::wstring> _macroCodes;
+  std::map<std::wstring, std::wstring> _macroReplacements;
+  std::map<std::wstring, sptr<MacroInfo>> _macros;
+  // user defined colors, they shadow the builtin ones
+  std::map<std::string, color> _colors;
+  // predefined formulas parsed by this context
+  std::map<std::wstring, sptr<Formula>> _predefinedFormulas;
+  // fonts to render the characters of the external unicode-blocks
+  std::map<UnicodeBlock, FontInfos*> _externalFonts;
+
+  /**
+   * Create a new context with the default settings, must be called after
+   * LaTeX::init.
+   */
+  Context();
+
+  no_copy_assign(Context);
+
+  /**
+   * Create a new context that inherits the settings and the user definitions
+   * of this context. The parsed predefined formulas are not inherited.
+   */
+  sptr<Context> fork() const;
+
+  /**
+   * Get the context of the calling thread, the default context is returned
+   * if no context is current.
+   *
+   * @throw ex_invalid_state if LaTeX is not initialized
+   */
+  inline static Context& current() {
+    Context* ctx = _current != nullptr ? _current : _default;
+    if (ctx == nullptr) throw ex_invalid_state("No context available, call LaTeX::init first!");
+    return *ctx;
+  }
+
+  /**
+   * Notify that the user definitions or the settings of this context have
+   * been modified, the renders cached before will not be hit anymore.
+   */
+  inline void invalidate() { _generation++; }
+
+  /**
+   * Notify that a font or an alphabet has been registered, it takes effect on
+   * all the contexts, the renders cached before will not be hit anymore.
+   */
+  inline static void invalidateFonts() { _fontGeneration++; }
+
+  /**
+   * Get the generation of the user definitions, the settings and the fonts
+   * registered, see invalidate and invalidateFonts
+   */
+  inline u32 getGeneration() const {
+    // both only increase, so does the sum
+    return _generation + _fontGeneration.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Enable or disable the arena allocation, if enabled, the atom tree and the
+   * box tree of every parse are allocated from an arena owned by the render,
+   * default is true. It saves the allocations of the nodes, but the nodes are
+   * still destroyed one by one when the render is released. See Arena.
+   */
+  inline void enableArena(bool b) { _arenaEnabled = b; }
+
+  /**
+   * Get the arena of the last parse, nullptr if the arena allocation is disabled
+   * or the render and the atoms of the last parse are released
+   */
+  inline sptr<Arena> getLastArena() const { return _lastArena.lock(); }
+
+  /**
+   * Enable or disable the incremental mode of the parses, default is false. In
+   * the incremental mode, the groups of the last parse are cached and only the
+   * groups changed since then are parsed and laid out again, it is suitable to
+   * render a formula being edited. The parts of an edit that are still linear
+   * in the size of the formula are listed in Formula::setIncremental. The
+   * arena allocation is disabled meanwhile, the cached groups would keep the
+   * arenas of all the parses alive.
+   */
+  void enableIncremental(bool b);
+
+  /** Test if the incremental mode is enabled */
+  bool isIncremental() const;
+
+  /** Get the cache of the renders parsed by this context */
+  inline RenderCache& cache() { return _cache; }
+
+  /**
+   * Parse TeX formatted string to TeXRender within this context, the render is
+   * taken from the cache if the same string has been parsed with the same
+   * parameters and definitions before.
+   *
+   * @param tex the TeX formatted string
+   * @param width the width of the 2D graphics context
+   * @param textSize the text size
+   * @param lineSpace the line space
+   * @param fg the foreground color
+   */
+  TeXRender* parse(const std::wstring& tex, int width, float textSize, float lineSpace, color fg);
+
+  /**
+   * Parse TeX formatted string within this context and get the metrics of the
+   * render it would produce, without creating the render. It is much cheaper
+   * than parse to find the sizes of many formulas, since no platform font is
+   * created for the builtin glyphs and the render cache is bypassed.
+   *
+   * @param tex the TeX formatted string
+   * @param width the width of the 2D graphics context
+   * @param textSize the text size
+   * @param lineSpace the line space
+   */
+  TeXMetrics measure(const std::wstring& tex, int width, float textSize, float lineSpace);
+
+  /**
+   * Set the DPI of target. The formulas are laid out in points, only the
+   * lengths given in pixels (e.g. the width of the text) depend on it, and the
+   * renders convert the points to pixels when drawn. Draw a render with a
+   * scale (see TeXRender::draw) to show it at another DPI without parsing it
+   * again.
+   *
+   * @param dpi the target DPI
+   */
+  void setDPITarget(float dpi);
+
+  /** Get the point-to-pixel conversion */
+  inline float getPixelsPerPoint() const { return _pixelsPerPoint; }
+
+  /** Get the size factor of given style */
+  inline float getSizeFactor(TexStyle style) const {
+    if (style < TexStyle::text) return 1;
+    if (style < TexStyle::script) return _textFactor;
+    if (style < TexStyle::scriptScript) return _scriptFactor;
+    return _scriptScriptFactor;
+  }
+
+  /** Get the size of 1 em in the given style */
+  inline float getEM(TexStyle style) const { return _em[static_cast<int>(style)]; }
+
+  /** Get the TeX parameter scaled to the given style */
+  inline float getStyleParam(TeXParam param, TexStyle style) const {
+    return _styleParams[static_cast<int>(style)][static_cast<int>(param)];
+  }
+
+  /** Get the default text size, -1 means not specified */
+  inline float getDefaultSize() const { return _defaultSize; }
+
+  /** Get the magnification factor, 0 means not specified */
+  inline float getMagFactor() const { return _magFactor; }
+
+  /**
+   * Set the various sizes of the environment
+   */
+  void setMathSizes(
+    float defaultSize,
+    float textStyleSize,
+    float scriptStyleSize,
+    float scriptsScriptStyleSize
+  );
+
+  void setMagnification(float mag);
+
+  inline void enableMagnification(bool b) {
+    _magnificationEnable = b;
+    invalidate();
+  }
+
+  ~Context();
+};
+
+/**
+ * Make the given context current on the calling thread during the lifetime
+ * of the scope, the previous one is restored when the scope is destroyed.
+ */
+class ContextScope {
+private:
+  Context* const _prev;
+
+public:
+  explicit ContextScope(Context& ctx) : _prev(Context::_current) {
+    Context::_current = &ctx;
+  }
+
+  no_copy_assign(ContextScope);
+
+  ~ContextScope() {
+    Context::_current = _prev;
+  }
+};
+
+}  // namespace tex
+
+#endif  // CONTEXT_H_INCLUDED
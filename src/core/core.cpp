@@ -4,6 +4,9 @@
 #include "box/box_group.h"
 #include "common.h"
 
+#include <algorithm>
+#include <limits>
+
 using namespace std;
 using namespace tex;
 
@@ -58,11 +61,11 @@ void tex::print_box(const sptr<Box>& b) {
 
 #endif  // HAVE_LOG
 
-sptr<Box> BoxSplitter::split(const sptr<Box>& b, float width, float lineSpace) {
+sptr<Box> BoxSplitter::split(const sptr<Box>& b, float width, float lineSpace, bool optimal) {
   auto h = dynamic_pointer_cast<HBox>(b);
   sptr<Box> box;
   if (h != nullptr) {
-    auto box = split(h, width, lineSpace);
+    auto box = optimal ? splitOptimal(h, width, lineSpace) : split(h, width, lineSpace);
 #ifdef HAVE_LOG
     if (box != b) {
       __print("[BEFORE SPLIT]:\n");
@@ -162,20 +165,175 @@ float BoxSplitter::canBreak(stack<Position>& s, const sptr<HBox>& hbox, const fl
 }
 
 int BoxSplitter::getBreakPosition(const sptr<HBox>& hb, int i) {
-  if (hb->_breakPositions.empty()) return -1;
+  // the last break position not after i, the positions are in ascending order
+  const auto& positions = hb->_breakPositions;
+  const auto it = upper_bound(positions.begin(), positions.end(), i);
+  return it == positions.begin() ? -1 : *(it - 1);
+}
+
+namespace {
+
+/**
+ * The break candidates of a box and its nested boxes, in the order they
+ * appear in the box.
+ */
+struct BreakScan {
+  // the offsets of the candidates from the left of the box
+  vector<float> _offsets;
+  // the count of the candidates and the count of the nested boxes inside of
+  // each nested box, in pre-order
+  vector<pair<int, int>> _groups;
+
+  void scan(const HBox& hb, float& x) {
+    const auto& positions = hb._breakPositions;
+    size_t next = 0;
+    for (size_t i = 0; i < hb._children.size(); i++) {
+      // a break position i breaks the line before the child i
+      for (; next < positions.size() && (size_t) positions[next] <= i; next++) {
+        if ((size_t) positions[next] == i) _offsets.push_back(x);
+      }
+      const auto& child = hb._children[i];
+      auto* h = dynamic_cast<HBox*>(child.get());
+      if (h == nullptr) {
+        x += child->_width;
+        continue;
+      }
+      const size_t g = _groups.size();
+      const size_t breaks = _offsets.size();
+      _groups.emplace_back();
+      scan(*h, x);
+      _groups[g] = {(int) (_offsets.size() - breaks), (int) (_groups.size() - g - 1)};
+    }
+  }
+};
+
+/**
+ * Build the lines ending at the chosen breaks, walks the box in the same
+ * order as BreakScan. The nested boxes that hold a break are rebuilt line by
+ * line, the others are taken as a whole.
+ */
+class LineBuilder {
+private:
+  const BreakScan& _scan;
+  const vector<int>& _breaks;
+  VBox& _lines;
+  const float _lineSpace;
+  // the index of the next break to choose, of the next candidate and of the
+  // next nested box
+  size_t _next = 0;
+  int _k = 0, _g = 0;
+  // the boxes being walked and their parts in the current line
+  vector<sptr<HBox>> _src, _open;
+
+  void newLine() {
+    for (size_t l = _open.size() - 1; l > 0; l--) {
+      if (!_open[l]->_children.empty()) _open[l - 1]->add(_open[l]);
+      _open[l] = _src[l]->cloneBox();
+    }
+    _lines.add(_open[0], _lineSpace);
+    _open[0] = _src[0]->cloneBox();
+  }
+
+  void walk(const HBox& hb) {
+    const auto& positions = hb._breakPositions;
+    size_t next = 0;
+    for (size_t i = 0; i < hb._children.size(); i++) {
+      for (; next < positions.size() && (size_t) positions[next] <= i; next++) {
+        if ((size_t) positions[next] != i) continue;
+        if (_next < _breaks.size() && _breaks[_next] == _k) {
+          _next++;
+          newLine();
+        }
+        _k++;
+      }
+      const auto& child = hb._children[i];
+      auto h = dynamic_pointer_cast<HBox>(child);
+      if (h == nullptr) {
+        _open.back()->add(child);
+        continue;
+      }
+      const auto& group = _scan._groups[_g];
+      if (_next == _breaks.size() || _breaks[_next] >= _k + group.first) {
+        _open.back()->add(child);
+        _k += group.first;
+        _g += group.second + 1;
+        continue;
+      }
+      _g++;
+      _src.push_back(h);
+      _open.push_back(h->cloneBox());
+      walk(*h);
+      auto part = _open.back();
+      _open.pop_back();
+      _src.pop_back();
+      if (!part->_children.empty()) _open.back()->add(part);
+    }
+  }
 
-  if (hb->_breakPositions.size() == 1 && hb->_breakPositions[0] <= i)
-    return hb->_breakPositions[0];
+public:
+  LineBuilder(const BreakScan& scan, const vector<int>& breaks, VBox& lines, float lineSpace)
+    : _scan(scan), _breaks(breaks), _lines(lines), _lineSpace(lineSpace) {}
+
+  void build(const sptr<HBox>& hb) {
+    _src.push_back(hb);
+    _open.push_back(hb->cloneBox());
+    walk(*hb);
+    _lines.add(_open[0], _lineSpace);
+  }
+};
+
+}  // namespace
+
+sptr<Box> BoxSplitter::splitOptimal(const sptr<HBox>& hb, float width, float lineSpace) {
+  if (width == 0 || hb->_width <= width) return hb;
 
-  size_t pos = 0;
-  for (; pos < hb->_breakPositions.size(); pos++) {
-    if (hb->_breakPositions[pos] > i) {
-      if (pos == 0) return -1;
-      return hb->_breakPositions[pos - 1];
+  BreakScan scan;
+  float total = 0;
+  scan.scan(*hb, total);
+  if (scan._offsets.empty()) return hb;
+
+  // the offsets of the start (0), the candidates (1..n) and the end (n + 1)
+  const int n = scan._offsets.size();
+  vector<float> x(n + 2);
+  x[0] = 0;
+  copy(scan._offsets.begin(), scan._offsets.end(), x.begin() + 1);
+  x[n + 1] = total;
+
+  // a line wider than the width costs more than any lines fit in the width
+  const double w = width;
+  const double overfull = (n + 2) * w * w;
+  vector<double> cost(n + 2, numeric_limits<double>::infinity());
+  vector<int> prev(n + 2, -1);
+  cost[0] = 0;
+  // the first line start that fits, the line widths grow with the start
+  // moving left, so it only moves right as the line end does
+  int lo = 0;
+  for (int b = 1; b <= n + 1; b++) {
+    while (lo < b - 1 && x[b] - x[lo] > width) lo++;
+    for (int a = lo; a < b; a++) {
+      const double len = x[b] - x[a];
+      double c;
+      if (len > w) {
+        c = overfull + (len - w) * (len - w);
+      } else {
+        c = b == n + 1 ? 0 : (w - len) * (w - len);
+      }
+      if (cost[a] + c < cost[b]) {
+        cost[b] = cost[a] + c;
+        prev[b] = a;
+      }
     }
   }
 
-  return hb->_breakPositions[pos - 1];
+  // the chosen candidates, in ascending order
+  vector<int> breaks;
+  for (int b = prev[n + 1]; b > 0; b = prev[b]) breaks.push_back(b - 1);
+  if (breaks.empty()) return hb;
+  reverse(breaks.begin(), breaks.end());
+
+  auto* vbox = new VBox();
+  LineBuilder(scan, breaks, *vbox, lineSpace).build(hb);
+  return sptr<Box>(vbox);
 }
 
 /************************************* Environment implementation ******************************/
@@ -196,64 +354,62 @@ void Environment::setTextWidth(UnitType wu, float w) {
   _textWidth = w * SpaceAtom::getFactor(wu, *this);
 }
 
+sptr<Environment>& Environment::derive(sptr<Environment>& slot, TexStyle style, const sptr<TeXFont>& tf) {
+  if (slot == nullptr) {
+    slot = sptr<Environment>(new Environment(style, _scaleFactor, tf, _textStyle, _smallCap));
+    return slot;
+  }
+  // the last user or this environment may have changed since it was derived,
+  // reset it to the state of a newly created one
+  Environment& e = *slot;
+  e._style = style;
+  if (e._tf != tf) e._tf = tf;
+  e._lastFontId = TeXFont::NO_FONT;
+  e._textWidth = POS_INF;
+  e._textStyle = _textStyle;
+  e._smallCap = _smallCap;
+  e._scaleFactor = _scaleFactor;
+  e.setInterline(UnitType::ex, 1.f);
+  return slot;
+}
+
 sptr<Environment>& Environment::copy() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _copy = sptr<Environment>(t);
-  return _copy;
+  return derive(_derived._copy, _style, _tf);
 }
 
 sptr<Environment>& Environment::copy(const sptr<TeXFont>& tf) {
-  Environment* te = new Environment(_style, _scaleFactor, tf, _textStyle, _smallCap);
+  auto& te = derive(_derived._copytf, _style, tf);
   te->_textWidth = _textWidth;
   te->_interline = _interline;
   te->_interlineUnit = _interlineUnit;
-  _copytf = sptr<Environment>(te);
-  return _copytf;
+  return te;
 }
 
 sptr<Environment>& Environment::crampStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _cramp = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _cramp->_style = static_cast<TexStyle>(style % 2 == 1 ? style : style + 1);
-  return _cramp;
+  return derive(static_cast<TexStyle>(style % 2 == 1 ? style : style + 1));
 }
 
 sptr<Environment>& Environment::dnomStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _dnom = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _dnom->_style = static_cast<TexStyle>(2 * (style / 2) + 1 + 2 - 2 * (style / 6));
-  return _dnom;
+  return derive(static_cast<TexStyle>(2 * (style / 2) + 1 + 2 - 2 * (style / 6)));
 }
 
 sptr<Environment>& Environment::numStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _num = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _num->_style = static_cast<TexStyle>(style + 2 - 2 * (style / 6));
-  return _num;
+  return derive(static_cast<TexStyle>(style + 2 - 2 * (style / 6)));
 }
 
 sptr<Environment>& Environment::rootStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _root = sptr<Environment>(t);
-  _root->_style = TexStyle::scriptScript;
-  return _root;
+  return derive(TexStyle::scriptScript);
 }
 
 sptr<Environment>& Environment::subStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _sub = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _sub->_style = static_cast<TexStyle>(2 * (style / 4) + 4 + 1);
-  return _sub;
+  return derive(static_cast<TexStyle>(2 * (style / 4) + 4 + 1));
 }
 
 sptr<Environment>& Environment::supStyle() {
-  Environment* t = new Environment(_style, _scaleFactor, _tf, _textStyle, _smallCap);
-  _sup = sptr<Environment>(t);
   const i8 style = static_cast<i8>(_style);
-  _sup->_style = static_cast<TexStyle>(2 * (style / 4) + 4 + (style % 2));
-  return _sup;
+  return derive(static_cast<TexStyle>(2 * (style / 4) + 4 + (style % 2)));
 }
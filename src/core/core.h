@@ -34,9 +34,26 @@ private:
   static int getBreakPosition(const sptr<HBox>& hb, int index);
 
 public:
-  static sptr<Box> split(const sptr<Box>& box, float width, float lineSpace);
+  /**
+   * Split the box into lines no wider than the given width at the break
+   * positions, the lines are separated by the given space.
+   *
+   * @param optimal if break the lines greedily (false), or choose all the
+   * breaks at once to minimize the sum of the squared spaces left at the end
+   * of the lines except the last one (true), see splitOptimal
+   */
+  static sptr<Box> split(const sptr<Box>& box, float width, float lineSpace, bool optimal = false);
 
   static sptr<Box> split(const sptr<HBox>& hb, float width, float lineSpace);
+
+  /**
+   * Split the box with the total-fit algorithm of Knuth and Plass. The break
+   * positions of the box and its nested boxes are scanned once to compute
+   * their offsets, the breaks are chosen by dynamic programming over the
+   * offsets, and the lines are built from the children in one pass, the box
+   * itself is never cloned or split halfway.
+   */
+  static sptr<Box> splitOptimal(const sptr<HBox>& hb, float width, float lineSpace);
 };
 
 /**
@@ -65,9 +82,22 @@ private:
   // The inter line space
   float _interline{};
 
-  // Member to store copies to prevent destruct
-  sptr<Environment> _copy, _copytf, _cramp, _dnom;
-  sptr<Environment> _num, _root, _sub, _sup;
+  /**
+   * The environments derived from this one, the style variants are indexed by
+   * their styles. Each of them is created once and reset when it is derived
+   * again, thus the layout does not allocate an environment for every script,
+   * fraction or radical. The copies of this environment never share them.
+   */
+  struct Derived {
+    sptr<Environment> _styles[TEX_STYLE_COUNT];
+    sptr<Environment> _copy, _copytf;
+
+    Derived() = default;
+
+    Derived(const Derived&) {}
+
+    Derived& operator=(const Derived&) { return *this; }
+  } _derived;
 
   inline void init() {
     _style = TexStyle::display;
@@ -93,6 +123,13 @@ private:
     setInterline(UnitType::ex, 1.f);
   }
 
+  /** Get the environment in the given slot with the given style and font, create it if not exists */
+  sptr<Environment>& derive(sptr<Environment>& slot, TexStyle style, const sptr<TeXFont>& tf);
+
+  inline sptr<Environment>& derive(TexStyle style) {
+    return derive(_derived._styles[static_cast<i8>(style)], style, _tf);
+  }
+
 public:
   Environment(TexStyle style, const sptr<TeXFont>& tf) {
     init();
@@ -168,6 +205,8 @@ public:
 
   inline const sptr<TeXFont>& getTeXFont() const { return _tf; }
 
+  inline void setTeXFont(const sptr<TeXFont>& tf) { _tf = tf; }
+
   inline float getSpace() const { return _tf->getSpace(_style) * _tf->getScaleFactor(); }
 
   inline void setLastFontId(int id) { _lastFontId = id; }
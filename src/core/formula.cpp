@@ -1,6 +1,7 @@
 #include "core/formula.h"
 
 #include "common.h"
+#include "context.h"
 #include "core/core.h"
 #include "core/parser.h"
 #include "fonts/alphabet.h"
@@ -10,12 +11,6 @@
 using namespace std;
 using namespace tex;
 
-map<wstring, sptr<Formula>> Formula::_predefinedTeXFormulas;
-
-map<UnicodeBlock, FontInfos*> Formula::_externalFontMap;
-
-float Formula::PIXELS_PER_POINT = 1.f;
-
 void Formula::_init_() {
 #ifdef HAVE_LOG
   __dbg("%s\n", "init formula");
@@ -44,6 +39,7 @@ Formula::Formula(
 ) : _parser(tp.isPartial(), latex, this, preprocess, isMathMode) {
   _textStyle = textStyle;
   _xmlMap = tp._formula->_xmlMap;
+  _parser.inherit(tp);
   if (tp.isPartial()) {
     try {
       _parser.parse();
@@ -59,6 +55,7 @@ Formula::Formula(const TeXParser& tp, const wstring& latex, bool preprocess)
   : _parser(tp.isPartial(), latex, this, preprocess) {
   _textStyle = "";
   _xmlMap = tp._formula->_xmlMap;
+  _parser.inherit(tp);
   if (tp.isPartial()) {
     try {
       _parser.parse();
@@ -72,6 +69,7 @@ Formula::Formula(const TeXParser& tp, const wstring& latex)
   : _parser(tp.isPartial(), latex, this) {
   _textStyle = "";
   _xmlMap = tp._formula->_xmlMap;
+  _parser.inherit(tp);
   if (tp.isPartial()) {
     try {
       _parser.parse();
@@ -96,8 +94,38 @@ Formula::Formula(const wstring& latex, bool preprocess) : _parser(latex, this, p
 }
 
 void Formula::setLaTeX(const wstring& latex) {
-  _parser.reset(latex);
-  if (!latex.empty()) _parser.parse();
+  if (_groupCache == nullptr) {
+    _parser.reset(latex);
+    if (!latex.empty()) _parser.parse();
+    return;
+  }
+  _source = latex;
+  _groupCache->begin();
+  try {
+    _parser.reset(latex);
+    if (!latex.empty()) _parser.parse();
+  } catch (...) {
+    _groupCache->end(false);
+    throw;
+  }
+  _groupCache->end(true);
+}
+
+void Formula::setIncremental(bool incremental) {
+  if (incremental == isIncremental()) return;
+  _groupCache = incremental ? std::make_shared<GroupCache>() : nullptr;
+  _parser.setGroupCache(_groupCache.get());
+  _source.clear();
+}
+
+void Formula::edit(int offset, int removed, const wstring& inserted) {
+  if (!isIncremental()) throw ex_invalid_param("Formula is not in the incremental mode!");
+  if (offset < 0 || removed < 0 || offset + removed > (int) _source.length()) {
+    throw ex_invalid_param("Edit is out of the latex!");
+  }
+  wstring latex = _source;
+  latex.replace(offset, removed, inserted);
+  setLaTeX(latex);
 }
 
 Formula* Formula::add(const sptr<Atom>& a) {
@@ -134,15 +162,20 @@ void Formula::setDEBUG(bool b) {
 }
 
 sptr<Formula> Formula::get(const wstring& name) {
-  auto it = _predefinedTeXFormulas.find(name);
-  if (it == _predefinedTeXFormulas.end()) {
+  // the parsed formulas are cached per context, the atoms are not shared between threads
+  auto& predefined = Context::current()._predefinedFormulas;
+  auto it = predefined.find(name);
+  if (it == predefined.end()) {
     auto i = _predefinedTeXFormulasAsString.find(name);
     if (i == _predefinedTeXFormulasAsString.end())
       throw ex_formula_not_found(wide2utf8(name));
+    // the cached formulas live as long as the context, do not allocate them from
+    // the arena of the current parse
+    ArenaScope scope(nullptr);
     auto tf = sptrOf<Formula>(i->second);
     auto* ra = dynamic_cast<RowAtom*>(tf->_root.get());
     if (ra == nullptr) {
-      _predefinedTeXFormulas[name] = tf;
+      predefined[name] = tf;
     }
     return tf;
   }
@@ -150,19 +183,21 @@ sptr<Formula> Formula::get(const wstring& name) {
 }
 
 void Formula::setDPITarget(float dpi) {
-  PIXELS_PER_POINT = dpi / 72.f;
+  Context::current().setDPITarget(dpi);
 }
 
 bool Formula::isRegisteredBlock(const UnicodeBlock& block) {
-  return _externalFontMap.find(block) != _externalFontMap.end();
+  const auto& fonts = Context::current()._externalFonts;
+  return fonts.find(block) != fonts.end();
 }
 
 FontInfos* Formula::getExternalFont(const UnicodeBlock& block) {
-  auto it = _externalFontMap.find(block);
+  auto& fonts = Context::current()._externalFonts;
+  auto it = fonts.find(block);
   FontInfos* infos = nullptr;
-  if (it == _externalFontMap.end()) {
+  if (it == fonts.end()) {
     infos = new FontInfos("SansSerif", "Serif");
-    _externalFontMap[block] = infos;
+    fonts[block] = infos;
   } else {
     infos = it->second;
   }
@@ -175,10 +210,6 @@ void Formula::addSymbolMappings(const string& file) {
   parser.parseSymbol2Formula(_symbolFormulaMappings, _symbolTextMappings);
 }
 
-void Formula::_free_() {
-  for (auto i : _externalFontMap) delete i.second;
-}
-
 /*************************************** ArrayFormula implementation ******************************/
 
 ArrayFormula::ArrayFormula() : _row(0), _col(0) {
@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "atom/atom_basic.h"
+#include "core/group_cache.h"
 #include "core/parser.h"
 #include "fonts/alphabet.h"
 #include "graphic/graphic.h"
@@ -49,21 +50,20 @@ struct FontInfos {
 class Formula {
 private:
   TeXParser _parser;
+  // the source of the last parse and the groups cached, incremental mode only
+  std::wstring _source;
+  sptr<GroupCache> _groupCache;
 
 public:
   std::map<std::string, std::string> _xmlMap;
-  // point-to-pixel conversion
-  static float PIXELS_PER_POINT;
 
   // predefined TeX formulas
-  static std::map<std::wstring, sptr<Formula>> _predefinedTeXFormulas;
   static std::map<std::wstring, std::wstring> _predefinedTeXFormulasAsString;
 
   // character-to-symbol and character-to-delimiter mappings
   static std::map<int, std::string> _symbolMappings;
   static std::map<int, std::string> _symbolTextMappings;
   static std::map<int, std::string> _symbolFormulaMappings;
-  static std::map<UnicodeBlock, FontInfos*> _externalFontMap;
 
   std::list<sptr<MiddleAtom>> _middle;
   // the root atom of the "atom tree" that represents the formula
@@ -112,6 +112,42 @@ public:
    */
   void setLaTeX(const std::wstring& latex);
 
+  /**
+   * Enable or disable the incremental mode, default is false. In the
+   * incremental mode, the groups of the last parse are cached (see GroupCache),
+   * when the latex is changed, only the groups that enclose the changes are
+   * parsed again, and only the boxes of these groups and their ancestors are
+   * created again.
+   *
+   * The latency is not flat: the whole latex is still preprocessed, the cached
+   * groups are looked up by their text, and the top-level row is parsed and
+   * laid out again, thus the cost of an edit grows linearly with the size of
+   * the formula, only slower than a full parse.
+   */
+  void setIncremental(bool incremental);
+
+  /** Test if this formula is in the incremental mode */
+  inline bool isIncremental() const { return _groupCache != nullptr; }
+
+  /**
+   * Edit the latex of this formula and regenerate the root atom, the groups not
+   * touched by the edit are not parsed again in the incremental mode.
+   *
+   * @param offset the offset of the edit in the latex
+   * @param removed the count of the characters removed from the offset
+   * @param inserted the text inserted at the offset
+   *
+   * @throw ex_invalid_param if not in the incremental mode or the edit is out
+   *     of the latex
+   */
+  void edit(int offset, int removed, const std::wstring& inserted);
+
+  /** Get the latex of the last parse, available in the incremental mode only */
+  inline const std::wstring& getLaTeX() const { return _source; }
+
+  /** Get the cache of the groups, nullptr if not in the incremental mode */
+  inline const GroupCache* getGroupCache() const { return _groupCache.get(); }
+
   /** Inserts an a at the end of the current formula. */
   Formula* add(const sptr<Atom>& a);
 
@@ -133,13 +169,13 @@ public:
   static sptr<Formula> get(const std::wstring& name);
 
   /**
-   * Set the DPI of target
+   * Set the DPI of target of the current context
    *
    * @param dpi the target DPI
    */
   static void setDPITarget(float dpi);
 
-  /** Check if the given unicode-block is registered. */
+  /** Check if the given unicode-block is registered in the current context. */
   static bool isRegisteredBlock(const UnicodeBlock& block);
 
   static FontInfos* getExternalFont(const UnicodeBlock& block);
@@ -151,8 +187,6 @@ public:
 
   static void _init_();
 
-  static void _free_();
-
   virtual ~Formula() = default;
 };
 
@@ -0,0 +1,68 @@
+#include "core/group_cache.h"
+
+#include "atom/atom_row.h"
+
+using namespace std;
+using namespace tex;
+
+const size_t GroupCache::MIN_LENGTH = 4;
+const size_t GroupCache::MAX_ENTRIES = 1 << 16;
+
+bool GroupCache::Key::operator==(const Key& k) const {
+  return _generation == k._generation
+         && _flags == k._flags
+         && _textStyle == k._textStyle
+         && _src == k._src;
+}
+
+size_t GroupCache::KeyHash::operator()(const Key& k) const {
+  size_t h = hash<wstring_view>()(k._src);
+  const auto combine = [&h](size_t v) { h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2); };
+  combine(hash<string_view>()(k._textStyle));
+  combine(hash<u32>()(k._generation));
+  combine(hash<u8>()(k._flags));
+  return h;
+}
+
+void GroupCache::end(bool completed) {
+  if (!completed && _entries.size() <= MAX_ENTRIES) return;
+  for (auto it = _entries.begin(); it != _entries.end();) {
+    if (it->second->_pass != _pass) {
+      it = _entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+sptr<Atom> GroupCache::get(const Key& key) {
+  const auto it = _entries.find(key);
+  if (it == _entries.end()) {
+    _misses++;
+    return nullptr;
+  }
+  _hits++;
+  Entry& e = *it->second;
+  e._pass = _pass;
+  return e._atom->clone();
+}
+
+sptr<Atom> GroupCache::put(const Key& key, const sptr<Atom>& atom) {
+  auto e = std::make_unique<Entry>();
+  e->_src = key._src;
+  e->_textStyle = key._textStyle;
+  e->_atom = atom;
+  e->_pass = _pass;
+  auto* row = dynamic_cast<RowAtom*>(atom.get());
+  if (row != nullptr) row->cacheBox();
+  // the key of an existing entry refers to the strings of that entry, replace
+  // the key as well
+  const Key k{e->_src, e->_textStyle, key._generation, key._flags};
+  _entries.erase(k);
+  _entries.emplace(k, std::move(e));
+  return atom->clone();
+}
+
+void GroupCache::clear() {
+  _entries.clear();
+}
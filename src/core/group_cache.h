@@ -0,0 +1,111 @@
+#ifndef GROUP_CACHE_H_INCLUDED
+#define GROUP_CACHE_H_INCLUDED
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "atom/atom.h"
+#include "common.h"
+
+namespace tex {
+
+/**
+ * Cache of the groups parsed by an incremental formula, see
+ * Formula::setIncremental. A group (the contents of a pair of braces, or an
+ * argument of a command parsed by a sub-parser) is keyed by its source and by
+ * the state of the parser it is parsed with. Thus after an edit, the groups
+ * not touched by the edit are taken from the cache and only the groups that
+ * enclose the edit are parsed again. The rows taken from the cache keep their
+ * boxes (see RowAtom::cacheBox), so only the dirty groups and their ancestors
+ * are laid out again.
+ * <p>
+ * Every parse of the formula is a pass, the groups not used by a completed
+ * pass are evicted at the end of the pass.
+ */
+class GroupCache {
+public:
+  /** The state of the parser taking effect on the parse of a group */
+  enum Flags : u8 {
+    mathMode = 1,
+    partial = 2,
+    atLetter = 4,
+    arrayMode = 8,
+    // the group is parsed in place by the enclosing parser
+    inPlace = 16,
+  };
+
+  struct Key {
+    std::wstring_view _src;
+    std::string_view _textStyle;
+    // generation of the user definitions of the context
+    u32 _generation;
+    u8 _flags;
+
+    bool operator==(const Key& k) const;
+  };
+
+private:
+  struct KeyHash {
+    size_t operator()(const Key& k) const;
+  };
+
+  struct Entry {
+    // the key refers to the strings
+    std::wstring _src;
+    std::string _textStyle;
+    sptr<Atom> _atom;
+    u32 _pass;
+  };
+
+  std::unordered_map<Key, std::unique_ptr<Entry>, KeyHash> _entries;
+  u32 _pass = 0;
+  size_t _hits = 0, _misses = 0;
+
+public:
+  /** Min length of the source of a group to be cached, the shorter ones are cheap to parse */
+  static const size_t MIN_LENGTH;
+  /** Max count of the groups kept by the aborted passes */
+  static const size_t MAX_ENTRIES;
+
+  GroupCache() = default;
+
+  no_copy_assign(GroupCache);
+
+  /** Start a pass */
+  inline void begin() { _pass++; }
+
+  /**
+   * End the current pass, the groups not used by the pass are evicted if the
+   * pass is completed. A pass aborted by an error keeps all the groups unless
+   * there are too many, the next edit usually fixes the error.
+   */
+  void end(bool completed);
+
+  /**
+   * Get a shallow clone of the atom cached for the given key, nullptr if not
+   * found. The caller may modify the returned atom but not its children.
+   */
+  sptr<Atom> get(const Key& key);
+
+  /**
+   * Cache the atom parsed from the group with the given key, return a shallow
+   * clone of the atom to be used in place of the given one
+   */
+  sptr<Atom> put(const Key& key, const sptr<Atom>& atom);
+
+  /** Remove all the cached groups, the counters are kept */
+  void clear();
+
+  /** Get the count of the cached groups */
+  inline size_t size() const { return _entries.size(); }
+
+  inline size_t hits() const { return _hits; }
+
+  inline size_t misses() const { return _misses; }
+};
+
+}  // namespace tex
+
+#endif  // GROUP_CACHE_H_INCLUDED
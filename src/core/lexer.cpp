@@ -0,0 +1,184 @@
+#include "core/lexer.h"
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+
+using namespace std;
+using namespace tex;
+
+const size_t Lexer::MAX_GROUPS = 16;
+
+/** The max count of the names interned by a thread */
+static const size_t MAX_INTERNED_NAMES = 4096;
+
+static inline bool isLetter(wchar_t ch) {
+  return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+const wstring* Lexer::intern(wstring_view name) {
+  // the deque never moves its elements, so the views and the pointers are stable
+  static thread_local deque<wstring> names;
+  static thread_local unordered_map<wstring_view, const wstring*> interned;
+  const auto it = interned.find(name);
+  if (it != interned.end()) return it->second;
+  if (names.size() >= MAX_INTERNED_NAMES) return nullptr;
+  const wstring& str = names.emplace_back(name);
+  interned[str] = &str;
+  return &str;
+}
+
+void Lexer::lex(const wstring& src) {
+  const int len = src.length();
+  // the tokens may be shared by the lexers of the groups
+  if (_tokens == nullptr || _tokens.use_count() > 1) {
+    _tokens = std::make_shared<vector<Token>>();
+  }
+  auto& tokens = *_tokens;
+  tokens.clear();
+  tokens.reserve(len / 4 + 4);
+  _groups.clear();
+  // the innermost opening tokens not closed yet, the opening tokens are
+  // chained by their _match until they are closed
+  int group = -1, brack = -1;
+
+  const auto open = [&](int pos, TokenType type, int& opened) {
+    tokens.push_back({pos, opened, 0, 0, type});
+    opened = tokens.size() - 1;
+  };
+  const auto close = [&](int pos, TokenType type, int& opened) {
+    const int i = tokens.size();
+    tokens.push_back({pos, opened, 0, 0, type});
+    if (opened < 0) return;
+    const int outer = tokens[opened]._match;
+    tokens[opened]._match = i;
+    opened = outer;
+  };
+
+  int pos = 0;
+  while (pos < len) {
+    switch (src[pos]) {
+      case '\\': {
+        int end = pos + 1;
+        while (end < len && isLetter(src[end])) end++;
+        int atEnd = end;
+        while (atEnd < len && (isLetter(src[atEnd]) || src[atEnd] == '@')) atEnd++;
+        // a single non-letter character follows the escape
+        if (end == pos + 1 && end < len) {
+          end = pos + 2;
+          atEnd = max(atEnd, end);
+        }
+        tokens.push_back({
+          pos, -1,
+          (u16) min(end - pos - 1, 0xffff),
+          (u16) min(atEnd - pos - 1, 0xffff),
+          TokenType::command
+        });
+        // the characters in [end, atEnd) are plain characters while '@' is
+        // not a letter
+        pos = end;
+        continue;
+      }
+      case '{':
+        open(pos, TokenType::lgroup, group);
+        break;
+      case '}':
+        close(pos, TokenType::rgroup, group);
+        break;
+      case '[':
+        open(pos, TokenType::lbrack, brack);
+        break;
+      case ']':
+        close(pos, TokenType::rbrack, brack);
+        break;
+      case '$':
+        tokens.push_back({pos, -1, 0, 0, TokenType::dollar});
+        break;
+      default:
+        break;
+    }
+    pos++;
+  }
+  // the groups not closed
+  for (int* opened : {&group, &brack}) {
+    while (*opened >= 0) {
+      const int outer = tokens[*opened]._match;
+      tokens[*opened]._match = -1;
+      *opened = outer;
+    }
+  }
+  _begin = _hint = _offset = 0;
+  _end = tokens.size();
+  _lexed = true;
+}
+
+bool Lexer::share(const Lexer& parent, const wstring& parentSrc, const wstring& src) {
+  if (!parent._lexed) return false;
+  const int len = src.length();
+  // the latest group first
+  for (auto it = parent._groups.rbegin(); it != parent._groups.rend(); ++it) {
+    const Group& g = *it;
+    if (g._len != len || parentSrc.compare(g._pos, len, src) != 0) continue;
+    _tokens = parent._tokens;
+    _begin = _hint = g._begin;
+    _end = g._end;
+    _offset = parent._offset + g._pos;
+    _groups.clear();
+    _lexed = true;
+    return true;
+  }
+  return false;
+}
+
+void Lexer::take(const Token& open) {
+  const int close = open._match;
+  if (close < _begin || close >= _end) return;
+  if (_groups.size() >= MAX_GROUPS) _groups.erase(_groups.begin());
+  const int begin = &open - _tokens->data() + 1;
+  const int pos = open._pos - _offset + 1;
+  _groups.push_back({pos, get(close)._pos - _offset - pos, begin, close});
+}
+
+int Lexer::find(int pos) const {
+  const int p = pos + _offset;
+  // try the last found token and its next
+  for (int i = _hint; i < _end && i <= _hint + 1; i++) {
+    if (get(i)._pos <= p && (i + 1 == _end || get(i + 1)._pos > p)) {
+      _hint = i;
+      return i;
+    }
+  }
+  const auto begin = _tokens->begin();
+  const auto it = upper_bound(
+    begin + _begin, begin + _end, p,
+    [](int x, const Token& t) { return x < t._pos; }
+  );
+  const int i = (int) (it - begin) - 1;
+  _hint = max(i, _begin);
+  return i < _begin ? -1 : i;
+}
+
+bool Lexer::isBoundary(int pos) const {
+  if (!_lexed) return false;
+  const int i = find(pos);
+  if (i < 0) return true;
+  const Token& t = get(i);
+  const int p = pos + _offset;
+  // inside the name of a command
+  return !(t._type == TokenType::command && p > t._pos && p <= t._pos + t._len);
+}
+
+const Token* Lexer::at(int pos) const {
+  if (!_lexed) return nullptr;
+  const int i = find(pos);
+  return i >= 0 && get(i)._pos == pos + _offset ? &get(i) : nullptr;
+}
+
+int Lexer::nextDollar(int pos) const {
+  int i = find(pos);
+  if (i < 0 || get(i)._pos < pos + _offset) i++;
+  for (i = max(i, _begin); i < _end; i++) {
+    if (get(i)._type == TokenType::dollar) return get(i)._pos - _offset;
+  }
+  return -1;
+}
@@ -0,0 +1,135 @@
+#ifndef LEXER_H_INCLUDED
+#define LEXER_H_INCLUDED
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/utils.h"
+
+namespace tex {
+
+enum class TokenType : u8 {
+  command,
+  lgroup,
+  rgroup,
+  lbrack,
+  rbrack,
+  dollar,
+};
+
+/**
+ * A structural token of a TeX source. The plain characters are not tokens.
+ */
+struct Token {
+  // offset of the first character in the lexed source
+  int _pos;
+  // index of the token that closes (or opens) the group, -1 if not balanced
+  // or not a group
+  int _match;
+  // length of the command name while '@' is not a letter
+  u16 _len;
+  // length of the command name while '@' is a letter (after \makeatletter)
+  u16 _atLen;
+  TokenType _type;
+};
+
+/**
+ * Split a TeX source into tokens. Every command (escape character followed by
+ * a letter run or by a single character) is a token, so are the braces, the
+ * brackets and the dollars, the groups are matched in advance. Thus the parser
+ * finds the end of a command or of a group with a single lookup instead of
+ * scanning the source again.
+ * <p>
+ * The groups taken as arguments are remembered, a lexer of the source of such
+ * a group (e.g. the parser of a macro argument) shares the tokens of the group
+ * instead of lexing the source again. The tokens must be rebuilt if the source
+ * is changed.
+ */
+class Lexer {
+private:
+  /** A group taken as argument */
+  struct Group {
+    // offset and length of the contents
+    int _pos, _len;
+    // the tokens of the contents
+    int _begin, _end;
+  };
+
+  static const size_t MAX_GROUPS;
+
+  // the tokens sorted by offset, shared with the lexers of the groups
+  sptr<std::vector<Token>> _tokens;
+  // the tokens of the source are [_begin, _end) and the source starts at
+  // offset _offset of the lexed source
+  int _begin = 0, _end = 0, _offset = 0;
+  bool _lexed = false;
+  // index of the last found token, the parser moves forward mostly
+  mutable int _hint = 0;
+  std::vector<Group> _groups;
+
+  /** Get the index of the last token starting at or before the given offset, -1 if none */
+  int find(int pos) const;
+
+  inline const Token& get(int i) const { return (*_tokens)[i]; }
+
+public:
+  Lexer() = default;
+
+  no_copy_assign(Lexer);
+
+  /** Split the given source into tokens */
+  void lex(const std::wstring& src);
+
+  /**
+   * Share the tokens of the lexer of the enclosing source if the given source
+   * is the contents of a group taken as argument from the enclosing source.
+   *
+   * @param parent the lexer of the enclosing source
+   * @param parentSrc the enclosing source
+   * @param src the source of this lexer
+   * @return true if the tokens are shared
+   */
+  bool share(const Lexer& parent, const std::wstring& parentSrc, const std::wstring& src);
+
+  /** Remember the contents of the given group is taken as argument */
+  void take(const Token& open);
+
+  /** Drop the tokens, must be called after the source is changed */
+  inline void reset() {
+    _lexed = false;
+    _groups.clear();
+  }
+
+  /** Test if the tokens are up to date */
+  inline bool isLexed() const { return _lexed; }
+
+  /** Test if a token or a plain character starts at the given offset */
+  bool isBoundary(int pos) const;
+
+  /** Get the token starting at the given offset, nullptr if no token starts there */
+  const Token* at(int pos) const;
+
+  /** Get the offset of the token that matches the given one, -1 if not balanced */
+  inline int matchOf(const Token& token) const {
+    const int i = token._match;
+    return i < _begin || i >= _end ? -1 : get(i)._pos - _offset;
+  }
+
+  /**
+   * Get the offset of the first dollar token at or after the given offset,
+   * -1 if not found
+   */
+  int nextDollar(int pos) const;
+
+  /**
+   * Intern the given command name in the pool of the calling thread, the pool
+   * is shared by all the lexers of the thread and the interned names remain
+   * valid until the thread exits. Return nullptr if the pool is full.
+   */
+  static const std::wstring* intern(std::wstring_view name);
+};
+
+}  // namespace tex
+
+#endif  // LEXER_H_INCLUDED
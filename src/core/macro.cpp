@@ -1,5 +1,6 @@
 #include "core/macro.h"
 #include "common.h"
+#include "context.h"
 #include "core/macro_impl.h"
 
 #include <string>
@@ -7,15 +8,13 @@
 using namespace std;
 using namespace tex;
 
-bool NewCommandMacro::_errIfConflict = true;
-
 bool NewCommandMacro::isMacro(const wstring& name) {
-  auto it = _codes.find(name);
-  return (it != _codes.end());
+  const auto& codes = Context::current()._macroCodes;
+  return codes.find(name) != codes.end() || __predefinedCode(name) != nullptr;
 }
 
 void NewCommandMacro::checkNew(const wstring& name) {
-  if (_errIfConflict && isMacro(name))
+  if (Context::current()._errIfConflict && isMacro(name))
     throw ex_parse(
       "Command " + wide2utf8(name)
       + " already exists! Use renewcommand instead!"
@@ -23,17 +22,41 @@ void NewCommandMacro::checkNew(const wstring& name) {
 }
 
 void NewCommandMacro::checkRenew(const wstring& name) {
-  if (NewCommandMacro::_errIfConflict && !isMacro(name))
+  if (Context::current()._errIfConflict && !isMacro(name))
     throw ex_parse(
       "Command " + wide2utf8(name)
       + " is no defined! Use newcommand instead!"
     );
 }
 
+void NewCommandMacro::define(
+  const wstring& name,
+  const wstring& code,
+  int argc,
+  const wstring* def
+) {
+  auto& ctx = Context::current();
+  // redefine a command with the same code changes nothing
+  const auto mac = ctx._macros.find(name);
+  const auto cit = ctx._macroCodes.find(name);
+  const auto rit = ctx._macroReplacements.find(name);
+  if (mac != ctx._macros.end() && mac->second->_argc == argc && cit != ctx._macroCodes.end()
+      && cit->second == code && (def == nullptr) == (rit == ctx._macroReplacements.end())
+      && (def == nullptr || rit->second == *def)) {
+    return;
+  }
+  ctx._macroCodes[name] = code;
+  if (def != nullptr) {
+    ctx._macroReplacements[name] = *def;
+    MacroInfo::add(name, new InflationMacroInfo(_instance, argc, 1));
+  } else {
+    MacroInfo::add(name, new InflationMacroInfo(_instance, argc));
+  }
+}
+
 void NewCommandMacro::addNewCommand(const wstring& name, const wstring& code, int argc) {
   checkNew(name);
-  _codes[name] = code;
-  MacroInfo::add(name, new InflationMacroInfo(_instance, argc));
+  define(name, code, argc, nullptr);
 }
 
 void NewCommandMacro::addNewCommand(
@@ -43,15 +66,12 @@ void NewCommandMacro::addNewCommand(
   const wstring& def
 ) {
   checkNew(name);
-  _codes[name] = code;
-  _replacements[name] = def;
-  MacroInfo::add(name, new InflationMacroInfo(_instance, argc, 1));
+  define(name, code, argc, &def);
 }
 
 void NewCommandMacro::addRenewCommand(const wstring& name, const wstring& code, int argc) {
   checkRenew(name);
-  _codes[name] = code;
-  MacroInfo::add(name, new InflationMacroInfo(_instance, argc));
+  define(name, code, argc, nullptr);
 }
 
 void NewCommandMacro::addRenewCommand(
@@ -61,18 +81,23 @@ void NewCommandMacro::addRenewCommand(
   const wstring& def
 ) {
   checkRenew(name);
-  _codes[name] = code;
-  _replacements[name] = def;
-  MacroInfo::add(name, new InflationMacroInfo(_instance, argc, 1));
+  define(name, code, argc, &def);
 }
 
 void NewCommandMacro::execute(TeXParser& tp, vector<wstring>& args) {
-  wstring code = _codes[args[0]];
+  const auto& ctx = Context::current();
+  // the commands defined in the context shadow the predefined ones, only the
+  // user defined ones have replacements (i.e. the default optional argument)
+  const auto cit = ctx._macroCodes.find(args[0]);
+  const bool isUserDefined = cit != ctx._macroCodes.end();
+  const wstring* predefined = isUserDefined ? nullptr : __predefinedCode(args[0]);
+  wstring code = isUserDefined ? cit->second : (predefined == nullptr ? L"" : *predefined);
   wstring rep;
   size_t argc = args.size() - 12;
   int dec = 0;
 
-  auto it = _replacements.find(args[0]);
+  const auto& replacements = ctx._macroReplacements;
+  auto it = isUserDefined ? replacements.find(args[0]) : replacements.end();
 
   // FIXME
   // Keep slash "\" and dollar "$" signs?
@@ -83,7 +108,7 @@ void NewCommandMacro::execute(TeXParser& tp, vector<wstring>& args) {
     dec = 1;
     // quotereplace(args[argc + 1], rep);
     replaceall(code, L"#1", args[argc + 1]);
-  } else if (it != _replacements.end()) {
+  } else if (it != replacements.end()) {
     dec = 1;
     // quotereplace(it->second, rep);
     replaceall(code, L"#1", it->second);
@@ -112,7 +137,7 @@ void NewEnvironmentMacro::addRenewEnvironment(
   const wstring& begDef, const wstring& endDef,
   int argc
 ) {
-  if (_codes.find(name + L"@env") == _codes.end()) {
+  if (!isMacro(name + L"@env")) {
     throw ex_parse(
       "Environment " + wide2utf8(name)
       + "is not defined! Use newenvironment instead!"
@@ -130,19 +155,16 @@ void NewCommandMacro::_free_() {
 }
 
 void MacroInfo::add(const wstring& name, MacroInfo* mac) {
-  auto it = _commands.find(name);
-  if (it != _commands.end()) delete it->second;
-  _commands[name] = mac;
+  auto& ctx = Context::current();
+  ctx._macros[name] = sptr<MacroInfo>(mac);
+  ctx.invalidate();
 }
 
 MacroInfo* MacroInfo::get(const std::wstring& name) {
-  auto it = _commands.find(name);
-  if (it == _commands.end()) return nullptr;
-  return it->second;
-}
-
-void MacroInfo::_free_() {
-  for (const auto& i : _commands) delete i.second;
+  const auto& macros = Context::current()._macros;
+  auto uit = macros.find(name);
+  if (uit != macros.end()) return uit->second.get();
+  return __builtin(name);
 }
 
 sptr<Atom> PreDefMacro::invoke(
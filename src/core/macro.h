@@ -6,6 +6,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 
 namespace tex {
 
@@ -20,22 +21,20 @@ public:
 
 class NewCommandMacro : public Macro {
 protected:
-  static std::map<std::wstring, std::wstring> _codes;
-  static std::map<std::wstring, std::wstring> _replacements;
   static Macro* _instance;
 
   static void checkNew(const std::wstring& name);
 
   static void checkRenew(const std::wstring& name);
 
-public:
-  /**
-   * If notify a fatal error when defining a new command but it has been
-   * defined already or redefine a command but it has not been defined,
-   * default is true.
-   */
-  static bool _errIfConflict;
+  static void define(
+    const std::wstring& name,
+    const std::wstring& code,
+    int argc,
+    const std::wstring* def
+  );
 
+public:
   void execute(TeXParser& tp, std::vector<std::wstring>& args) override;
 
   static void addNewCommand(
@@ -66,7 +65,16 @@ public:
 
   static bool isMacro(const std::wstring& name);
 
-  static void _init_();
+  /**
+   * INTERNAL USE: get the code of the predefined command (or environment) with
+   * given name, the predefined ones are shared by all the contexts and the user
+   * defined ones are held by the context (see Context). Return nullptr if not
+   * found.
+   */
+  static const std::wstring* __predefinedCode(std::wstring_view name);
+
+  /** INTERNAL USE: get the macro to expand the predefined commands and environments */
+  static inline Macro* __instance() { return _instance; }
 
   static void _free_();
 
@@ -92,12 +100,20 @@ public:
 
 class MacroInfo {
 public:
-  static std::map<std::wstring, MacroInfo*> _commands;
+  /**
+   * INTERNAL USE: get the builtin (or predefined) macro with given name from the
+   * table generated at compile time, return nullptr if not found. The table is
+   * read-only after LaTeX::init, so it is safe for concurrent readers.
+   */
+  static MacroInfo* __builtin(std::wstring_view name);
 
-  /** Add a macro, replace it if the macro is exists. */
+  /** Add a macro to the current context, replace it if the macro is exists. */
   static void add(const std::wstring& name, MacroInfo* mac);
 
-  /** Get the macro info from given name, return nullptr if not found. */
+  /**
+   * Get the macro info from given name, the macros defined in the current
+   * context come first, return nullptr if not found.
+   */
   static MacroInfo* get(const std::wstring& name);
 
   // Number of arguments
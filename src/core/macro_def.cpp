@@ -1,25 +1,45 @@
 #include "common.h"
 #include "core/macro.h"
 #include "macro_impl.h"
+#include "utils/perfect_hash.h"
+
+#include <atomic>
+#include <mutex>
+#include <string_view>
 
 using namespace std;
 using namespace tex;
 
-#define mac3(argc, name, code) \
-  { L##code, m(argc, name) }
+namespace {
 
-#define mac4(argc, posOpts, name, code) \
-  { L##code, m(argc, posOpts, name) }
+/** A builtin macro implemented by a delegate */
+struct BuiltinMacro {
+  wstring_view _name;
+  int _argc;
+  int _posOpts;
+  MacroDelegate _delegate;
+};
 
-inline static PreDefMacro* m(int argc, int posOpts, MacroDelegate del) {
-  return new PreDefMacro(argc, posOpts, del);
-}
+/** A predefined command or environment that inflates to TeX code */
+struct PredefinedMacro {
+  wstring_view _name;
+  int _argc;
+  // the code of a command, or the begin code of an environment
+  wstring_view _begin;
+  // the end code of an environment
+  wstring_view _end;
+  bool _isEnv;
+};
 
-inline static PreDefMacro* m(int argc, MacroDelegate del) {
-  return new PreDefMacro(argc, del);
-}
+}  // namespace
+
+#define mac3(argc, name, code) \
+  { L##code, argc, 0, name }
+
+#define mac4(argc, posOpts, name, code) \
+  { L##code, argc, posOpts, name }
 
-map<wstring, MacroInfo*> MacroInfo::_commands{
+static constexpr BuiltinMacro builtinMacros[]{
 #define mac mac4
     mac(2, 2, macro_newcommand, "newcommand"),
     mac(2, 2, macro_renewcommand, "renewcommand"),
@@ -326,90 +346,156 @@ map<wstring, MacroInfo*> MacroInfo::_commands{
 #endif  // GRAPHICS_DEBUG
 };
 
-map<wstring, wstring> NewCommandMacro::_codes;
-map<wstring, wstring> NewCommandMacro::_replacements;
+#undef mac
+
 Macro* NewCommandMacro::_instance = new NewCommandMacro();
 
-inline static void env(
-  int argc,
-  const wstring& name,
-  const wstring& begDef,
-  const wstring& endDef
-) {
-  NewEnvironmentMacro::addNewEnvironment(name, begDef, endDef, argc);
-}
+// an environment "name" is the command "name@env" with an extra argument that
+// takes the contents of the environment
+#define env(argc, name, begDef, endDef) \
+  { name L"@env", argc, begDef, endDef, true }
 
-inline static void cmd(
-  int argc,
-  const wstring& name,
-  const wstring& code
-) {
-  NewCommandMacro::addNewCommand(name, code, argc);
-}
+#define cmd(argc, name, code) \
+  { name, argc, code, L"", false }
 
-void NewCommandMacro::_init_() {
+static constexpr PredefinedMacro predefinedMacros[]{
   // region Predefined environments
-  env(1, L"array", L"\\array@@env{#1}{", L"}");
-  env(1, L"tabular", L"\\array@@env{#1}{", L"}");
-  env(0, L"matrix", L"\\matrix@@env{", L"}");
-  env(0, L"smallmatrix", L"\\smallmatrix@@env{", L"}");
-  env(0, L"pmatrix", L"\\left(\\begin{matrix}", L"\\end{matrix}\\right)");
-  env(0, L"bmatrix", L"\\left[\\begin{matrix}", L"\\end{matrix}\\right]");
-  env(0, L"Bmatrix", L"\\left\\{\\begin{matrix}", L"\\end{matrix}\\right\\}");
-  env(0, L"vmatrix", L"\\left|\\begin{matrix}", L"\\end{matrix}\\right|");
-  env(0, L"Vmatrix", L"\\left\\|\\begin{matrix}", L"\\end{matrix}\\right\\|");
-  env(0, L"eqnarray", L"\\begin{array}{rcl}", L"\\end{array}");
-  env(0, L"align", L"\\align@@env{", L"}");
-  env(0, L"flalign", L"\\flalign@@env{", L"}");
-  env(1, L"alignat", L"\\alignat@@env{#1}{", L"}");
-  env(0, L"aligned", L"\\aligned@@env{", L"}");
-  env(1, L"alignedat", L"\\alignedat@@env{#1}{", L"}");
-  env(0, L"multline", L"\\multline@@env{", L"}");
-  env(0, L"cases", L"\\left\\{\\begin{array}{@{}ll@{\\,}}", L"\\end{array}\\right.");
-  env(0, L"split", L"\\begin{array}{r@{\\;}l}", L"\\end{array}");
-  env(0, L"gather", L"\\gather@@env{", L"}");
-  env(0, L"gathered", L"\\gathered@@env{", L"}");
-  env(0, L"math", L"\\(", L"\\)");
-  env(0, L"displaymath", L"\\[", L"\\]");
-  env(0, L"equation", L"\\begin{align}", L"\\end{align}");
+  env(1, L"array", L"\\array@@env{#1}{", L"}"),
+  env(1, L"tabular", L"\\array@@env{#1}{", L"}"),
+  env(0, L"matrix", L"\\matrix@@env{", L"}"),
+  env(0, L"smallmatrix", L"\\smallmatrix@@env{", L"}"),
+  env(0, L"pmatrix", L"\\left(\\begin{matrix}", L"\\end{matrix}\\right)"),
+  env(0, L"bmatrix", L"\\left[\\begin{matrix}", L"\\end{matrix}\\right]"),
+  env(0, L"Bmatrix", L"\\left\\{\\begin{matrix}", L"\\end{matrix}\\right\\}"),
+  env(0, L"vmatrix", L"\\left|\\begin{matrix}", L"\\end{matrix}\\right|"),
+  env(0, L"Vmatrix", L"\\left\\|\\begin{matrix}", L"\\end{matrix}\\right\\|"),
+  env(0, L"eqnarray", L"\\begin{array}{rcl}", L"\\end{array}"),
+  env(0, L"align", L"\\align@@env{", L"}"),
+  env(0, L"flalign", L"\\flalign@@env{", L"}"),
+  env(1, L"alignat", L"\\alignat@@env{#1}{", L"}"),
+  env(0, L"aligned", L"\\aligned@@env{", L"}"),
+  env(1, L"alignedat", L"\\alignedat@@env{#1}{", L"}"),
+  env(0, L"multline", L"\\multline@@env{", L"}"),
+  env(0, L"cases", L"\\left\\{\\begin{array}{@{}ll@{\\,}}", L"\\end{array}\\right."),
+  env(0, L"split", L"\\begin{array}{r@{\\;}l}", L"\\end{array}"),
+  env(0, L"gather", L"\\gather@@env{", L"}"),
+  env(0, L"gathered", L"\\gathered@@env{", L"}"),
+  env(0, L"math", L"\\(", L"\\)"),
+  env(0, L"displaymath", L"\\[", L"\\]"),
+  env(0, L"equation", L"\\begin{align}", L"\\end{align}"),
   // endregion
   // region Predefined commands
-  cmd(1, L"operatorname", L"\\mathop{\\mathrm{#1}}\\nolimits ");
-  cmd(2, L"DeclareMathOperator", L"\\newcommand{#1}{\\mathop{\\mathrm{#2}}\\nolimits}");
-  cmd(1, L"substack", L"{\\scriptstyle\\begin{array}{c}#1\\end{array}}");
-  cmd(2, L"dfrac", L"\\genfrac{}{}{}{}{#1}{#2}");
-  cmd(2, L"tfrac", L"\\genfrac{}{}{}{1}{#1}{#2}");
-  cmd(2, L"dbinom", L"\\genfrac{(}{)}{0pt}{}{#1}{#2}");
-  cmd(2, L"tbinom", L"\\genfrac{(}{)}{0pt}{1}{#1}{#2}");
-  cmd(1, L"pmod", L"\\qquad\\mathbin{(\\mathrm{mod}\\ #1)}");
-  cmd(1, L"mod", L"\\qquad\\mathbin{\\mathrm{mod}\\ #1}");
-  cmd(1, L"pod", L"\\qquad\\mathbin{(#1)}");
-  cmd(1, L"dddot", L"\\mathop{#1}\\limits^{...}");
-  cmd(1, L"ddddot", L"\\mathop{#1}\\limits^{....}");
-  cmd(0, L"spdddot", L"^{\\mathrm{...}}");
-  cmd(0, L"spbreve", L"^{\\makeatletter\\sp@breve\\makeatother}");
-  cmd(0, L"sphat", L"^{\\makeatletter\\sp@hat\\makeatother}");
-  cmd(0, L"spddot", L"^{\\displaystyle..}");
-  cmd(0, L"spcheck", L"^{\\vee}");
-  cmd(0, L"sptilde", L"^{\\sim}");
-  cmd(0, L"spdot", L"^{\\displaystyle.}");
-  cmd(1, L"d", L"\\underaccent{\\dot}{#1}");
-  cmd(1, L"b", L"\\underaccent{\\bar}{#1}");
-  cmd(1, L"Bra", L"\\left\\langle{#1}\\right\\vert");
-  cmd(1, L"Ket", L"\\left\\vert{#1}\\right\\rangle");
-  cmd(1, L"textsuperscript", L"{}^{\\text{#1}}");
-  cmd(1, L"textsubscript", L"{}_{\\text{#1}}");
-  cmd(1, L"textit", L"\\mathit{\\text{#1}}");
-  cmd(1, L"textbf", L"\\mathbf{\\text{#1}}");
-  cmd(1, L"textsf", L"\\mathsf{\\text{#1}}");
-  cmd(1, L"texttt", L"\\mathtt{\\text{#1}}");
-  cmd(1, L"textrm", L"\\text{#1}");
-  cmd(0, L"degree", L"^\\circ");
-  cmd(0, L"with", L"\\mathbin{\\&}");
-  cmd(0, L"parr", L"\\mathbin{\\rotatebox[origin=c]{180}{\\&}}");
-  cmd(0, L"copyright", L"\\textcircled{\\raisebox{0.2ex}{c}}");
-  cmd(0, L"L", L"\\mathrm{\\polishlcross L}");
-  cmd(0, L"l", L"\\mathrm{\\polishlcross l}");
-  cmd(0, L"Join", L"\\mathop{\\rlap{\\ltimes}\\rtimes}");
+  cmd(1, L"operatorname", L"\\mathop{\\mathrm{#1}}\\nolimits "),
+  cmd(2, L"DeclareMathOperator", L"\\newcommand{#1}{\\mathop{\\mathrm{#2}}\\nolimits}"),
+  cmd(1, L"substack", L"{\\scriptstyle\\begin{array}{c}#1\\end{array}}"),
+  cmd(2, L"dfrac", L"\\genfrac{}{}{}{}{#1}{#2}"),
+  cmd(2, L"tfrac", L"\\genfrac{}{}{}{1}{#1}{#2}"),
+  cmd(2, L"dbinom", L"\\genfrac{(}{)}{0pt}{}{#1}{#2}"),
+  cmd(2, L"tbinom", L"\\genfrac{(}{)}{0pt}{1}{#1}{#2}"),
+  cmd(1, L"pmod", L"\\qquad\\mathbin{(\\mathrm{mod}\\ #1)}"),
+  cmd(1, L"mod", L"\\qquad\\mathbin{\\mathrm{mod}\\ #1}"),
+  cmd(1, L"pod", L"\\qquad\\mathbin{(#1)}"),
+  cmd(1, L"dddot", L"\\mathop{#1}\\limits^{...}"),
+  cmd(1, L"ddddot", L"\\mathop{#1}\\limits^{....}"),
+  cmd(0, L"spdddot", L"^{\\mathrm{...}}"),
+  cmd(0, L"spbreve", L"^{\\makeatletter\\sp@breve\\makeatother}"),
+  cmd(0, L"sphat", L"^{\\makeatletter\\sp@hat\\makeatother}"),
+  cmd(0, L"spddot", L"^{\\displaystyle..}"),
+  cmd(0, L"spcheck", L"^{\\vee}"),
+  cmd(0, L"sptilde", L"^{\\sim}"),
+  cmd(0, L"spdot", L"^{\\displaystyle.}"),
+  cmd(1, L"d", L"\\underaccent{\\dot}{#1}"),
+  cmd(1, L"b", L"\\underaccent{\\bar}{#1}"),
+  cmd(1, L"Bra", L"\\left\\langle{#1}\\right\\vert"),
+  cmd(1, L"Ket", L"\\left\\vert{#1}\\right\\rangle"),
+  cmd(1, L"textsuperscript", L"{}^{\\text{#1}}"),
+  cmd(1, L"textsubscript", L"{}_{\\text{#1}}"),
+  cmd(1, L"textit", L"\\mathit{\\text{#1}}"),
+  cmd(1, L"textbf", L"\\mathbf{\\text{#1}}"),
+  cmd(1, L"textsf", L"\\mathsf{\\text{#1}}"),
+  cmd(1, L"texttt", L"\\mathtt{\\text{#1}}"),
+  cmd(1, L"textrm", L"\\text{#1}"),
+  cmd(0, L"degree", L"^\\circ"),
+  cmd(0, L"with", L"\\mathbin{\\&}"),
+  cmd(0, L"parr", L"\\mathbin{\\rotatebox[origin=c]{180}{\\&}}"),
+  cmd(0, L"copyright", L"\\textcircled{\\raisebox{0.2ex}{c}}"),
+  cmd(0, L"L", L"\\mathrm{\\polishlcross L}"),
+  cmd(0, L"l", L"\\mathrm{\\polishlcross l}"),
+  cmd(0, L"Join", L"\\mathop{\\rlap{\\ltimes}\\rtimes}"),
   // endregion
+};
+
+#undef env
+#undef cmd
+
+static constexpr size_t BUILTIN_COUNT = std::size(builtinMacros);
+static constexpr size_t PREDEFINED_COUNT = std::size(predefinedMacros);
+static constexpr size_t MACRO_COUNT = BUILTIN_COUNT + PREDEFINED_COUNT;
+
+static constexpr array<wstring_view, MACRO_COUNT> macroNames() {
+  array<wstring_view, MACRO_COUNT> names{};
+  for (size_t i = 0; i < BUILTIN_COUNT; i++) names[i] = builtinMacros[i]._name;
+  for (size_t i = 0; i < PREDEFINED_COUNT; i++) names[BUILTIN_COUNT + i] = predefinedMacros[i]._name;
+  return names;
+}
+
+// the builtin macros come first, then the predefined ones
+static constexpr StaticPerfectHash<wchar_t, MACRO_COUNT> macroTable(macroNames());
+
+// indexed by the table, created on first use, see macroAt
+static atomic<MacroInfo*> macros[MACRO_COUNT];
+static wstring predefinedCodes[PREDEFINED_COUNT];
+static mutex macrosMutex;
+
+/** Create the macro at the given index of the table, and its code if it is a predefined one */
+static MacroInfo* createMacro(size_t i) {
+  if (i < BUILTIN_COUNT) {
+    const auto& m = builtinMacros[i];
+    return new PreDefMacro(m._argc, m._posOpts, m._delegate);
+  }
+  const auto& m = predefinedMacros[i - BUILTIN_COUNT];
+  wstring& code = predefinedCodes[i - BUILTIN_COUNT];
+  if (m._isEnv) {
+    code.append(m._begin).append(L" #").append(towstring(m._argc + 1)).append(L" ").append(m._end);
+  } else {
+    code = m._begin;
+  }
+  return new InflationMacroInfo(NewCommandMacro::__instance(), m._isEnv ? m._argc + 1 : m._argc);
+}
+
+/**
+ * Get the macro at the given index of the table, the macros are created on
+ * their first use rather than all at the initialization, a parse uses only
+ * a few of them.
+ */
+static MacroInfo* macroAt(size_t i) {
+  MacroInfo* m = macros[i].load(memory_order_acquire);
+  if (m != nullptr) return m;
+  lock_guard<mutex> lock(macrosMutex);
+  m = macros[i].load(memory_order_relaxed);
+  if (m == nullptr) {
+    m = createMacro(i);
+    macros[i].store(m, memory_order_release);
+  }
+  return m;
+}
+
+const wstring* NewCommandMacro::__predefinedCode(wstring_view name) {
+  const int i = macroTable.find(name);
+  if (i < (int) BUILTIN_COUNT) return nullptr;
+  // the code is created with the macro
+  macroAt(i);
+  return &predefinedCodes[i - BUILTIN_COUNT];
+}
+
+MacroInfo* MacroInfo::__builtin(wstring_view name) {
+  const int i = macroTable.find(name);
+  return i < 0 ? nullptr : macroAt(i);
+}
+
+void MacroInfo::_free_() {
+  for (size_t i = 0; i < MACRO_COUNT; i++) {
+    delete macros[i].exchange(nullptr);
+    if (i >= BUILTIN_COUNT) predefinedCodes[i - BUILTIN_COUNT].clear();
+  }
 }
@@ -175,14 +175,15 @@ macro(textstyles) {
   else if (style == L"cal") style = L"mathcal";
 
   FontInfos* info = nullptr;
-  auto it = Formula::_externalFontMap.find(UnicodeBlock::BASIC_LATIN);
-  if (it != Formula::_externalFontMap.end()) {
+  auto& fonts = Context::current()._externalFonts;
+  auto it = fonts.find(UnicodeBlock::BASIC_LATIN);
+  if (it != fonts.end()) {
     info = it->second;
-    Formula::_externalFontMap[UnicodeBlock::BASIC_LATIN] = nullptr;
+    fonts[UnicodeBlock::BASIC_LATIN] = nullptr;
   }
   auto atom = Formula(tp, args[1], false)._root;
   if (info != nullptr) {
-    Formula::_externalFontMap[UnicodeBlock::BASIC_LATIN] = info;
+    fonts[UnicodeBlock::BASIC_LATIN] = info;
   }
 
   string s = wide2utf8(style);
@@ -6,6 +6,7 @@
 #include "atom/atom_basic.h"
 #include "atom/atom_impl.h"
 #include "common.h"
+#include "context.h"
 #include "core/core.h"
 #include "core/formula.h"
 #include "core/macro.h"
@@ -34,12 +35,22 @@ inline macro(undebug) {
 #endif  // GRAPHICS_DEBUG
 
 inline macro(fatalIfCmdConflict) {
-  NewCommandMacro::_errIfConflict = args[1] == L"true";
+  auto& ctx = Context::current();
+  const bool b = args[1] == L"true";
+  if (ctx._errIfConflict != b) {
+    ctx._errIfConflict = b;
+    ctx.invalidate();
+  }
   return nullptr;
 }
 
 inline macro(breakEverywhere) {
-  RowAtom::_breakEveywhere = args[1] == L"true";
+  auto& ctx = Context::current();
+  const bool b = args[1] == L"true";
+  if (ctx._breakEverywhere != b) {
+    ctx._breakEverywhere = b;
+    ctx.invalidate();
+  }
   return nullptr;
 }
 
@@ -61,7 +72,7 @@ inline macro(longdiv) {
 }
 
 inline macro(cellcolor) {
-  if (!tp.isArrayMode()) throw ex_parse("Command \\cellcolor must used in array environment!");
+  if (!tp.isInArray()) throw ex_parse("Command \\cellcolor must used in array environment!");
   color c = ColorAtom::getColor(wide2utf8(args[1]));
   auto atom = sptrOf<CellColorAtom>(c);
   ((ArrayFormula*) tp._formula)->addCellSpecifier(atom);
@@ -86,7 +97,11 @@ inline macro(newcolumntype) {
 
 inline macro(arrayrulecolor) {
   color c = ColorAtom::getColor(wide2utf8(args[1]));
-  MatrixAtom::LINE_COLOR = c;
+  auto& ctx = Context::current();
+  if (ctx._arrayRuleColor != c) {
+    ctx._arrayRuleColor = c;
+    ctx.invalidate();
+  }
   return nullptr;
 }
 
@@ -96,7 +111,7 @@ inline macro(columnbg) {
 }
 
 inline macro(rowcolor) {
-  if (!tp.isArrayMode()) throw ex_parse("Command \\rowcolor must used in array environment!");
+  if (!tp.isInArray()) throw ex_parse("Command \\rowcolor must used in array environment!");
   color c = ColorAtom::getColor(wide2utf8(args[1]));
   auto spe = sptrOf<CellColorAtom>(c);
   ((ArrayFormula*) tp._formula)->addRowSpecifier(spe);
@@ -508,6 +523,8 @@ inline macro(cr) {
       false,
       tp.isMathMode()
     );
+    parser.inherit(tp);
+
     parser.parse();
     arr.checkDimensions();
     tp._formula->_root = arr.getAsVRow();
@@ -523,6 +540,8 @@ inline macro(backslashcr) {
 inline macro(smallmatrixATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser parser(tp.isPartial(), args[1], arr, false);
+  parser.inherit(tp);
+
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::smallMatrix);
@@ -531,12 +550,15 @@ inline macro(smallmatrixATATenv) {
 inline macro(matrixATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser parser(tp.isPartial(), args[1], arr, false);
+  parser.inherit(tp);
+
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::matrix);
 }
 
 inline macro(multicolumn) {
+  if (!tp.isInArray()) throw ex_parse("Command \\multicolumn must used in array environment!");
   int n = 0;
   valueof(args[1], n);
   const std::string x = wide2utf8(args[2]);
@@ -546,7 +568,7 @@ inline macro(multicolumn) {
 }
 
 inline macro(hdotsfor) {
-  if (!tp.isArrayMode())
+  if (!tp.isInArray())
     throw ex_parse("Command 'hdotsfor' only available in array mode!");
   int n = 0;
   valueof(args[1], n);
@@ -560,6 +582,8 @@ inline macro(hdotsfor) {
 inline macro(arrayATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser parser(tp.isPartial(), args[2], arr, false);
+  parser.inherit(tp);
+
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), args[1], true);
@@ -568,6 +592,8 @@ inline macro(arrayATATenv) {
 inline macro(alignATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser parser(tp.isPartial(), args[1], arr, false);
+  parser.inherit(tp);
+
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::align);
@@ -576,6 +602,8 @@ inline macro(alignATATenv) {
 inline macro(flalignATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser parser(tp.isPartial(), args[1], arr, false);
+  parser.inherit(tp);
+
   parser.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::flAlign);
@@ -584,6 +612,8 @@ inline macro(flalignATATenv) {
 inline macro(alignatATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser par(tp.isPartial(), args[2], arr, false);
+  par.inherit(tp);
+
   par.parse();
   arr->checkDimensions();
   size_t n = 0;
@@ -596,6 +626,8 @@ inline macro(alignatATATenv) {
 inline macro(alignedATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser p(tp.isPartial(), args[1], arr, false);
+  p.inherit(tp);
+
   p.parse();
   arr->checkDimensions();
   return sptrOf<MatrixAtom>(tp.isPartial(), sptr<ArrayFormula>(arr), MatrixType::aligned);
@@ -604,6 +636,8 @@ inline macro(alignedATATenv) {
 inline macro(alignedatATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser p(tp.isPartial(), args[2], arr, false);
+  p.inherit(tp);
+
   p.parse();
   arr->checkDimensions();
   size_t n = 0;
@@ -618,6 +652,8 @@ inline macro(alignedatATATenv) {
 inline macro(multlineATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser p(tp.isPartial(), args[1], arr, false);
+  p.inherit(tp);
+
   p.parse();
   arr->checkDimensions();
   if (arr->cols() > 1) {
@@ -631,6 +667,8 @@ inline macro(multlineATATenv) {
 inline macro(gatherATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser p(tp.isPartial(), args[1], arr, false);
+  p.inherit(tp);
+
   p.parse();
   arr->checkDimensions();
   if (arr->cols() > 1) throw ex_parse("Requires exact one column in gather envrionment!");
@@ -643,6 +681,8 @@ inline macro(gatherATATenv) {
 inline macro(gatheredATATenv) {
   auto* arr = new ArrayFormula();
   TeXParser p(tp.isPartial(), args[1], arr, false);
+  p.inherit(tp);
+
   p.parse();
   arr->checkDimensions();
   if (arr->cols() > 1) throw ex_parse("Requires exact one column in gathered envrionment!");
@@ -937,8 +977,12 @@ inline macro(cornersize) {
   float size = 0.5f;
   valueof(args[1], size);
   if (size <= 0 || size > 0.5f) size = 0.5f;
-  OvalAtom::_multiplier = size;
-  OvalAtom::_diameter = 0;
+  auto& ctx = Context::current();
+  if (ctx._ovalMultiplier != size || ctx._ovalDiameter != 0) {
+    ctx._ovalMultiplier = size;
+    ctx._ovalDiameter = 0;
+    ctx.invalidate();
+  }
   return nullptr;
 }
 
@@ -3,6 +3,7 @@
 #include "atom/atom.h"
 #include "atom/atom_basic.h"
 #include "common.h"
+#include "context.h"
 #include "core/formula.h"
 #include "core/macro.h"
 #include "fonts/alphabet.h"
@@ -12,6 +13,7 @@
 using namespace std;
 using namespace tex;
 
+const int TeXParser::MIN_LEX_LENGTH = 64;
 const wchar_t TeXParser::ESCAPE = '\\';
 const wchar_t TeXParser::L_GROUP = '{';
 const wchar_t TeXParser::R_GROUP = '}';
@@ -74,6 +76,50 @@ const set<wstring> TeXParser::_unparsedContents = {
 
 bool TeXParser::_isLoading = false;
 
+void SourceMap::reset(const wstring& src) {
+  _spans.clear();
+  _lines.clear();
+  for (auto i = src.find(L'\n'); i != wstring::npos; i = src.find(L'\n', i + 1)) {
+    _lines.push_back(i);
+  }
+}
+
+void SourceMap::copy(int pos, int src) {
+  if (!_spans.empty()) {
+    const Span& last = _spans.back();
+    // continues the last span
+    if (last._copied && pos - last._pos == src - last._src) return;
+  }
+  _spans.push_back({pos, src, true});
+}
+
+void SourceMap::generate(int pos, int src) {
+  if (!_spans.empty()) {
+    const Span& last = _spans.back();
+    if (!last._copied && last._src == src) return;
+  }
+  _spans.push_back({pos, src, false});
+}
+
+int SourceMap::sourceOf(int pos) const {
+  const auto it = upper_bound(
+    _spans.begin(), _spans.end(), pos,
+    [](int p, const Span& s) { return p < s._pos; }
+  );
+  if (it == _spans.begin()) return pos;
+  const Span& span = *(it - 1);
+  return span._copied ? span._src + pos - span._pos : span._src;
+}
+
+int SourceMap::lineOf(int src) const {
+  return lower_bound(_lines.begin(), _lines.end(), src) - _lines.begin();
+}
+
+int SourceMap::colOf(int src) const {
+  const int line = lineOf(src);
+  return line == 0 ? src : src - _lines[line - 1] - 1;
+}
+
 void TeXParser::init(
   bool isPartial,
   const wstring& latex,
@@ -81,10 +127,10 @@ void TeXParser::init(
   bool firstPass
 ) {
   _pos = _spos = _len = 0;
-  _line = _col = 0;
   _group = 0;
+  _outOfGroup = false;
   _atIsLetter = 0;
-  _insertion = _arrayMode = _isMathMode = false;
+  _insertion = _arrayMode = _isMathMode = _preprocessing = false;
   _isPartial = _hideUnknownChar = true;
 
   _formula = formula;
@@ -92,11 +138,15 @@ void TeXParser::init(
   _isPartial = isPartial;
   if (!latex.empty()) {
     _latex = latex;
+    _lexer.reset();
     _len = latex.length();
     _pos = 0;
+    _srcMap.reset(latex);
     if (firstPass) preprocess();
   } else {
     _latex = L"";
+    _lexer.reset();
+    _srcMap.reset(_latex);
     _pos = 0;
     _len = 0;
   }
@@ -105,17 +155,19 @@ void TeXParser::init(
 
 void TeXParser::reset(const wstring& latex) {
   _latex = latex;
+  _lexer.reset();
   _len = latex.length();
   _formula->_root = nullptr;
+  _formula->_middle.clear();
   _pos = 0;
   _spos = 0;
-  _line = 0;
-  _col = 0;
   _group = 0;
+  _outOfGroup = false;
   _insertion = false;
   _atIsLetter = 0;
   _arrayMode = false;
   _isMathMode = true;
+  _srcMap.reset(latex);
   preprocess();
 }
 
@@ -137,8 +189,12 @@ void TeXParser::addAtom(const sptr<Atom>& atom) const {
   _formula->add(atom);
 }
 
+bool TeXParser::isInArray() const {
+  return _arrayMode && _formula->isArrayMode();
+}
+
 void TeXParser::addRow() const {
-  if (!_arrayMode) throw ex_parse("Can not add row in none-array mode!");
+  if (!isInArray()) throw ex_parse("Can not add row in none-array mode!");
   ((ArrayFormula*) _formula)->addRow();
 }
 
@@ -146,6 +202,14 @@ wstring TeXParser::getDollarGroup(wchar_t openclose) {
   int spos = _pos;
   wchar_t ch;
 
+  if (openclose == DOLLAR && (token(_pos) != nullptr || _lexer.isBoundary(_pos))) {
+    const int end = _lexer.nextDollar(_pos);
+    if (end >= 0) {
+      _pos = end + 1;
+      return _latex.substr(spos, end - spos);
+    }
+  }
+
   do {
     ch = _latex[_pos++];
     if (ch == ESCAPE) _pos++;
@@ -162,8 +226,22 @@ wstring TeXParser::getGroup(wchar_t open, wchar_t close) {
   wchar_t ch = _latex[_pos];
 
   if (_pos < _len && ch == open) {
-    group = 1;
     spos = _pos;
+    // the braces and the brackets are matched by the lexer
+    const bool matched = (open == L_GROUP && close == R_GROUP) || (open == L_BRACK && close == R_BRACK);
+    const Token* token = matched ? this->token(_pos) : nullptr;
+    if (token != nullptr) {
+      const int end = _lexer.matchOf(*token);
+      if (end < 0) {
+        _pos = _len;
+        return _latex.substr(spos + 1);
+      }
+      _lexer.take(*token);
+      _pos = end + 1;
+      return _latex.substr(spos + 1, end - spos - 1);
+    }
+
+    group = 1;
     while (_pos < _len - 1 && group != 0) {
       _pos++;
       ch = _latex[_pos];
@@ -309,7 +387,21 @@ wstring TeXParser::getOverArgument() {
   return str;
 }
 
-wstring TeXParser::getCommand() {
+const wstring& TeXParser::getCommand() {
+  static const wstring empty;
+  const Token* token = this->token(_pos);
+  if (token != nullptr && token->_type == TokenType::command) {
+    const int len = _atIsLetter == 0 ? token->_len : token->_atLen;
+    const wstring* name = Lexer::intern(wstring_view(_latex).substr(_pos + 1, len));
+    if (name != nullptr && (len != 1 || _latex[_pos + 1] != L'\0')) {
+      _pos += len + 1;
+      if (len == 0) return empty;
+      if (*name == L"cr" && _pos < _len && _latex[_pos] == ' ') _pos++;
+      return *name;
+    }
+  }
+
+  // not a token or the source is not lexed, scan the source
   int spos = ++_pos;
   wchar_t ch = L'\0';
 
@@ -324,11 +416,13 @@ wstring TeXParser::getCommand() {
     _pos++;
   }
 
-  if (ch == L'\0') return L"";
+  if (ch == L'\0') return empty;
 
   if (_pos == spos) _pos++;
 
-  wstring com = _latex.substr(spos, _pos - spos);
+  const wstring_view view = wstring_view(_latex).substr(spos, _pos - spos);
+  const wstring* interned = Lexer::intern(view);
+  const wstring& com = interned != nullptr ? *interned : _names.emplace_back(view);
   if (com == L"cr" && _pos < _len && _latex[_pos] == ' ') _pos++;
 
   return com;
@@ -336,6 +430,7 @@ wstring TeXParser::getCommand() {
 
 void TeXParser::insert(int beg, int end, const wstring& formula) {
   _latex.replace(beg, end - beg, formula);
+  _lexer.reset();
   _len = _latex.length();
   _pos = beg;
   _insertion = true;
@@ -378,10 +473,6 @@ void TeXParser::skipWhiteSpace() {
   while (_pos < _len) {
     c = _latex[_pos];
     if (c != ' ' && c != '\t' && c != '\n' && c != '\r') break;
-    if (c == '\n') {
-      _line++;
-      _col = _pos;
-    }
     _pos++;
   }
 }
@@ -392,6 +483,7 @@ wstring TeXParser::forwardBalancedGroup() {
     finish();
     return sub;
   }
+  _outOfGroup = true;
   int closing = _group;
   auto i = _latex.length() - 1;
   for (; i >= _pos; i--) {
@@ -416,22 +508,19 @@ void TeXParser::getOptsArgs(int argc, int opts, Args& args) {
   args.resize(argc + 10 + 1 + 1);
 
   auto getOpts = [&]() {
-    int j = argc + 1;
-    try {
-      for (; j < argc + 11; j++) {
-        skipWhiteSpace();
-        args[j] = getGroup(L_BRACK, R_BRACK);
-      }
-    } catch (ex_parse& e) {
-      args[j] = L"";
+    for (int j = argc + 1; j < argc + 11; j++) {
+      skipWhiteSpace();
+      // no more options
+      if (_pos < _len && _latex[_pos] != L_BRACK) break;
+      args[j] = getGroup(L_BRACK, R_BRACK);
     }
   };
 
   auto getArg = [&](int i) { // NOLINT(misc-no-recursion)
     skipWhiteSpace();
-    try {
+    if (_pos == _len || _latex[_pos] == L_GROUP) {
       args[i] = getGroup(L_GROUP, R_GROUP);
-    } catch (ex_parse& e) {
+    } else {
       if (_latex[_pos] != '\\') {
         args[i] = towstring(_latex[_pos]);
         _pos++;
@@ -475,7 +564,7 @@ bool TeXParser::isValidName(const wstring& com) const {
 
 sptr<Atom> TeXParser::processEscape() {
   _spos = _pos;
-  const wstring command = getCommand();
+  const wstring& command = getCommand();
 
   if (command.length() == 0) return sptrOf<EmptyAtom>();
 
@@ -511,6 +600,8 @@ sptr<Atom> TeXParser::processCommands(const wstring& cmd, MacroInfo* mac) {
   args[0] = cmd;
 
   if (NewCommandMacro::isMacro(cmd)) {
+    profile_phase(macro);
+    profile_count(_macros);
     // The last value in "args" is the replacement string
     auto ret = mac->invoke(*this, args);
     insert(_spos, _pos, args.back());
@@ -597,19 +688,13 @@ sptr<Atom> TeXParser::getArgument() {
   else return sptrOf<EmptyAtom>();
 
   if (ch == L_GROUP) {
-    Formula tf;
-    Formula* tmp = _formula;
-    _formula = &tf;
-    _pos++;
-    _group++;
-    parse();
-    _formula = tmp;
+    auto atom = parseGroup();
     if (_formula->_root == nullptr) {
       auto* rm = new RowAtom();
-      rm->add(tf._root);
+      rm->add(atom);
       return sptr<Atom>(rm);
     }
-    return tf._root;
+    return atom;
   }
 
   if (ch == ESCAPE) {
@@ -645,26 +730,24 @@ pair<UnitType, float> TeXParser::getLength() {
 
 bool TeXParser::replaceScript() {
   wchar_t ch = _latex[_pos];
+  const char* cmd = nullptr;
   auto it = SUP_SCRIPT_MAP.find(ch);
   if (it != SUP_SCRIPT_MAP.end()) {
-    wstring sup = wstring(L"\\mathcumsup{").append(1, (wchar_t) (it->second)).append(L"}");
-    _latex.replace(_pos, 1, sup);
-    _len = _latex.length();
-    _pos += sup.size();
-    return true;
-  }
-  it = SUB_SCRIPT_MAP.find(ch);
-  if (it != SUB_SCRIPT_MAP.end()) {
-    wstring sub = wstring(L"\\mathcumsub{").append(1, (wchar_t) (it->second)).append(L"}");
-    _latex.replace(_pos, 1, sub);
-    _len = _latex.length();
-    _pos += sub.size();
-    return true;
+    cmd = "\\mathcumsup{";
+  } else if ((it = SUB_SCRIPT_MAP.find(ch)) != SUB_SCRIPT_MAP.end()) {
+    cmd = "\\mathcumsub{";
+  } else {
+    return false;
   }
-  return false;
+  flush(_pos);
+  _srcMap.generate(_output.length(), sourcePos());
+  while (*cmd != '\0') _output.push_back(*cmd++);
+  _output.append(1, (wchar_t) (it->second)).append(1, R_GROUP);
+  _flushed = ++_pos;
+  return true;
 }
 
-void TeXParser::preprocess(wstring& cmd, Args& args, int& pos) {
+void TeXParser::preprocess(const wstring& cmd, Args& args, int& pos) {
   if (cmd == L"newcommand" || cmd == L"renewcommand") {
     preprocessNewCmd(cmd, args, pos);
   } else if (cmd == L"newenvironment" || cmd == L"renewenvironment") {
@@ -682,34 +765,33 @@ void TeXParser::preprocess(wstring& cmd, Args& args, int& pos) {
   }
 }
 
-void TeXParser::preprocessNewCmd(wstring& cmd, Args& args, int& pos) {
+void TeXParser::preprocessNewCmd(const wstring& cmd, Args& args, int& pos) {
   // The macro must exists
   auto mac = MacroInfo::get(cmd);
   getOptsArgs(mac->_argc, mac->_posOpts, args);
   mac->invoke(*this, args);
-  _latex.erase(pos, _pos - pos);
-  _len = _latex.length();
-  _pos = pos;
+  pushBack(pos, L"");
 }
 
-void TeXParser::inflateNewCmd(wstring& cmd, Args& args, int& pos) {
+void TeXParser::inflateNewCmd(const wstring& cmd, Args& args, int& pos) {
   // The macro must exists
   auto mac = MacroInfo::get(cmd);
   getOptsArgs(mac->_argc, mac->_posOpts, args);
   args[0] = cmd;
+  profile_phase(macro);
+  profile_count(_macros);
   try {
     mac->invoke(*this, args);
     // The last element is the returned value (after inflated macro)
-    _latex.replace(pos, _pos - pos, args.back());
+    pushBack(pos, args.back());
   } catch (ex_parse& e) {
     if (!_isPartial) throw;
-    pos += cmd.length() + 1;
+    // keep the command and go on after its name
+    _pos = pos + cmd.length() + 1;
   }
-  _len = _latex.length();
-  _pos = pos;
 }
 
-void TeXParser::inflateEnv(wstring& cmd, Args& args, int& pos) {
+void TeXParser::inflateEnv(const wstring& cmd, Args& args, int& pos) {
   getOptsArgs(1, 0, args);
   wstring env = args[1] + L"@env";
   auto mac = MacroInfo::get(env);
@@ -727,25 +809,74 @@ void TeXParser::inflateEnv(wstring& cmd, Args& args, int& pos) {
   wstring expr = L"{\\makeatletter \\" + args[1] + L"@env";
   for (int i = 1; i <= mac->_argc - 1; i++) expr += L"{" + optargs[i] + L"}";
   expr += L"{" + grp + L"}\\makeatother}";
-  _latex.replace(pos, _pos - pos, expr);
-  _len = _latex.length();
-  _pos = pos;
+  pushBack(pos, expr);
+}
+
+int TeXParser::sourcePos() const {
+  if (!_preprocessing) return _srcMap.sourceOf(_pos);
+  return _pos < _genEnd ? _genSrc : _pos + _inputToSrc;
+}
+
+void TeXParser::flush(int end) {
+  if (end <= _flushed) return;
+  int pos = _flushed;
+  if (pos < _genEnd) {
+    const int genEnd = min(end, _genEnd);
+    _srcMap.generate(_output.length(), _genSrc);
+    _output.append(_latex, pos, genEnd - pos);
+    pos = genEnd;
+  }
+  if (pos < end) {
+    _srcMap.copy(_output.length(), pos + _inputToSrc);
+    _output.append(_latex, pos, end - pos);
+  }
+  _flushed = end;
+}
+
+void TeXParser::pushBack(int from, const wstring& str) {
+  flush(from);
+  const bool generated = from < _genEnd;
+  const int src = generated ? _genSrc : from + _inputToSrc;
+  const int len = str.length();
+  if (len > _pos) {
+    // no room before the current position, grow the input at the front, reserve
+    // as much as the remaining input to amortize the following expansions
+    const int shift = len + (_len - _pos);
+    wstring input(shift, L' ');
+    input.append(_latex, _pos, wstring::npos);
+    _latex = std::move(input);
+    _len = _latex.length();
+    _inputToSrc -= shift - _pos;
+    _genEnd = _genEnd > _pos ? _genEnd + shift - _pos : 0;
+    _pos = shift;
+  }
+  // the input before _pos is consumed, overwrite it
+  const int start = _pos - len;
+  _latex.replace(start, len, str);
+  if (!generated) _genSrc = src;
+  _genEnd = max(_genEnd, _pos);
+  _pos = _flushed = start;
 }
 
 void TeXParser::preprocess() {
   if (_len == 0) return;
+  _preprocessing = true;
+  _output.clear();
+  _output.reserve(_len);
+  _flushed = _genEnd = _genSrc = _inputToSrc = 0;
 
   wchar_t ch;
   int spos;
   vector<wstring> args;
   while (_pos < _len) {
-    if (replaceScript()) continue;
-
     ch = _latex[_pos];
+    // the script characters are not in the Latin-1 range below 0xb2
+    if (ch >= 0xb2 && replaceScript()) continue;
+
     switch (ch) {
       case ESCAPE: {
         spos = _pos;
-        wstring cmd = getCommand();
+        const wstring& cmd = getCommand();
         try {
           preprocess(cmd, args, spos);
         } catch (ex_parse& e) {
@@ -755,21 +886,18 @@ void TeXParser::preprocess() {
         break;
       }
       case PERCENT: {
-        spos = _pos++;
-        wchar_t chr;
-        while (_pos < _len) {
-          chr = _latex[_pos++];
-          if (chr == '\r' || chr == '\n') break;
-        }
-        if (_pos < _len) _pos--;
-        _latex.replace(spos, _pos - spos, L"");
-        _len = _latex.length();
-        _pos = spos;
+        // drop the comment, the line break is kept unless it is the last character
+        flush(_pos);
+        int end = _pos + 1;
+        while (end < _len && _latex[end] != '\r' && _latex[end] != '\n') end++;
+        if (end == _len - 1) end++;
+        _pos = _flushed = end;
         break;
       }
       case DEGRE: {
-        _latex.replace(_pos, 1, L"^{\\circ}");
-        _len = _latex.length();
+        _pos++;
+        pushBack(_pos - 1, L"^{\\circ}");
+        // skip the '^'
         _pos++;
         break;
       }
@@ -778,8 +906,77 @@ void TeXParser::preprocess() {
         break;
     }
   }
+  flush(_len);
+  _latex = std::move(_output);
+  _output = wstring();
+  _lexer.reset();
   _pos = 0;
   _len = _latex.length();
+  _preprocessing = false;
+}
+
+GroupCache::Key TeXParser::groupKey(wstring_view src, bool inPlace) const {
+  const u8 flags = (_isMathMode ? GroupCache::mathMode : 0)
+                   | (_isPartial ? GroupCache::partial : 0)
+                   | (_atIsLetter != 0 ? GroupCache::atLetter : 0)
+                   | (_arrayMode ? GroupCache::arrayMode : 0)
+                   | (inPlace ? GroupCache::inPlace : 0);
+  return {src, _formula->_textStyle, Context::current().getGeneration(), flags};
+}
+
+void TeXParser::parseInPlace(Formula& formula) {
+  Formula* tmp = _formula;
+  _formula = &formula;
+  _pos++;
+  _group++;
+  // the formula is on the stack of the caller, restore the enclosing one
+  // even if the parse fails, the parser may be reused
+  try {
+    parse();
+  } catch (...) {
+    _formula = tmp;
+    throw;
+  }
+  _formula = tmp;
+}
+
+sptr<Atom> TeXParser::parseGroup() {
+  // the contents of the group are known only if lexed
+  const Token* open = _groupCache == nullptr ? nullptr : token(_pos);
+  const int close = open == nullptr ? -1 : _lexer.matchOf(*open);
+  const int len = close - _pos - 1;
+  if (len < (int) GroupCache::MIN_LENGTH) {
+    Formula tf;
+    parseInPlace(tf);
+    return tf._root;
+  }
+
+  const int start = _pos + 1;
+  auto atom = _groupCache->get(groupKey(wstring_view(_latex).substr(start, len), true));
+  if (atom != nullptr) {
+    _pos = close + 1;
+    return atom;
+  }
+  // the source may be changed by the parse (e.g. an insertion), keep a copy
+  const wstring src = _latex.substr(start, len);
+  const auto key = groupKey(src, true);
+  const int group = _group;
+  const bool outOfGroup = _outOfGroup;
+  _outOfGroup = false;
+  Formula tf;
+  parseInPlace(tf);
+  // do not cache the groups with side effects on the parser or the context,
+  // the groups not closed by their own '}' (e.g. taken as a script), or the
+  // groups that read the input beyond their '}'
+  const bool cacheable = tf._root != nullptr
+                         && !_outOfGroup
+                         && tf._middle.empty()
+                         && _group == group
+                         && _pos == close + 1
+                         && _latex.compare(start, len, src) == 0
+                         && groupKey(src, true) == key;
+  _outOfGroup = _outOfGroup || outOfGroup;
+  return cacheable ? _groupCache->put(key, tf._root) : tf._root;
 }
 
 void TeXParser::parse() {
@@ -789,14 +986,40 @@ void TeXParser::parse() {
     return;
   }
 
+  // an argument parsed by a sub-parser is cached as a whole
+  const bool cacheable = _groupCache != nullptr
+                         && _inherited
+                         && _pos == 0
+                         && _group == 0
+                         && !_arrayMode
+                         && _formula->_root == nullptr
+                         && _len >= (int) GroupCache::MIN_LENGTH;
+  if (!cacheable) {
+    parseInput();
+    return;
+  }
+
+  auto atom = _groupCache->get(groupKey(_latex, false));
+  if (atom != nullptr) {
+    _formula->_root = atom;
+    _pos = _len;
+    return;
+  }
+  const wstring src = _latex;
+  const auto key = groupKey(src, false);
+  parseInput();
+  if (_formula->_root != nullptr && _formula->_middle.empty() && groupKey(src, false) == key) {
+    _formula->_root = _groupCache->put(key, _formula->_root);
+  }
+}
+
+void TeXParser::parseInput() {
   wchar_t ch;
   while (_pos < _len) {
     ch = _latex[_pos];
 
     switch (ch) {
       case '\n':
-        _line++;
-        _col = _pos;
       case '\t':
       case '\r':
         _pos++;
@@ -840,12 +1063,16 @@ void TeXParser::parse() {
         sptr<Atom> atom = processEscape();
         _formula->add(atom);
         auto* h = dynamic_cast<HlineAtom*>(atom.get());
-        if (_arrayMode && h != nullptr) ((ArrayFormula*) _formula)->addRow();
+        if (h != nullptr && isInArray()) ((ArrayFormula*) _formula)->addRow();
         if (_insertion) _insertion = false;
       }
         break;
       case L_GROUP: {
         auto atom = getArgument();
+        // the symbols are shared, copy it before changing its type
+        if (dynamic_cast<SymbolAtom*>(atom.get()) != nullptr) {
+          atom = sptrOf<SymbolAtom>(*std::static_pointer_cast<SymbolAtom>(atom));
+        }
         if (atom != nullptr) atom->_type = AtomType::ordinary;
         _formula->add(atom);
       }
@@ -873,7 +1100,7 @@ void TeXParser::parse() {
       }
         break;
       case '&': {
-        if (!_arrayMode) {
+        if (!isInArray()) {
           throw ex_parse("Character '&' is only available in array mode!");
         }
         ((ArrayFormula*) _formula)->addCol();
@@ -1006,7 +1233,8 @@ sptr<Atom> TeXParser::convertCharacter(wchar_t c, bool oneChar) {
       if (!_isMathMode) {
         auto it = Formula::_symbolTextMappings.find(c);
         if (it != Formula::_symbolTextMappings.end()) {
-          auto atom = SymbolAtom::get(it->second);
+          // copy the builtin symbol, it's shared by all the contexts
+          auto atom = sptrOf<SymbolAtom>(*SymbolAtom::get(it->second));
           atom->setUnicode(c);
           return atom;
         }
@@ -1035,8 +1263,9 @@ sptr<Atom> TeXParser::convertCharacter(wchar_t c, bool oneChar) {
        * Alphanumeric character
        */
     FontInfos* infos = nullptr;
-    auto it = Formula::_externalFontMap.find(UnicodeBlock::BASIC_LATIN);
-    if (it != Formula::_externalFontMap.end()) {
+    const auto& fonts = Context::current()._externalFonts;
+    auto it = fonts.find(UnicodeBlock::BASIC_LATIN);
+    if (it != fonts.end()) {
       infos = it->second;
       if (oneChar) return sptrOf<TextRenderingAtom>(towstring(c), infos);
 
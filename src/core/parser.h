@@ -1,11 +1,15 @@
 #ifndef PARSER_H_INCLUDED
 #define PARSER_H_INCLUDED
 
+#include <deque>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "atom/atom.h"
 #include "common.h"
+#include "core/group_cache.h"
+#include "core/lexer.h"
 
 namespace tex {
 
@@ -21,20 +25,78 @@ class Formula;
 
 class MacroInfo;
 
+/**
+ * Map from the offsets of a preprocessed parse string to the offsets of the
+ * string given by the user, used to report the positions of the errors. The
+ * text copied from the given string maps to its origin, the text generated
+ * (e.g. the expansion of a macro) maps to the position where it is generated.
+ */
+class SourceMap {
+private:
+  struct Span {
+    // offset in the preprocessed string and in the given string
+    int _pos, _src;
+    bool _copied;
+  };
+
+  std::vector<Span> _spans;
+  // offsets of the line breaks of the given string
+  std::vector<int> _lines;
+
+public:
+  /** Reset to the identity map of the given string */
+  void reset(const std::wstring& src);
+
+  /** Add a span of text copied from the given string */
+  void copy(int pos, int src);
+
+  /** Add a span of generated text */
+  void generate(int pos, int src);
+
+  /** Get the offset in the given string of the given offset */
+  int sourceOf(int pos) const;
+
+  /** Get the line (0 based) of the given offset in the given string */
+  int lineOf(int src) const;
+
+  /** Get the column (0 based) of the given offset in the given string */
+  int colOf(int src) const;
+};
+
 /** This class implements a parser for latex formulas */
 class TeXParser {
 private:
   std::wstring _latex;
+  Lexer _lexer;
+  // names of the commands not interned since the pool is full
+  std::deque<std::wstring> _names;
   int _pos, _spos, _len;
-  int _line, _col;
+  SourceMap _srcMap;
+  // state of the preprocess, the input is _latex from _pos, the text before
+  // _flushed is either copied into _output or dropped. The input before
+  // _genEnd is generated at _genSrc, the one after _genEnd is copied from the
+  // given string with offset + _inputToSrc.
+  std::wstring _output;
+  int _flushed, _genEnd, _genSrc, _inputToSrc;
   int _group;
   int _atIsLetter;
   bool _insertion;
+  // the preprocess changes the source frequently, so it does not use the lexer
+  bool _preprocessing;
   bool _arrayMode;
   bool _isMathMode;
   bool _isPartial;
   bool _hideUnknownChar;
-
+  // the groups cached by the incremental formula, nullptr if not incremental
+  GroupCache* _groupCache = nullptr;
+  // if the input string is an argument of another parser, see inherit
+  bool _inherited = false;
+  // if the parse read the input beyond the current group (see
+  // forwardBalancedGroup), such a group depends on its context and is not cached
+  bool _outOfGroup = false;
+
+  /** the min length of a source to be lexed */
+  static const int MIN_LEX_LENGTH;
   /** escape character */
   static const wchar_t ESCAPE;
   /** grouping characters (for parsing) */
@@ -59,15 +121,64 @@ private:
 
   static const std::set<std::wstring> _unparsedContents;
 
-  /** Preprocess parse string */
+  /**
+   * Preprocess parse string, strip the comments and expand the user-defined
+   * macros and environments in a single forward pass
+   */
   void preprocess();
 
+  /** Copy the input before the given offset into the output of the preprocess */
+  void flush(int end);
+
+  /**
+   * Replace the input in [from, _pos) with the given string that will be
+   * preprocessed again, used by the preprocess to expand the macros
+   */
+  void pushBack(int from, const std::wstring& str);
+
+  /** Get the offset in the given string of the current position */
+  int sourcePos() const;
+
   sptr<Atom> getScripts(wchar_t first);
 
-  std::wstring getCommand();
+  /**
+   * Get the name of the command at the current position and forward, the
+   * name remains valid during the lifetime of the parser
+   */
+  const std::wstring& getCommand();
+
+  /**
+   * Get the token starting at the given position, the source is lexed if it
+   * is changed. Return nullptr if no token starts at the position, during the
+   * preprocess or if the source is too short to be worth lexing, the callers
+   * scan the source in that case.
+   */
+  inline const Token* token(int pos) {
+    if (_preprocessing) return nullptr;
+    if (!_lexer.isLexed()) {
+      if (_len < MIN_LEX_LENGTH) return nullptr;
+      _lexer.lex(_latex);
+    }
+    return _lexer.at(pos);
+  }
 
   sptr<Atom> processEscape();
 
+  /** Get the key of the given group within the current state */
+  GroupCache::Key groupKey(std::wstring_view src, bool inPlace) const;
+
+  /** Parse the group at the current position into the given formula */
+  void parseInPlace(Formula& formula);
+
+  /**
+   * Parse the group embraced by '{' and '}' at the current position and
+   * forward, the group is taken from the group cache if cached
+   */
+  sptr<Atom> parseGroup();
+
+  /** Parse the input string from the current position */
+  void parseInput();
+
   void insert(int beg, int end, const std::wstring& formula);
 
   /**
@@ -86,16 +197,16 @@ private:
 
   void skipWhiteSpace();
 
-  /** Replace the script-characters with command. */
+  /** Replace the script-characters with command into the output of the preprocess. */
   bool replaceScript();
 
-  void preprocess(std::wstring& cmd, Args& args, int& pos);
+  void preprocess(const std::wstring& cmd, Args& args, int& pos);
 
-  void preprocessNewCmd(std::wstring& cmd, Args& args, int& pos);
+  void preprocessNewCmd(const std::wstring& cmd, Args& args, int& pos);
 
-  void inflateNewCmd(std::wstring& cmd, Args& args, int& pos);
+  void inflateNewCmd(const std::wstring& cmd, Args& args, int& pos);
 
-  void inflateEnv(std::wstring& cmd, Args& args, int& pos);
+  void inflateEnv(const std::wstring& cmd, Args& args, int& pos);
 
   void init(
     bool isPartial,
@@ -183,17 +294,37 @@ public:
     _isMathMode = isMathMode;
   }
 
+  /**
+   * Share the tokens of the given parser if the parse string of this parser
+   * is an argument taken by the given parser, must be called before parse
+   */
+  inline void inherit(const TeXParser& parent) {
+    if (!_lexer.isLexed()) _lexer.share(parent._lexer, parent._latex, _latex);
+    _groupCache = parent._groupCache;
+    _inherited = true;
+  }
+
+  /** Set the cache of the groups parsed, nullptr to disable the cache */
+  inline void setGroupCache(GroupCache* cache) { _groupCache = cache; }
+
   /** Reset the parser with a new latex expression */
   void reset(const std::wstring& latex);
 
   /** Return true if we get a partial formula */
   inline bool isPartial() const { return _isPartial; }
 
-  /** Get the number of the current line */
-  inline int getLine() const { return _line; }
+  /**
+   * Get the number (0 based) of the current line in the given string. The
+   * text generated by a macro is on the line where the macro is used.
+   */
+  inline int getLine() const { return _srcMap.lineOf(sourcePos()); }
 
-  /** Get the number of the current column */
-  inline int getCol() const { return _pos - _col - 1; }
+  /**
+   * Get the number (0 based) of the current column in the given string, thus
+   * the column just after the command that reports an error. The text
+   * generated by a macro is at the column where the macro is used.
+   */
+  inline int getCol() const { return _srcMap.colOf(sourcePos()); }
 
   /** Get and remove the last atom of the current formula */
   sptr<Atom> popLastAtom() const;
@@ -216,6 +347,12 @@ public:
   /** Test if the parser is used to parse an array or not */
   inline bool isArrayMode() const { return _arrayMode; }
 
+  /**
+   * Test if the parser is parsing the cells of an array, false if in a group
+   * of a cell (the rows and the columns can not be added there)
+   */
+  bool isInArray() const;
+
   /** Test if the parser is in math mode  */
   inline bool isMathMode() const { return _isMathMode; }
 
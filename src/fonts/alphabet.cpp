@@ -1,5 +1,6 @@
 #include "fonts/alphabet.h"
 #include "common.h"
+#include "res/reg/builtin_alphabet_reg.h"
 
 using namespace tex;
 
@@ -55,6 +56,10 @@ const UnicodeBlock& UnicodeBlock::of(wchar_t c) {
 
 /*********************************** alphabet implementation **************************/
 
+__reg_alphabet_func AlphabetRegistration::getCompiled() const {
+  return nullptr;
+}
+
 AlphabetRegistration::~AlphabetRegistration() {}
 
 const std::vector<UnicodeBlock> CyrillicRegistration::_block = {UnicodeBlock::CYRILLIC};
@@ -73,6 +78,10 @@ const std::string CyrillicRegistration::getTeXFontFile() const {
   return RES_BASE + "/" + _font;
 }
 
+__reg_alphabet_func CyrillicRegistration::getCompiled() const {
+  return __alphabet_reg(Cyrillic);
+}
+
 const std::vector<UnicodeBlock> GreekRegistration::_block = {
     UnicodeBlock::GREEK,
     UnicodeBlock::GREEK_EXTENDED};
@@ -91,3 +100,7 @@ const std::string GreekRegistration::getPackage() const {
 const std::string GreekRegistration::getTeXFontFile() const {
   return RES_BASE + "/" + _font;
 }
+
+__reg_alphabet_func GreekRegistration::getCompiled() const {
+  return __alphabet_reg(Greek);
+}
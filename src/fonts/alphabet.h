@@ -6,6 +6,9 @@
 
 namespace tex {
 
+/** Alphabet registration function, generated by prebuilt/alphabet_def.py */
+typedef void (*__reg_alphabet_func)(void);
+
 class UnicodeBlock {
 private:
   static std::vector<const UnicodeBlock*> _defined;
@@ -45,6 +48,13 @@ public:
 
   virtual const std::string getTeXFontFile() const = 0;
 
+  /**
+   * Get the function to register the alphabet from the tables compiled into
+   * the library, or nullptr to parse the XML descriptions of the alphabet
+   * (see #getTeXFontFile()) at runtime. Default returns nullptr.
+   */
+  virtual __reg_alphabet_func getCompiled() const;
+
   virtual ~AlphabetRegistration();
 };
 
@@ -60,6 +70,8 @@ public:
   const std::string getPackage() const override;
 
   const std::string getTeXFontFile() const override;
+
+  __reg_alphabet_func getCompiled() const override;
 };
 
 class GreekRegistration : public AlphabetRegistration {
@@ -74,8 +86,16 @@ public:
   const std::string getPackage() const override;
 
   const std::string getTeXFontFile() const override;
+
+  __reg_alphabet_func getCompiled() const override;
 };
 
 }  // namespace tex
 
+#define __alphabet_reg(name) \
+  __reg_alphabet_##name
+
+#define DECL_ALPHABET_REG(name) \
+  extern void __alphabet_reg(name)()
+
 #endif  // ALPHABET_H_INCLUDED
@@ -1,15 +1,10 @@
 #include "fonts/font_basic.h"
+#include "fonts/font_info.h"
 
 using namespace tex;
 
-Char::Char(wchar_t c, const Font* f, int fc, const sptr<Metrics>& m)
-    : _c(c), _fontCode(fc), _font(f), _m(m), _cf(new CharFont(_c, _fontCode)) {}
-
-Extension::~Extension() {
-  if (hasTop()) delete _top;
-  if (hasMiddle()) delete _middle;
-  if (hasRepeat()) delete _repeat;
-  if (hasBottom()) delete _bottom;
+const Font* Char::getFont() const {
+  return FontInfo::getFont(_cf.fontId);
 }
 
 #ifdef HAVE_LOG
@@ -4,21 +4,28 @@
 #include "common.h"
 #include "graphic/graphic.h"
 
+#include <optional>
+#include <type_traits>
+
 namespace tex {
 
-/** Contains the metrics for 1 character: width, height, depth and italic correction */
+/**
+ * Contains the metrics for 1 character: width, height, depth and italic correction.
+ * It is trivially copyable, pass it by value.
+ */
 struct Metrics {
   float width, height, depth, italic, size;
 
   Metrics() = delete;
 
-  Metrics(const Metrics&) = delete;
-
   explicit Metrics(float w, float h, float d, float i, float factor, float s)
     : width(w * factor), height(h * factor), depth(d * factor), italic(i * factor), size(s) {}
 };
 
-/** Represents a specific character in a specific font (identified by its font id) */
+/**
+ * Represents a specific character in a specific font (identified by its font id).
+ * It is trivially copyable, pass it by value.
+ */
 struct CharFont {
   wchar_t chr;
   int fontId, boldFontId;
@@ -36,65 +43,75 @@ struct CharFont {
 #endif
 };
 
-/** Class represents a character together with its font, font id and metric information */
+/**
+ * Class represents a character together with its font id and metric information.
+ * The metrics come from the builtin tables, the platform font is created only
+ * when it is required (i.e. to draw), see getFont. It is trivially copyable,
+ * pass it by value.
+ */
 class Char {
 private:
-  wchar_t _c;
-  int _fontCode;
-  const Font* _font;
-  sptr<CharFont> _cf;
-  sptr<Metrics> _m;
+  CharFont _cf;
+  Metrics _m;
 
 public:
   Char() = delete;
 
-  Char(wchar_t c, const Font* f, int fc, const sptr<Metrics>& m);
+  Char(wchar_t c, int fc, const Metrics& m) : _cf(c, fc), _m(m) {}
 
-  sptr<CharFont> getCharFont() const { return _cf; }
+  inline const CharFont& getCharFont() const { return _cf; }
 
-  inline wchar_t getChar() const { return _c; }
+  inline wchar_t getChar() const { return _cf.chr; }
 
-  inline const Font* getFont() const { return _font; }
+  /** Get the platform font of this character, it is created by the first call */
+  const Font* getFont() const;
 
-  inline int getFontCode() const { return _fontCode; }
+  inline int getFontCode() const { return _cf.fontId; }
 
-  inline float getWidth() const { return _m->width; }
+  inline float getWidth() const { return _m.width; }
 
-  inline float getItalic() const { return _m->italic; }
+  inline float getItalic() const { return _m.italic; }
 
-  inline float getHeight() const { return _m->height; }
+  inline float getHeight() const { return _m.height; }
 
-  inline float getDepth() const { return _m->depth; }
+  inline float getDepth() const { return _m.depth; }
 
-  inline float getSize() const { return _m->size; }
+  inline float getSize() const { return _m.size; }
 };
 
+static_assert(std::is_trivially_copyable<Metrics>::value, "Metrics must be trivially copyable");
+static_assert(std::is_trivially_copyable<CharFont>::value, "CharFont must be trivially copyable");
+static_assert(std::is_trivially_copyable<Char>::value, "Char must be trivially copyable");
+
 /**
  * Represents an extension character that is defined by Char-objects of it's 4
- * possible parts (null means part not present).
+ * possible parts (empty means part not present). It is a value, pass it by
+ * value or by reference.
  */
 class Extension {
 private:
-  const Char* const _top;
-  const Char* const _middle;
-  const Char* const _bottom;
-  const Char* const _repeat;
+  std::optional<Char> _top;
+  std::optional<Char> _middle;
+  std::optional<Char> _repeat;
+  std::optional<Char> _bottom;
 
 public:
   Extension() = delete;
 
-  Extension(const Extension&) = delete;
+  Extension(
+    const std::optional<Char>& t,
+    const std::optional<Char>& m,
+    const std::optional<Char>& r,
+    const std::optional<Char>& b
+  ) : _top(t), _middle(m), _repeat(r), _bottom(b) {}
 
-  Extension(Char* t, Char* m, Char* r, Char* b)
-    : _top(t), _middle(m), _repeat(r), _bottom(b) {}
+  inline bool hasTop() const { return _top.has_value(); }
 
-  inline bool hasTop() const { return _top != nullptr; }
+  inline bool hasMiddle() const { return _middle.has_value(); }
 
-  inline bool hasMiddle() const { return _middle != nullptr; }
+  inline bool hasBottom() const { return _bottom.has_value(); }
 
-  inline bool hasBottom() const { return _bottom != nullptr; }
-
-  inline bool hasRepeat() const { return _repeat != nullptr; }
+  inline bool hasRepeat() const { return _repeat.has_value(); }
 
   inline const Char& getTop() const { return *_top; }
 
@@ -103,8 +120,6 @@ public:
   inline const Char& getRepeat() const { return *_repeat; }
 
   inline const Char& getBottom() const { return *_bottom; }
-
-  ~Extension();
 };
 
 }  // namespace tex
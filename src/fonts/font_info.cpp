@@ -1,6 +1,5 @@
 #include "fonts/font_info.h"
 
-#include "core/formula.h"
 #include "fonts/font_reg.h"
 
 using namespace std;
@@ -8,19 +7,46 @@ using namespace tex;
 
 vector<FontInfo*> FontInfo::_infos;
 vector<string>    FontInfo::_names;
+mutex             FontInfo::_fontMutex;
 
 void FontInfo::__register(const FontSet& set) {
   const vector<FontReg>& regs = set.regs();
   for (auto r : regs) __predefine_name(r.name);
-  for (auto r : regs) r.reg();
+  // the slots are taken now, the infos never move when they are loaded
+  for (auto r : regs) __add(new FontInfo(__id(r.name), r.reg));
+}
+
+FontInfo* FontInfo::__create(int id, const string& path, float xHeight, float space, float quad) {
+  if ((size_t) id < _infos.size() && _infos[id] != nullptr) {
+    // being loaded by FontInfo::load
+    FontInfo* i = _infos[id];
+    i->_path = path;
+    i->_xHeight = xHeight;
+    i->_space = space;
+    i->_quad = quad;
+    return i;
+  }
+  auto i = new FontInfo(id, path, xHeight, space, quad);
+  __add(i);
+  return i;
+}
+
+void FontInfo::load() {
+  // the contexts may ask for the same font from different threads
+  call_once(_once, [this]() {
+    _reg();
+    _loaded.store(true, memory_order_release);
+  });
 }
 
 const float* const FontInfo::getMetrics(wchar_t ch) const {
-  return _metrics.isEmpty() ? nullptr : _metrics((float)ch) + 1;
+  const float* const item = _metrics((float)ch);
+  return item == nullptr ? nullptr : item + 1;
 }
 
 const int* const FontInfo::getExtension(wchar_t ch) const {
-  return _extensions.isEmpty() ? nullptr : _extensions((int)ch) + 1;
+  const int* const item = _extensions((int)ch);
+  return item == nullptr ? nullptr : item + 1;
 }
 
 //sptr<CharFont> FontInfo::getNextLarger(wchar_t ch) const {
@@ -55,12 +81,23 @@ void FontInfo::setVariousId(
 }
 
 const Font* FontInfo::getFont() {
-  if (_font == nullptr) _font = Font::create(_path, Formula::PIXELS_PER_POINT);
-  return _font;
+  const Font* font = _font.load(memory_order_acquire);
+  if (font != nullptr) return font;
+  // The font is shared by all the contexts and the platform may register the
+  // font file globally, so the creation is serialized, but only happens once.
+  // The font is created with size 1, the boxes scale it to the desired size.
+  lock_guard<mutex> lock(_fontMutex);
+  font = _font.load(memory_order_relaxed);
+  if (font == nullptr) {
+    font = Font::create(_path, 1.f);
+    _font.store(font, memory_order_release);
+  }
+  return font;
 }
 
 FontInfo::~FontInfo() {
-  if (_font != nullptr) delete _font;
+  const Font* font = _font.load();
+  if (font != nullptr) delete font;
 }
 
 void FontInfo::__free() {
@@ -3,9 +3,13 @@
 
 #include "common.h"
 #include "fonts/font_basic.h"
+#include "fonts/font_reg.h"
 #include "graphic/graphic.h"
 #include "utils/indexed_arr.h"
 
+#include <atomic>
+#include <mutex>
+
 namespace tex {
 
 class FontSet;
@@ -14,10 +18,15 @@ class FontInfo {
 private:
   static std::vector<FontInfo*> _infos;
   static std::vector<std::string> _names;
+  static std::mutex _fontMutex;
 
   const int _id;    // id of this font info
-  const Font* _font;  // font of this info
-  const std::string _path;  // font file path
+  std::atomic<const Font*> _font;  // font of this info, created on first use
+  std::string _path;  // font file path
+  // the function to fill this info on first use, nullptr if already filled
+  __reg_font_func _reg;
+  std::atomic<bool> _loaded;
+  std::once_flag _once;
 
   IndexedArray<int, 5, 1> _extensions;   // extensions for big delimiter
   IndexedArray<int, 3, 1> _nextLargers;  // largers, e.g. sigma
@@ -37,14 +46,24 @@ private:
   FontInfo(const FontInfo&);
 
   FontInfo(int id, const std::string& path, float xHeight, float space, float quad)
-    : _id(id), _path(path), _xHeight(xHeight), _space(space), _quad(quad) {
+    : _id(id), _path(path), _reg(nullptr), _xHeight(xHeight), _space(space), _quad(quad) {
     // default various ids
     _boldId = _romanId = _ssId = _ttId = _itId = _id;
     // the skew char
     _skewChar = (wchar_t) -1;
     _font = nullptr;
+    _loaded = true;
+  }
+
+  /** Create an empty info filled by the given registration function on first use */
+  FontInfo(int id, __reg_font_func reg) : FontInfo(id, "", 0, 0, 0) {
+    _reg = reg;
+    _loaded = false;
   }
 
+  /** Fill this info by the registration function, only once */
+  void load();
+
   static void __add(FontInfo* info) {
     if (info->_id >= _infos.size()) _infos.resize(info->_id + 1);
     _infos[info->_id] = info;
@@ -57,13 +76,13 @@ private:
 
 public:
   /************************************** INTERNAL USE ******************************************/
+  /**
+   * Create the info with given id, or fill the info registered by a font set
+   * if it is being loaded (see #__register(const FontSet&)).
+   */
   static FontInfo* __create(
     int id, const std::string& path,
-    float xHeight = 0, float space = 0, float quad = 0) {
-    auto i = new FontInfo(id, path, xHeight, space, quad);
-    __add(i);
-    return i;
-  }
+    float xHeight = 0, float space = 0, float quad = 0);
 
   static void __predefine_name(const std::string& name) { _names.push_back(name); }
 
@@ -71,8 +90,17 @@ public:
 
   static inline const std::vector<FontInfo*>& __infos() { return _infos; }
 
-  static inline FontInfo* __get(int id) { return _infos[id]; }
+  /** Get the info with given id, the info is loaded if it has not been loaded yet */
+  static inline FontInfo* __get(int id) {
+    FontInfo* info = _infos[id];
+    if (!info->_loaded.load(std::memory_order_acquire)) info->load();
+    return info;
+  }
 
+  /**
+   * Register the fonts of the given set, the names are defined immediately
+   * but the font descriptions are loaded on the first use of every font.
+   */
   static void __register(const FontSet& set);
 
   static void __free();
@@ -121,22 +149,20 @@ public:
 
   const int* const getExtension(wchar_t ch) const;
 
-  // FIXME
-  // workaround for the MSVC's LNK2019 error
-  // it should be implemented in the font_info.cpp file
-  sptr<CharFont> getNextLarger(wchar_t ch) const {
-    const int* const item = _nextLargers((int) ch);
-    if (item == nullptr) return nullptr;
-    return sptrOf<CharFont>(item[1], item[2]);
+  /**
+   * Get the next larger item of the given character: {char, larger char, font id},
+   * return nullptr if not found
+   */
+  inline const int* const getNextLarger(wchar_t ch) const {
+    return _nextLargers((int) ch);
   }
 
-  // FIXME
-  // workaround for the MSVS's LNK2019 error
-  // it should be implemented in the font_info.cpp file
-  sptr<CharFont> getLigture(wchar_t left, wchar_t right) const {
-    const wchar_t* const item = _lig(left, right);
-    if (item == nullptr) return nullptr;
-    return sptrOf<CharFont>(item[2], _id);
+  /**
+   * Get the ligature item of the given characters: {left, right, ligature},
+   * return nullptr if not found
+   */
+  inline const wchar_t* const getLigture(wchar_t left, wchar_t right) const {
+    return _lig(left, right);
   }
 
   float getKern(wchar_t left, wchar_t right, float factor) const;
@@ -177,7 +203,7 @@ public:
   ~FontInfo();
 
   inline static const Font* getFont(int id) {
-    return _infos[id]->getFont();
+    return __get(id)->getFont();
   }
 
 #ifdef HAVE_LOG
@@ -16,7 +16,25 @@ const int TeXFont::NO_FONT = -1;
 string* DefaultTeXFont::_defaultTextStyleMappings;
 map<string, vector<CharFont*>> DefaultTeXFont::_textStyleMappings;
 map<string, CharFont*> DefaultTeXFont::_symbolMappings;
+vector<string> DefaultTeXFont::_builtinSymbolNames;
+vector<CharFont> DefaultTeXFont::_builtinSymbols;
+PerfectHash<char> DefaultTeXFont::_builtinSymbolTable;
+atomic<bool> DefaultTeXFont::_builtinSymbolsReady(false);
+mutex DefaultTeXFont::_builtinSymbolsMutex;
 map<string, float> DefaultTeXFont::_generalSettings;
+const char* const DefaultTeXFont::_paramNames[TEX_PARAM_COUNT] = {
+  "num1", "num2", "num3",
+  "denom1", "denom2",
+  "sup1", "sup2", "sup3",
+  "sub1", "sub2",
+  "supdrop", "subdrop",
+  "axisheight",
+  "defaultrulethickness",
+  "bigopspacing1", "bigopspacing2", "bigopspacing3", "bigopspacing4", "bigopspacing5",
+};
+float DefaultTeXFont::_params[TEX_PARAM_COUNT];
+int DefaultTeXFont::_muFontId = 0;
+int DefaultTeXFont::_spaceFontId = 0;
 vector<UnicodeBlock> DefaultTeXFont::_loadedAlphabets;
 map<UnicodeBlock, AlphabetRegistration*> DefaultTeXFont::_registeredAlphabets;
 
@@ -38,8 +56,6 @@ const int DefaultTeXFont::MID = 1;
 const int DefaultTeXFont::REP = 2;
 const int DefaultTeXFont::BOT = 3;
 
-bool DefaultTeXFont::_magnificationEnable = true;
-
 TeXFont::~TeXFont() {}
 
 DefaultTeXFont::~DefaultTeXFont() {
@@ -55,7 +71,9 @@ void DefaultTeXFont::__register_symbols_set(const SymbolsSet& set) {
 void DefaultTeXFont::__push_symbols(const __symbol_component* symbols, const int len) {
   for (int i = 0; i < len; i++) {
     const __symbol_component& c = symbols[i];
-    _symbolMappings[c.name] = new CharFont(c.code, c.font);
+    CharFont*& cf = _symbolMappings[c.name];
+    delete cf;
+    cf = new CharFont(c.code, c.font);
   }
 }
 
@@ -67,30 +85,46 @@ void DefaultTeXFont::addTeXFontDescription(
   const auto x = parser.parseTextStyleMappings();
   _textStyleMappings.insert(x.begin(), x.end());
   parser.parseSymbolMappings(_symbolMappings);
+  Context::invalidateFonts();
+}
+
+bool DefaultTeXFont::isAlphabetLoaded(const vector<UnicodeBlock>& alphabet) {
+  for (const auto& block : alphabet) {
+    if (indexOf(_loadedAlphabets, block) != -1) return true;
+  }
+  return false;
 }
 
 void DefaultTeXFont::addAlphabet(
   const string& base,
   const vector<UnicodeBlock>& alphabet,
   const string& lang) {
-  bool b = false;
-  for (size_t i = 0; !b && i < alphabet.size(); i++) {
-    b = (indexOf(_loadedAlphabets, alphabet[i]) != -1) || b;
-  }
-  if (!b) {
-    TeXParser::_isLoading = true;
-    string file = lang;
-    addTeXFontDescription(base, file);
-    for (size_t i = 0; i < alphabet.size(); i++) {
-      _loadedAlphabets.push_back(alphabet[i]);
-    }
-    TeXParser::_isLoading = false;
-  }
+  if (isAlphabetLoaded(alphabet)) return;
+  // the alphabet lives as long as the library, may be loaded while parsing
+  ArenaScope noArena(nullptr);
+  TeXParser::_isLoading = true;
+  string file = lang;
+  addTeXFontDescription(base, file);
+  for (const auto& block : alphabet) _loadedAlphabets.push_back(block);
+  TeXParser::_isLoading = false;
+}
+
+void DefaultTeXFont::addAlphabet(const vector<UnicodeBlock>& alphabet, __reg_alphabet_func reg) {
+  if (isAlphabetLoaded(alphabet)) return;
+  ArenaScope noArena(nullptr);
+  reg();
+  for (const auto& block : alphabet) _loadedAlphabets.push_back(block);
+  Context::invalidateFonts();
 }
 
 void DefaultTeXFont::addAlphabet(AlphabetRegistration* reg) {
   try {
-    addAlphabet(reg->getPackage(), reg->getUnicodeBlock(), reg->getTeXFontFile());
+    const auto compiled = reg->getCompiled();
+    if (compiled != nullptr) {
+      addAlphabet(reg->getUnicodeBlock(), compiled);
+    } else {
+      addAlphabet(reg->getPackage(), reg->getUnicodeBlock(), reg->getTeXFontFile());
+    }
   } catch (ex_font_loaded& e) {
   } catch (ex_alphabet_registration& e) {
 #ifdef HAVE_LOG
@@ -104,6 +138,13 @@ void DefaultTeXFont::registerAlphabet(AlphabetRegistration* reg) {
   for (size_t i = 0; i < blocks.size(); i++) {
     _registeredAlphabets[blocks[i]] = reg;
   }
+  Context::invalidateFonts();
+}
+
+void DefaultTeXFont::loadRegisteredAlphabets() {
+  for (const auto& i : _registeredAlphabets) {
+    if (indexOf(_loadedAlphabets, i.first) == -1) addAlphabet(i.second);
+  }
 }
 
 sptr<TeXFont> DefaultTeXFont::copy() {
@@ -153,6 +194,7 @@ Char DefaultTeXFont::getChar(
 }
 
 Char DefaultTeXFont::getChar(const CharFont& c, TexStyle style) {
+  profile_count(_glyphs);
   CharFont cf = c;
   float fsize = getSizeFactor(style);
   int id = _isBold ? cf.boldFontId : cf.fontId;
@@ -192,105 +234,125 @@ Char DefaultTeXFont::getChar(const CharFont& c, TexStyle style) {
     info->getPath().c_str());
 #endif
 
-  return Char(cf.chr, info->getFont(), id, getMetrics(cf, _factor * fsize));
+  return Char(cf.chr, id, getMetrics(cf, _factor * fsize));
 }
 
 Char DefaultTeXFont::getChar(
   const string& symbolName, TexStyle style) {
-  // find first
-  auto i = _symbolMappings.find(symbolName);
+  __ensure_symbol_table();
+  if (!_symbolMappings.empty()) {
+    const auto i = _symbolMappings.find(symbolName);
+    if (i != _symbolMappings.end()) return getChar(*(i->second), style);
+  }
+  const int i = _builtinSymbolTable.find(symbolName);
   // no symbol mapping found
-  if (i == _symbolMappings.end()) throw ex_symbol_mapping_not_found(symbolName);
-  return getChar(*(i->second), style);
+  if (i < 0) throw ex_symbol_mapping_not_found(symbolName);
+  return getChar(_builtinSymbols[i], style);
 }
 
-sptr<Metrics> DefaultTeXFont::getMetrics(const CharFont& cf, float size) {
+Metrics DefaultTeXFont::getMetrics(const CharFont& cf, float size) {
   auto info = getInfo(cf.fontId);
   const float* m = info->getMetrics(cf.chr);
-  Metrics* met = new Metrics(
-    m[WIDTH], m[HEIGHT], m[DEPTH], m[IT], size * Formula::PIXELS_PER_POINT, size);
-  return sptr<Metrics>(met);
+  // the glyphs are drawn with fonts of size 1, the layout is in points and the
+  // point-to-pixel conversion is applied by the render
+  return Metrics(m[WIDTH], m[HEIGHT], m[DEPTH], m[IT], size, size);
 }
 
-Extension* DefaultTeXFont::getExtension(const Char& c, TexStyle style) {
-  const Font* f = c.getFont();
+Extension DefaultTeXFont::getExtension(const Char& c, TexStyle style) {
   int fc = c.getFontCode();
   float s = getSizeFactor(style);
   // construct Char for every part
   auto info = getInfo(fc);
   const int* ext = info->getExtension(c.getChar());
   // 4 parts of extensions, TOP, MID, REP, BOT
-  Char* parts[4] = {nullptr};
+  optional<Char> parts[4];
   for (int i = 0; i < 4; i++) {
-    if (ext[i] == NONE) {
-      parts[i] = nullptr;
-    } else {
-      auto m = getMetrics(CharFont(ext[i], fc), s);
-      parts[i] = new Char(ext[i], f, fc, m);
-    }
+    if (ext[i] != NONE) parts[i].emplace(ext[i], fc, getMetrics(CharFont(ext[i], fc), s));
   }
-  return new Extension(parts[TOP], parts[MID], parts[REP], parts[BOT]);
+  return Extension(parts[TOP], parts[MID], parts[REP], parts[BOT]);
 }
 
 float DefaultTeXFont::getKern(const CharFont& left, const CharFont& right, TexStyle style) {
   if (left.fontId == right.fontId) {
     auto info = getInfo(left.fontId);
-    return info->getKern(left.chr, right.chr, getSizeFactor(style) * Formula::PIXELS_PER_POINT);
+    return info->getKern(left.chr, right.chr, getEM(style));
   }
   return 0;
 }
 
-sptr<CharFont> DefaultTeXFont::getLigature(const CharFont& left, const CharFont& right) {
+optional<CharFont> DefaultTeXFont::getLigature(const CharFont& left, const CharFont& right) {
   if (left.fontId == right.fontId) {
     auto info = getInfo(left.fontId);
-    return info->getLigture(left.chr, right.chr);
+    const wchar_t* const item = info->getLigture(left.chr, right.chr);
+    if (item != nullptr) return CharFont(item[2], left.fontId);
   }
-  return nullptr;
+  return nullopt;
 }
 
 int DefaultTeXFont::getMuFontId() {
-  return _generalSettings[DefaultTeXFontParser::MUFONTID_ATTR];
+  return _muFontId;
 }
 
 Char DefaultTeXFont::getNextLarger(const Char& c, TexStyle style) {
   auto info = getInfo(c.getFontCode());
-  auto ch = info->getNextLarger(c.getChar());
-  auto newInfo = getInfo(ch->fontId);
-  return Char(ch->chr, newInfo->getFont(), ch->fontId, getMetrics(*ch, getSizeFactor(style)));
+  const int* const item = info->getNextLarger(c.getChar());
+  const CharFont ch(item[1], item[2]);
+  return Char(ch.chr, ch.fontId, getMetrics(ch, getSizeFactor(style)));
 }
 
 float DefaultTeXFont::getSpace(TexStyle style) {
-  int spaceFontId = _generalSettings[DefaultTeXFontParser::SPACEFONTID_ATTR];
-  auto info = getInfo(spaceFontId);
-  return info->getSpace(getSizeFactor(style) * Formula::PIXELS_PER_POINT);
+  auto info = getInfo(_spaceFontId);
+  return info->getSpace(getEM(style));
 }
 
 void DefaultTeXFont::setMathSizes(float ds, float ts, float ss, float sss) {
-  if (!_magnificationEnable) return;
-  _generalSettings["scriptfactor"] = abs(ss / ds);
-  _generalSettings["scriptscriptfactor"] = abs(sss / ds);
-  _generalSettings["textfactor"] = abs(ts / ds);
-  TeXRender::_defaultSize = abs(ds);
+  Context::current().setMathSizes(ds, ts, ss, sss);
 }
 
 void DefaultTeXFont::setMagnification(float mag) {
-  if (!_magnificationEnable) return;
-  TeXRender::_magFactor = mag / 1000.f;
+  Context::current().setMagnification(mag);
 }
 
 void DefaultTeXFont::enableMagnification(bool b) {
-  _magnificationEnable = b;
+  Context::current().enableMagnification(b);
 }
 
 #include "res/reg/builtin_font_reg.h"
 #include "res/reg/builtin_syms_reg.h"
 
+void DefaultTeXFont::__resolve_parameters() {
+  for (int i = 0; i < TEX_PARAM_COUNT; i++) _params[i] = getParameter(_paramNames[i]);
+  _muFontId = (int) getGeneralSetting(DefaultTeXFontParser::MUFONTID_ATTR);
+  _spaceFontId = (int) getGeneralSetting(DefaultTeXFontParser::SPACEFONTID_ATTR);
+}
+
+void DefaultTeXFont::__build_symbol_table() {
+  lock_guard<mutex> lock(_builtinSymbolsMutex);
+  if (_builtinSymbolsReady.load(memory_order_relaxed)) return;
+  // the sets push the symbols into the mappings, keep the ones added so far
+  // (e.g. by the alphabets) aside, they shadow the builtin ones
+  map<string, CharFont*> added;
+  added.swap(_symbolMappings);
+  __register_symbols_set(SymbolsSetBuiltin());
+  for (const auto& [name, cf] : _symbolMappings) {
+    _builtinSymbolNames.push_back(name);
+    _builtinSymbols.push_back(*cf);
+    delete cf;
+  }
+  _symbolMappings.swap(added);
+  // the names never move from now on, the table refers to them
+  vector<string_view> keys(_builtinSymbolNames.begin(), _builtinSymbolNames.end());
+  _builtinSymbolTable = PerfectHash<char>(std::move(keys));
+  _builtinSymbolsReady.store(true, memory_order_release);
+}
+
 void DefaultTeXFont::_init_() {
   _loadedAlphabets.push_back(UnicodeBlock::of('a'));
+  // the fonts and the symbols are loaded on their first use
   FontInfo::__register(FontSetBuiltin());
   __default_general_settings();
   __default_text_style_mapping();
-  __register_symbols_set(SymbolsSetBuiltin());
+  __resolve_parameters();
 
 #ifdef HAVE_LOG
   log();
@@ -306,6 +368,11 @@ void DefaultTeXFont::_free_() {
     }
   }
   for (auto f : _symbolMappings) delete f.second;
+  _symbolMappings.clear();
+  _builtinSymbolTable = PerfectHash<char>();
+  _builtinSymbolNames.clear();
+  _builtinSymbols.clear();
+  _builtinSymbolsReady = false;
   FontInfo::__free();
   // _registeredAlphabets :=> map<UnicodeBlock, AlphabetRegistration>
   // multi => one
@@ -350,6 +417,7 @@ void DefaultTeXFont::log() {
   // symbol mappings
   __log << "SYMBOL MAPPINGS:" << endl
         << "\t";
+  for (const auto& i : _builtinSymbolNames) __log << i << "; ";
   for (auto i : _symbolMappings) __log << i.first << "; ";
   __log << "\n\n";
   // font information
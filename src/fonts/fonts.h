@@ -1,18 +1,22 @@
 #ifndef FONTS_H_INCLUDED
 #define FONTS_H_INCLUDED
 
+#include <atomic>
 #include <cstring>
 #include <map>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "common.h"
+#include "context.h"
 #include "core/formula.h"
 #include "fonts/alphabet.h"
 #include "fonts/font_info.h"
 #include "fonts/tex_font.h"
 #include "graphic/graphic.h"
+#include "utils/perfect_hash.h"
 
 namespace tex {
 
@@ -32,16 +36,28 @@ private:
   // font related
   static std::string* _defaultTextStyleMappings;
   static std::map<std::string, std::vector<CharFont*>> _textStyleMappings;
+  // the symbol mappings added after LaTeX::init, shadow the builtin ones
   static std::map<std::string, CharFont*> _symbolMappings;
+  // the builtin symbol mappings indexed by the table, built on the first
+  // symbol lookup and read-only since then
+  static std::vector<std::string> _builtinSymbolNames;
+  static std::vector<CharFont> _builtinSymbols;
+  static PerfectHash<char> _builtinSymbolTable;
+  static std::atomic<bool> _builtinSymbolsReady;
+  static std::mutex _builtinSymbolsMutex;
   static std::map<std::string, float> _parameters;
   static std::map<std::string, float> _generalSettings;
-  static bool _magnificationEnable;
+  // names of the TeXParam, indexed by TeXParam
+  static const char* const _paramNames[TEX_PARAM_COUNT];
+  // parameters and settings resolved from the maps above by _init_
+  static float _params[TEX_PARAM_COUNT];
+  static int _muFontId, _spaceFontId;
 
   float _factor, _size;
 
   Char getChar(wchar_t c, const std::vector<CharFont*>& cf, TexStyle style);
 
-  sptr<Metrics> getMetrics(const CharFont& cf, float size);
+  Metrics getMetrics(const CharFont& cf, float size);
 
   inline FontInfo* getInfo(int id) { return FontInfo::__get(id); }
 
@@ -49,6 +65,16 @@ private:
 
   static void __default_text_style_mapping();
 
+  static void __resolve_parameters();
+
+  /** Register the builtin symbol sets and build the table from them */
+  static void __build_symbol_table();
+
+  /** Build the builtin symbol table if it has not been built yet */
+  static inline void __ensure_symbol_table() {
+    if (!_builtinSymbolsReady.load(std::memory_order_acquire)) __build_symbol_table();
+  }
+
 public:
   static std::vector<UnicodeBlock> _loadedAlphabets;
   static std::map<UnicodeBlock, AlphabetRegistration*> _registeredAlphabets;
@@ -93,26 +119,45 @@ public:
     const std::vector<UnicodeBlock>& alphabet,
     const std::string& lang);
 
+  /** Add the alphabet registered by the given function compiled into the library */
+  static void addAlphabet(const std::vector<UnicodeBlock>& alphabet, __reg_alphabet_func reg);
+
+  /** Test if any of the given unicode-blocks has been loaded */
+  static bool isAlphabetLoaded(const std::vector<UnicodeBlock>& alphabet);
+
   static void registerAlphabet(AlphabetRegistration* reg);
 
+  /** Load all the registered alphabets that have not been loaded yet */
+  static void loadRegisteredAlphabets();
+
   inline static float getParameter(const std::string& name) {
     auto it = _parameters.find(name);
     if (it == _parameters.end()) return 0;
     return it->second;
   }
 
+  /** Get the builtin parameter, in point, resolved at initialization */
+  inline static float getParameter(TeXParam param) {
+    return _params[static_cast<int>(param)];
+  }
+
+  /** Get the builtin general setting of given name, 0 if not found */
+  inline static float getGeneralSetting(const std::string& name) {
+    auto it = _generalSettings.find(name);
+    if (it == _generalSettings.end()) return 0;
+    return it->second;
+  }
+
   /**
-   * Get the size factor of given style
+   * Get the size factor of given style in the current context
    */
   inline static float getSizeFactor(TexStyle style) {
-    if (style < TexStyle::text) return 1;
-    if (style < TexStyle::script) return _generalSettings["textfactor"];
-    if (style < TexStyle::scriptScript) return _generalSettings["scriptfactor"];
-    return _generalSettings["scriptscriptfactor"];
+    return Context::current().getSizeFactor(style);
   }
 
-  inline float styleParam(const std::string& name, TexStyle style) {
-    return getParameter(name) * getSizeFactor(style) * Formula::PIXELS_PER_POINT;
+  /** Get the parameter scaled to the given style in the current context */
+  inline float styleParam(TeXParam param, TexStyle style) {
+    return Context::current().getStyleParam(param, style);
   }
 
   /************************************ get char ************************************************/
@@ -130,11 +175,11 @@ public:
 
   /*********************************** font information *****************************************/
 
-  Extension* getExtension(const Char& c, TexStyle style) override;
+  Extension getExtension(const Char& c, TexStyle style) override;
 
   float getKern(const CharFont& left, const CharFont& right, TexStyle style) override;
 
-  sptr<CharFont> getLigature(const CharFont& left, const CharFont& right) override;
+  std::optional<CharFont> getLigature(const CharFont& left, const CharFont& right) override;
 
   Char getNextLarger(const Char& c, TexStyle style) override;
 
@@ -142,48 +187,48 @@ public:
 
   inline float getScaleFactor() override { return _factor; }
 
-  inline float getAxisHeight(TexStyle style) override { return styleParam("axisheight", style); }
+  inline float getAxisHeight(TexStyle style) override { return styleParam(TeXParam::axisheight, style); }
 
-  inline float getBigOpSpacing1(TexStyle style) override { return styleParam("bigopspacing1", style); }
+  inline float getBigOpSpacing1(TexStyle style) override { return styleParam(TeXParam::bigopspacing1, style); }
 
-  inline float getBigOpSpacing2(TexStyle style) override { return styleParam("bigopspacing2", style); }
+  inline float getBigOpSpacing2(TexStyle style) override { return styleParam(TeXParam::bigopspacing2, style); }
 
-  inline float getBigOpSpacing3(TexStyle style) override { return styleParam("bigopspacing3", style); }
+  inline float getBigOpSpacing3(TexStyle style) override { return styleParam(TeXParam::bigopspacing3, style); }
 
-  inline float getBigOpSpacing4(TexStyle style) override { return styleParam("bigopspacing4", style); }
+  inline float getBigOpSpacing4(TexStyle style) override { return styleParam(TeXParam::bigopspacing4, style); }
 
-  inline float getBigOpSpacing5(TexStyle style) override { return styleParam("bigopspacing5", style); }
+  inline float getBigOpSpacing5(TexStyle style) override { return styleParam(TeXParam::bigopspacing5, style); }
 
-  inline float getNum1(TexStyle style) override { return styleParam("num1", style); }
+  inline float getNum1(TexStyle style) override { return styleParam(TeXParam::num1, style); }
 
-  inline float getNum2(TexStyle style) override { return styleParam("num2", style); }
+  inline float getNum2(TexStyle style) override { return styleParam(TeXParam::num2, style); }
 
-  inline float getNum3(TexStyle style) override { return styleParam("num3", style); }
+  inline float getNum3(TexStyle style) override { return styleParam(TeXParam::num3, style); }
 
-  inline float getSub1(TexStyle style) override { return styleParam("sub1", style); }
+  inline float getSub1(TexStyle style) override { return styleParam(TeXParam::sub1, style); }
 
-  inline float getSub2(TexStyle style) override { return styleParam("sub2", style); }
+  inline float getSub2(TexStyle style) override { return styleParam(TeXParam::sub2, style); }
 
-  inline float getSubDrop(TexStyle style) override { return styleParam("subdrop", style); }
+  inline float getSubDrop(TexStyle style) override { return styleParam(TeXParam::subdrop, style); }
 
-  inline float getSup1(TexStyle style) override { return styleParam("sup1", style); }
+  inline float getSup1(TexStyle style) override { return styleParam(TeXParam::sup1, style); }
 
-  inline float getSup2(TexStyle style) override { return styleParam("sup2", style); }
+  inline float getSup2(TexStyle style) override { return styleParam(TeXParam::sup2, style); }
 
-  inline float getSup3(TexStyle style) override { return styleParam("sup3", style); }
+  inline float getSup3(TexStyle style) override { return styleParam(TeXParam::sup3, style); }
 
-  inline float getSupDrop(TexStyle style) override { return styleParam("supdrop", style); }
+  inline float getSupDrop(TexStyle style) override { return styleParam(TeXParam::supdrop, style); }
 
-  inline float getDenom1(TexStyle style) override { return styleParam("denom1", style); }
+  inline float getDenom1(TexStyle style) override { return styleParam(TeXParam::denom1, style); }
 
-  inline float getDenom2(TexStyle style) override { return styleParam("denom2", style); }
+  inline float getDenom2(TexStyle style) override { return styleParam(TeXParam::denom2, style); }
 
   inline float getDefaultRuleThickness(TexStyle style) override {
-    return styleParam("defaultrulethickness", style);
+    return styleParam(TeXParam::defaultrulethickness, style);
   }
 
   inline float getQuad(TexStyle style, int fontCode) override {
-    return getInfo(fontCode)->getQuad(getSizeFactor(style) * Formula::PIXELS_PER_POINT);
+    return getInfo(fontCode)->getQuad(getEM(style));
   }
 
   int getMuFontId() override;
@@ -201,11 +246,11 @@ public:
 
   inline float getXHeight(TexStyle style, int fontCode) override {
     FontInfo* info = getInfo(fontCode);
-    return info->getXHeight(getSizeFactor(style) * Formula::PIXELS_PER_POINT);
+    return info->getXHeight(getEM(style));
   }
 
   inline float getEM(TexStyle style) override {
-    return getSizeFactor(style) * Formula::PIXELS_PER_POINT;
+    return Context::current().getEM(style);
   }
 
   inline bool hasNextLarger(const Char& c) override {
@@ -244,7 +289,7 @@ public:
   }
 
   /**
-   * Set the various sizes of the envrionment
+   * Set the various sizes of the envrionment of the current context
    */
   static void setMathSizes(
     float defaultSize,
@@ -95,7 +95,7 @@ public:
    *      the style in which the atom should be drawn
    * @return an extension object containing the 4 possible parts
    */
-  virtual Extension* getExtension(const Char& c, TexStyle style) = 0;
+  virtual Extension getExtension(const Char& c, TexStyle style) = 0;
 
   /**
    * Get the kern value to be inserted between the given characters in the
@@ -116,9 +116,9 @@ public:
    *      left character
    * @param right
    *      right character
-   * @return a ligature replacing both characters (or null if no any ligature)
+   * @return a ligature replacing both characters (or empty if no any ligature)
    */
-  virtual sptr<CharFont> getLigature(const CharFont& left, const CharFont& right) = 0;
+  virtual std::optional<CharFont> getLigature(const CharFont& left, const CharFont& right) = 0;
 
   /**
    * Get the id of mu font
@@ -0,0 +1,337 @@
+#include "graphic/display_list.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace tex;
+
+/************************************** display list implementation *******************************/
+
+// the tolerance to take 2 frames as the same, the scales are compared relatively
+static const float FRAME_EPS = 1e-5f;
+
+static bool sameFrame(float angle, float sx, float sy, float angle2, float sx2, float sy2) {
+  return std::abs(angle - angle2) <= FRAME_EPS
+         && std::abs(sx - sx2) <= FRAME_EPS * std::abs(sx2)
+         && std::abs(sy - sy2) <= FRAME_EPS * std::abs(sy2);
+}
+
+bool DisplayList::sameStroke(const Stroke& a, const Stroke& b) {
+  return a.lineWidth == b.lineWidth
+         && a.miterLimit == b.miterLimit
+         && a.cap == b.cap
+         && a.join == b.join;
+}
+
+void DisplayList::setFrame(Graphics2D& g2, const Frame& from, const Frame& to) {
+  if (std::abs(from.angle - to.angle) <= FRAME_EPS) {
+    if (from.sx != to.sx || from.sy != to.sy) g2.scale(to.sx / from.sx, to.sy / from.sy);
+    return;
+  }
+  if (from.sx != 1 || from.sy != 1) g2.scale(1 / from.sx, 1 / from.sy);
+  g2.rotate(to.angle - from.angle);
+  if (to.sx != 1 || to.sy != 1) g2.scale(to.sx, to.sy);
+}
+
+bool DisplayList::isReplayableOn(const Graphics2D& g2) const {
+  return g2.sx() == _sx && g2.sy() == _sy && sameStroke(g2.getStroke(), _stroke);
+}
+
+void DisplayList::replay(Graphics2D& g2, float x, float y) const {
+  const color oldColor = g2.getColor();
+  const Stroke oldStroke = g2.getStroke();
+  g2.translate(x, y);
+
+  Frame frame{0, 1, 1};
+  int frameIndex = -1, strokeIndex = 0;
+  color fg = oldColor;
+  const Font* font = g2.getFont();
+  for (const auto& op : _ops) {
+    if (op.frame != frameIndex) {
+      const Frame& to = _frames[op.frame];
+      setFrame(g2, frame, to);
+      frame = to;
+      frameIndex = op.frame;
+    }
+    if (op.fg != fg) {
+      g2.setColor(op.fg);
+      fg = op.fg;
+    }
+    switch (op.type) {
+      case OpType::text:
+        if (op.font != font) {
+          g2.setFont(op.font);
+          font = op.font;
+        }
+        break;
+      case OpType::line:
+      case OpType::rect:
+      case OpType::roundRect:
+        if (op.stroke != strokeIndex) {
+          g2.setStroke(_strokes[op.stroke]);
+          strokeIndex = op.stroke;
+        }
+        break;
+      default:
+        break;
+    }
+    const float* p = _coords.data() + op.index;
+    switch (op.type) {
+      case OpType::glyphs:
+        g2.drawGlyphRun(op.font, _chars.data() + op.index, _points.data() + op.index, op.count, 1);
+        font = g2.getFont();
+        break;
+      case OpType::text:
+        g2.drawText(_texts[op.count], p[0], p[1]);
+        break;
+      case OpType::layout:
+        _layouts[op.count]->draw(g2, p[0], p[1]);
+        // the layout may change the state of the graphics
+        fg = g2.getColor();
+        font = g2.getFont();
+        break;
+      case OpType::line:
+        g2.drawLine(p[0], p[1], p[2], p[3]);
+        break;
+      case OpType::rect:
+        g2.drawRect(p[0], p[1], p[2], p[3]);
+        break;
+      case OpType::fillRect:
+        g2.fillRect(p[0], p[1], p[2], p[3]);
+        break;
+      case OpType::roundRect:
+        g2.drawRoundRect(p[0], p[1], p[2], p[3], p[4], p[5]);
+        break;
+      case OpType::fillRoundRect:
+        g2.fillRoundRect(p[0], p[1], p[2], p[3], p[4], p[5]);
+        break;
+    }
+  }
+
+  // restore
+  g2.reset();
+  if (fg != oldColor) g2.setColor(oldColor);
+  if (strokeIndex != 0) g2.setStroke(oldStroke);
+}
+
+/************************************** recorder implementation ***********************************/
+
+Graphics2D_recorder::Graphics2D_recorder(DisplayList& list, const Graphics2D& g2)
+  : _list(&list), _sx(g2.sx()), _sy(g2.sy()),
+    _color(g2.getColor()), _stroke(g2.getStroke()), _font(g2.getFont()) {
+  list._stroke = _stroke;
+  list._sx = _sx;
+  list._sy = _sy;
+  list._strokes.push_back(_stroke);
+}
+
+bool Graphics2D_recorder::prepare() {
+  if (_dirty) {
+    _dirty = false;
+    _moved = true;
+    _frameIndex = -1;
+    // decompose the linear part into rotate(angle) * scale(sx, sy)
+    double angle = 0, sx = _a, sy = _d;
+    if (_b != 0 || _c != 0) {
+      angle = std::atan2(_b, _a);
+      const double cos = std::cos(angle), sin = std::sin(angle);
+      sx = std::hypot(_a, _b);
+      sy = _d * cos - _c * sin;
+      const double skew = _c * cos + _d * sin;
+      if (std::abs(skew) > FRAME_EPS * std::max(std::abs(sx), std::abs(sy))) {
+        _list->_flattened = false;
+        return false;
+      }
+    }
+    // nothing to show if degenerate
+    if (sx == 0 || sy == 0) return false;
+
+    auto& frames = _list->_frames;
+    for (size_t i = 0; i < frames.size(); i++) {
+      const auto& f = frames[i];
+      if (sameFrame((float) angle, (float) sx, (float) sy, f.angle, f.sx, f.sy)) {
+        _frameIndex = (int) i;
+        break;
+      }
+    }
+    if (_frameIndex < 0) {
+      _frameIndex = (int) frames.size();
+      frames.push_back({(float) angle, (float) sx, (float) sy});
+    }
+    const float a = frames[_frameIndex].angle;
+    _cos = a == 0 ? 1 : std::cos((double) a);
+    _sin = a == 0 ? 0 : std::sin((double) a);
+  }
+  if (_frameIndex < 0) return false;
+  if (_moved) {
+    // the translation in the frame, thus the inverse of the frame applied to (e, f)
+    _moved = false;
+    const auto& f = _list->_frames[_frameIndex];
+    _u = (float) ((_cos * _e + _sin * _f) / f.sx);
+    _v = (float) ((_cos * _f - _sin * _e) / f.sy);
+  }
+  return true;
+}
+
+DisplayList::Op* Graphics2D_recorder::add(DisplayList::OpType type, bool stroked, u32 index, u32 count) {
+  if (!prepare()) return nullptr;
+  if (stroked && _strokeIndex < 0) {
+    auto& strokes = _list->_strokes;
+    if (!DisplayList::sameStroke(strokes.back(), _stroke)) strokes.push_back(_stroke);
+    _strokeIndex = (int) strokes.size() - 1;
+  }
+  DisplayList::Op op{};
+  op.type = type;
+  op.frame = (u16) _frameIndex;
+  op.stroke = (u16) (stroked ? _strokeIndex : 0);
+  op.fg = _color;
+  op.font = _font;
+  op.index = index;
+  op.count = count;
+  _list->_ops.push_back(op);
+  return &_list->_ops.back();
+}
+
+void Graphics2D_recorder::addShape(
+  DisplayList::OpType type,
+  bool stroked,
+  std::initializer_list<float> coords
+) {
+  if (add(type, stroked, _list->_coords.size(), 0) == nullptr) return;
+  _list->_coords.insert(_list->_coords.end(), coords);
+}
+
+void Graphics2D_recorder::drawLayout(const sptr<TextLayout>& layout, float x, float y) {
+  if (!prepare()) return;
+  addShape(DisplayList::OpType::layout, false, {x + _u, y + _v});
+  _list->_ops.back().count = _list->_layouts.size();
+  _list->_layouts.push_back(layout);
+}
+
+void Graphics2D_recorder::setColor(color c) {
+  _color = c;
+}
+
+color Graphics2D_recorder::getColor() const {
+  return _color;
+}
+
+void Graphics2D_recorder::setStroke(const Stroke& s) {
+  _stroke = s;
+  _strokeIndex = -1;
+}
+
+const Stroke& Graphics2D_recorder::getStroke() const {
+  return _stroke;
+}
+
+void Graphics2D_recorder::setStrokeWidth(float w) {
+  _stroke.lineWidth = w;
+  _strokeIndex = -1;
+}
+
+const Font* Graphics2D_recorder::getFont() const {
+  return _font;
+}
+
+void Graphics2D_recorder::setFont(const Font* font) {
+  _font = font;
+}
+
+void Graphics2D_recorder::translate(float dx, float dy) {
+  _e += _a * dx + _c * dy;
+  _f += _b * dx + _d * dy;
+  _moved = true;
+}
+
+void Graphics2D_recorder::scale(float sx, float sy) {
+  _a *= sx;
+  _b *= sx;
+  _c *= sy;
+  _d *= sy;
+  _sx *= sx;
+  _sy *= sy;
+  _dirty = true;
+}
+
+void Graphics2D_recorder::rotate(float angle) {
+  const double cos = std::cos((double) angle), sin = std::sin((double) angle);
+  const double a = _a * cos + _c * sin, b = _b * cos + _d * sin;
+  _c = _c * cos - _a * sin;
+  _d = _d * cos - _b * sin;
+  _a = a;
+  _b = b;
+  _dirty = true;
+}
+
+void Graphics2D_recorder::rotate(float angle, float px, float py) {
+  translate(px, py);
+  rotate(angle);
+  translate(-px, -py);
+}
+
+void Graphics2D_recorder::reset() {
+  _a = _d = 1;
+  _b = _c = _e = _f = 0;
+  _sx = _sy = 1;
+  _dirty = true;
+}
+
+float Graphics2D_recorder::sx() const {
+  return _sx;
+}
+
+float Graphics2D_recorder::sy() const {
+  return _sy;
+}
+
+void Graphics2D_recorder::drawChar(wchar_t c, float x, float y) {
+  if (!prepare()) return;
+  auto& ops = _list->_ops;
+  // merge into the last run if possible
+  const bool merge = !ops.empty()
+                     && ops.back().type == DisplayList::OpType::glyphs
+                     && ops.back().frame == _frameIndex
+                     && ops.back().fg == _color
+                     && ops.back().font == _font;
+  if (merge) {
+    ops.back().count++;
+  } else {
+    add(DisplayList::OpType::glyphs, false, _list->_chars.size(), 1);
+  }
+  _list->_chars.push_back(c);
+  _list->_points.emplace_back(x + _u, y + _v);
+}
+
+void Graphics2D_recorder::drawText(const wstring& c, float x, float y) {
+  if (!prepare()) return;
+  addShape(DisplayList::OpType::text, false, {x + _u, y + _v});
+  _list->_ops.back().count = _list->_texts.size();
+  _list->_texts.push_back(c);
+}
+
+void Graphics2D_recorder::drawLine(float x1, float y1, float x2, float y2) {
+  if (!prepare()) return;
+  addShape(DisplayList::OpType::line, true, {x1 + _u, y1 + _v, x2 + _u, y2 + _v});
+}
+
+void Graphics2D_recorder::drawRect(float x, float y, float w, float h) {
+  if (!prepare()) return;
+  addShape(DisplayList::OpType::rect, true, {x + _u, y + _v, w, h});
+}
+
+void Graphics2D_recorder::fillRect(float x, float y, float w, float h) {
+  if (!prepare()) return;
+  addShape(DisplayList::OpType::fillRect, false, {x + _u, y + _v, w, h});
+}
+
+void Graphics2D_recorder::drawRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  if (!prepare()) return;
+  addShape(DisplayList::OpType::roundRect, true, {x + _u, y + _v, w, h, rx, ry});
+}
+
+void Graphics2D_recorder::fillRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  if (!prepare()) return;
+  addShape(DisplayList::OpType::fillRoundRect, false, {x + _u, y + _v, w, h, rx, ry});
+}
@@ -0,0 +1,202 @@
+#ifndef DISPLAY_LIST_H_INCLUDED
+#define DISPLAY_LIST_H_INCLUDED
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "graphic/graphic.h"
+
+namespace tex {
+
+/**
+ * A flattened draw of a box tree, recorded by Graphics2D_recorder and replayed
+ * on any graphics context. The operations are kept in draw order, each refers
+ * to the linear part (rotation and scale) of the transformation it was drawn
+ * with, the translation is folded into its coordinates. Thus consecutive
+ * operations sharing the same scale (i.e. almost all the glyphs in a formula)
+ * need no transformation calls on replay, and consecutive glyphs with the same
+ * frame, font and color are merged into a run drawn by Graphics2D::drawGlyphRun.
+ */
+class DisplayList {
+private:
+  friend class Graphics2D_recorder;
+
+  /** The linear part of a transformation, thus rotate(angle) * scale(sx, sy) */
+  struct Frame {
+    float angle, sx, sy;
+  };
+
+  enum class OpType : u8 {
+    glyphs,
+    text,
+    layout,
+    line,
+    rect,
+    fillRect,
+    roundRect,
+    fillRoundRect,
+  };
+
+  struct Op {
+    OpType type;
+    u16 frame;
+    // index in _strokes, for lines and rects
+    u16 stroke;
+    color fg;
+    // font of the glyphs and the text
+    const Font* font;
+    // glyphs: index of the first glyph in _chars and _points
+    // otherwise: index of the first coordinate in _coords
+    u32 index;
+    // glyphs: count of the glyphs in the run
+    // text: index in _texts, layout: index in _layouts
+    u32 count;
+  };
+
+  std::vector<Frame> _frames;
+  std::vector<Stroke> _strokes;
+  std::vector<Op> _ops;
+  std::vector<wchar_t> _chars;
+  std::vector<Point> _points;
+  std::vector<float> _coords;
+  std::vector<std::wstring> _texts;
+  std::vector<sptr<TextLayout>> _layouts;
+
+  // the state of the graphics the list was recorded with
+  Stroke _stroke;
+  float _sx = 1, _sy = 1;
+  // if all the operations were drawn with a transformation that can be set
+  // by rotation and scale
+  bool _flattened = true;
+
+  static bool sameStroke(const Stroke& a, const Stroke& b);
+
+  static void setFrame(Graphics2D& g2, const Frame& from, const Frame& to);
+
+public:
+  DisplayList() = default;
+
+  no_copy_assign(DisplayList);
+
+  /**
+   * Test if this list can be replayed on the given graphics, thus its stroke
+   * and scale are the same as the graphics the list was recorded with (the
+   * debug boxes and the lines depend on them).
+   */
+  bool isReplayableOn(const Graphics2D& g2) const;
+
+  /**
+   * Replay the list on the given graphics, translated by (x, y), with the
+   * minimal calls to set the transformation, the color, the stroke and the
+   * font. The transformation of the graphics is reset after, as
+   * TeXRender::draw does, the color and the stroke are restored.
+   */
+  void replay(Graphics2D& g2, float x, float y) const;
+
+  /**
+   * Test if all the operations were flattened, false if some operation was
+   * drawn with a skewed transformation (e.g. a rotation inside a non-uniform
+   * scale) that cannot be set by the graphics, the tree must be drawn instead.
+   */
+  inline bool isFlattened() const { return _flattened; }
+
+  /** Get the count of the operations (a glyph run is one operation) */
+  inline size_t size() const { return _ops.size(); }
+
+  /** Get the count of the glyphs */
+  inline size_t glyphs() const { return _chars.size(); }
+};
+
+/**
+ * Graphics to record the draws into a DisplayList. The draws are not shown,
+ * the recorder tracks the full affine transformation and the state (color,
+ * stroke and font) to flatten the operations.
+ */
+class Graphics2D_recorder : public Graphics2D {
+private:
+  DisplayList* _list;
+  // the transformation, x' = a * x + c * y + e, y' = b * x + d * y + f
+  double _a = 1, _b = 0, _c = 0, _d = 1, _e = 0, _f = 0;
+  float _sx, _sy;
+  color _color = black;
+  Stroke _stroke;
+  const Font* _font = nullptr;
+  // the frame is found lazily if the linear part is dirty, and the
+  // translation in the frame is computed lazily if moved
+  bool _dirty = true, _moved = true;
+  // index of the current frame in the list, -1 if the transformation is
+  // degenerate or skewed
+  int _frameIndex = -1;
+  double _cos = 1, _sin = 0;
+  // index of the current stroke in the list, -1 if not added yet
+  int _strokeIndex = 0;
+  // the translation of the transformation in the current frame
+  float _u = 0, _v = 0;
+
+  bool prepare();
+
+  DisplayList::Op* add(DisplayList::OpType type, bool stroked, u32 index, u32 count);
+
+  void addShape(DisplayList::OpType type, bool stroked, std::initializer_list<float> coords);
+
+public:
+  /**
+   * Create a recorder to record into the given list, the initial state is
+   * taken from the given graphics.
+   */
+  Graphics2D_recorder(DisplayList& list, const Graphics2D& g2);
+
+  /**
+   * Record the draw of a text layout. The layouts are drawn by the platform
+   * with its own graphics, thus the layout is recorded as a whole and drawn on
+   * replay.
+   */
+  void drawLayout(const sptr<TextLayout>& layout, float x, float y);
+
+  void setColor(color c) override;
+
+  color getColor() const override;
+
+  void setStroke(const Stroke& s) override;
+
+  const Stroke& getStroke() const override;
+
+  void setStrokeWidth(float w) override;
+
+  const Font* getFont() const override;
+
+  void setFont(const Font* font) override;
+
+  void translate(float dx, float dy) override;
+
+  void scale(float sx, float sy) override;
+
+  void rotate(float angle) override;
+
+  void rotate(float angle, float px, float py) override;
+
+  void reset() override;
+
+  float sx() const override;
+
+  float sy() const override;
+
+  void drawChar(wchar_t c, float x, float y) override;
+
+  void drawText(const std::wstring& c, float x, float y) override;
+
+  void drawLine(float x1, float y1, float x2, float y2) override;
+
+  void drawRect(float x, float y, float w, float h) override;
+
+  void fillRect(float x, float y, float w, float h) override;
+
+  void drawRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  void fillRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+};
+
+}  // namespace tex
+
+#endif  // DISPLAY_LIST_H_INCLUDED
@@ -0,0 +1,20 @@
+#include "graphic/graphic.h"
+
+using namespace std;
+using namespace tex;
+
+void Graphics2D::drawGlyphRun(
+  const Font* font,
+  const wchar_t* glyphs,
+  const Point* positions,
+  size_t n,
+  float scale
+) {
+  if (getFont() != font) setFont(font);
+  if (scale != 1) this->scale(scale, scale);
+  const float inv = 1.f / scale;
+  for (size_t i = 0; i < n; i++) {
+    drawChar(glyphs[i], positions[i].x * inv, positions[i].y * inv);
+  }
+  if (scale != 1) this->scale(inv, inv);
+}
@@ -238,6 +238,25 @@ public:
    * @param ry radius in y-direction
    */
   virtual void fillRoundRect(float x, float y, float w, float h, float rx, float ry) = 0;
+
+  /**
+   * Draw a run of glyphs with the same font, is baseline aligned. The default
+   * implementation draws the glyphs one by one via drawChar, the platforms may
+   * override it to draw the run in a batch.
+   *
+   * @param font the font of the glyphs
+   * @param glyphs the characters to draw
+   * @param positions the position of every glyph
+   * @param n the count of the glyphs
+   * @param scale the scale of the glyphs, applied around their positions
+   */
+  virtual void drawGlyphRun(
+    const Font* font,
+    const wchar_t* glyphs,
+    const Point* positions,
+    size_t n,
+    float scale
+  );
 };
 
 }  // namespace tex
@@ -14,9 +14,6 @@ using namespace tex;
 string tex::RES_BASE = "res";
 static string CHECK_FILE = ".clatexmath-res_root";
 
-Formula* LaTeX::_formula = nullptr;
-TeXRenderBuilder* LaTeX::_builder = nullptr;
-
 string LaTeX::queryResourceLocation(string& custom_path) {
   queue<string> paths;
   paths.push(custom_path);
@@ -84,7 +81,7 @@ string LaTeX::queryResourceLocation(string& custom_path) {
   return "";
 }
 
-void LaTeX::init(string res_root_path) {
+void LaTeX::init(string res_root_path, bool preloadAlphabets) {
   try {
     auto path = queryResourceLocation(res_root_path);
     if (!path.empty()) {
@@ -92,26 +89,27 @@ void LaTeX::init(string res_root_path) {
     }
   } catch (std::exception&) {
   }
-  if (_formula != nullptr) return;
+  if (Context::_default != nullptr) return;
 
-  NewCommandMacro::_init_();
+  // only the names are registered here, the font descriptions, the symbols,
+  // the macros and the text font are loaded on their first use (thread-safe)
   DefaultTeXFont::_init_();
   Formula::_init_();
-  TextRenderingBox::_init_();
 
-  _formula = new Formula();
-  _builder = new TeXRenderBuilder();
+  Context::_default = new Context();
+  // load the registered alphabets now, the builtin tables must not be
+  // modified once the contexts may be used from different threads
+  if (preloadAlphabets) DefaultTeXFont::loadRegisteredAlphabets();
 }
 
 void LaTeX::release() {
+  if (Context::_default != nullptr) delete Context::_default;
+  Context::_default = nullptr;
+
   DefaultTeXFont::_free_();
-  Formula::_free_();
   MacroInfo::_free_();
   NewCommandMacro::_free_();
   TextRenderingBox::_free_();
-
-  if (_formula != nullptr) delete _formula;
-  if (_builder != nullptr) delete _builder;
 }
 
 const string& LaTeX::getResRootPath() {
@@ -123,19 +121,13 @@ void LaTeX::setDebug(bool debug) {
 }
 
 TeXRender* LaTeX::parse(const wstring& latex, int width, float textSize, float lineSpace, color fg) {
-  bool lined = true;
-  if (startswith(latex, L"$$") || startswith(latex, L"\\[")) {
-    lined = false;
-  }
-  Alignment align = lined ? Alignment::left : Alignment::center;
-  _formula->setLaTeX(latex);
-  TeXRender* render =
-    _builder->setStyle(TexStyle::display)
-      .setTextSize(textSize)
-      .setWidth(UnitType::pixel, width, align)
-      .setIsMaxWidth(lined)
-      .setLineSpace(UnitType::pixel, lineSpace)
-      .setForeground(fg)
-      .build(*_formula);
-  return render;
+  return Context::current().parse(latex, width, textSize, lineSpace, fg);
+}
+
+TeXMetrics LaTeX::measure(const wstring& latex, int width, float textSize, float lineSpace) {
+  return Context::current().measure(latex, width, textSize, lineSpace);
+}
+
+vector<BatchResult> LaTeX::parseBatch(const vector<BatchJob>& jobs, size_t threads) {
+  return RenderBatch(threads).run(jobs);
 }
@@ -1,7 +1,9 @@
 #ifndef LATEX_H_INCLUDED
 #define LATEX_H_INCLUDED
 
+#include "batch.h"
 #include "common.h"
+#include "context.h"
 #include "graphic/graphic.h"
 #include "graphic/graphic_basic.h"
 #include "render.h"
@@ -12,23 +14,23 @@
 
 namespace tex {
 
-class Formula;
-
 class LaTeX {
-private:
-  static Formula* _formula;
-  static TeXRenderBuilder* _builder;
-
 protected:
   static std::string queryResourceLocation(std::string& custom_path);
 
 public:
   /**
-   * Initialize TeX context with given root path of the TeX resources
+   * Initialize TeX context with given root path of the TeX resources. It is
+   * cheap, the resources are loaded when they are used first time.
    *
    * @param res_root_path root path of the resources, default is 'res'
+   * @param preloadAlphabets whether to load the registered alphabets (e.g.
+   * Cyrillic and Greek) now, default is true. Otherwise an alphabet is loaded
+   * when it is used first time, that modifies the global tables, thus the
+   * contexts must not be used from different threads before all the used
+   * alphabets are loaded.
    */
-  static void init(std::string res_root_path = "res");
+  static void init(std::string res_root_path = "res", bool preloadAlphabets = true);
 
   /**
    * Get the root path of the "TeX resources"
@@ -41,7 +43,8 @@ public:
   static void setDebug(bool debug);
 
   /**
-   * Parse TeX formatted string to TeXRender
+   * Parse TeX formatted string to TeXRender within the current context, see
+   * Context::current
    *
    * @param tex the TeX formatted string
    * @param width the width of the 2D graphics context
@@ -52,7 +55,29 @@ public:
   static TeXRender* parse(const std::wstring& tex, int width, float textSize, float lineSpace, color fg);
 
   /**
-   * Release the LaTeX context
+   * Get the metrics of the render that parse would produce within the current
+   * context, without creating the render, see Context::measure
+   *
+   * @param tex the TeX formatted string
+   * @param width the width of the 2D graphics context
+   * @param textSize the text size
+   * @param lineSpace the line space
+   */
+  static TeXMetrics measure(const std::wstring& tex, int width, float textSize, float lineSpace);
+
+  /**
+   * Parse the given jobs concurrently within contexts forked from the current
+   * context, see RenderBatch
+   *
+   * @param jobs the jobs to parse
+   * @param threads the number of workers, 0 means the number of the hardware
+   * threads
+   * @return the results in the order of the jobs
+   */
+  static std::vector<BatchResult> parseBatch(const std::vector<BatchJob>& jobs, size_t threads = 0);
+
+  /**
+   * Release the default context and the builtin resources
    */
   static void release();
 };
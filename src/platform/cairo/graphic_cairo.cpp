@@ -295,6 +295,49 @@ void Graphics2D_cairo::drawText(const wstring& t, float x, float y) {
   _context->show_text(wide2utf8(t));
 }
 
+void Graphics2D_cairo::drawGlyphRun(
+  const Font* font,
+  const wchar_t* glyphs,
+  const Point* positions,
+  size_t n,
+  float scale
+) {
+  if (n == 0) return;
+  setFont(font);
+  _context->set_font_face(_font->getCairoFontFace());
+  _context->set_font_size(_font->getSize());
+  // scale the context only, the run does not change the scale of this
+  // graphics
+  if (scale != 1) {
+    _context->save();
+    _context->scale(scale, scale);
+  }
+  // map all the characters to the glyphs at once, the buffer is reused if
+  // large enough
+  cairo_t* cr = _context->cobj();
+  const string utf8 = wide2utf8(wstring(glyphs, n));
+  _glyphs.resize(n);
+  cairo_glyph_t* buf = _glyphs.data();
+  int count = (int) n;
+  const auto status = cairo_scaled_font_text_to_glyphs(
+    cairo_get_scaled_font(cr), 0, 0, utf8.c_str(), (int) utf8.length(),
+    &buf, &count, nullptr, nullptr, nullptr
+  );
+  const double inv = 1. / scale;
+  if (status == CAIRO_STATUS_SUCCESS && count == (int) n) {
+    for (size_t i = 0; i < n; i++) {
+      buf[i].x = positions[i].x * inv;
+      buf[i].y = positions[i].y * inv;
+    }
+    cairo_show_glyphs(cr, buf, count);
+  } else {
+    // not one glyph per character, draw them one by one
+    for (size_t i = 0; i < n; i++) drawChar(glyphs[i], positions[i].x * inv, positions[i].y * inv);
+  }
+  if (buf != _glyphs.data()) cairo_glyph_free(buf);
+  if (scale != 1) _context->restore();
+}
+
 void Graphics2D_cairo::drawLine(float x1, float y1, float x2, float y2) {
   _context->move_to(x1, y1);
   _context->line_to(x2, y2);
@@ -76,6 +76,8 @@ private:
   Stroke _stroke;
   const Font_cairo* _font;
   float _sx, _sy;
+  // buffer of the glyph runs
+  vector<cairo_glyph_t> _glyphs;
 
   void roundRect(float x, float y, float w, float h, float rx, float ry);
 
@@ -125,6 +127,14 @@ public:
   void drawRoundRect(float x, float y, float w, float h, float rx, float ry) override;
 
   void fillRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  void drawGlyphRun(
+    const Font* font,
+    const wchar_t* glyphs,
+    const Point* positions,
+    size_t n,
+    float scale
+  ) override;
 };
 
 }  // namespace tex
@@ -0,0 +1,486 @@
+#include "config.h"
+
+#if defined(BUILD_HEADLESS) && !defined(MEM_CHECK)
+
+#include "platform/headless/graphic_headless.h"
+
+using namespace std;
+using namespace tex;
+
+// the count of the horizontal positions per pixel the glyphs are rendered at
+static const int SUBPIXELS = 4;
+// the glyphs larger than this (in pixels) are not cached
+static const float MAX_CACHED_PPEM = 256.f;
+// the tolerance (in pixels) to flatten the arcs
+static const float ARC_TOLERANCE = 0.25f;
+
+/************************************** face implementation ***************************************/
+
+mutex HeadlessFace::_facesMutex;
+unordered_map<string, sptr<HeadlessFace>> HeadlessFace::_faces;
+
+const size_t HeadlessFace::CACHE_BUDGET = 4 * 1024 * 1024;
+
+HeadlessFace::HeadlessFace(const string& file) : _face(file) {}
+
+sptr<HeadlessFace> HeadlessFace::load(const string& file) {
+  lock_guard<mutex> lock(_facesMutex);
+  auto it = _faces.find(file);
+  if (it != _faces.end()) return it->second;
+  // the faces live until exit, do not allocate them from an arena
+  auto face = make_shared<HeadlessFace>(file);
+  _faces[file] = face;
+  return face;
+}
+
+sptr<const GlyphBitmap> HeadlessFace::cached(u64 key) {
+  lock_guard<mutex> lock(_mutex);
+  auto it = _glyphs.find(key);
+  return it == _glyphs.end() ? nullptr : it->second;
+}
+
+void HeadlessFace::cache(u64 key, const sptr<const GlyphBitmap>& bitmap) {
+  const size_t bytes = bitmap->coverage.size() + sizeof(GlyphBitmap);
+  lock_guard<mutex> lock(_mutex);
+  if (_bytes + bytes > CACHE_BUDGET) {
+    _glyphs.clear();
+    _bytes = 0;
+  }
+  if (_glyphs.emplace(key, bitmap).second) _bytes += bytes;
+}
+
+/************************************** font implementation ***************************************/
+
+static string fontFile(const string& family, int style) {
+  const string base = RES_BASE + "/fonts/latin/";
+  const bool bold = (style & BOLD) != 0, italic = (style & ITALIC) != 0;
+  if (family == "SansSerif") {
+    if (bold) return base + "optional/cmssbx10.ttf";
+    return base + (italic ? "optional/cmssi10.ttf" : "optional/cmss10.ttf");
+  }
+  if (family == "Monospaced") return base + "optional/cmtt10.ttf";
+  // other families fall back to serif
+  if (bold && italic) return base + "optional/cmbxti10.ttf";
+  if (bold) return base + "optional/cmbx10.ttf";
+  if (italic) return base + "optional/cmti10.ttf";
+  return base + "cmr10.ttf";
+}
+
+Font_headless::Font_headless(const string& file, float size)
+  : _face(HeadlessFace::load(file)), _style(PLAIN), _size(size) {}
+
+Font_headless::Font_headless(const string& family, int style, float size)
+  : _face(HeadlessFace::load(fontFile(family, style))), _family(family), _style(style), _size(size) {}
+
+float Font_headless::getSize() const {
+  return _size;
+}
+
+sptr<Font> Font_headless::deriveFont(int style) const {
+  // the fonts loaded from file have no family to derive from
+  if (_family.empty()) return sptrOf<Font_headless>(_face->face().getPath(), _size);
+  return sptrOf<Font_headless>(_family, style, _size);
+}
+
+bool Font_headless::operator==(const Font& ft) const {
+  const auto& f = static_cast<const Font_headless&>(ft);
+  return _face == f._face && _size == f._size;
+}
+
+bool Font_headless::operator!=(const Font& f) const {
+  return !(*this == f);
+}
+
+Font* Font::create(const string& file, float size) {
+  return new Font_headless(file, size);
+}
+
+sptr<Font> Font::_create(const string& name, int style, float size) {
+  return sptrOf<Font_headless>(name, style, size);
+}
+
+/************************************** text layout implementation ********************************/
+
+TextLayout_headless::TextLayout_headless(const wstring& src, const sptr<Font_headless>& font)
+  : _text(src), _font(font) {}
+
+void TextLayout_headless::getBounds(Rect& r) {
+  const auto& face = _font->getFace()->face();
+  const float scale = _font->getSize() / face.getUnitsPerEm();
+  float w = 0;
+  for (wchar_t c : _text) w += face.advance(face.glyphIndex((u32) c));
+  r.x = 0;
+  r.y = -face.getAscent() * scale;
+  r.w = w * scale;
+  r.h = (face.getAscent() + face.getDescent()) * scale;
+}
+
+void TextLayout_headless::draw(Graphics2D& g2, float x, float y) {
+  const Font* old = g2.getFont();
+  g2.setFont(_font.get());
+  g2.drawText(_text, x, y);
+  g2.setFont(old);
+}
+
+sptr<TextLayout> TextLayout::create(const wstring& src, const sptr<Font>& font) {
+  return sptrOf<TextLayout_headless>(src, static_pointer_cast<Font_headless>(font));
+}
+
+/************************************** graphics implementation ***********************************/
+
+namespace {
+
+/** Add the decomposed outline into a path */
+class PathSink : public OutlineSink {
+private:
+  Path& _path;
+
+public:
+  explicit PathSink(Path& path) : _path(path) {}
+
+  void moveTo(float x, float y) override { _path.moveTo(x, y); }
+
+  void lineTo(float x, float y) override { _path.lineTo(x, y); }
+
+  void quadTo(float cx, float cy, float x, float y) override { _path.quadTo(cx, cy, x, y); }
+};
+
+}  // namespace
+
+Font_headless* Graphics2D_headless::_default_font = nullptr;
+
+Graphics2D_headless::Graphics2D_headless(u8* pixels, int width, int height, int stride)
+  : _pixels(pixels), _width(width), _height(height), _stride(stride),
+    _color(black), _gray(255), _stroke(), _sx(1), _sy(1) {
+  if (pixels == nullptr || width < 0 || height < 0 || stride < width) {
+    throw ex_invalid_param("Invalid pixel buffer for the headless graphics!");
+  }
+  if (_default_font == nullptr) _default_font = new Font_headless("Serif", PLAIN, 20.f);
+  _font = _default_font;
+}
+
+void Graphics2D_headless::release() {
+  delete _default_font;
+  _default_font = nullptr;
+}
+
+Point Graphics2D_headless::transform(float x, float y) const {
+  return {(float) (_a * x + _c * y + _e), (float) (_b * x + _d * y + _f)};
+}
+
+int Graphics2D_headless::arcSegments(float r, float angle) const {
+  // the radius in pixels, take the larger scale
+  const double s = std::max(std::hypot(_a, _b), std::hypot(_c, _d));
+  const double rd = std::abs(r) * s;
+  if (rd <= ARC_TOLERANCE) return 1;
+  // the deviation of a chord spans θ is r * θ^2 / 8
+  const double step = std::sqrt(8 * ARC_TOLERANCE / rd);
+  return std::max(1, std::min(64, (int) std::ceil(std::abs(angle) / step)));
+}
+
+void Graphics2D_headless::fillPath() {
+  const int alpha = (int) color_a(_color);
+  if (_path.isEmpty() || alpha == 0) {
+    _path.clear();
+    return;
+  }
+  // clip to the buffer
+  const int x0 = (int) std::floor(std::max(_path.xMin(), 0.f));
+  const int y0 = (int) std::floor(std::max(_path.yMin(), 0.f));
+  const int x1 = (int) std::ceil(std::min(_path.xMax(), (float) _width));
+  const int y1 = (int) std::ceil(std::min(_path.yMax(), (float) _height));
+  if (x0 < x1 && y0 < y1) {
+    _raster.reset(x1 - x0, y1 - y0);
+    _raster.fill(_path, (float) -x0, (float) -y0);
+    _raster.composite(_pixels + (size_t) y0 * _stride + x0, _stride, alpha, _gray);
+  }
+  _path.clear();
+}
+
+void Graphics2D_headless::addPolygon(const vector<Point>& points, bool reverse) {
+  if (points.empty()) return;
+  if (reverse) {
+    const Point p = transform(points.back().x, points.back().y);
+    _path.moveTo(p.x, p.y);
+    for (size_t i = points.size() - 1; i-- > 0;) {
+      const Point q = transform(points[i].x, points[i].y);
+      _path.lineTo(q.x, q.y);
+    }
+  } else {
+    const Point p = transform(points[0].x, points[0].y);
+    _path.moveTo(p.x, p.y);
+    for (size_t i = 1; i < points.size(); i++) {
+      const Point q = transform(points[i].x, points[i].y);
+      _path.lineTo(q.x, q.y);
+    }
+  }
+}
+
+void Graphics2D_headless::addRoundRect(float x, float y, float w, float h, float rx, float ry, bool reverse) {
+  rx = std::max(0.f, std::min(rx, w / 2));
+  ry = std::max(0.f, std::min(ry, h / 2));
+  const int n = arcSegments(std::max(rx, ry), (float) (PI / 2));
+  // the centers of the corners, clockwise from the top-left
+  const float cx[] = {x + rx, x + w - rx, x + w - rx, x + rx};
+  const float cy[] = {y + ry, y + ry, y + h - ry, y + h - ry};
+  _points.clear();
+  for (int k = 0; k < 4; k++) {
+    const double start = PI + k * PI / 2;
+    for (int i = 0; i <= n; i++) {
+      const double t = start + i * (PI / 2) / n;
+      _points.emplace_back(cx[k] + rx * (float) std::cos(t), cy[k] + ry * (float) std::sin(t));
+    }
+  }
+  addPolygon(_points, reverse);
+}
+
+void Graphics2D_headless::addOutline(const float m[6]) {
+  PathSink sink(_path);
+  _outline.decompose(m, sink);
+}
+
+sptr<const GlyphBitmap> Graphics2D_headless::renderGlyph(
+  const HeadlessFace& face, u16 glyph, float ppem, float dx
+) {
+  face.face().outline(glyph, _outline);
+  auto bitmap = make_shared<GlyphBitmap>();
+  bitmap->left = bitmap->top = bitmap->width = bitmap->height = 0;
+  if (_outline.isEmpty()) return bitmap;
+  const float s = ppem / face.face().getUnitsPerEm();
+  // the y-axis of the font points up
+  const float m[6] = {s, 0, 0, -s, dx, 0};
+  _path.clear();
+  addOutline(m);
+  bitmap->left = (int) std::floor(_path.xMin());
+  bitmap->top = (int) std::floor(_path.yMin());
+  bitmap->width = (int) std::ceil(_path.xMax()) - bitmap->left;
+  bitmap->height = (int) std::ceil(_path.yMax()) - bitmap->top;
+  bitmap->coverage.resize((size_t) bitmap->width * bitmap->height);
+  _raster.reset(bitmap->width, bitmap->height);
+  _raster.fill(_path, (float) -bitmap->left, (float) -bitmap->top);
+  _raster.coverage(bitmap->coverage.data(), bitmap->width);
+  _path.clear();
+  return bitmap;
+}
+
+void Graphics2D_headless::blit(const GlyphBitmap& bitmap, int x, int y) {
+  const int alpha = (int) color_a(_color);
+  const int left = x + bitmap.left, top = y + bitmap.top;
+  const int x0 = std::max(0, left), x1 = std::min(_width, left + bitmap.width);
+  const int y0 = std::max(0, top), y1 = std::min(_height, top + bitmap.height);
+  if (alpha == 0 || x0 >= x1 || y0 >= y1) return;
+  for (int j = y0; j < y1; j++) {
+    const u8* src = bitmap.coverage.data() + (size_t) (j - top) * bitmap.width + (x0 - left);
+    u8* dst = _pixels + (size_t) j * _stride + x0;
+    for (int i = 0; i < x1 - x0; i++) {
+      if (src[i] != 0) compositePixel(dst[i], src[i], alpha, _gray);
+    }
+  }
+}
+
+void Graphics2D_headless::drawGlyph(const Font_headless* font, u16 glyph, float x, float y) {
+  auto& face = *font->getFace();
+  const float size = font->getSize();
+  const float ppem = (float) (size * _a);
+  if (_b == 0 && _c == 0 && _a == _d && ppem > 0 && ppem <= MAX_CACHED_PPEM) {
+    const Point p = transform(x, y);
+    if (!std::isfinite(p.x) || !std::isfinite(p.y)) return;
+    const float px = std::floor(p.x);
+    const int sub = std::min(SUBPIXELS - 1, (int) ((p.x - px) * SUBPIXELS));
+    const u64 size64 = (u64) std::lround(ppem * 64);
+    const u64 key = glyph | (size64 << 16) | ((u64) sub << 48);
+    auto bitmap = face.cached(key);
+    if (bitmap == nullptr) {
+      bitmap = renderGlyph(face, glyph, size64 / 64.f, (float) sub / SUBPIXELS);
+      face.cache(key, bitmap);
+    }
+    blit(*bitmap, (int) px, (int) std::floor(p.y + 0.5f));
+    return;
+  }
+  // rasterize the outline with the full transformation
+  face.face().outline(glyph, _outline);
+  if (_outline.isEmpty()) return;
+  const float s = size / face.face().getUnitsPerEm();
+  const float m[6] = {
+    (float) (_a * s), (float) (_b * s), (float) (-_c * s), (float) (-_d * s),
+    (float) (_a * x + _c * y + _e), (float) (_b * x + _d * y + _f),
+  };
+  addOutline(m);
+  fillPath();
+}
+
+void Graphics2D_headless::setColor(color c) {
+  _color = c;
+  // the darkness, thus black is 255
+  const int luma = (int) (color_r(c) * 77 + color_g(c) * 150 + color_b(c) * 29) >> 8;
+  _gray = 255 - luma;
+}
+
+color Graphics2D_headless::getColor() const {
+  return _color;
+}
+
+void Graphics2D_headless::setStroke(const Stroke& s) {
+  _stroke = s;
+}
+
+const Stroke& Graphics2D_headless::getStroke() const {
+  return _stroke;
+}
+
+void Graphics2D_headless::setStrokeWidth(float w) {
+  _stroke.lineWidth = w;
+}
+
+const Font* Graphics2D_headless::getFont() const {
+  return _font;
+}
+
+void Graphics2D_headless::setFont(const Font* font) {
+  _font = static_cast<const Font_headless*>(font);
+}
+
+void Graphics2D_headless::translate(float dx, float dy) {
+  _e += _a * dx + _c * dy;
+  _f += _b * dx + _d * dy;
+}
+
+void Graphics2D_headless::scale(float sx, float sy) {
+  _a *= sx;
+  _b *= sx;
+  _c *= sy;
+  _d *= sy;
+  _sx *= sx;
+  _sy *= sy;
+}
+
+void Graphics2D_headless::rotate(float angle) {
+  const double cos = std::cos((double) angle), sin = std::sin((double) angle);
+  const double a = _a * cos + _c * sin, b = _b * cos + _d * sin;
+  _c = _c * cos - _a * sin;
+  _d = _d * cos - _b * sin;
+  _a = a;
+  _b = b;
+}
+
+void Graphics2D_headless::rotate(float angle, float px, float py) {
+  translate(px, py);
+  rotate(angle);
+  translate(-px, -py);
+}
+
+void Graphics2D_headless::reset() {
+  _a = _d = 1;
+  _b = _c = _e = _f = 0;
+  _sx = _sy = 1;
+}
+
+float Graphics2D_headless::sx() const {
+  return _sx;
+}
+
+float Graphics2D_headless::sy() const {
+  return _sy;
+}
+
+void Graphics2D_headless::drawChar(wchar_t c, float x, float y) {
+  const auto& face = _font->getFace()->face();
+  drawGlyph(_font, face.glyphIndex((u32) c), x, y);
+}
+
+void Graphics2D_headless::drawText(const wstring& t, float x, float y) {
+  const auto& face = _font->getFace()->face();
+  const float scale = _font->getSize() / face.getUnitsPerEm();
+  for (wchar_t c : t) {
+    const u16 glyph = face.glyphIndex((u32) c);
+    drawGlyph(_font, glyph, x, y);
+    x += face.advance(glyph) * scale;
+  }
+}
+
+void Graphics2D_headless::drawGlyphRun(
+  const Font* font,
+  const wchar_t* glyphs,
+  const Point* positions,
+  size_t n,
+  float scale
+) {
+  if (n == 0) return;
+  setFont(font);
+  if (scale != 1) this->scale(scale, scale);
+  const float inv = 1.f / scale;
+  const auto& face = _font->getFace()->face();
+  for (size_t i = 0; i < n; i++) {
+    drawGlyph(_font, face.glyphIndex((u32) glyphs[i]), positions[i].x * inv, positions[i].y * inv);
+  }
+  if (scale != 1) this->scale(inv, inv);
+}
+
+void Graphics2D_headless::drawLine(float x1, float y1, float x2, float y2) {
+  const float r = _stroke.lineWidth / 2;
+  const float dx = x2 - x1, dy = y2 - y1;
+  const float len = std::sqrt(dx * dx + dy * dy);
+  // the direction and the normal scaled by the half of the line width
+  float ux = r, uy = 0;
+  if (len > 0) {
+    ux = dx / len * r;
+    uy = dy / len * r;
+  }
+  _points.clear();
+  if (_stroke.cap == CAP_ROUND) {
+    // half circles at the ends
+    const int n = arcSegments(r, (float) PI);
+    const double base = std::atan2(uy, ux);
+    for (int i = 0; i <= n; i++) {
+      const double t = base - PI / 2 + i * PI / n;
+      _points.emplace_back(x2 + r * (float) std::cos(t), y2 + r * (float) std::sin(t));
+    }
+    for (int i = 0; i <= n; i++) {
+      const double t = base + PI / 2 + i * PI / n;
+      _points.emplace_back(x1 + r * (float) std::cos(t), y1 + r * (float) std::sin(t));
+    }
+  } else {
+    const float ex = _stroke.cap == CAP_SQUARE ? ux : 0;
+    const float ey = _stroke.cap == CAP_SQUARE ? uy : 0;
+    _points.emplace_back(x1 - ex + uy, y1 - ey - ux);
+    _points.emplace_back(x2 + ex + uy, y2 + ey - ux);
+    _points.emplace_back(x2 + ex - uy, y2 + ey + ux);
+    _points.emplace_back(x1 - ex - uy, y1 - ey + ux);
+  }
+  addPolygon(_points, false);
+  fillPath();
+}
+
+void Graphics2D_headless::drawRect(float x, float y, float w, float h) {
+  const float r = _stroke.lineWidth / 2;
+  _points = {{x - r, y - r}, {x + w + r, y - r}, {x + w + r, y + h + r}, {x - r, y + h + r}};
+  addPolygon(_points, false);
+  if (w > 2 * r && h > 2 * r) {
+    // the hole, in the opposite direction
+    _points = {{x + r, y + r}, {x + w - r, y + r}, {x + w - r, y + h - r}, {x + r, y + h - r}};
+    addPolygon(_points, true);
+  }
+  fillPath();
+}
+
+void Graphics2D_headless::fillRect(float x, float y, float w, float h) {
+  _points = {{x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}};
+  addPolygon(_points, false);
+  fillPath();
+}
+
+void Graphics2D_headless::drawRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  const float r = _stroke.lineWidth / 2;
+  addRoundRect(x - r, y - r, w + 2 * r, h + 2 * r, rx + r, ry + r, false);
+  if (w > 2 * r && h > 2 * r) {
+    addRoundRect(x + r, y + r, w - 2 * r, h - 2 * r, rx - r, ry - r, true);
+  }
+  fillPath();
+}
+
+void Graphics2D_headless::fillRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  addRoundRect(x, y, w, h, rx, ry, false);
+  fillPath();
+}
+
+#endif  // BUILD_HEADLESS && !MEM_CHECK
@@ -0,0 +1,221 @@
+#include "config.h"
+
+#if defined(BUILD_HEADLESS) && !defined(MEM_CHECK)
+
+#ifndef GRAPHIC_HEADLESS_H_INCLUDED
+#define GRAPHIC_HEADLESS_H_INCLUDED
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "graphic/graphic.h"
+#include "platform/headless/raster.h"
+#include "platform/headless/truetype.h"
+
+namespace tex {
+
+/** A glyph rendered into coverage, the offsets are relative to the pen */
+struct GlyphBitmap {
+  int left, top, width, height;
+  std::vector<u8> coverage;
+};
+
+/**
+ * A TrueType face shared by all the fonts loaded from the same file, with the
+ * cache of the rendered glyph bitmaps. The cache is shared by all the threads,
+ * and is dropped as a whole when exceeds the budget.
+ */
+class HeadlessFace {
+private:
+  static std::mutex _facesMutex;
+  static std::unordered_map<std::string, sptr<HeadlessFace>> _faces;
+
+  TrueTypeFace _face;
+  std::mutex _mutex;
+  std::unordered_map<u64, sptr<const GlyphBitmap>> _glyphs;
+  size_t _bytes = 0;
+
+public:
+  /** The max bytes of the rendered glyphs to cache per face */
+  static const size_t CACHE_BUDGET;
+
+  explicit HeadlessFace(const std::string& file);
+
+  no_copy_assign(HeadlessFace);
+
+  /** Get the face loaded from the given file, the faces are loaded only once */
+  static sptr<HeadlessFace> load(const std::string& file);
+
+  inline const TrueTypeFace& face() const { return _face; }
+
+  /** Get the cached bitmap of the given key, nullptr if not cached */
+  sptr<const GlyphBitmap> cached(u64 key);
+
+  /** Cache the bitmap with the given key */
+  void cache(u64 key, const sptr<const GlyphBitmap>& bitmap);
+};
+
+class Font_headless : public Font {
+private:
+  sptr<HeadlessFace> _face;
+  std::string _family;
+  int _style;
+  float _size;
+
+public:
+  /** Create font from the given TrueType file */
+  Font_headless(const std::string& file, float size);
+
+  /** Create font with the given family (Serif, SansSerif or Monospaced) */
+  Font_headless(const std::string& family, int style, float size);
+
+  inline const sptr<HeadlessFace>& getFace() const { return _face; }
+
+  float getSize() const override;
+
+  sptr<Font> deriveFont(int style) const override;
+
+  bool operator==(const Font& f) const override;
+
+  bool operator!=(const Font& f) const override;
+
+  ~Font_headless() override = default;
+};
+
+/**************************************************************************************************/
+
+class TextLayout_headless : public TextLayout {
+private:
+  std::wstring _text;
+  sptr<Font_headless> _font;
+
+public:
+  TextLayout_headless(const std::wstring& src, const sptr<Font_headless>& font);
+
+  void getBounds(Rect& r) override;
+
+  void draw(Graphics2D& g2, float x, float y) override;
+};
+
+/**************************************************************************************************/
+
+/**
+ * Graphics to render into an 8-bit buffer in memory, with no dependencies on
+ * the platforms. A pixel is the coverage of the ink, thus 0 is the background
+ * and 255 is fully covered by black, the colors are reduced to their gray
+ * level and composited with the "source over" operator, thus the black glyphs
+ * give their alpha mask exactly. The glyphs drawn with an axis-aligned uniform
+ * scale are rendered once and blit from the cache of the face, positioned to
+ * 1/4 pixel horizontally, others are rasterized from their outlines. The graphics is not thread safe, but the graphics of
+ * different buffers can draw concurrently.
+ */
+class Graphics2D_headless : public Graphics2D {
+private:
+  static Font_headless* _default_font;
+
+  u8* _pixels;
+  int _width, _height, _stride;
+  color _color;
+  // the gray level of the color, 255 is black
+  int _gray;
+  Stroke _stroke;
+  const Font_headless* _font;
+  float _sx, _sy;
+  // the transformation, x' = a * x + c * y + e, y' = b * x + d * y + f
+  double _a = 1, _b = 0, _c = 0, _d = 1, _e = 0, _f = 0;
+
+  // scratches
+  Rasterizer _raster;
+  Path _path;
+  GlyphOutline _outline;
+  std::vector<Point> _points;
+
+  Point transform(float x, float y) const;
+
+  /** Get the count of the lines to flatten an arc with the given radius */
+  int arcSegments(float r, float angle) const;
+
+  void fillPath();
+
+  void addPolygon(const std::vector<Point>& points, bool reverse);
+
+  void addRoundRect(float x, float y, float w, float h, float rx, float ry, bool reverse);
+
+  void addOutline(const float m[6]);
+
+  sptr<const GlyphBitmap> renderGlyph(const HeadlessFace& face, u16 glyph, float ppem, float dx);
+
+  void blit(const GlyphBitmap& bitmap, int x, int y);
+
+  void drawGlyph(const Font_headless* font, u16 glyph, float x, float y);
+
+public:
+  /**
+   * Create a graphics to draw into the given buffer
+   *
+   * @param pixels the buffer, 1 byte per pixel
+   * @param width the width of the buffer in pixels
+   * @param height the height of the buffer in pixels
+   * @param stride the bytes per row
+   */
+  Graphics2D_headless(u8* pixels, int width, int height, int stride);
+
+  static void release();
+
+  void setColor(color c) override;
+
+  color getColor() const override;
+
+  void setStroke(const Stroke& s) override;
+
+  const Stroke& getStroke() const override;
+
+  void setStrokeWidth(float w) override;
+
+  const Font* getFont() const override;
+
+  void setFont(const Font* font) override;
+
+  void translate(float dx, float dy) override;
+
+  void scale(float sx, float sy) override;
+
+  void rotate(float angle) override;
+
+  void rotate(float angle, float px, float py) override;
+
+  void reset() override;
+
+  float sx() const override;
+
+  float sy() const override;
+
+  void drawChar(wchar_t c, float x, float y) override;
+
+  void drawText(const std::wstring& t, float x, float y) override;
+
+  void drawLine(float x1, float y1, float x2, float y2) override;
+
+  void drawRect(float x, float y, float w, float h) override;
+
+  void fillRect(float x, float y, float w, float h) override;
+
+  void drawRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  void fillRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  void drawGlyphRun(
+    const Font* font,
+    const wchar_t* glyphs,
+    const Point* positions,
+    size_t n,
+    float scale
+  ) override;
+};
+
+}  // namespace tex
+
+#endif  // GRAPHIC_HEADLESS_H_INCLUDED
+#endif  // BUILD_HEADLESS && !MEM_CHECK
@@ -0,0 +1,409 @@
+#include "config.h"
+
+#if defined(BUILD_HEADLESS) && !defined(MEM_CHECK)
+
+#include "platform/headless/graphic_svg.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+using namespace std;
+using namespace tex;
+
+// the output is flushed to the writer when the buffer exceeds this
+static const size_t BUFFER_SIZE = 16 * 1024;
+
+/************************************** document implementation ***********************************/
+
+/** Append a number with at most the given decimals, the trailing zeros are dropped */
+static void appendNumber(string& out, double v, int decimals) {
+  char buf[32];
+  int n = snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+  if (n <= 0 || n >= (int) sizeof(buf)) {
+    out += '0';
+    return;
+  }
+  if (decimals > 0) {
+    while (buf[n - 1] == '0') n--;
+    if (buf[n - 1] == '.') n--;
+  }
+  if (n == 2 && buf[0] == '-' && buf[1] == '0') {
+    out += '0';
+    return;
+  }
+  out.append(buf, (size_t) n);
+}
+
+namespace {
+
+/** Append the decomposed outline as SVG path data */
+class SvgPathSink : public OutlineSink {
+private:
+  string& _out;
+  bool _first = true;
+
+  inline void point(float x, float y) {
+    appendNumber(_out, x, 1);
+    _out += ' ';
+    appendNumber(_out, y, 1);
+  }
+
+public:
+  explicit SvgPathSink(string& out) : _out(out) {}
+
+  void moveTo(float x, float y) override {
+    if (!_first) _out += 'Z';
+    _first = false;
+    _out += 'M';
+    point(x, y);
+  }
+
+  void lineTo(float x, float y) override {
+    _out += 'L';
+    point(x, y);
+  }
+
+  void quadTo(float cx, float cy, float x, float y) override {
+    _out += 'Q';
+    point(cx, cy);
+    _out += ' ';
+    point(x, y);
+  }
+
+  void close() {
+    if (!_first) _out += 'Z';
+  }
+};
+
+}  // namespace
+
+SvgDocument::SvgDocument(SvgWriter writer, string idPrefix)
+  : _writer(std::move(writer)), _prefix(std::move(idPrefix)) {
+  _buffer.reserve(BUFFER_SIZE);
+}
+
+SvgDocument::~SvgDocument() {
+  flush();
+}
+
+void SvgDocument::write(const char* str, size_t len) {
+  _buffer.append(str, len);
+  if (_buffer.size() >= BUFFER_SIZE) flush();
+}
+
+void SvgDocument::writeNumber(double v, int decimals) {
+  appendNumber(_buffer, v, decimals);
+  if (_buffer.size() >= BUFFER_SIZE) flush();
+}
+
+void SvgDocument::writeColor(const char* attr, color c) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "=\"#%02x%02x%02x\"", color_r(c), color_g(c), color_b(c));
+  write(" ");
+  write(attr);
+  write(buf);
+  const color a = color_a(c);
+  if (a != 0xff) {
+    write(" ");
+    write(attr);
+    write("-opacity=\"");
+    writeNumber(a / 255., 3);
+    write("\"");
+  }
+}
+
+const string& SvgDocument::symbol(const HeadlessFace& face, u16 glyph) {
+  const auto it = _faces.find(&face);
+  const u32 faceId = it == _faces.end() ? (u32) _faces.size() : it->second;
+  if (it == _faces.end()) _faces[&face] = faceId;
+  const u64 key = ((u64) faceId << 16) | glyph;
+  const auto found = _symbols.find(key);
+  if (found != _symbols.end()) return found->second;
+
+  auto& id = _symbols[key];
+  face.face().outline(glyph, _outline);
+  if (_outline.isEmpty()) return id;
+  id = _prefix + to_string(faceId) + "-" + to_string(glyph);
+  // in font units, flip the y-axis to point down
+  _path.clear();
+  SvgPathSink sink(_path);
+  const float m[6] = {1, 0, 0, -1, 0, 0};
+  _outline.decompose(m, sink);
+  sink.close();
+  write("<symbol id=\"");
+  write(id);
+  write("\" overflow=\"visible\"><path d=\"");
+  write(_path);
+  write("\"/></symbol>");
+  return id;
+}
+
+void SvgDocument::begin(float width, float height) {
+  if (_open) throw ex_invalid_state("The previous formula of the SVG document was not ended!");
+  _open = true;
+  write("<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"");
+  writeNumber(width);
+  write("\" height=\"");
+  writeNumber(height);
+  write("\" viewBox=\"0 0 ");
+  writeNumber(width);
+  write(" ");
+  writeNumber(height);
+  write("\">");
+}
+
+void SvgDocument::end() {
+  if (!_open) return;
+  _open = false;
+  write("</svg>\n");
+  flush();
+}
+
+void SvgDocument::flush() {
+  if (_buffer.empty()) return;
+  _writer(_buffer.data(), _buffer.size());
+  _buffer.clear();
+}
+
+/************************************** graphics implementation ***********************************/
+
+Graphics2D_svg::Graphics2D_svg(SvgDocument& doc)
+  : _doc(doc), _color(black), _stroke(), _font(nullptr), _sx(1), _sy(1) {
+  if (!doc._open) throw ex_invalid_state("Begin a formula before drawing into the SVG document!");
+}
+
+int Graphics2D_svg::decimals() const {
+  // 1/100 pixel
+  const double s = std::max(std::hypot(_a, _b), std::hypot(_c, _d));
+  if (s <= 1) return 2;
+  return std::min(6, 2 + (int) std::ceil(std::log10(s)));
+}
+
+void Graphics2D_svg::writeTransform() {
+  if (_a == 1 && _b == 0 && _c == 0 && _d == 1 && _e == 0 && _f == 0) return;
+  auto& doc = _doc;
+  if (_a == 1 && _b == 0 && _c == 0 && _d == 1) {
+    doc.write(" transform=\"translate(");
+    doc.writeNumber(_e);
+    doc.write(" ");
+    doc.writeNumber(_f);
+    doc.write(")\"");
+    return;
+  }
+  doc.write(" transform=\"matrix(");
+  const double v[] = {_a, _b, _c, _d};
+  for (double x : v) {
+    doc.writeNumber(x, 5);
+    doc.write(" ");
+  }
+  doc.writeNumber(_e);
+  doc.write(" ");
+  doc.writeNumber(_f);
+  doc.write(")\"");
+}
+
+void Graphics2D_svg::writeStroke() {
+  auto& doc = _doc;
+  doc.write(" fill=\"none\"");
+  doc.writeColor("stroke", _color);
+  doc.write(" stroke-width=\"");
+  doc.writeNumber(_stroke.lineWidth, decimals());
+  doc.write("\"");
+  // the defaults of SVG are butt and miter
+  if (_stroke.cap == CAP_ROUND) doc.write(" stroke-linecap=\"round\"");
+  else if (_stroke.cap == CAP_SQUARE) doc.write(" stroke-linecap=\"square\"");
+  if (_stroke.join == JOIN_ROUND) doc.write(" stroke-linejoin=\"round\"");
+  else if (_stroke.join == JOIN_BEVEL) doc.write(" stroke-linejoin=\"bevel\"");
+}
+
+void Graphics2D_svg::writeRect(float x, float y, float w, float h, float rx, float ry, bool fill) {
+  auto& doc = _doc;
+  const int n = decimals();
+  doc.write("<rect x=\"");
+  doc.writeNumber(x, n);
+  doc.write("\" y=\"");
+  doc.writeNumber(y, n);
+  doc.write("\" width=\"");
+  doc.writeNumber(w, n);
+  doc.write("\" height=\"");
+  doc.writeNumber(h, n);
+  doc.write("\"");
+  if (rx > 0 || ry > 0) {
+    doc.write(" rx=\"");
+    doc.writeNumber(rx, n);
+    doc.write("\" ry=\"");
+    doc.writeNumber(ry, n);
+    doc.write("\"");
+  }
+  if (fill) {
+    if (_color != black) doc.writeColor("fill", _color);
+  } else {
+    writeStroke();
+  }
+  writeTransform();
+  doc.write("/>");
+}
+
+void Graphics2D_svg::drawGlyph(const Font_headless* font, u16 glyph, float x, float y) {
+  const auto& face = *font->getFace();
+  auto& doc = _doc;
+  const string& id = doc.symbol(face, glyph);
+  if (id.empty()) return;
+  // the symbol is in font units
+  const double s = font->getSize() / face.face().getUnitsPerEm();
+  doc.write("<use href=\"#");
+  doc.write(id);
+  doc.write("\"");
+  if (_color != black) doc.writeColor("fill", _color);
+  doc.write(" transform=\"matrix(");
+  const double v[] = {_a * s, _b * s, _c * s, _d * s};
+  for (double t : v) {
+    doc.writeNumber(t, 6);
+    doc.write(" ");
+  }
+  doc.writeNumber(_a * x + _c * y + _e);
+  doc.write(" ");
+  doc.writeNumber(_b * x + _d * y + _f);
+  doc.write(")\"/>");
+}
+
+void Graphics2D_svg::setColor(color c) {
+  _color = c;
+}
+
+color Graphics2D_svg::getColor() const {
+  return _color;
+}
+
+void Graphics2D_svg::setStroke(const Stroke& s) {
+  _stroke = s;
+}
+
+const Stroke& Graphics2D_svg::getStroke() const {
+  return _stroke;
+}
+
+void Graphics2D_svg::setStrokeWidth(float w) {
+  _stroke.lineWidth = w;
+}
+
+const Font* Graphics2D_svg::getFont() const {
+  return _font;
+}
+
+void Graphics2D_svg::setFont(const Font* font) {
+  _font = static_cast<const Font_headless*>(font);
+}
+
+void Graphics2D_svg::translate(float dx, float dy) {
+  _e += _a * dx + _c * dy;
+  _f += _b * dx + _d * dy;
+}
+
+void Graphics2D_svg::scale(float sx, float sy) {
+  _a *= sx;
+  _b *= sx;
+  _c *= sy;
+  _d *= sy;
+  _sx *= sx;
+  _sy *= sy;
+}
+
+void Graphics2D_svg::rotate(float angle) {
+  const double cos = std::cos((double) angle), sin = std::sin((double) angle);
+  const double a = _a * cos + _c * sin, b = _b * cos + _d * sin;
+  _c = _c * cos - _a * sin;
+  _d = _d * cos - _b * sin;
+  _a = a;
+  _b = b;
+}
+
+void Graphics2D_svg::rotate(float angle, float px, float py) {
+  translate(px, py);
+  rotate(angle);
+  translate(-px, -py);
+}
+
+void Graphics2D_svg::reset() {
+  _a = _d = 1;
+  _b = _c = _e = _f = 0;
+  _sx = _sy = 1;
+}
+
+float Graphics2D_svg::sx() const {
+  return _sx;
+}
+
+float Graphics2D_svg::sy() const {
+  return _sy;
+}
+
+void Graphics2D_svg::drawChar(wchar_t c, float x, float y) {
+  if (_font == nullptr) return;
+  drawGlyph(_font, _font->getFace()->face().glyphIndex((u32) c), x, y);
+}
+
+void Graphics2D_svg::drawText(const wstring& t, float x, float y) {
+  if (_font == nullptr) return;
+  const auto& face = _font->getFace()->face();
+  const float scale = _font->getSize() / face.getUnitsPerEm();
+  for (wchar_t c : t) {
+    const u16 glyph = face.glyphIndex((u32) c);
+    drawGlyph(_font, glyph, x, y);
+    x += face.advance(glyph) * scale;
+  }
+}
+
+void Graphics2D_svg::drawGlyphRun(
+  const Font* font,
+  const wchar_t* glyphs,
+  const Point* positions,
+  size_t n,
+  float scale
+) {
+  if (n == 0) return;
+  setFont(font);
+  if (scale != 1) this->scale(scale, scale);
+  const float inv = 1.f / scale;
+  const auto& face = _font->getFace()->face();
+  for (size_t i = 0; i < n; i++) {
+    drawGlyph(_font, face.glyphIndex((u32) glyphs[i]), positions[i].x * inv, positions[i].y * inv);
+  }
+  if (scale != 1) this->scale(inv, inv);
+}
+
+void Graphics2D_svg::drawLine(float x1, float y1, float x2, float y2) {
+  auto& doc = _doc;
+  const int n = decimals();
+  doc.write("<path d=\"M");
+  doc.writeNumber(x1, n);
+  doc.write(" ");
+  doc.writeNumber(y1, n);
+  doc.write("L");
+  doc.writeNumber(x2, n);
+  doc.write(" ");
+  doc.writeNumber(y2, n);
+  doc.write("\"");
+  writeStroke();
+  writeTransform();
+  doc.write("/>");
+}
+
+void Graphics2D_svg::drawRect(float x, float y, float w, float h) {
+  writeRect(x, y, w, h, 0, 0, false);
+}
+
+void Graphics2D_svg::fillRect(float x, float y, float w, float h) {
+  writeRect(x, y, w, h, 0, 0, true);
+}
+
+void Graphics2D_svg::drawRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  writeRect(x, y, w, h, rx, ry, false);
+}
+
+void Graphics2D_svg::fillRoundRect(float x, float y, float w, float h, float rx, float ry) {
+  writeRect(x, y, w, h, rx, ry, true);
+}
+
+#endif  // BUILD_HEADLESS && !MEM_CHECK
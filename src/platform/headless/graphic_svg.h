@@ -0,0 +1,171 @@
+#include "config.h"
+
+#if defined(BUILD_HEADLESS) && !defined(MEM_CHECK)
+
+#ifndef GRAPHIC_SVG_H_INCLUDED
+#define GRAPHIC_SVG_H_INCLUDED
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+#include "platform/headless/graphic_headless.h"
+
+namespace tex {
+
+/** The callback to receive the output of a SvgDocument, may be called many times */
+using SvgWriter = std::function<void(const char* data, size_t len)>;
+
+/**
+ * A document to write many formulas as SVG, every formula is an <svg> element.
+ * The glyphs are written as <use> references to <symbol> outlines, every
+ * symbol is defined only once per document, in the first formula uses it, thus
+ * all the formulas of a document must be shown in the same page (e.g. inline
+ * in an HTML page). The output is buffered and streamed to the writer, the
+ * buffer is flushed when a formula ends. The document is not thread safe.
+ */
+class SvgDocument {
+private:
+  friend class Graphics2D_svg;
+
+  SvgWriter _writer;
+  std::string _prefix;
+  std::string _buffer;
+  // the ids of the faces, in the order they were used
+  std::unordered_map<const HeadlessFace*, u32> _faces;
+  // the ids of the defined symbols by (face id << 16) | glyph, empty if the
+  // glyph has no outline
+  std::unordered_map<u64, std::string> _symbols;
+  GlyphOutline _outline;
+  std::string _path;
+  bool _open = false;
+
+  void write(const char* str, size_t len);
+
+  inline void write(const char* str) { write(str, std::strlen(str)); }
+
+  inline void write(const std::string& str) { write(str.data(), str.length()); }
+
+  /** Write a number with at most the given decimals, the trailing zeros are dropped */
+  void writeNumber(double v, int decimals = 2);
+
+  void writeColor(const char* attr, color c);
+
+  /**
+   * Get the id of the symbol of the given glyph, the symbol is defined if not
+   * defined yet. The id is empty if the glyph has no outline.
+   */
+  const std::string& symbol(const HeadlessFace& face, u16 glyph);
+
+public:
+  /**
+   * Create a document writes to the given writer
+   *
+   * @param writer the callback to receive the output
+   * @param idPrefix the prefix of the ids of the symbols, to separate the
+   * documents shown in the same page
+   */
+  explicit SvgDocument(SvgWriter writer, std::string idPrefix = "g");
+
+  no_copy_assign(SvgDocument);
+
+  /** Begin a formula with the given size in pixels */
+  void begin(float width, float height);
+
+  /** End the current formula and flush the output */
+  void end();
+
+  /** Flush the buffered output to the writer */
+  void flush();
+
+  /** Get the count of the symbols defined in this document */
+  inline size_t symbols() const { return _symbols.size(); }
+
+  ~SvgDocument();
+};
+
+/**
+ * Graphics to draw into the current formula of a SvgDocument. The fonts must
+ * be the headless fonts (see Font_headless), their outlines are written as
+ * symbols.
+ */
+class Graphics2D_svg : public Graphics2D {
+private:
+  SvgDocument& _doc;
+  color _color;
+  Stroke _stroke;
+  const Font_headless* _font;
+  float _sx, _sy;
+  // the transformation, x' = a * x + c * y + e, y' = b * x + d * y + f
+  double _a = 1, _b = 0, _c = 0, _d = 1, _e = 0, _f = 0;
+
+  /** Get the decimals to write the coordinates in the user space */
+  int decimals() const;
+
+  void writeTransform();
+
+  void writeStroke();
+
+  void writeRect(float x, float y, float w, float h, float rx, float ry, bool fill);
+
+  void drawGlyph(const Font_headless* font, u16 glyph, float x, float y);
+
+public:
+  explicit Graphics2D_svg(SvgDocument& doc);
+
+  void setColor(color c) override;
+
+  color getColor() const override;
+
+  void setStroke(const Stroke& s) override;
+
+  const Stroke& getStroke() const override;
+
+  void setStrokeWidth(float w) override;
+
+  const Font* getFont() const override;
+
+  void setFont(const Font* font) override;
+
+  void translate(float dx, float dy) override;
+
+  void scale(float sx, float sy) override;
+
+  void rotate(float angle) override;
+
+  void rotate(float angle, float px, float py) override;
+
+  void reset() override;
+
+  float sx() const override;
+
+  float sy() const override;
+
+  void drawChar(wchar_t c, float x, float y) override;
+
+  void drawText(const std::wstring& t, float x, float y) override;
+
+  void drawLine(float x1, float y1, float x2, float y2) override;
+
+  void drawRect(float x, float y, float w, float h) override;
+
+  void fillRect(float x, float y, float w, float h) override;
+
+  void drawRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  void fillRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  void drawGlyphRun(
+    const Font* font,
+    const wchar_t* glyphs,
+    const Point* positions,
+    size_t n,
+    float scale
+  ) override;
+};
+
+}  // namespace tex
+
+#endif  // GRAPHIC_SVG_H_INCLUDED
+#endif  // BUILD_HEADLESS && !MEM_CHECK
@@ -0,0 +1,181 @@
+#include "config.h"
+
+#if defined(BUILD_HEADLESS) && !defined(MEM_CHECK)
+
+#include "platform/headless/raster.h"
+
+#include <cfloat>
+
+using namespace std;
+using namespace tex;
+
+// the max count of the lines to flatten a curve into
+static const int MAX_CURVE_SEGMENTS = 100;
+
+/************************************** path implementation ***************************************/
+
+Path::Path() {
+  clear();
+}
+
+void Path::clear() {
+  _points.clear();
+  _starts.clear();
+  _xMin = _yMin = FLT_MAX;
+  _xMax = _yMax = -FLT_MAX;
+}
+
+void Path::add(float x, float y) {
+  _points.emplace_back(x, y);
+  _xMin = std::min(_xMin, x);
+  _yMin = std::min(_yMin, y);
+  _xMax = std::max(_xMax, x);
+  _yMax = std::max(_yMax, y);
+}
+
+void Path::moveTo(float x, float y) {
+  _starts.push_back((u32) _points.size());
+  add(x, y);
+}
+
+void Path::lineTo(float x, float y) {
+  if (_starts.empty()) _starts.push_back(0);
+  add(x, y);
+}
+
+void Path::quadTo(float cx, float cy, float x, float y) {
+  if (_points.empty()) {
+    moveTo(x, y);
+    return;
+  }
+  const Point p = _points.back();
+  // the deviation of n lines from the curve is |p0 - 2p1 + p2| / (4n^2),
+  // take 1/4 pixel as the tolerance
+  const float ddx = p.x - 2 * cx + x, ddy = p.y - 2 * cy + y;
+  const float dd = std::sqrt(ddx * ddx + ddy * ddy);
+  const int n = std::min(MAX_CURVE_SEGMENTS, std::max(1, (int) std::ceil(std::sqrt(dd))));
+  const float dt = 1.f / n;
+  for (int i = 1; i < n; i++) {
+    const float t = i * dt, mt = 1 - t;
+    add(
+      mt * mt * p.x + 2 * mt * t * cx + t * t * x,
+      mt * mt * p.y + 2 * mt * t * cy + t * t * y
+    );
+  }
+  add(x, y);
+}
+
+void Path::polygon(const Point* points, size_t n) {
+  if (n == 0) return;
+  moveTo(points[0].x, points[0].y);
+  for (size_t i = 1; i < n; i++) add(points[i].x, points[i].y);
+}
+
+/************************************** rasterizer implementation *********************************/
+
+void Rasterizer::reset(int w, int h) {
+  _w = std::max(0, w);
+  _h = std::max(0, h);
+  _acc.assign((size_t) stride() * _h, 0.f);
+}
+
+void Rasterizer::line(float x0, float y0, float x1, float y1) {
+  if (y0 == y1 || !std::isfinite(x0 + y0 + x1 + y1)) return;
+  float dir = 1;
+  if (y0 > y1) {
+    dir = -1;
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+  }
+  if (y1 <= 0 || y0 >= _h) return;
+  const float dxdy = (x1 - x0) / (y1 - y0);
+  if (!std::isfinite(dxdy)) return;
+  const int yStart = (int) std::floor(std::max(y0, 0.f));
+  const int yEnd = (int) std::ceil(std::min(y1, (float) _h));
+  const float w = (float) _w;
+  float x = x0 + (std::max(y0, 0.f) - y0) * dxdy;
+  for (int y = yStart; y < yEnd; y++) {
+    float* row = _acc.data() + (size_t) y * stride();
+    const float dy = std::min((float) (y + 1), y1) - std::max((float) y, y0);
+    const float xNext = x + dxdy * dy;
+    const float d = dy * dir;
+    // the area left to the raster covers the first column, and the area right
+    // to the raster is not visible
+    float xa = std::min(std::max(std::min(x, xNext), 0.f), w);
+    float xb = std::min(std::max(std::max(x, xNext), 0.f), w);
+    const float xaFloor = std::floor(xa);
+    const int xai = (int) xaFloor;
+    const int xbi = (int) std::ceil(xb);
+    if (xbi <= xai + 1) {
+      // inside one pixel
+      const float xmf = 0.5f * (xa + xb) - xaFloor;
+      row[xai] += d - d * xmf;
+      row[xai + 1] += d * xmf;
+    } else {
+      const float s = 1 / (xb - xa);
+      const float xaf = xa - xaFloor;
+      const float a0 = 0.5f * s * (1 - xaf) * (1 - xaf);
+      const float xbf = xb - xbi + 1;
+      const float am = 0.5f * s * xbf * xbf;
+      row[xai] += d * a0;
+      if (xbi == xai + 2) {
+        row[xai + 1] += d * (1 - a0 - am);
+      } else {
+        const float a1 = s * (1.5f - xaf);
+        row[xai + 1] += d * (a1 - a0);
+        for (int xi = xai + 2; xi < xbi - 1; xi++) row[xi] += d * s;
+        const float a2 = a1 + (xbi - xai - 3) * s;
+        row[xbi - 1] += d * (1 - a2 - am);
+      }
+      row[xbi] += d * am;
+    }
+    x = xNext;
+  }
+}
+
+void Rasterizer::fill(const Path& path, float dx, float dy) {
+  const auto& points = path._points;
+  const auto& starts = path._starts;
+  for (size_t i = 0; i < starts.size(); i++) {
+    const size_t start = starts[i];
+    const size_t end = i + 1 < starts.size() ? starts[i + 1] : points.size();
+    if (end <= start + 1) continue;
+    Point prev = points[end - 1];
+    for (size_t j = start; j < end; j++) {
+      const Point& p = points[j];
+      line(prev.x + dx, prev.y + dy, p.x + dx, p.y + dy);
+      prev = p;
+    }
+  }
+}
+
+void Rasterizer::coverage(u8* out, int stride) {
+  for (int y = 0; y < _h; y++) {
+    float* row = _acc.data() + (size_t) y * this->stride();
+    u8* dst = out + (size_t) y * stride;
+    float acc = 0;
+    for (int x = 0; x < _w; x++) {
+      acc += row[x];
+      row[x] = 0;
+      dst[x] = (u8) (std::min(1.f, std::abs(acc)) * 255.f + 0.5f);
+    }
+    row[_w] = row[_w + 1] = 0;
+  }
+}
+
+void Rasterizer::composite(u8* out, int stride, int alpha, int gray) {
+  for (int y = 0; y < _h; y++) {
+    float* row = _acc.data() + (size_t) y * this->stride();
+    u8* dst = out + (size_t) y * stride;
+    float acc = 0;
+    for (int x = 0; x < _w; x++) {
+      acc += row[x];
+      row[x] = 0;
+      const int cov = (int) (std::min(1.f, std::abs(acc)) * 255.f + 0.5f);
+      if (cov != 0) compositePixel(dst[x], cov, alpha, gray);
+    }
+    row[_w] = row[_w + 1] = 0;
+  }
+}
+
+#endif  // BUILD_HEADLESS && !MEM_CHECK
@@ -0,0 +1,105 @@
+#include "config.h"
+
+#if defined(BUILD_HEADLESS) && !defined(MEM_CHECK)
+
+#ifndef RASTER_H_INCLUDED
+#define RASTER_H_INCLUDED
+
+#include <vector>
+
+#include "graphic/graphic_basic.h"
+
+namespace tex {
+
+/** A path flattened into polygons, in the device space */
+class Path {
+private:
+  std::vector<Point> _points;
+  // index of the first point of every polygon
+  std::vector<u32> _starts;
+  float _xMin, _yMin, _xMax, _yMax;
+
+  void add(float x, float y);
+
+public:
+  Path();
+
+  /** Begin a new polygon at (x, y) */
+  void moveTo(float x, float y);
+
+  void lineTo(float x, float y);
+
+  /** Add a quadratic curve, flattened into lines */
+  void quadTo(float cx, float cy, float x, float y);
+
+  /** Add the polygon of the given points */
+  void polygon(const Point* points, size_t n);
+
+  void clear();
+
+  inline bool isEmpty() const { return _points.empty(); }
+
+  inline float xMin() const { return _xMin; }
+
+  inline float yMin() const { return _yMin; }
+
+  inline float xMax() const { return _xMax; }
+
+  inline float yMax() const { return _yMax; }
+
+  friend class Rasterizer;
+};
+
+/**
+ * Scan converter computes the exact coverage of the pixels by accumulating
+ * the signed area of every edge, then integrating per row. The polygons are
+ * closed implicitly and filled with the non-zero rule, the coverage saturates
+ * where the polygons overlap.
+ */
+class Rasterizer {
+private:
+  int _w = 0, _h = 0;
+  // the accumulation buffer, 2 more cells per row for the edges touching the
+  // right side
+  std::vector<float> _acc;
+
+  inline int stride() const { return _w + 2; }
+
+  void line(float x0, float y0, float x1, float y1);
+
+public:
+  Rasterizer() = default;
+
+  /** Clear and resize the raster to (w, h) */
+  void reset(int w, int h);
+
+  inline int width() const { return _w; }
+
+  inline int height() const { return _h; }
+
+  /** Accumulate the given path, translated by (dx, dy) */
+  void fill(const Path& path, float dx, float dy);
+
+  /** Write the coverage into the given buffer, and clear the raster */
+  void coverage(u8* out, int stride);
+
+  /**
+   * Composite the coverage multiplied by the given alpha (0 - 255) of the
+   * given gray level over the given 8-bit buffer, and clear the raster.
+   */
+  void composite(u8* out, int stride, int alpha, int gray);
+};
+
+/**
+ * Composite the gray level with the coverage multiplied by the given alpha
+ * over the pixel
+ */
+inline void compositePixel(u8& dst, int cov, int alpha, int gray) {
+  const int a = (cov * alpha + 127) / 255;
+  dst = (u8) ((gray * a + dst * (255 - a) + 127) / 255);
+}
+
+}  // namespace tex
+
+#endif  // RASTER_H_INCLUDED
+#endif  // BUILD_HEADLESS && !MEM_CHECK
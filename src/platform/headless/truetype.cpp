@@ -0,0 +1,365 @@
+#include "config.h"
+
+#if defined(BUILD_HEADLESS) && !defined(MEM_CHECK)
+
+#include "platform/headless/truetype.h"
+
+#include <fstream>
+
+#include "graphic/graphic_basic.h"
+
+using namespace std;
+using namespace tex;
+
+// flags of the points of a simple glyph
+enum SimpleFlag : u8 {
+  ON_CURVE = 0x01,
+  X_SHORT = 0x02,
+  Y_SHORT = 0x04,
+  REPEAT = 0x08,
+  X_SAME_OR_POSITIVE = 0x10,
+  Y_SAME_OR_POSITIVE = 0x20,
+};
+
+// flags of the components of a composite glyph
+enum CompositeFlag : u16 {
+  ARGS_ARE_WORDS = 0x0001,
+  ARGS_ARE_XY_VALUES = 0x0002,
+  HAVE_A_SCALE = 0x0008,
+  MORE_COMPONENTS = 0x0020,
+  HAVE_X_AND_Y_SCALE = 0x0040,
+  HAVE_TWO_BY_TWO = 0x0080,
+};
+
+// the max depth of the nested composite glyphs
+static const int MAX_COMPOSITE_DEPTH = 8;
+
+void GlyphOutline::clear() {
+  points.clear();
+  ends.clear();
+  xMin = yMin = xMax = yMax = 0;
+}
+
+void GlyphOutline::decompose(const float m[6], OutlineSink& sink) const {
+  auto at = [&](size_t i) {
+    const auto& p = points[i];
+    return Point(m[0] * p.x + m[2] * p.y + m[4], m[1] * p.x + m[3] * p.y + m[5]);
+  };
+  auto mid = [](const Point& a, const Point& b) {
+    return Point((a.x + b.x) / 2, (a.y + b.y) / 2);
+  };
+  size_t start = 0;
+  for (const u16 e : ends) {
+    const size_t end = e;
+    if (end < start) continue;
+    // find the start point, the implied on-curve point between 2 off-curve
+    // points if no on-curve point at the start or the end
+    Point first;
+    size_t from = start, to = end + 1;
+    if (points[start].onCurve) {
+      first = at(start);
+      from = start + 1;
+    } else if (points[end].onCurve) {
+      first = at(end);
+      to = end;
+    } else {
+      first = mid(at(start), at(end));
+    }
+    sink.moveTo(first.x, first.y);
+    bool pending = false;
+    Point ctrl;
+    for (size_t i = from; i < to; i++) {
+      const Point p = at(i);
+      if (points[i].onCurve) {
+        if (pending) sink.quadTo(ctrl.x, ctrl.y, p.x, p.y);
+        else sink.lineTo(p.x, p.y);
+        pending = false;
+      } else {
+        if (pending) {
+          const Point q = mid(ctrl, p);
+          sink.quadTo(ctrl.x, ctrl.y, q.x, q.y);
+        }
+        ctrl = p;
+        pending = true;
+      }
+    }
+    if (pending) sink.quadTo(ctrl.x, ctrl.y, first.x, first.y);
+    start = end + 1;
+  }
+}
+
+TrueTypeFace::TrueTypeFace(const string& path) : _path(path) {
+  ifstream in(path, ios::binary);
+  if (!in) throw ex_file_not_found("Font file '" + path + "' not found!");
+  in.seekg(0, ios::end);
+  const auto size = (size_t) in.tellg();
+  in.seekg(0, ios::beg);
+  _data.resize(size);
+  if (size > 0) in.read((char*) _data.data(), (streamsize) size);
+  if (!in) throw ex_font_loaded("Cannot read the font file '" + path + "'!");
+  parse();
+}
+
+u16 TrueTypeFace::u16At(u32 offset) const {
+  if ((size_t) offset + 2 > _data.size()) return 0;
+  const u8* p = _data.data() + offset;
+  return (u16) ((p[0] << 8) | p[1]);
+}
+
+u32 TrueTypeFace::u32At(u32 offset) const {
+  if ((size_t) offset + 4 > _data.size()) return 0;
+  const u8* p = _data.data() + offset;
+  return ((u32) p[0] << 24) | ((u32) p[1] << 16) | ((u32) p[2] << 8) | (u32) p[3];
+}
+
+void TrueTypeFace::parse() {
+  const u32 version = u32At(0);
+  if (version != 0x00010000 && version != 0x74727565 /* 'true' */) {
+    throw ex_font_loaded("'" + _path + "' is not a TrueType font!");
+  }
+  u32 head = 0, maxp = 0, hhea = 0;
+  const u16 tables = u16At(4);
+  for (u16 i = 0; i < tables; i++) {
+    const u32 record = 12 + 16 * i;
+    const u32 tag = u32At(record);
+    const u32 offset = u32At(record + 8);
+    switch (tag) {
+      case 0x636d6170: _cmap = offset; break; // cmap
+      case 0x676c7966: _glyf = offset; break; // glyf
+      case 0x68656164: head = offset; break;  // head
+      case 0x68686561: hhea = offset; break;  // hhea
+      case 0x686d7478: _hmtx = offset; break; // hmtx
+      case 0x6c6f6361: _loca = offset; break; // loca
+      case 0x6d617870: maxp = offset; break;  // maxp
+      default: break;
+    }
+  }
+  if (head == 0 || maxp == 0 || hhea == 0 || _hmtx == 0 || _loca == 0 || _glyf == 0) {
+    throw ex_font_loaded("'" + _path + "' has no TrueType outlines!");
+  }
+  _unitsPerEm = u16At(head + 18);
+  if (_unitsPerEm == 0) _unitsPerEm = 1000;
+  _longLoca = i16At(head + 50) != 0;
+  _glyphCount = u16At(maxp + 4);
+  _ascent = i16At(hhea + 4);
+  _descent = i16At(hhea + 6);
+  _hMetricCount = u16At(hhea + 34);
+  _cmap = _cmap == 0 ? 0 : findCmap();
+}
+
+u32 TrueTypeFace::findCmap() const {
+  // prefer the full unicode table, then the BMP table, then any table with
+  // the format 4 or 12
+  u32 full = 0, bmp = 0, any = 0;
+  const u16 tables = u16At(_cmap + 2);
+  for (u16 i = 0; i < tables; i++) {
+    const u32 record = _cmap + 4 + 8 * i;
+    const u16 platform = u16At(record);
+    const u16 encoding = u16At(record + 2);
+    const u32 offset = _cmap + u32At(record + 4);
+    const u16 format = u16At(offset);
+    if (format != 4 && format != 12) continue;
+    if (format == 12 && (platform == 0 || (platform == 3 && encoding == 10))) {
+      full = offset;
+    } else if (format == 4 && (platform == 0 || (platform == 3 && encoding == 1))) {
+      bmp = offset;
+    } else if (any == 0) {
+      any = offset;
+    }
+  }
+  return full != 0 ? full : (bmp != 0 ? bmp : any);
+}
+
+u16 TrueTypeFace::glyphIndex(u32 chr) const {
+  if (_cmap == 0) return 0;
+  const u16 format = u16At(_cmap);
+  if (format == 12) {
+    const u32 groups = u32At(_cmap + 12);
+    // the groups are sorted by the start character
+    u32 lo = 0, hi = groups;
+    while (lo < hi) {
+      const u32 mid = (lo + hi) / 2;
+      const u32 group = _cmap + 16 + 12 * mid;
+      if (chr < u32At(group)) {
+        hi = mid;
+      } else if (chr > u32At(group + 4)) {
+        lo = mid + 1;
+      } else {
+        const u32 glyph = u32At(group + 8) + (chr - u32At(group));
+        return glyph < _glyphCount ? (u16) glyph : 0;
+      }
+    }
+    return 0;
+  }
+  // format 4, binary search the segment whose end is the first >= chr
+  if (chr > 0xffff) return 0;
+  const u16 segments = u16At(_cmap + 6) / 2;
+  const u32 ends = _cmap + 14;
+  const u32 starts = ends + 2 * segments + 2;
+  const u32 deltas = starts + 2 * segments;
+  const u32 ranges = deltas + 2 * segments;
+  u32 lo = 0, hi = segments;
+  while (lo < hi) {
+    const u32 mid = (lo + hi) / 2;
+    if (u16At(ends + 2 * mid) < chr) lo = mid + 1;
+    else hi = mid;
+  }
+  if (lo >= segments) return 0;
+  const u32 start = u16At(starts + 2 * lo);
+  if (chr < start) return 0;
+  const u16 delta = u16At(deltas + 2 * lo);
+  const u32 rangeOffset = ranges + 2 * lo;
+  const u16 range = u16At(rangeOffset);
+  if (range == 0) return (u16) (chr + delta);
+  const u16 glyph = u16At(rangeOffset + range + 2 * (chr - start));
+  return glyph == 0 ? 0 : (u16) (glyph + delta);
+}
+
+u16 TrueTypeFace::advance(u16 glyph) const {
+  if (_hMetricCount == 0) return 0;
+  const u16 i = glyph < _hMetricCount ? glyph : (u16) (_hMetricCount - 1);
+  return u16At(_hmtx + 4 * i);
+}
+
+bool TrueTypeFace::glyphRange(u16 glyph, u32& start, u32& end) const {
+  if (glyph >= _glyphCount) return false;
+  if (_longLoca) {
+    start = u32At(_loca + 4 * glyph);
+    end = u32At(_loca + 4 * glyph + 4);
+  } else {
+    start = 2 * (u32) u16At(_loca + 2 * glyph);
+    end = 2 * (u32) u16At(_loca + 2 * glyph + 2);
+  }
+  start += _glyf;
+  end += _glyf;
+  // empty glyph (e.g. the space) or broken table
+  return start < end && end <= _data.size();
+}
+
+void TrueTypeFace::outline(u16 glyph, GlyphOutline& outline) const {
+  outline.clear();
+  u32 start, end;
+  if (!glyphRange(glyph, start, end)) return;
+  outline.xMin = i16At(start + 2);
+  outline.yMin = i16At(start + 4);
+  outline.xMax = i16At(start + 6);
+  outline.yMax = i16At(start + 8);
+  const float identity[6] = {1, 0, 0, 1, 0, 0};
+  appendOutline(glyph, identity, outline, 0);
+}
+
+void TrueTypeFace::appendOutline(u16 glyph, const float m[6], GlyphOutline& outline, int depth) const {
+  u32 start, end;
+  if (depth > MAX_COMPOSITE_DEPTH || !glyphRange(glyph, start, end)) return;
+  const i16 contours = i16At(start);
+  if (contours >= 0) {
+    appendSimple(start + 10, contours, m, outline);
+    return;
+  }
+  u32 p = start + 10;
+  u16 flags;
+  do {
+    flags = u16At(p);
+    const u16 component = u16At(p + 2);
+    p += 4;
+    float dx = 0, dy = 0;
+    if (flags & ARGS_ARE_WORDS) {
+      if (flags & ARGS_ARE_XY_VALUES) {
+        dx = i16At(p);
+        dy = i16At(p + 2);
+      }
+      p += 4;
+    } else {
+      if (flags & ARGS_ARE_XY_VALUES) {
+        const u16 args = u16At(p);
+        dx = (i8) (args >> 8);
+        dy = (i8) (args & 0xff);
+      }
+      p += 2;
+    }
+    // the transformation of the component in F2Dot14
+    float a = 1, b = 0, c = 0, d = 1;
+    if (flags & HAVE_A_SCALE) {
+      a = d = i16At(p) / 16384.f;
+      p += 2;
+    } else if (flags & HAVE_X_AND_Y_SCALE) {
+      a = i16At(p) / 16384.f;
+      d = i16At(p + 2) / 16384.f;
+      p += 4;
+    } else if (flags & HAVE_TWO_BY_TWO) {
+      a = i16At(p) / 16384.f;
+      b = i16At(p + 2) / 16384.f;
+      c = i16At(p + 4) / 16384.f;
+      d = i16At(p + 6) / 16384.f;
+      p += 8;
+    }
+    // concatenate with the parent, x' = m0 * x + m2 * y + m4
+    const float t[6] = {
+      m[0] * a + m[2] * b,
+      m[1] * a + m[3] * b,
+      m[0] * c + m[2] * d,
+      m[1] * c + m[3] * d,
+      m[0] * dx + m[2] * dy + m[4],
+      m[1] * dx + m[3] * dy + m[5],
+    };
+    appendOutline(component, t, outline, depth + 1);
+  } while ((flags & MORE_COMPONENTS) && p < end);
+}
+
+void TrueTypeFace::appendSimple(u32 offset, i16 contours, const float m[6], GlyphOutline& outline) const {
+  if (contours == 0) return;
+  const u16 count = (u16) (u16At(offset + 2 * (contours - 1)) + 1);
+  const u32 instructions = u16At(offset + 2 * contours);
+  u32 p = offset + 2 * contours + 2 + instructions;
+  const size_t base = outline.points.size();
+  const size_t size = _data.size();
+
+  // read the flags
+  outline.points.resize(base + count);
+  vector<u8> flags(count);
+  for (u16 i = 0; i < count && p < size;) {
+    const u8 f = _data[p++];
+    flags[i++] = f;
+    if ((f & REPEAT) && p < size) {
+      for (u8 r = _data[p++]; r > 0 && i < count; r--) flags[i++] = f;
+    }
+  }
+  // read the x coordinates
+  i32 x = 0;
+  for (u16 i = 0; i < count; i++) {
+    const u8 f = flags[i];
+    if (f & X_SHORT) {
+      const i32 dx = p < size ? _data[p++] : 0;
+      x += (f & X_SAME_OR_POSITIVE) ? dx : -dx;
+    } else if (!(f & X_SAME_OR_POSITIVE)) {
+      x += i16At(p);
+      p += 2;
+    }
+    outline.points[base + i].x = (float) x;
+  }
+  // read the y coordinates
+  i32 y = 0;
+  for (u16 i = 0; i < count; i++) {
+    const u8 f = flags[i];
+    if (f & Y_SHORT) {
+      const i32 dy = p < size ? _data[p++] : 0;
+      y += (f & Y_SAME_OR_POSITIVE) ? dy : -dy;
+    } else if (!(f & Y_SAME_OR_POSITIVE)) {
+      y += i16At(p);
+      p += 2;
+    }
+    auto& pt = outline.points[base + i];
+    const float px = pt.x, py = (float) y;
+    pt.x = m[0] * px + m[2] * py + m[4];
+    pt.y = m[1] * px + m[3] * py + m[5];
+    pt.onCurve = (f & ON_CURVE) != 0;
+  }
+  // the ends of the contours
+  for (i16 i = 0; i < contours; i++) {
+    const u16 e = u16At(offset + 2 * i);
+    if (e >= count) break;
+    outline.ends.push_back((u16) (base + e));
+  }
+}
+
+#endif  // BUILD_HEADLESS && !MEM_CHECK
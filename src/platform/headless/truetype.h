@@ -0,0 +1,124 @@
+#include "config.h"
+
+#if defined(BUILD_HEADLESS) && !defined(MEM_CHECK)
+
+#ifndef TRUETYPE_H_INCLUDED
+#define TRUETYPE_H_INCLUDED
+
+#include <string>
+#include <vector>
+
+#include "common.h"
+
+namespace tex {
+
+/** A point of a glyph outline in font units */
+struct OutlinePoint {
+  float x, y;
+  // false if it is the control point of a quadratic curve
+  bool onCurve;
+};
+
+/** Receiver of the segments of a decomposed outline */
+class OutlineSink {
+public:
+  /** Begin a new contour, the contours are closed implicitly */
+  virtual void moveTo(float x, float y) = 0;
+
+  virtual void lineTo(float x, float y) = 0;
+
+  virtual void quadTo(float cx, float cy, float x, float y) = 0;
+
+  virtual ~OutlineSink() = default;
+};
+
+/** The outline of a glyph in font units, y-axis points up */
+struct GlyphOutline {
+  std::vector<OutlinePoint> points;
+  // index of the last point of every contour
+  std::vector<u16> ends;
+  // the bounding box
+  i16 xMin = 0, yMin = 0, xMax = 0, yMax = 0;
+
+  inline bool isEmpty() const { return ends.empty(); }
+
+  void clear();
+
+  /**
+   * Decompose the contours into lines and quadratic curves, the points are
+   * transformed by m, thus x' = m0 * x + m2 * y + m4, y' = m1 * x + m3 * y + m5.
+   * The implied on-curve points between 2 off-curve points are inserted.
+   */
+  void decompose(const float m[6], OutlineSink& sink) const;
+};
+
+/**
+ * A TrueType font (with glyf outlines) loaded from a file, only the tables
+ * required to draw the glyphs are read: the character map (format 4 and 12),
+ * the horizontal metrics and the outlines (simple and composite). The hinting
+ * instructions are ignored. The face is immutable after loaded, thus safe for
+ * concurrent readers.
+ */
+class TrueTypeFace {
+private:
+  std::string _path;
+  std::vector<u8> _data;
+
+  u16 _unitsPerEm = 1000;
+  bool _longLoca = false;
+  u16 _glyphCount = 0;
+  u16 _hMetricCount = 0;
+  i16 _ascent = 0, _descent = 0;
+
+  // offsets of the tables, 0 if absent
+  u32 _cmap = 0, _loca = 0, _glyf = 0, _hmtx = 0;
+
+  u16 u16At(u32 offset) const;
+
+  u32 u32At(u32 offset) const;
+
+  inline i16 i16At(u32 offset) const { return (i16) u16At(offset); }
+
+  void parse();
+
+  u32 findCmap() const;
+
+  bool glyphRange(u16 glyph, u32& start, u32& end) const;
+
+  void appendOutline(u16 glyph, const float m[6], GlyphOutline& outline, int depth) const;
+
+  void appendSimple(u32 offset, i16 contours, const float m[6], GlyphOutline& outline) const;
+
+public:
+  /** Load the font from the given file, throw ex_file_not_found or ex_font_loaded if failed */
+  explicit TrueTypeFace(const std::string& path);
+
+  no_copy_assign(TrueTypeFace);
+
+  inline const std::string& getPath() const { return _path; }
+
+  inline u16 getUnitsPerEm() const { return _unitsPerEm; }
+
+  /** Get the ascent in font units, positive */
+  inline i16 getAscent() const { return _ascent; }
+
+  /** Get the descent in font units, positive */
+  inline i16 getDescent() const { return (i16) -_descent; }
+
+  /** Get the glyph index of the given character, 0 (the missing glyph) if not found */
+  u16 glyphIndex(u32 chr) const;
+
+  /** Get the advance width of the given glyph in font units */
+  u16 advance(u16 glyph) const;
+
+  /**
+   * Get the outline of the given glyph, the composite glyphs are resolved
+   * into the simple ones. The curves are quadratic.
+   */
+  void outline(u16 glyph, GlyphOutline& outline) const;
+};
+
+}  // namespace tex
+
+#endif  // TRUETYPE_H_INCLUDED
+#endif  // BUILD_HEADLESS && !MEM_CHECK
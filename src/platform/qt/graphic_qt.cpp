@@ -12,6 +12,7 @@
 #include <QColor>
 #include <QFont>
 #include <QFontDatabase>
+#include <QGlyphRun>
 #include <QPainter>
 #include <QPen>
 #include <QPointF>
@@ -106,6 +107,15 @@ QFont Font_qt::getQFont() const {
   return _font;
 }
 
+const QRawFont& Font_qt::getQRawFont(qreal dpi) const {
+  if (!_rawFont.isValid() || _rawDpi != dpi) {
+    _rawFont = QRawFont::fromFont(_font);
+    _rawFont.setPixelSize(_font.pointSizeF() * dpi / 72);
+    _rawDpi = dpi;
+  }
+  return _rawFont;
+}
+
 float Font_qt::getSize() const {
   return _font.pointSizeF();
 }
@@ -306,6 +316,37 @@ void Graphics2D_qt::drawText(const std::wstring& t, float x, float y) {
   _painter->drawText(QPointF(x, y), text);
 }
 
+void Graphics2D_qt::drawGlyphRun(
+  const Font* font,
+  const wchar_t* glyphs,
+  const Point* positions,
+  size_t n,
+  float scale
+) {
+  if (n == 0) return;
+  _font = static_cast<const Font_qt*>(font);
+  const QRawFont& raw = _font->getQRawFont(_painter->device()->logicalDpiY());
+  const QVector<quint32> indexes = raw.glyphIndexesForString(QString::fromWCharArray(glyphs, (int) n));
+  if (indexes.size() != (int) n) {
+    // not one glyph per character
+    Graphics2D::drawGlyphRun(font, glyphs, positions, n, scale);
+    return;
+  }
+  const float inv = 1.f / scale;
+  QVector<QPointF> points(indexes.size());
+  for (size_t i = 0; i < n; i++) points[i] = QPointF(positions[i].x * inv, positions[i].y * inv);
+  QGlyphRun run;
+  run.setRawFont(raw);
+  run.setGlyphIndexes(indexes);
+  run.setPositions(points);
+  if (scale != 1) {
+    _painter->save();
+    _painter->scale(scale, scale);
+  }
+  _painter->drawGlyphRun(QPointF(0, 0), run);
+  if (scale != 1) _painter->restore();
+}
+
 void Graphics2D_qt::drawLine(float x1, float y1, float x2, float y2) {
   _painter->drawLine(QPointF(x1, y1), QPointF(x2, y2));
 }
@@ -12,6 +12,7 @@
 #include <QFont>
 #include <QMap>
 #include <QPainter>
+#include <QRawFont>
 #include <QString>
 
 namespace tex {
@@ -23,6 +24,9 @@ class Font_qt : public Font {
 
 private:
   QFont _font;
+  // the raw font to draw the glyph runs, created lazily for the dpi
+  mutable QRawFont _rawFont;
+  mutable qreal _rawDpi = 0;
 
   static QMap<QString, QString> _loaded_families;
 
@@ -38,6 +42,9 @@ public:
 
   QFont getQFont() const;
 
+  /** Get the raw font with the same pixel size as this font on a device with the given dpi */
+  const QRawFont& getQRawFont(qreal dpi) const;
+
   virtual float getSize() const override;
 
   virtual sptr<Font> deriveFont(int style) const override;
@@ -128,6 +135,14 @@ public:
   virtual void drawRoundRect(float x, float y, float w, float h, float rx, float ry) override;
 
   virtual void fillRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  virtual void drawGlyphRun(
+    const Font* font,
+    const wchar_t* glyphs,
+    const Point* positions,
+    size_t n,
+    float scale
+  ) override;
 };
 
 }
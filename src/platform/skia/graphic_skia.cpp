@@ -6,6 +6,8 @@
 
 #include <utility>
 
+#include <core/SkTextBlob.h>
+
 using namespace tex;
 using namespace std;
 
@@ -258,6 +260,39 @@ void Graphics2D_skia::drawText(const wstring &t, float x, float y) {
   _canvas->drawString(str.c_str(), x, y, _font->getSkFont(), _paint);
 }
 
+void Graphics2D_skia::drawGlyphRun(
+  const Font* font,
+  const wchar_t* glyphs,
+  const Point* positions,
+  size_t n,
+  float scale
+) {
+  if (n == 0) return;
+  _font = static_cast<const Font_skia*>(font);
+  const SkFont f = _font->getSkFont();
+  SkTextBlobBuilder builder;
+  const auto& run = builder.allocRunPos(f, (int) n);
+  const auto encoding = sizeof(wchar_t) == 4 ? SkTextEncoding::kUTF32 : SkTextEncoding::kUTF16;
+  const int count = f.textToGlyphs(glyphs, n * sizeof(wchar_t), encoding, run.glyphs, (int) n);
+  if (count != (int) n) {
+    // not one glyph per character
+    Graphics2D::drawGlyphRun(font, glyphs, positions, n, scale);
+    return;
+  }
+  const float inv = 1.f / scale;
+  for (size_t i = 0; i < n; i++) {
+    run.pos[2 * i] = positions[i].x * inv;
+    run.pos[2 * i + 1] = positions[i].y * inv;
+  }
+  _paint.setStyle(SkPaint::kFill_Style);
+  if (scale != 1) {
+    _canvas->save();
+    _canvas->scale(scale, scale);
+  }
+  _canvas->drawTextBlob(builder.make(), 0, 0, _paint);
+  if (scale != 1) _canvas->restore();
+}
+
 void Graphics2D_skia::drawLine(float x1, float y1, float x2, float y2) {
   _paint.setStyle(SkPaint::kStroke_Style);
   _canvas->drawLine(x1, y1, x2, y2, _paint);
@@ -134,6 +134,14 @@ public:
   virtual void drawRoundRect(float x, float y, float w, float h, float rx, float ry) override;
 
   virtual void fillRoundRect(float x, float y, float w, float h, float rx, float ry) override;
+
+  virtual void drawGlyphRun(
+    const Font* font,
+    const wchar_t* glyphs,
+    const Point* positions,
+    size_t n,
+    float scale
+  ) override;
 };
 
 }
@@ -1,6 +1,7 @@
 #include "render.h"
 
 #include "atom/atom.h"
+#include "context.h"
 #include "core/core.h"
 #include "core/formula.h"
 
@@ -8,18 +9,19 @@ using namespace std;
 using namespace tex;
 
 const color TeXRender::_defaultcolor = black;
-float TeXRender::_defaultSize = -1;
-float TeXRender::_magFactor = 0;
+
+/** Get the text size magnified by the current context, see Context::setMagnification */
+static float magnify(float textSize) {
+  const auto& ctx = Context::current();
+  if (ctx.getMagFactor() != 0) return textSize * std::abs(ctx.getMagFactor());
+  return textSize;
+}
 
 TeXRender::TeXRender(const sptr<Box>& box, float textSize, bool trueValues) {
   _box = box;
-  if (_defaultSize != -1) _textSize = _defaultSize;
-  if (_magFactor != 0) {
-    _textSize = textSize * std::abs(_magFactor);
-  } else {
-    _textSize = textSize;
-  }
-  if (!trueValues) _insets += (int) (0.18f * textSize);
+  _textSize = magnify(textSize);
+  _pixelsPerPoint = Context::current().getPixelsPerPoint();
+  if (!trueValues) _insets += defaultInset(textSize);
   if (Box::DEBUG) {
     const auto group = wrap(box);
     _box = group;
@@ -74,35 +76,41 @@ float TeXRender::getTextSize() const {
   return _textSize;
 }
 
+TeXMetrics TeXRender::metricsOf(const Box& box, float pixelsOfUnit, const Insets& insets) {
+  const float height = box._height * pixelsOfUnit + insets.top;
+  const float depth = box._depth * pixelsOfUnit + insets.bottom;
+  TeXMetrics m;
+  m.width = (int) (box._width * pixelsOfUnit + insets.left + insets.right);
+  m.height = (int) (height + depth);
+  m.depth = (int) depth;
+  m.baseline = height / (height + depth);
+  return m;
+}
+
 int TeXRender::getHeight() const {
-  return (int) (
-    _box->_height * _textSize +
-    _box->_depth * _textSize +
-    _insets.top + _insets.bottom
-  );
+  return metricsOf(*_box, pixelsOfUnit(), _insets).height;
 }
 
 int TeXRender::getDepth() const {
-  return (int) (_box->_depth * _textSize + _insets.bottom);
+  return metricsOf(*_box, pixelsOfUnit(), _insets).depth;
 }
 
 int TeXRender::getWidth() const {
-  return (int) (_box->_width * _textSize + _insets.left + _insets.right);
+  return metricsOf(*_box, pixelsOfUnit(), _insets).width;
 }
 
 float TeXRender::getBaseline() const {
-  return (
-    (_box->_height * _textSize + _insets.top) /
-    ((_box->_height + _box->_depth) * _textSize + _insets.top + _insets.bottom)
-  );
+  return metricsOf(*_box, pixelsOfUnit(), _insets).baseline;
 }
 
 void TeXRender::setTextSize(float textSize) {
   _textSize = textSize;
+  invalidate();
 }
 
 void TeXRender::setForeground(color fg) {
   _fg = fg;
+  invalidate();
 }
 
 Insets TeXRender::getInsets() {
@@ -111,7 +119,8 @@ Insets TeXRender::getInsets() {
 
 void TeXRender::setInsets(const Insets& insets, bool trueval) {
   _insets = insets;
-  if (!trueval) _insets += (int) (0.18f * _textSize);
+  if (!trueval) _insets += defaultInset(_textSize);
+  invalidate();
 }
 
 void TeXRender::setWidth(int width, Alignment align) {
@@ -120,6 +129,7 @@ void TeXRender::setWidth(int width, Alignment align) {
   // only care if new width larger than old
   if (diff > 0) {
     _box = sptrOf<HBox>(_box, (float) width, align);
+    invalidate();
   }
 }
 
@@ -129,12 +139,90 @@ void TeXRender::setHeight(int height, Alignment align) {
   // only care if new height larger than old
   if (diff > 0) {
     _box = sptrOf<VBox>(_box, diff, align);
+    invalidate();
+  }
+}
+
+sptr<Box> TeXRender::breakLines(
+  const sptr<Box>& box, float width, float lineSpace,
+  Alignment align, bool isMaxWidth, bool optimal
+) {
+  if (width == 0) return box;
+  sptr<Box> lines = box;
+  if (lineSpace != 0) {
+    profile_phase(split);
+    lines = BoxSplitter::split(box, width, lineSpace, optimal);
+  }
+  return sptr<Box>(new HBox(lines, isMaxWidth ? lines->_width : width, align));
+}
+
+void TeXRender::relayout(int width, Alignment align, float lineSpace) {
+  if (_unsplit == nullptr) {
+    throw ex_invalid_state("Cannot relayout a render with the debug boxes!");
   }
+#ifdef HAVE_PROFILE
+  ProfileScope profile(&_stats);
+#endif
+  // the boxes are shared with the old lines, the splitter never modifies them
+  _box = breakLines(_unsplit, width * _pixel, lineSpace * _pixel, align, _isMaxWidth, _optimalBreak);
+  invalidate();
 }
 
 void TeXRender::draw(Graphics2D& g2, int x, int y) {
+#ifdef HAVE_PROFILE
+  ProfileScope profile(&_stats);
+  {
+    profile_phase(draw);
+    drawBox(g2, x, y);
+  }
+  Profiler::report(_stats);
+#else
+  drawBox(g2, x, y);
+#endif
+}
+
+void TeXRender::draw(Graphics2D& g2, int x, int y, float scale) {
+  if (scale == 1) {
+    draw(g2, x, y);
+    return;
+  }
+#ifdef HAVE_PROFILE
+  ProfileScope profile(&_stats);
+  {
+    profile_phase(draw);
+    drawTree(g2, x, y, scale);
+  }
+  Profiler::report(_stats);
+#else
+  drawTree(g2, x, y, scale);
+#endif
+}
+
+void TeXRender::invalidate() {
+  _displayList = nullptr;
+  _draws = 0;
+}
+
+void TeXRender::drawBox(Graphics2D& g2, int x, int y) {
+  if (_displayList != nullptr && !_displayList->isReplayableOn(g2)) invalidate();
+  // a single draw walks the box tree, the repeated draws record the tree
+  // once and replay the display list
+  if (_displayList == nullptr && ++_draws > 1) {
+    _displayList = std::make_shared<DisplayList>();
+    Graphics2D_recorder recorder(*_displayList, g2);
+    drawTree(recorder, 0, 0, 1);
+  }
+  if (_displayList != nullptr && _displayList->isFlattened()) {
+    _displayList->replay(g2, x, y);
+  } else {
+    drawTree(g2, x, y, 1);
+  }
+}
+
+void TeXRender::drawTree(Graphics2D& g2, int x, int y, float scale) {
   color old = g2.getColor();
-  g2.scale(_textSize, _textSize);
+  const float size = pixelsOfUnit() * scale;
+  g2.scale(size, size);
   if (!isTransparent(_fg)) {
     g2.setColor(_fg);
   } else {
@@ -142,7 +230,7 @@ void TeXRender::draw(Graphics2D& g2, int x, int y) {
   }
 
   // draw formula box
-  _box->draw(g2, (x + _insets.left) / _textSize, (y + _insets.top) / _textSize + _box->_height);
+  _box->draw(g2, (x + _insets.left * scale) / size, (y + _insets.top * scale) / size + _box->_height);
 
   // restore
   g2.reset();
@@ -164,7 +252,7 @@ TeXRender* TeXRenderBuilder::build(Formula& f) {
   return build(f._root);
 }
 
-TeXRender* TeXRenderBuilder::build(const sptr<Atom>& fc) {
+TeXRenderBuilder::Layout TeXRenderBuilder::layout(const sptr<Atom>& fc) {
   sptr<Atom> f = fc;
   if (f == nullptr) f = sptrOf<EmptyAtom>();
   if (_textSize == -1) {
@@ -188,24 +276,57 @@ TeXRender* TeXRenderBuilder::build(const sptr<Atom>& fc) {
     env->setInterline(_lineSpaceUnit, _lineSpace);
   }
 
-  auto box = f->createBox(*env);
-  TeXRender* render;
+  Layout l;
+  {
+    profile_phase(layout);
+    l._box = f->createBox(*env);
+  }
   if (_widthUnit != UnitType::none && _textWidth != 0) {
-    HBox* hb;
-    if (_lineSpaceUnit != UnitType::none && _lineSpace != 0) {
-      float space = _lineSpace * SpaceAtom::getFactor(_lineSpaceUnit, *env);
-      auto split = BoxSplitter::split(box, env->getTextWidth(), space);
-      hb = new HBox(split, _isMaxWidth ? split->_width : env->getTextWidth(), _align);
-    } else {
-      hb = new HBox(box, _isMaxWidth ? box->_width : env->getTextWidth(), _align);
+    l._textWidth = env->getTextWidth();
+    if (_lineSpaceUnit != UnitType::none) {
+      l._lineSpace = _lineSpace * SpaceAtom::getFactor(_lineSpaceUnit, *env);
     }
-    render = new TeXRender(sptr<Box>(hb), _textSize, _trueValues);
-  } else {
-    render = new TeXRender(box, _textSize, _trueValues);
   }
-
-  if (!isTransparent(_fg)) render->setForeground(_fg);
+  l._pixel = SpaceAtom::getFactor(UnitType::pixel, *env);
 
   delete env;
+  return l;
+}
+
+sptr<Box> TeXRenderBuilder::createBox(const Layout& l) {
+  return TeXRender::breakLines(l._box, l._textWidth, l._lineSpace, _align, _isMaxWidth, _optimalBreak);
+}
+
+TeXRender* TeXRenderBuilder::build(const sptr<Atom>& f) {
+#ifdef HAVE_PROFILE
+  ProfileScope profile;
+#endif
+  const Layout l = layout(f);
+  TeXRender* render = new TeXRender(createBox(l), _textSize, _trueValues);
+  if (!isTransparent(_fg)) render->setForeground(_fg);
+  // the debug boxes are added into the box tree, it cannot be broken again
+  if (!Box::DEBUG) {
+    render->_unsplit = l._box;
+    render->_pixel = l._pixel;
+    render->_isMaxWidth = _isMaxWidth;
+    render->_optimalBreak = _optimalBreak;
+  }
+#ifdef HAVE_PROFILE
+  render->_stats = profile.stats();
+  if (profile.isOutermost()) Profiler::report(render->_stats);
+#endif
   return render;
 }
+
+TeXMetrics TeXRenderBuilder::measure(Formula& f) {
+  return measure(f._root);
+}
+
+TeXMetrics TeXRenderBuilder::measure(const sptr<Atom>& f) {
+  const sptr<Box> box = createBox(layout(f));
+  // the same as the render built from the box, see TeXRender
+  Insets insets;
+  if (!_trueValues) insets += TeXRender::defaultInset(_textSize);
+  const float size = magnify(_textSize) * Context::current().getPixelsPerPoint();
+  return TeXRender::metricsOf(*box, size, insets);
+}
@@ -5,6 +5,7 @@
 
 #include "utils/enums.h"
 #include "box/box.h"
+#include "graphic/display_list.h"
 #include "graphic/graphic.h"
 
 namespace tex {
@@ -19,14 +20,37 @@ class Atom;
 
 using BoxFilter = std::function<bool(const sptr<Box>&)>;
 
+/** The metrics of a formula in pixels, the same as the ones of its TeXRender */
+struct TeXMetrics {
+  int width, height, depth;
+  /** The ratio of the height above the baseline to the total height */
+  float baseline;
+};
+
 class TeXRender {
 private:
   static const color _defaultcolor;
 
   sptr<Box> _box;
   float _textSize;
+  // the box is laid out in points, converted to pixels when drawn
+  float _pixelsPerPoint;
   color _fg = black;
   Insets _insets;
+  RenderStats _stats;
+  // the draws are recorded into the display list from the second draw, and
+  // replayed after, the list is immutable thus shared by the copies
+  sptr<DisplayList> _displayList;
+  u32 _draws = 0;
+  // the box laid out before it was broken into lines and aligned, and how to
+  // break it again, see relayout
+  sptr<Box> _unsplit;
+  float _pixel = 0;
+  bool _isMaxWidth = false, _optimalBreak = false;
+
+  friend class Context;
+
+  friend class TeXRenderBuilder;
 
   void buildDebug(
     const sptr<BoxGroup>& parent,
@@ -36,14 +60,43 @@ private:
 
   static sptr<BoxGroup> wrap(const sptr<Box>& box);
 
-public:
-  static float _defaultSize;
-  static float _magFactor;
+  void drawBox(Graphics2D& g2, int x, int y);
+
+  /** The pixels of a unit of the box */
+  inline float pixelsOfUnit() const { return _textSize * _pixelsPerPoint; }
+
+  /** The insets added around a formula in the given text size, unless true values are required */
+  static inline int defaultInset(float textSize) { return (int) (0.18f * textSize); }
 
+  /**
+   * Get the metrics in pixels of the given box drawn with the given pixels of
+   * a unit and insets
+   */
+  static TeXMetrics metricsOf(const Box& box, float pixelsOfUnit, const Insets& insets);
+
+  void drawTree(Graphics2D& g2, int x, int y, float scale);
+
+  void invalidate();
+
+  /**
+   * Break the box into lines no wider than the width, and align it in the
+   * width, the width and the line space are in the units of the box. The box
+   * is returned as is if the width is 0, and it is not broken if the line
+   * space is 0.
+   */
+  static sptr<Box> breakLines(
+    const sptr<Box>& box, float width, float lineSpace,
+    Alignment align, bool isMaxWidth, bool optimal
+  );
+
+public:
   TeXRender(const sptr<Box>& box, float textSize, bool trueValues = false);
 
   float getTextSize() const;
 
+  /** Get the box to draw, it must not be modified */
+  inline const sptr<Box>& getBox() const { return _box; }
+
   int getHeight() const;
 
   int getDepth() const;
@@ -64,7 +117,35 @@ public:
 
   void setHeight(int height, Alignment align);
 
+  /**
+   * Break the formula into lines again at the given width and align it,
+   * without parsing or laying out it again. The width and the line space are
+   * in pixels, the line space 0 means not to break the formula. It replaces
+   * the changes by setWidth and setHeight.
+   *
+   * The parts laid out with the text width or the line space of the build
+   * (e.g. multline, the arrays stretched to the text width) keep their sizes,
+   * build the formula again to lay them out in the new width.
+   *
+   * @throw ex_invalid_state if the render is built with the debug boxes
+   */
+  void relayout(int width, Alignment align, float lineSpace);
+
   void draw(Graphics2D& g2, int x, int y);
+
+  /**
+   * Draw the formula scaled by the given factor, e.g. 2 for the images at
+   * 2x or the ratio of the DPIs to draw it at another DPI, the size drawn is
+   * the size of this render multiplied by the factor. The draws with a scale
+   * other than 1 walk the box tree, they do not use the display list.
+   */
+  void draw(Graphics2D& g2, int x, int y, float scale);
+
+  /**
+   * Get the stats of the parse and the draws of this render, the stats are
+   * recorded only if compiled with the flag HAVE_PROFILE.
+   */
+  inline const RenderStats& getStats() const { return _stats; }
 };
 
 class TeXRenderBuilder {
@@ -74,10 +155,25 @@ private:
   UnitType _widthUnit = UnitType::none;
   UnitType _lineSpaceUnit = UnitType::none;
   float _textSize = 0, _textWidth = 0, _lineSpace = 0;
-  bool _trueValues = false, _isMaxWidth = false;
+  bool _trueValues = false, _isMaxWidth = false, _optimalBreak = false;
   color _fg = black;
   Alignment _align = Alignment::none;
 
+  /**
+   * The formula laid out, with the text width and the line space to break it
+   * and the size of a pixel, in the units of the box
+   */
+  struct Layout {
+    sptr<Box> _box;
+    float _textWidth = 0, _lineSpace = 0, _pixel = 0;
+  };
+
+  /** Layout the given formula before breaking it into lines */
+  Layout layout(const sptr<Atom>& f);
+
+  /** Layout the given formula into the box to render */
+  sptr<Box> createBox(const Layout& l);
+
 public:
   // TODO declaration conflict with TypefaceStyle defined in graphic/graphic.h
   enum TeXFontStyle {
@@ -167,10 +263,29 @@ public:
     return *this;
   }
 
+  /**
+   * Set if choose the line breaks of the formula all at once to make the lines
+   * even (true), or break them greedily (false, the default), see
+   * BoxSplitter::splitOptimal. It takes effect only if the line space is set.
+   */
+  inline TeXRenderBuilder& setOptimalBreak(bool optimal) {
+    _optimalBreak = optimal;
+    return *this;
+  }
+
   TeXRender* build(const sptr<Atom>& f);
 
   TeXRender* build(Formula& f);
 
+  /**
+   * Layout the given formula and get its metrics without building a render,
+   * the glyph metrics come from the builtin font tables, the platform fonts
+   * are not touched.
+   */
+  TeXMetrics measure(const sptr<Atom>& f);
+
+  TeXMetrics measure(Formula& f);
+
   static DefaultTeXFont* createFont(float size, int type);
 };
 
@@ -0,0 +1,117 @@
+#include "render_cache.h"
+
+#include "render.h"
+#include "utils/arena.h"
+
+using namespace std;
+using namespace tex;
+
+const size_t RenderCache::DEFAULT_BUDGET = 4 << 20;
+
+bool RenderCache::Key::operator==(const Key& k) const {
+  return _width == k._width
+         && _textSize == k._textSize
+         && _lineSpace == k._lineSpace
+         && _fg == k._fg
+         && _style == k._style
+         && _pixelsPerPoint == k._pixelsPerPoint
+         && _generation == k._generation
+         && _tex == k._tex;
+}
+
+size_t RenderCache::KeyHash::operator()(const Key& k) const {
+  size_t h = hash<wstring>()(k._tex);
+  const auto combine = [&h](size_t v) { h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2); };
+  combine(hash<int>()(k._width));
+  combine(hash<float>()(k._textSize));
+  combine(hash<float>()(k._lineSpace));
+  combine(hash<color>()(k._fg));
+  combine(hash<int>()(static_cast<int>(k._style)));
+  combine(hash<float>()(k._pixelsPerPoint));
+  combine(hash<u32>()(k._generation));
+  return h;
+}
+
+/** Estimate the bytes taken by the given render and its box tree */
+static size_t estimateBytes(const RenderCache::Key& key, const TeXRender& render) {
+  // a box is shared by a shared-pointer and usually held by a vector
+  const size_t boxBytes = sizeof(Box) + sizeof(sptr<Box>) + 2 * sizeof(void*);
+  size_t count = 0;
+  vector<sptr<Box>> stack{render.getBox()};
+  while (!stack.empty()) {
+    const auto box = stack.back();
+    stack.pop_back();
+    count++;
+    for (const auto& child : box->descendants()) {
+      if (child != nullptr) stack.push_back(child);
+    }
+  }
+  return sizeof(TeXRender) + key._tex.capacity() * sizeof(wchar_t) + count * boxBytes;
+}
+
+TeXRender* RenderCache::get(const Key& key) {
+  if (_budget == 0) return nullptr;
+  const auto it = _index.find(key);
+  if (it == _index.end()) {
+    _misses++;
+    return nullptr;
+  }
+  _hits++;
+  // move to front as the most recently used
+  _entries.splice(_entries.begin(), _entries, it->second);
+  return new TeXRender(*it->second->_render);
+}
+
+void RenderCache::put(const Key& key, const TeXRender& render, const sptr<Arena>& arena) {
+  if (_budget == 0) return;
+  const size_t bytes = estimateBytes(key, render);
+  // the arena may be charged already, make room for it anyway since the
+  // renders that share it may be evicted
+  const size_t arenaBytes = arena == nullptr ? 0 : arena->reserved();
+  if (bytes + arenaBytes > _budget) return;
+  const auto it = _index.find(key);
+  if (it != _index.end()) remove(it->second);
+  evict(_budget - bytes - arenaBytes);
+  _entries.push_front({key, sptrOf<TeXRender>(render), bytes, arena.get()});
+  _index[key] = _entries.begin();
+  _bytes += bytes;
+  if (arena != nullptr) {
+    auto& charge = _arenas[arena.get()];
+    if (charge._renders++ == 0) {
+      charge._bytes = arena->reserved();
+      _bytes += charge._bytes;
+    }
+  }
+}
+
+void RenderCache::remove(list<Entry>::iterator it) {
+  _bytes -= it->_bytes;
+  if (it->_arena != nullptr) {
+    const auto charge = _arenas.find(it->_arena);
+    if (--charge->second._renders == 0) {
+      _bytes -= charge->second._bytes;
+      _arenas.erase(charge);
+    }
+  }
+  _index.erase(it->_key);
+  _entries.erase(it);
+}
+
+void RenderCache::evict(size_t budget) {
+  while (_bytes > budget && !_entries.empty()) {
+    remove(prev(_entries.end()));
+    _evictions++;
+  }
+}
+
+void RenderCache::setBudget(size_t bytes) {
+  _budget = bytes;
+  evict(bytes);
+}
+
+void RenderCache::clear() {
+  _entries.clear();
+  _index.clear();
+  _arenas.clear();
+  _bytes = 0;
+}
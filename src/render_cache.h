@@ -0,0 +1,123 @@
+#ifndef RENDER_CACHE_H_INCLUDED
+#define RENDER_CACHE_H_INCLUDED
+
+#include "common.h"
+#include "graphic/graphic_basic.h"
+#include "utils/enums.h"
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace tex {
+
+class TeXRender;
+
+class Arena;
+
+/**
+ * A LRU cache of the renders parsed by a context, keyed by the TeX source and
+ * all the parameters that take effect on the layout. The box tree of a render
+ * is immutable once built, so the cached renders share it with the renders
+ * returned to the caller, only the TeXRender itself is copied.
+ * <p>
+ * The budget takes the arenas kept alive by the cached renders into account,
+ * an arena shared by several renders is charged once.
+ */
+class RenderCache {
+public:
+  struct Key {
+    std::wstring _tex;
+    int _width;
+    float _textSize;
+    float _lineSpace;
+    color _fg;
+    TexStyle _style;
+    float _pixelsPerPoint;
+    // generation of the user definitions and settings of the context
+    u32 _generation;
+
+    bool operator==(const Key& k) const;
+  };
+
+private:
+  struct KeyHash {
+    size_t operator()(const Key& k) const;
+  };
+
+  struct Entry {
+    Key _key;
+    sptr<TeXRender> _render;
+    size_t _bytes;
+    // the arena the render is allocated from, nullptr if none
+    const Arena* _arena;
+  };
+
+  // the count of the cached renders allocated from an arena and the bytes
+  // charged for it
+  struct ArenaCharge {
+    size_t _renders;
+    size_t _bytes;
+  };
+
+  std::list<Entry> _entries;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> _index;
+  std::unordered_map<const Arena*, ArenaCharge> _arenas;
+  size_t _budget;
+  size_t _bytes = 0;
+  size_t _hits = 0, _misses = 0, _evictions = 0;
+
+  void evict(size_t budget);
+
+  void remove(std::list<Entry>::iterator it);
+
+public:
+  /** Default memory budget of a cache, in bytes */
+  static const size_t DEFAULT_BUDGET;
+
+  explicit RenderCache(size_t budget = DEFAULT_BUDGET) : _budget(budget) {}
+
+  no_copy_assign(RenderCache);
+
+  /**
+   * Get a copy of the render cached for the given key, the caller takes the
+   * ownership of the returned render, return nullptr if not found.
+   */
+  TeXRender* get(const Key& key);
+
+  /**
+   * Cache a copy of the given render
+   *
+   * @param key the key of the render
+   * @param render the render to cache
+   * @param arena the arena the render is allocated from, nullptr if none
+   */
+  void put(const Key& key, const TeXRender& render, const sptr<Arena>& arena = nullptr);
+
+  /**
+   * Set the memory budget (estimated) in bytes, the least recently used
+   * renders are evicted if the budget is exceeded. 0 disables the cache.
+   */
+  void setBudget(size_t bytes);
+
+  inline size_t getBudget() const { return _budget; }
+
+  /** Get the estimated bytes taken by the cached renders and their arenas */
+  inline size_t bytes() const { return _bytes; }
+
+  /** Get the count of the cached renders */
+  inline size_t size() const { return _entries.size(); }
+
+  inline size_t hits() const { return _hits; }
+
+  inline size_t misses() const { return _misses; }
+
+  inline size_t evictions() const { return _evictions; }
+
+  /** Remove all the cached renders, the counters are kept */
+  void clear();
+};
+
+}  // namespace tex
+
+#endif  // RENDER_CACHE_H_INCLUDED
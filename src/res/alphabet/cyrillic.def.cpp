@@ -0,0 +1,4584 @@
+// Generated by prebuilt/alphabet_def.py from res/cyrillic, do not edit
+#include "res/alphabet_def.res.h"
+
+CHECK_ALPHABET_DEF_VERSION(1)
+
+DEF_FONT(wnr10, cyrillic/wnr10.ttf, 95)
+
+xHeight(0.430555) quad(1.000003) space(0.333334)
+
+bold(wnbx10) ss(wnss10) tt(wntt10) it(wnti10)
+
+METRICS_START
+171, 0.555557, 0.483335, 0, 0,
+187, 0.555557, 0.483335, 0, 0,
+305, 0.277779, 0.430555, 0, 0,
+774, 0.500002, 0.638838, 0, 0,
+776, 0.500002, 0.659131, 0, 0,
+1025, 0.680557, 0.891615, 0, 0,
+1026, 0.8611145, 0.683332, 0, 0,
+1028, 0.722224, 0.683332, 0, 0,
+1029, 0.555557, 0.683332, 0, 0,
+1030, 0.361112, 0.683332, 0, 0,
+1032, 0.51389, 0.683332, 0, 0,
+1033, 1.083338, 0.683332, 0, 0,
+1034, 1.083338, 0.683332, 0, 0,
+1035, 0.763891, 0.683332, 0, 0,
+1039, 0.777781, 0.683332, 0.194445, 0,
+1040, 0.750002, 0.683332, 0, 0,
+1041, 0.708336, 0.683332, 0, 0,
+1042, 0.708336, 0.683332, 0, 0,
+1043, 0.625002, 0.683332, 0, 0,
+1044, 0.777781, 0.683332, 0.194445, 0,
+1045, 0.680557, 0.683332, 0, 0,
+1046, 1.194448, 0.683332, 0, 0,
+1047, 0.611113, 0.683332, 0, 0,
+1048, 0.777781, 0.683332, 0, 0,
+1049, 0.777781, 0.891615, 0, 0,
+1050, 0.777781, 0.683332, 0, 0,
+1051, 0.777781, 0.683332, 0, 0,
+1052, 0.916669, 0.683332, 0, 0,
+1053, 0.777781, 0.683332, 0, 0,
+1054, 0.777781, 0.683332, 0, 0,
+1055, 0.777781, 0.683332, 0, 0,
+1056, 0.680557, 0.683332, 0, 0,
+1057, 0.722224, 0.683332, 0, 0,
+1058, 0.722224, 0.683332, 0, 0,
+1059, 0.750002, 0.683332, 0, 0.013888,
+1060, 0.833336, 0.683332, 0, 0,
+1061, 0.750002, 0.683332, 0, 0,
+1062, 0.777781, 0.683332, 0.194445, 0,
+1063, 0.777781, 0.683332, 0, 0,
+1064, 1.125003, 0.683332, 0, 0,
+1065, 1.125003, 0.683332, 0.194445, 0,
+1066, 0.888893, 0.683332, 0, 0,
+1067, 0.972226, 0.683332, 0, 0,
+1068, 0.708336, 0.683332, 0, 0,
+1069, 0.722224, 0.683332, 0, 0,
+1070, 1.125003, 0.683332, 0, 0,
+1071, 0.777781, 0.683332, 0, 0,
+1072, 0.500002, 0.430555, 0, 0,
+1073, 0.500002, 0.694445, 0, 0,
+1074, 0.500002, 0.430555, 0, 0,
+1075, 0.444446, 0.430555, 0, 0,
+1076, 0.555557, 0.430555, 0.162038, 0.001389,
+1077, 0.444446, 0.430555, 0, 0,
+1078, 0.833336, 0.430555, 0, 0,
+1079, 0.444446, 0.430555, 0, 0.005556,
+1080, 0.555557, 0.430555, 0, 0.001389,
+1081, 0.555557, 0.638838, 0, 0.001389,
+1082, 0.555557, 0.430555, 0, 0,
+1083, 0.555557, 0.430555, 0, 0.001389,
+1084, 0.666669, 0.430555, 0, 0.001389,
+1085, 0.555557, 0.430555, 0, 0.001389,
+1086, 0.500002, 0.430555, 0, 0,
+1087, 0.555557, 0.430555, 0, 0.001389,
+1088, 0.555557, 0.430555, 0.194445, 0,
+1089, 0.444446, 0.430555, 0, 0,
+1090, 0.500002, 0.430555, 0, 0,
+1091, 0.527781, 0.430555, 0.194445, 0.013888,
+1092, 0.7777815, 0.694445, 0.194445, 0,
+1093, 0.527781, 0.430555, 0, 0,
+1094, 0.555557, 0.430555, 0.162038, 0.001389,
+1095, 0.555557, 0.430555, 0, 0.001389,
+1096, 0.805559, 0.430555, 0, 0.001389,
+1097, 0.805559, 0.430555, 0.162038, 0.001389,
+1098, 0.611113, 0.430555, 0, 0,
+1099, 0.722224, 0.430555, 0, 0.001389,
+1100, 0.500002, 0.430555, 0, 0,
+1101, 0.444446, 0.430555, 0, 0,
+1102, 0.750003, 0.430555, 0, 0,
+1103, 0.541669, 0.430555, 0, 0.001389,
+1105, 0.444446, 0.659131, 0, 0,
+1106, 0.527781, 0.694445, 0.194445, 0,
+1108, 0.43889, 0.430555, 0, 0,
+1109, 0.394445, 0.430555, 0, 0,
+1110, 0.277779, 0.667859, 0, 0,
+1112, 0.305557, 0.667859, 0.194445, 0,
+1113, 0.763891, 0.430555, 0, 0,
+1114, 0.763891, 0.430555, 0, 0,
+1115, 0.555557, 0.694445, 0, 0,
+1119, 0.555557, 0.430555, 0.162038, 0.001389,
+1122, 0.8194475, 0.75, 0, 0,
+1123, 0.500002, 0.638838, 0, 0,
+1138, 0.777781, 0.683332, 0, 0,
+1139, 0.444446, 0.430555, 0, 0,
+1140, 0.8194475, 0.683332, 0, 0.013888,
+1141, 0.587503, 0.430555, 0, 0.013888
+METRICS_END
+
+LIGTURES_START
+1044, 1032, 1026,
+1044, 1112, 1026,
+1047, 1061, 1046,
+1047, 1093, 1046,
+1050, 1061, 1061,
+1050, 1093, 1061,
+1051, 1032, 1033,
+1051, 1112, 1033,
+1053, 1032, 1034,
+1053, 1112, 1034,
+1057, 1061, 1064,
+1057, 1093, 1064,
+1058, 1057, 1062,
+1058, 1089, 1062,
+1062, 1061, 1063,
+1062, 1093, 1063,
+1064, 1062, 0,
+1064, 1063, 1065,
+1064, 1094, 0,
+1064, 1095, 1065,
+1067, 1040, 1071,
+1067, 1059, 1070,
+1067, 1072, 1071,
+1067, 1091, 1070,
+1076, 1112, 1106,
+1079, 1093, 1078,
+1082, 1093, 1093,
+1083, 1112, 1113,
+1085, 1112, 1114,
+1089, 1093, 1096,
+1090, 1089, 1094,
+1094, 1093, 1095,
+1096, 1094, 0,
+1096, 1095, 1097,
+1099, 1072, 1103,
+1099, 1091, 1102
+LIGTURES_END
+
+KERNS_START
+1026, 1026, -0.083334,
+1026, 1028, -0.027779,
+1026, 1035, -0.083334,
+1026, 1046, -0.027779,
+1026, 1054, -0.027779,
+1026, 1057, -0.027779,
+1026, 1058, -0.083334,
+1026, 1059, -0.083334,
+1026, 1060, -0.027779,
+1026, 1061, -0.027779,
+1026, 1063, -0.083334,
+1026, 1066, -0.083334,
+1026, 1090, -0.027779,
+1026, 1095, -0.083334,
+1026, 1098, -0.027779,
+1026, 1122, -0.083334,
+1026, 1123, -0.027779,
+1026, 1138, -0.027779,
+1026, 1140, -0.111112,
+1030, 1030, 0.027779,
+1033, 1026, -0.083334,
+1033, 1028, -0.027779,
+1033, 1035, -0.083334,
+1033, 1046, -0.027779,
+1033, 1054, -0.027779,
+1033, 1057, -0.027779,
+1033, 1058, -0.083334,
+1033, 1059, -0.083334,
+1033, 1060, -0.027779,
+1033, 1061, -0.027779,
+1033, 1063, -0.083334,
+1033, 1066, -0.083334,
+1033, 1090, -0.027779,
+1033, 1095, -0.083334,
+1033, 1098, -0.027779,
+1033, 1122, -0.083334,
+1033, 1123, -0.027779,
+1033, 1138, -0.027779,
+1033, 1140, -0.111112,
+1034, 1026, -0.083334,
+1034, 1028, -0.027779,
+1034, 1035, -0.083334,
+1034, 1046, -0.027779,
+1034, 1054, -0.027779,
+1034, 1057, -0.027779,
+1034, 1058, -0.083334,
+1034, 1059, -0.083334,
+1034, 1060, -0.027779,
+1034, 1061, -0.027779,
+1034, 1063, -0.083334,
+1034, 1066, -0.083334,
+1034, 1090, -0.027779,
+1034, 1095, -0.083334,
+1034, 1098, -0.027779,
+1034, 1122, -0.083334,
+1034, 1123, -0.027779,
+1034, 1138, -0.027779,
+1034, 1140, -0.111112,
+1040, 1026, -0.083334,
+1040, 1028, -0.027779,
+1040, 1035, -0.083334,
+1040, 1054, -0.027779,
+1040, 1057, -0.027779,
+1040, 1058, -0.083334,
+1040, 1059, -0.083334,
+1040, 1060, -0.027779,
+1040, 1063, -0.083334,
+1040, 1066, -0.083334,
+1040, 1090, -0.027779,
+1040, 1095, -0.083334,
+1040, 1098, -0.027779,
+1040, 1122, -0.083334,
+1040, 1123, -0.027779,
+1040, 1138, -0.027779,
+1040, 1140, -0.111112,
+1043, 1033, -0.027779,
+1043, 1040, -0.083334,
+1043, 1044, -0.083334,
+1043, 1051, -0.027779,
+1043, 1071, -0.083334,
+1043, 1072, -0.083334,
+1043, 1076, -0.083334,
+1043, 1077, -0.083334,
+1043, 1083, -0.083334,
+1043, 1086, -0.083334,
+1043, 1089, -0.083334,
+1043, 1092, -0.083334,
+1043, 1103, -0.083334,
+1043, 1105, -0.083334,
+1043, 1108, -0.083334,
+1043, 1113, -0.083334,
+1043, 1139, -0.083334,
+1046, 1028, -0.027779,
+1046, 1054, -0.027779,
+1046, 1057, -0.027779,
+1046, 1060, -0.027779,
+1046, 1090, -0.027779,
+1046, 1095, -0.027779,
+1046, 1098, -0.027779,
+1046, 1123, -0.027779,
+1046, 1138, -0.027779,
+1050, 1028, -0.027779,
+1050, 1054, -0.027779,
+1050, 1057, -0.027779,
+1050, 1060, -0.027779,
+1050, 1090, -0.027779,
+1050, 1095, -0.027779,
+1050, 1098, -0.027779,
+1050, 1123, -0.027779,
+1050, 1138, -0.027779,
+1054, 1040, -0.027779,
+1054, 1044, -0.027779,
+1054, 1046, -0.027779,
+1054, 1059, -0.027779,
+1054, 1061, -0.027779,
+1054, 1071, -0.027779,
+1054, 1140, -0.027779,
+1056, 1033, -0.083334,
+1056, 1040, -0.083334,
+1056, 1044, -0.083334,
+1056, 1051, -0.083334,
+1056, 1071, -0.083334,
+1056, 1072, -0.027779,
+1056, 1076, -0.083334,
+1056, 1077, -0.027779,
+1056, 1083, -0.083334,
+1056, 1086, -0.027779,
+1056, 1105, -0.027779,
+1056, 1113, -0.083334,
+1056, 1139, -0.027779,
+1058, 1033, -0.027779,
+1058, 1040, -0.083334,
+1058, 1044, -0.083334,
+1058, 1051, -0.027779,
+1058, 1071, -0.083334,
+1058, 1072, -0.083334,
+1058, 1076, -0.083334,
+1058, 1077, -0.083334,
+1058, 1083, -0.083334,
+1058, 1086, -0.083334,
+1058, 1089, -0.083334,
+1058, 1092, -0.083334,
+1058, 1103, -0.083334,
+1058, 1105, -0.083334,
+1058, 1108, -0.083334,
+1058, 1113, -0.083334,
+1058, 1139, -0.083334,
+1059, 1028, -0.027779,
+1059, 1033, -0.055555,
+1059, 1040, -0.083334,
+1059, 1044, -0.055555,
+1059, 1051, -0.055555,
+1059, 1054, -0.027779,
+1059, 1057, -0.027779,
+1059, 1060, -0.027779,
+1059, 1071, -0.083334,
+1059, 1072, -0.083334,
+1059, 1076, -0.083334,
+1059, 1077, -0.083334,
+1059, 1083, -0.083334,
+1059, 1086, -0.083334,
+1059, 1089, -0.083334,
+1059, 1103, -0.083334,
+1059, 1105, -0.083334,
+1059, 1108, -0.083334,
+1059, 1113, -0.083334,
+1059, 1138, -0.027779,
+1059, 1139, -0.083334,
+1060, 1040, -0.027779,
+1060, 1044, -0.027779,
+1060, 1046, -0.027779,
+1060, 1059, -0.027779,
+1060, 1061, -0.027779,
+1060, 1071, -0.027779,
+1060, 1140, -0.027779,
+1061, 1028, -0.027779,
+1061, 1054, -0.027779,
+1061, 1057, -0.027779,
+1061, 1060, -0.027779,
+1061, 1090, -0.027779,
+1061, 1095, -0.027779,
+1061, 1098, -0.027779,
+1061, 1123, -0.027779,
+1061, 1138, -0.027779,
+1066, 1026, -0.083334,
+1066, 1028, -0.027779,
+1066, 1035, -0.083334,
+1066, 1046, -0.027779,
+1066, 1054, -0.027779,
+1066, 1057, -0.027779,
+1066, 1058, -0.083334,
+1066, 1059, -0.083334,
+1066, 1060, -0.027779,
+1066, 1061, -0.027779,
+1066, 1063, -0.083334,
+1066, 1066, -0.083334,
+1066, 1090, -0.027779,
+1066, 1095, -0.083334,
+1066, 1098, -0.027779,
+1066, 1122, -0.083334,
+1066, 1123, -0.027779,
+1066, 1138, -0.027779,
+1066, 1140, -0.111112,
+1068, 1026, -0.083334,
+1068, 1028, -0.027779,
+1068, 1035, -0.083334,
+1068, 1046, -0.027779,
+1068, 1054, -0.027779,
+1068, 1057, -0.027779,
+1068, 1058, -0.083334,
+1068, 1059, -0.083334,
+1068, 1060, -0.027779,
+1068, 1061, -0.027779,
+1068, 1063, -0.083334,
+1068, 1066, -0.083334,
+1068, 1090, -0.027779,
+1068, 1095, -0.083334,
+1068, 1098, -0.027779,
+1068, 1122, -0.083334,
+1068, 1123, -0.027779,
+1068, 1138, -0.027779,
+1068, 1140, -0.111112,
+1069, 1040, -0.027779,
+1069, 1044, -0.027779,
+1069, 1046, -0.027779,
+1069, 1059, -0.027779,
+1069, 1061, -0.027779,
+1069, 1071, -0.027779,
+1069, 1140, -0.027779,
+1070, 1040, -0.027779,
+1070, 1044, -0.027779,
+1070, 1046, -0.027779,
+1070, 1059, -0.027779,
+1070, 1061, -0.027779,
+1070, 1071, -0.027779,
+1070, 1140, -0.027779,
+1072, 1091, -0.027779,
+1072, 1095, -0.027779,
+1072, 1141, -0.027779,
+1073, 1076, -0.027779,
+1073, 1078, -0.027779,
+1073, 1093, -0.027779,
+1073, 1103, -0.027779,
+1075, 1072, -0.027779,
+1075, 1076, -0.027779,
+1075, 1083, -0.027779,
+1075, 1103, -0.027779,
+1075, 1113, -0.027779,
+1078, 1072, -0.027779,
+1078, 1077, -0.027779,
+1078, 1086, -0.027779,
+1078, 1089, -0.027779,
+1078, 1105, -0.027779,
+1078, 1108, -0.027779,
+1078, 1139, -0.027779,
+1082, 1072, -0.027779,
+1082, 1077, -0.027779,
+1082, 1086, -0.027779,
+1082, 1089, -0.027779,
+1082, 1105, -0.027779,
+1082, 1108, -0.027779,
+1082, 1139, -0.027779,
+1086, 1076, -0.027779,
+1086, 1078, -0.027779,
+1086, 1093, -0.027779,
+1086, 1103, -0.027779,
+1088, 1076, -0.027779,
+1088, 1078, -0.027779,
+1088, 1093, -0.027779,
+1088, 1103, -0.027779,
+1089, 1076, -0.027779,
+1089, 1078, -0.027779,
+1089, 1093, -0.027779,
+1089, 1103, -0.027779,
+1090, 1072, -0.027779,
+1090, 1076, -0.027779,
+1090, 1083, -0.027779,
+1090, 1103, -0.027779,
+1090, 1113, -0.027779,
+1091, 1072, -0.027779,
+1091, 1076, -0.055555,
+1091, 1077, -0.027779,
+1091, 1083, -0.055555,
+1091, 1086, -0.027779,
+1091, 1089, -0.027779,
+1091, 1103, -0.027779,
+1091, 1105, -0.027779,
+1091, 1108, -0.027779,
+1091, 1113, -0.055555,
+1091, 1139, -0.027779,
+1092, 1076, -0.027779,
+1092, 1078, -0.027779,
+1092, 1093, -0.027779,
+1092, 1103, -0.027779,
+1093, 1072, -0.027779,
+1093, 1077, -0.027779,
+1093, 1086, -0.027779,
+1093, 1089, -0.027779,
+1093, 1105, -0.027779,
+1093, 1108, -0.027779,
+1093, 1139, -0.027779,
+1098, 1086, -0.027779,
+1098, 1090, -0.027779,
+1098, 1091, -0.055555,
+1098, 1092, -0.027779,
+1098, 1095, -0.083334,
+1098, 1098, -0.027779,
+1098, 1108, -0.027779,
+1098, 1123, -0.027779,
+1098, 1139, -0.027779,
+1098, 1141, -0.055555,
+1100, 1086, -0.027779,
+1100, 1090, -0.027779,
+1100, 1091, -0.055555,
+1100, 1092, -0.027779,
+1100, 1095, -0.083334,
+1100, 1098, -0.027779,
+1100, 1108, -0.027779,
+1100, 1123, -0.027779,
+1100, 1139, -0.027779,
+1100, 1141, -0.055555,
+1101, 1076, -0.027779,
+1101, 1078, -0.027779,
+1101, 1093, -0.027779,
+1101, 1103, -0.027779,
+1102, 1076, -0.027779,
+1102, 1078, -0.027779,
+1102, 1093, -0.027779,
+1102, 1103, -0.027779,
+1113, 1086, -0.027779,
+1113, 1090, -0.027779,
+1113, 1091, -0.055555,
+1113, 1092, -0.027779,
+1113, 1095, -0.083334,
+1113, 1098, -0.027779,
+1113, 1108, -0.027779,
+1113, 1123, -0.027779,
+1113, 1139, -0.027779,
+1113, 1141, -0.055555,
+1114, 1086, -0.027779,
+1114, 1090, -0.027779,
+1114, 1091, -0.055555,
+1114, 1092, -0.027779,
+1114, 1095, -0.083334,
+1114, 1098, -0.027779,
+1114, 1108, -0.027779,
+1114, 1123, -0.027779,
+1114, 1139, -0.027779,
+1114, 1141, -0.055555,
+1122, 1026, -0.083334,
+1122, 1028, -0.027779,
+1122, 1035, -0.083334,
+1122, 1046, -0.027779,
+1122, 1054, -0.027779,
+1122, 1057, -0.027779,
+1122, 1058, -0.083334,
+1122, 1059, -0.083334,
+1122, 1060, -0.027779,
+1122, 1061, -0.027779,
+1122, 1063, -0.083334,
+1122, 1066, -0.083334,
+1122, 1090, -0.027779,
+1122, 1095, -0.083334,
+1122, 1098, -0.027779,
+1122, 1122, -0.083334,
+1122, 1123, -0.027779,
+1122, 1138, -0.027779,
+1122, 1140, -0.111112,
+1123, 1086, -0.027779,
+1123, 1090, -0.027779,
+1123, 1091, -0.055555,
+1123, 1092, -0.027779,
+1123, 1095, -0.083334,
+1123, 1098, -0.027779,
+1123, 1108, -0.027779,
+1123, 1123, -0.027779,
+1123, 1139, -0.027779,
+1123, 1141, -0.055555,
+1138, 1040, -0.027779,
+1138, 1044, -0.027779,
+1138, 1046, -0.027779,
+1138, 1059, -0.027779,
+1138, 1061, -0.027779,
+1138, 1071, -0.027779,
+1138, 1140, -0.027779,
+1139, 1076, -0.027779,
+1139, 1078, -0.027779,
+1139, 1093, -0.027779,
+1139, 1103, -0.027779,
+1140, 1028, -0.027779,
+1140, 1040, -0.111112,
+1140, 1054, -0.027779,
+1140, 1057, -0.027779,
+1140, 1060, -0.027779,
+1140, 1071, -0.111112,
+1140, 1072, -0.083334,
+1140, 1076, -0.111112,
+1140, 1077, -0.083334,
+1140, 1083, -0.111112,
+1140, 1086, -0.083334,
+1140, 1103, -0.111112,
+1140, 1105, -0.083334,
+1140, 1113, -0.111112,
+1140, 1138, -0.027779,
+1140, 1139, -0.083334,
+1141, 1072, -0.027779,
+1141, 1076, -0.055555,
+1141, 1077, -0.027779,
+1141, 1083, -0.055555,
+1141, 1086, -0.027779,
+1141, 1089, -0.027779,
+1141, 1103, -0.027779,
+1141, 1105, -0.027779,
+1141, 1108, -0.027779,
+1141, 1113, -0.055555,
+1141, 1139, -0.027779
+KERNS_END
+
+END
+
+DEF_FONT(wnti10, cyrillic/wnti10.ttf, 95)
+
+xHeight(0.430555) quad(1.022217) space(0.357776)
+
+bold(wnbxti10) roman(wnr10) ss(wnssi10) tt(wntt10)
+
+METRICS_START
+171, 0.56222, 0.483335, 0, 0.022985,
+187, 0.56222, 0.483335, 0, 0,
+305, 0.306665, 0.430555, 0, 0.076714,
+774, 0.511108, 0.638838, 0, 0.094154,
+776, 0.511108, 0.659131, 0, 0.102562,
+1025, 0.678329, 0.891615, 0, 0.120277,
+1026, 0.843328, 0.683332, 0, 0.133055,
+1028, 0.715551, 0.683332, 0, 0.145277,
+1029, 0.56222, 0.683332, 0, 0.119722,
+1030, 0.385553, 0.683332, 0, 0.158055,
+1032, 0.524997, 0.683332, 0, 0.140279,
+1033, 1.048883, 0.683332, 0, 0.036629,
+1034, 1.048883, 0.683332, 0, 0.036629,
+1035, 0.753885, 0.683332, 0, 0.094722,
+1039, 0.768885, 0.683332, 0.194445, 0.16389,
+1040, 0.743329, 0.683332, 0, 0,
+1041, 0.703885, 0.683332, 0, 0.069166,
+1042, 0.703885, 0.683332, 0, 0.077014,
+1043, 0.627218, 0.683332, 0, 0.133055,
+1044, 0.768885, 0.683332, 0.194445, 0.16389,
+1045, 0.678329, 0.683332, 0, 0.120277,
+1046, 1.152216, 0.683332, 0, 0.145277,
+1047, 0.61333, 0.683332, 0, 0.10257,
+1048, 0.768885, 0.683332, 0, 0.16389,
+1049, 0.768885, 0.891615, 0, 0.16389,
+1050, 0.768885, 0.683332, 0, 0.145277,
+1051, 0.768885, 0.683332, 0, 0.16389,
+1052, 0.896662, 0.683332, 0, 0.16389,
+1053, 0.768885, 0.683332, 0, 0.16389,
+1054, 0.766663, 0.683332, 0, 0.0940275,
+1055, 0.768885, 0.683332, 0, 0.16389,
+1056, 0.678329, 0.683332, 0, 0.10257,
+1057, 0.715551, 0.683332, 0, 0.145277,
+1058, 0.715551, 0.683332, 0, 0.133055,
+1059, 0.743329, 0.683332, 0, 0.183611,
+1060, 0.817774, 0.683332, 0, 0.0940275,
+1061, 0.743329, 0.683332, 0, 0.158055,
+1062, 0.768885, 0.683332, 0.194445, 0.16389,
+1063, 0.768885, 0.683332, 0, 0.16389,
+1064, 1.088327, 0.683332, 0, 0.16389,
+1065, 1.088327, 0.683332, 0.194445, 0.16389,
+1066, 0.868884, 0.683332, 0, 0.036629,
+1067, 0.947772, 0.683332, 0, 0.16389,
+1068, 0.703885, 0.683332, 0, 0.036629,
+1069, 0.715551, 0.683332, 0, 0.0940275,
+1070, 1.087216, 0.683332, 0, 0.0940275,
+1071, 0.768885, 0.683332, 0, 0.16389,
+1072, 0.493219, 0.430555, 0, 0.076714,
+1073, 0.475329, 0.694445, 0, 0.154445,
+1074, 0.493219, 0.430555, 0, 0.075139,
+1075, 0.421664, 0.430555, 0, 0.075139,
+1076, 0.475329, 0.694445, 0, 0.113861,
+1077, 0.442108, 0.430555, 0, 0.075139,
+1078, 1.047772, 0.430555, 0, 0.056528,
+1079, 0.459997, 0.430555, 0, 0.056528,
+1080, 0.56222, 0.430555, 0, 0.076714,
+1081, 0.56222, 0.638838, 0, 0.076714,
+1082, 0.511108, 0.430555, 0, 0.107638,
+1083, 0.536664, 0.430555, 0, 0.076714,
+1084, 0.741107, 0.430555, 0, 0.076714,
+1085, 0.56222, 0.430555, 0, 0.076714,
+1086, 0.475329, 0.430555, 0, 0.063124,
+1087, 0.56222, 0.430555, 0, 0.076714,
+1088, 0.505997, 0.430555, 0.194445, 0.063124,
+1089, 0.442108, 0.430555, 0, 0.056528,
+1090, 0.817774, 0.430555, 0, 0.076714,
+1091, 0.511108, 0.430555, 0.194445, 0.088472,
+1092, 0.679773, 0.694445, 0.194445, 0.063124,
+1093, 0.540553, 0.430555, 0, 0.120417,
+1094, 0.567331, 0.430555, 0.194445, 0.076714,
+1095, 0.536664, 0.430555, 0, 0.076714,
+1096, 0.817774, 0.430555, 0, 0.076714,
+1097, 0.8228855, 0.430555, 0.194445, 0.076714,
+1098, 0.485553, 0.430555, 0, 0.063124,
+1099, 0.664441, 0.430555, 0, 0.076714,
+1100, 0.511108, 0.430555, 0, 0.063124,
+1101, 0.442108, 0.430555, 0, 0.063124,
+1102, 0.723218, 0.430555, 0, 0.063124,
+1103, 0.536664, 0.430555, 0, 0.076714,
+1105, 0.442108, 0.659131, 0, 0.075139,
+1106, 0.459997, 0.694445, 0.194445, 0.075346,
+1108, 0.442108, 0.430555, 0, 0.082083,
+1109, 0.408887, 0.430555, 0, 0.082083,
+1110, 0.306665, 0.655359, 0, 0.101896,
+1112, 0.306665, 0.655359, 0.194445, 0.144673,
+1113, 0.689997, 0.430555, 0, 0.063124,
+1114, 0.715551, 0.430555, 0, 0.063124,
+1115, 0.511108, 0.694445, 0, 0.076714,
+1119, 0.536664, 0.430555, 0.194445, 0.076714,
+1122, 0.806107, 0.75, 0, 0.10257,
+1123, 0.715551, 0.430555, 0, 0.063124,
+1138, 0.766663, 0.683332, 0, 0.0940275,
+1139, 0.459997, 0.430555, 0, 0.063124,
+1140, 0.806107, 0.683332, 0, 0.183611,
+1141, 0.615275, 0.430555, 0, 0.120417
+METRICS_END
+
+LIGTURES_START
+1044, 1032, 1026,
+1044, 1112, 1026,
+1047, 1061, 1046,
+1047, 1093, 1046,
+1050, 1061, 1061,
+1050, 1093, 1061,
+1051, 1032, 1033,
+1051, 1112, 1033,
+1053, 1032, 1034,
+1053, 1112, 1034,
+1057, 1061, 1064,
+1057, 1093, 1064,
+1058, 1057, 1062,
+1058, 1089, 1062,
+1062, 1061, 1063,
+1062, 1093, 1063,
+1064, 1062, 0,
+1064, 1063, 1065,
+1064, 1094, 0,
+1064, 1095, 1065,
+1067, 1040, 1071,
+1067, 1059, 1070,
+1067, 1072, 1071,
+1067, 1091, 1070,
+1076, 1112, 1106,
+1079, 1093, 1078,
+1082, 1093, 1093,
+1083, 1112, 1113,
+1085, 1112, 1114,
+1089, 1093, 1096,
+1090, 1089, 1094,
+1094, 1093, 1095,
+1096, 1094, 0,
+1096, 1095, 1097,
+1099, 1072, 1103,
+1099, 1091, 1102
+LIGTURES_END
+
+KERNS_START
+1026, 1026, -0.076666,
+1026, 1028, -0.025556,
+1026, 1035, -0.076666,
+1026, 1046, -0.025556,
+1026, 1054, -0.025556,
+1026, 1057, -0.025556,
+1026, 1058, -0.076666,
+1026, 1059, -0.076666,
+1026, 1060, -0.025556,
+1026, 1061, -0.025556,
+1026, 1063, -0.076666,
+1026, 1066, -0.076666,
+1026, 1080, -0.025556,
+1026, 1081, -0.025556,
+1026, 1082, -0.025556,
+1026, 1085, -0.025556,
+1026, 1087, -0.025556,
+1026, 1090, -0.025556,
+1026, 1091, -0.025556,
+1026, 1094, -0.025556,
+1026, 1096, -0.025556,
+1026, 1097, -0.025556,
+1026, 1098, -0.025556,
+1026, 1099, -0.025556,
+1026, 1100, -0.025556,
+1026, 1102, -0.025556,
+1026, 1110, -0.025556,
+1026, 1114, -0.025556,
+1026, 1122, -0.076666,
+1026, 1123, -0.025556,
+1026, 1138, -0.025556,
+1026, 1140, -0.1022215,
+1026, 1141, -0.025556,
+1030, 1030, 0.025556,
+1033, 1026, -0.076666,
+1033, 1028, -0.025556,
+1033, 1035, -0.076666,
+1033, 1046, -0.025556,
+1033, 1054, -0.025556,
+1033, 1057, -0.025556,
+1033, 1058, -0.076666,
+1033, 1059, -0.076666,
+1033, 1060, -0.025556,
+1033, 1061, -0.025556,
+1033, 1063, -0.076666,
+1033, 1066, -0.076666,
+1033, 1080, -0.025556,
+1033, 1081, -0.025556,
+1033, 1082, -0.025556,
+1033, 1085, -0.025556,
+1033, 1087, -0.025556,
+1033, 1090, -0.025556,
+1033, 1091, -0.025556,
+1033, 1094, -0.025556,
+1033, 1096, -0.025556,
+1033, 1097, -0.025556,
+1033, 1098, -0.025556,
+1033, 1099, -0.025556,
+1033, 1100, -0.025556,
+1033, 1102, -0.025556,
+1033, 1110, -0.025556,
+1033, 1114, -0.025556,
+1033, 1122, -0.076666,
+1033, 1123, -0.025556,
+1033, 1138, -0.025556,
+1033, 1140, -0.1022215,
+1033, 1141, -0.025556,
+1034, 1026, -0.076666,
+1034, 1028, -0.025556,
+1034, 1035, -0.076666,
+1034, 1046, -0.025556,
+1034, 1054, -0.025556,
+1034, 1057, -0.025556,
+1034, 1058, -0.076666,
+1034, 1059, -0.076666,
+1034, 1060, -0.025556,
+1034, 1061, -0.025556,
+1034, 1063, -0.076666,
+1034, 1066, -0.076666,
+1034, 1080, -0.025556,
+1034, 1081, -0.025556,
+1034, 1082, -0.025556,
+1034, 1085, -0.025556,
+1034, 1087, -0.025556,
+1034, 1090, -0.025556,
+1034, 1091, -0.025556,
+1034, 1094, -0.025556,
+1034, 1096, -0.025556,
+1034, 1097, -0.025556,
+1034, 1098, -0.025556,
+1034, 1099, -0.025556,
+1034, 1100, -0.025556,
+1034, 1102, -0.025556,
+1034, 1110, -0.025556,
+1034, 1114, -0.025556,
+1034, 1122, -0.076666,
+1034, 1123, -0.025556,
+1034, 1138, -0.025556,
+1034, 1140, -0.1022215,
+1034, 1141, -0.025556,
+1040, 1026, -0.076666,
+1040, 1028, -0.025556,
+1040, 1035, -0.076666,
+1040, 1054, -0.025556,
+1040, 1057, -0.025556,
+1040, 1058, -0.076666,
+1040, 1059, -0.076666,
+1040, 1060, -0.025556,
+1040, 1063, -0.076666,
+1040, 1066, -0.076666,
+1040, 1080, -0.025556,
+1040, 1081, -0.025556,
+1040, 1082, -0.025556,
+1040, 1085, -0.025556,
+1040, 1087, -0.025556,
+1040, 1090, -0.025556,
+1040, 1091, -0.025556,
+1040, 1094, -0.025556,
+1040, 1096, -0.025556,
+1040, 1097, -0.025556,
+1040, 1098, -0.025556,
+1040, 1099, -0.025556,
+1040, 1100, -0.025556,
+1040, 1102, -0.025556,
+1040, 1110, -0.025556,
+1040, 1114, -0.025556,
+1040, 1122, -0.076666,
+1040, 1123, -0.025556,
+1040, 1138, -0.025556,
+1040, 1140, -0.1022215,
+1040, 1141, -0.025556,
+1043, 1033, -0.025556,
+1043, 1040, -0.076666,
+1043, 1044, -0.076666,
+1043, 1051, -0.025556,
+1043, 1071, -0.076666,
+1043, 1072, -0.076666,
+1043, 1077, -0.076666,
+1043, 1080, -0.076666,
+1043, 1081, -0.076666,
+1043, 1083, -0.076666,
+1043, 1084, -0.076666,
+1043, 1086, -0.076666,
+1043, 1089, -0.076666,
+1043, 1091, -0.076666,
+1043, 1092, -0.076666,
+1043, 1094, -0.076666,
+1043, 1096, -0.076666,
+1043, 1097, -0.076666,
+1043, 1098, -0.076666,
+1043, 1099, -0.076666,
+1043, 1100, -0.076666,
+1043, 1105, -0.076666,
+1043, 1108, -0.076666,
+1043, 1113, -0.076666,
+1043, 1139, -0.076666,
+1043, 1141, -0.076666,
+1046, 1028, -0.025556,
+1046, 1054, -0.025556,
+1046, 1057, -0.025556,
+1046, 1060, -0.025556,
+1046, 1095, -0.025556,
+1046, 1138, -0.025556,
+1050, 1028, -0.025556,
+1050, 1054, -0.025556,
+1050, 1057, -0.025556,
+1050, 1060, -0.025556,
+1050, 1095, -0.025556,
+1050, 1138, -0.025556,
+1054, 1040, -0.025556,
+1054, 1044, -0.025556,
+1054, 1046, -0.025556,
+1054, 1059, -0.025556,
+1054, 1061, -0.025556,
+1054, 1071, -0.025556,
+1054, 1140, -0.025556,
+1056, 1033, -0.076666,
+1056, 1040, -0.076666,
+1056, 1044, -0.076666,
+1056, 1051, -0.076666,
+1056, 1071, -0.076666,
+1056, 1072, -0.025556,
+1056, 1076, -0.076666,
+1056, 1077, -0.025556,
+1056, 1083, -0.076666,
+1056, 1086, -0.025556,
+1056, 1105, -0.025556,
+1056, 1113, -0.076666,
+1056, 1139, -0.025556,
+1058, 1033, -0.025556,
+1058, 1040, -0.076666,
+1058, 1044, -0.076666,
+1058, 1051, -0.025556,
+1058, 1071, -0.076666,
+1058, 1072, -0.076666,
+1058, 1077, -0.076666,
+1058, 1080, -0.076666,
+1058, 1081, -0.076666,
+1058, 1083, -0.076666,
+1058, 1084, -0.076666,
+1058, 1086, -0.076666,
+1058, 1089, -0.076666,
+1058, 1091, -0.076666,
+1058, 1092, -0.076666,
+1058, 1094, -0.076666,
+1058, 1096, -0.076666,
+1058, 1097, -0.076666,
+1058, 1098, -0.076666,
+1058, 1099, -0.076666,
+1058, 1100, -0.076666,
+1058, 1105, -0.076666,
+1058, 1108, -0.076666,
+1058, 1113, -0.076666,
+1058, 1139, -0.076666,
+1058, 1141, -0.076666,
+1059, 1028, -0.025556,
+1059, 1033, -0.051111,
+1059, 1040, -0.076666,
+1059, 1044, -0.051111,
+1059, 1051, -0.051111,
+1059, 1054, -0.025556,
+1059, 1057, -0.025556,
+1059, 1060, -0.025556,
+1059, 1071, -0.076666,
+1059, 1072, -0.076666,
+1059, 1077, -0.076666,
+1059, 1080, -0.1022215,
+1059, 1081, -0.1022215,
+1059, 1083, -0.1022215,
+1059, 1084, -0.1022215,
+1059, 1086, -0.076666,
+1059, 1089, -0.076666,
+1059, 1091, -0.1022215,
+1059, 1094, -0.1022215,
+1059, 1096, -0.1022215,
+1059, 1097, -0.1022215,
+1059, 1098, -0.1022215,
+1059, 1099, -0.1022215,
+1059, 1100, -0.1022215,
+1059, 1105, -0.076666,
+1059, 1108, -0.076666,
+1059, 1113, -0.1022215,
+1059, 1138, -0.025556,
+1059, 1139, -0.076666,
+1059, 1141, -0.1022215,
+1060, 1040, -0.025556,
+1060, 1044, -0.025556,
+1060, 1046, -0.025556,
+1060, 1059, -0.025556,
+1060, 1061, -0.025556,
+1060, 1071, -0.025556,
+1060, 1140, -0.025556,
+1061, 1028, -0.025556,
+1061, 1054, -0.025556,
+1061, 1057, -0.025556,
+1061, 1060, -0.025556,
+1061, 1095, -0.025556,
+1061, 1138, -0.025556,
+1066, 1026, -0.076666,
+1066, 1028, -0.025556,
+1066, 1035, -0.076666,
+1066, 1046, -0.025556,
+1066, 1054, -0.025556,
+1066, 1057, -0.025556,
+1066, 1058, -0.076666,
+1066, 1059, -0.076666,
+1066, 1060, -0.025556,
+1066, 1061, -0.025556,
+1066, 1063, -0.076666,
+1066, 1066, -0.076666,
+1066, 1080, -0.025556,
+1066, 1081, -0.025556,
+1066, 1082, -0.025556,
+1066, 1085, -0.025556,
+1066, 1087, -0.025556,
+1066, 1090, -0.025556,
+1066, 1091, -0.025556,
+1066, 1094, -0.025556,
+1066, 1096, -0.025556,
+1066, 1097, -0.025556,
+1066, 1098, -0.025556,
+1066, 1099, -0.025556,
+1066, 1100, -0.025556,
+1066, 1102, -0.025556,
+1066, 1110, -0.025556,
+1066, 1114, -0.025556,
+1066, 1122, -0.076666,
+1066, 1123, -0.025556,
+1066, 1138, -0.025556,
+1066, 1140, -0.1022215,
+1066, 1141, -0.025556,
+1068, 1026, -0.076666,
+1068, 1028, -0.025556,
+1068, 1035, -0.076666,
+1068, 1046, -0.025556,
+1068, 1054, -0.025556,
+1068, 1057, -0.025556,
+1068, 1058, -0.076666,
+1068, 1059, -0.076666,
+1068, 1060, -0.025556,
+1068, 1061, -0.025556,
+1068, 1063, -0.076666,
+1068, 1066, -0.076666,
+1068, 1080, -0.025556,
+1068, 1081, -0.025556,
+1068, 1082, -0.025556,
+1068, 1085, -0.025556,
+1068, 1087, -0.025556,
+1068, 1090, -0.025556,
+1068, 1091, -0.025556,
+1068, 1094, -0.025556,
+1068, 1096, -0.025556,
+1068, 1097, -0.025556,
+1068, 1098, -0.025556,
+1068, 1099, -0.025556,
+1068, 1100, -0.025556,
+1068, 1102, -0.025556,
+1068, 1110, -0.025556,
+1068, 1114, -0.025556,
+1068, 1122, -0.076666,
+1068, 1123, -0.025556,
+1068, 1138, -0.025556,
+1068, 1140, -0.1022215,
+1068, 1141, -0.025556,
+1069, 1040, -0.025556,
+1069, 1044, -0.025556,
+1069, 1046, -0.025556,
+1069, 1059, -0.025556,
+1069, 1061, -0.025556,
+1069, 1071, -0.025556,
+1069, 1140, -0.025556,
+1070, 1040, -0.025556,
+1070, 1044, -0.025556,
+1070, 1046, -0.025556,
+1070, 1059, -0.025556,
+1070, 1061, -0.025556,
+1070, 1071, -0.025556,
+1070, 1140, -0.025556,
+1073, 1072, -0.051111,
+1073, 1083, -0.025556,
+1073, 1084, -0.025556,
+1073, 1092, -0.051111,
+1073, 1113, -0.025556,
+1077, 1072, -0.051111,
+1077, 1083, -0.025556,
+1077, 1084, -0.025556,
+1077, 1092, -0.051111,
+1077, 1113, -0.025556,
+1083, 1083, -0.025556,
+1083, 1084, -0.025556,
+1083, 1095, -0.076666,
+1083, 1098, -0.025556,
+1083, 1113, -0.025556,
+1083, 1141, -0.025556,
+1086, 1072, -0.051111,
+1086, 1083, -0.025556,
+1086, 1084, -0.025556,
+1086, 1092, -0.051111,
+1086, 1113, -0.025556,
+1088, 1072, -0.051111,
+1088, 1083, -0.025556,
+1088, 1084, -0.025556,
+1088, 1092, -0.051111,
+1088, 1113, -0.025556,
+1089, 1072, -0.051111,
+1089, 1083, -0.025556,
+1089, 1084, -0.025556,
+1089, 1092, -0.051111,
+1089, 1113, -0.025556,
+1092, 1072, -0.051111,
+1092, 1083, -0.025556,
+1092, 1084, -0.025556,
+1092, 1092, -0.051111,
+1092, 1113, -0.025556,
+1098, 1083, -0.025556,
+1098, 1084, -0.025556,
+1098, 1086, -0.025556,
+1098, 1092, -0.025556,
+1098, 1095, -0.076666,
+1098, 1098, -0.025556,
+1098, 1108, -0.025556,
+1098, 1113, -0.025556,
+1098, 1139, -0.025556,
+1098, 1141, -0.025556,
+1100, 1083, -0.025556,
+1100, 1084, -0.025556,
+1100, 1086, -0.025556,
+1100, 1092, -0.025556,
+1100, 1095, -0.076666,
+1100, 1098, -0.025556,
+1100, 1108, -0.025556,
+1100, 1113, -0.025556,
+1100, 1139, -0.025556,
+1100, 1141, -0.025556,
+1101, 1072, -0.051111,
+1101, 1083, -0.025556,
+1101, 1084, -0.025556,
+1101, 1092, -0.051111,
+1101, 1113, -0.025556,
+1102, 1072, -0.051111,
+1102, 1083, -0.025556,
+1102, 1084, -0.025556,
+1102, 1092, -0.051111,
+1102, 1113, -0.025556,
+1105, 1072, -0.051111,
+1105, 1083, -0.025556,
+1105, 1084, -0.025556,
+1105, 1092, -0.051111,
+1105, 1113, -0.025556,
+1113, 1083, -0.025556,
+1113, 1084, -0.025556,
+1113, 1086, -0.025556,
+1113, 1092, -0.025556,
+1113, 1095, -0.076666,
+1113, 1098, -0.025556,
+1113, 1108, -0.025556,
+1113, 1113, -0.025556,
+1113, 1139, -0.025556,
+1113, 1141, -0.025556,
+1114, 1083, -0.025556,
+1114, 1084, -0.025556,
+1114, 1086, -0.025556,
+1114, 1092, -0.025556,
+1114, 1095, -0.076666,
+1114, 1098, -0.025556,
+1114, 1108, -0.025556,
+1114, 1113, -0.025556,
+1114, 1139, -0.025556,
+1114, 1141, -0.025556,
+1122, 1026, -0.076666,
+1122, 1028, -0.025556,
+1122, 1035, -0.076666,
+1122, 1046, -0.025556,
+1122, 1054, -0.025556,
+1122, 1057, -0.025556,
+1122, 1058, -0.076666,
+1122, 1059, -0.076666,
+1122, 1060, -0.025556,
+1122, 1061, -0.025556,
+1122, 1063, -0.076666,
+1122, 1066, -0.076666,
+1122, 1080, -0.025556,
+1122, 1081, -0.025556,
+1122, 1082, -0.025556,
+1122, 1085, -0.025556,
+1122, 1087, -0.025556,
+1122, 1090, -0.025556,
+1122, 1091, -0.025556,
+1122, 1094, -0.025556,
+1122, 1096, -0.025556,
+1122, 1097, -0.025556,
+1122, 1098, -0.025556,
+1122, 1099, -0.025556,
+1122, 1100, -0.025556,
+1122, 1102, -0.025556,
+1122, 1110, -0.025556,
+1122, 1114, -0.025556,
+1122, 1122, -0.076666,
+1122, 1123, -0.025556,
+1122, 1138, -0.025556,
+1122, 1140, -0.1022215,
+1122, 1141, -0.025556,
+1123, 1083, -0.025556,
+1123, 1084, -0.025556,
+1123, 1086, -0.025556,
+1123, 1092, -0.025556,
+1123, 1095, -0.076666,
+1123, 1098, -0.025556,
+1123, 1108, -0.025556,
+1123, 1113, -0.025556,
+1123, 1139, -0.025556,
+1123, 1141, -0.025556,
+1138, 1040, -0.025556,
+1138, 1044, -0.025556,
+1138, 1046, -0.025556,
+1138, 1059, -0.025556,
+1138, 1061, -0.025556,
+1138, 1071, -0.025556,
+1138, 1140, -0.025556,
+1139, 1072, -0.051111,
+1139, 1083, -0.025556,
+1139, 1084, -0.025556,
+1139, 1092, -0.051111,
+1139, 1113, -0.025556,
+1140, 1028, -0.025556,
+1140, 1040, -0.1022215,
+1140, 1054, -0.025556,
+1140, 1057, -0.025556,
+1140, 1060, -0.025556,
+1140, 1071, -0.1022215,
+1140, 1072, -0.076666,
+1140, 1077, -0.076666,
+1140, 1080, -0.1022215,
+1140, 1081, -0.1022215,
+1140, 1083, -0.1022215,
+1140, 1084, -0.1022215,
+1140, 1086, -0.076666,
+1140, 1091, -0.1022215,
+1140, 1094, -0.1022215,
+1140, 1096, -0.1022215,
+1140, 1097, -0.1022215,
+1140, 1098, -0.1022215,
+1140, 1099, -0.1022215,
+1140, 1100, -0.1022215,
+1140, 1105, -0.076666,
+1140, 1113, -0.1022215,
+1140, 1138, -0.025556,
+1140, 1139, -0.076666,
+1140, 1141, -0.1022215,
+1141, 1083, -0.076666,
+1141, 1084, -0.076666,
+1141, 1113, -0.076666
+KERNS_END
+
+END
+
+DEF_FONT(wntt10, cyrillic/wntt10.ttf, 95)
+
+xHeight(0.430555) quad(1.049991) space(0.524996)
+
+roman(wnr10) ss(wnss10)
+
+METRICS_START
+171, 0.524996, 0.438889, 0, 0,
+187, 0.524996, 0.438889, 0, 0,
+305, 0.524996, 0.430555, 0, 0,
+774, 0.524996, 0.638838, 0, 0,
+776, 0.524996, 0.611112, 0, 0,
+1025, 0.524996, 0.819394, 0, 0,
+1026, 0.524996, 0.611112, 0, 0,
+1028, 0.524996, 0.611112, 0, 0,
+1029, 0.524996, 0.611112, 0, 0,
+1030, 0.524996, 0.611112, 0, 0,
+1032, 0.524996, 0.611112, 0, 0,
+1033, 0.524996, 0.611112, 0, 0,
+1034, 0.524996, 0.611112, 0, 0,
+1035, 0.524996, 0.611112, 0, 0,
+1039, 0.524996, 0.611112, 0.166667, 0,
+1040, 0.524996, 0.611112, 0, 0,
+1041, 0.524996, 0.611112, 0, 0,
+1042, 0.524996, 0.611112, 0, 0,
+1043, 0.524996, 0.611112, 0, 0,
+1044, 0.524996, 0.611112, 0.166667, 0,
+1045, 0.524996, 0.611112, 0, 0,
+1046, 0.524996, 0.611112, 0, 0,
+1047, 0.524996, 0.611112, 0, 0,
+1048, 0.524996, 0.611112, 0, 0,
+1049, 0.524996, 0.819394, 0, 0,
+1050, 0.524996, 0.611112, 0, 0,
+1051, 0.524996, 0.611112, 0, 0,
+1052, 0.524996, 0.611112, 0, 0,
+1053, 0.524996, 0.611112, 0, 0,
+1054, 0.524996, 0.611112, 0, 0,
+1055, 0.524996, 0.611112, 0, 0,
+1056, 0.524996, 0.611112, 0, 0,
+1057, 0.524996, 0.611112, 0, 0,
+1058, 0.524996, 0.611112, 0, 0,
+1059, 0.524996, 0.611112, 0, 0,
+1060, 0.524996, 0.611112, 0, 0,
+1061, 0.524996, 0.611112, 0, 0,
+1062, 0.524996, 0.611112, 0.166667, 0,
+1063, 0.524996, 0.611112, 0, 0,
+1064, 0.524996, 0.611112, 0, 0,
+1065, 0.524996, 0.611112, 0.166667, 0,
+1066, 0.524996, 0.611112, 0, 0,
+1067, 0.524996, 0.611112, 0, 0,
+1068, 0.524996, 0.611112, 0, 0,
+1069, 0.524996, 0.611112, 0, 0,
+1070, 0.524996, 0.611112, 0, 0,
+1071, 0.524996, 0.611112, 0, 0,
+1072, 0.524996, 0.430555, 0, 0,
+1073, 0.524996, 0.611112, 0, 0,
+1074, 0.524996, 0.430555, 0, 0,
+1075, 0.524996, 0.430555, 0, 0,
+1076, 0.524996, 0.430555, 0.13889, 0,
+1077, 0.524996, 0.430555, 0, 0,
+1078, 0.524996, 0.430555, 0, 0,
+1079, 0.524996, 0.430555, 0, 0,
+1080, 0.524996, 0.430555, 0, 0,
+1081, 0.524996, 0.638838, 0, 0,
+1082, 0.524996, 0.430555, 0, 0,
+1083, 0.524996, 0.430555, 0, 0,
+1084, 0.524996, 0.430555, 0, 0,
+1085, 0.524996, 0.430555, 0, 0,
+1086, 0.524996, 0.430555, 0, 0,
+1087, 0.524996, 0.430555, 0, 0,
+1088, 0.524996, 0.430555, 0.222223, 0,
+1089, 0.524996, 0.430555, 0, 0,
+1090, 0.524996, 0.430555, 0, 0,
+1091, 0.524996, 0.430555, 0.222223, 0,
+1092, 0.524996, 0.611112, 0.222223, 0,
+1093, 0.524996, 0.430555, 0, 0,
+1094, 0.524996, 0.430555, 0.13889, 0,
+1095, 0.524996, 0.430555, 0, 0,
+1096, 0.524996, 0.430555, 0, 0,
+1097, 0.524996, 0.430555, 0.13889, 0,
+1098, 0.524996, 0.430555, 0, 0,
+1099, 0.524996, 0.430555, 0, 0,
+1100, 0.524996, 0.430555, 0, 0,
+1101, 0.524996, 0.430555, 0, 0,
+1102, 0.524996, 0.430555, 0, 0,
+1103, 0.524996, 0.430555, 0, 0,
+1105, 0.524996, 0.611112, 0, 0,
+1106, 0.524996, 0.611112, 0.222223, 0,
+1108, 0.524996, 0.430555, 0, 0,
+1109, 0.524996, 0.430555, 0, 0,
+1110, 0.524996, 0.611112, 0, 0,
+1112, 0.524996, 0.611112, 0.222223, 0,
+1113, 0.524996, 0.430555, 0, 0,
+1114, 0.524996, 0.430555, 0, 0,
+1115, 0.524996, 0.611112, 0, 0,
+1119, 0.524996, 0.430555, 0.13889, 0,
+1122, 0.524996, 0.694445, 0, 0,
+1123, 0.524996, 0.638838, 0, 0,
+1138, 0.524996, 0.611112, 0, 0,
+1139, 0.524996, 0.430555, 0, 0,
+1140, 0.524996, 0.611112, 0, 0,
+1141, 0.524996, 0.430555, 0, 0
+METRICS_END
+
+LIGTURES_START
+1044, 1032, 1026,
+1044, 1112, 1026,
+1047, 1061, 1046,
+1047, 1093, 1046,
+1050, 1061, 1061,
+1050, 1093, 1061,
+1051, 1032, 1033,
+1051, 1112, 1033,
+1053, 1032, 1034,
+1053, 1112, 1034,
+1057, 1061, 1064,
+1057, 1093, 1064,
+1058, 1057, 1062,
+1058, 1089, 1062,
+1062, 1061, 1063,
+1062, 1093, 1063,
+1064, 1062, 0,
+1064, 1063, 1065,
+1064, 1094, 0,
+1064, 1095, 1065,
+1067, 1040, 1071,
+1067, 1059, 1070,
+1067, 1072, 1071,
+1067, 1091, 1070,
+1076, 1112, 1106,
+1079, 1093, 1078,
+1082, 1093, 1093,
+1083, 1112, 1113,
+1085, 1112, 1114,
+1089, 1093, 1096,
+1090, 1089, 1094,
+1094, 1093, 1095,
+1096, 1094, 0,
+1096, 1095, 1097,
+1099, 1072, 1103,
+1099, 1091, 1102
+LIGTURES_END
+
+END
+
+DEF_FONT(wnss10, cyrillic/wnss10.ttf, 95)
+
+xHeight(0.444445) quad(1.000003) space(0.333334)
+
+bold(wnssbx10) roman(wnr10) tt(wntt10) it(wnssi10)
+
+METRICS_START
+171, 0.666669, 0.438889, 0, 0,
+187, 0.666669, 0.438889, 0, 0,
+305, 0.23889, 0.444445, 0, 0,
+774, 0.500002, 0.652727, 0, 0,
+776, 0.500002, 0.660319, 0, 0,
+1025, 0.597224, 0.902727, 0, 0,
+1026, 0.8194475, 0.694445, 0, 0,
+1028, 0.638891, 0.694445, 0, 0,
+1029, 0.555557, 0.694445, 0, 0,
+1030, 0.277781, 0.694445, 0, 0,
+1032, 0.472224, 0.694445, 0, 0,
+1033, 1.037504, 0.694445, 0, 0,
+1034, 1.020838, 0.694445, 0, 0,
+1035, 0.763891, 0.694445, 0, 0,
+1039, 0.694448, 0.694445, 0.194445, 0,
+1040, 0.66667, 0.694445, 0, 0,
+1041, 0.66667, 0.694445, 0, 0,
+1042, 0.66667, 0.694445, 0, 0,
+1043, 0.541669, 0.694445, 0, 0,
+1044, 0.727783, 0.694445, 0.194445, 0,
+1045, 0.597224, 0.694445, 0, 0,
+1046, 1.111117, 0.694445, 0, 0,
+1047, 0.611113, 0.694445, 0, 0,
+1048, 0.694448, 0.694445, 0, 0,
+1049, 0.694448, 0.902727, 0, 0,
+1050, 0.694448, 0.694445, 0, 0,
+1051, 0.711116, 0.694445, 0, 0,
+1052, 0.875005, 0.694445, 0, 0,
+1053, 0.694448, 0.694445, 0, 0,
+1054, 0.736113, 0.694445, 0, 0,
+1055, 0.694448, 0.694445, 0, 0,
+1056, 0.638891, 0.694445, 0, 0,
+1057, 0.638891, 0.694445, 0, 0,
+1058, 0.680557, 0.694445, 0, 0,
+1059, 0.66667, 0.694445, 0, 0.013888,
+1060, 0.833336, 0.694445, 0, 0,
+1061, 0.66667, 0.694445, 0, 0,
+1062, 0.711116, 0.694445, 0.194445, 0,
+1063, 0.694448, 0.694445, 0, 0,
+1064, 1.083339, 0.694445, 0, 0,
+1065, 1.100006, 0.694445, 0.194445, 0,
+1066, 0.868059, 0.694445, 0, 0,
+1067, 0.888895, 0.694445, 0, 0,
+1068, 0.66667, 0.694445, 0, 0,
+1069, 0.638891, 0.694445, 0, 0,
+1070, 1.04167, 0.694445, 0, 0,
+1071, 0.645836, 0.694445, 0, 0,
+1072, 0.480557, 0.444445, 0, 0,
+1073, 0.500002, 0.694445, 0, 0,
+1074, 0.480557, 0.444445, 0, 0,
+1075, 0.404167, 0.444445, 0, 0.013888,
+1076, 0.538892, 0.444445, 0.162038, 0,
+1077, 0.444446, 0.444445, 0, 0,
+1078, 0.7388935, 0.444445, 0, 0,
+1079, 0.444446, 0.444445, 0, 0.002777,
+1080, 0.537503, 0.444445, 0, 0,
+1081, 0.537503, 0.652727, 0, 0,
+1082, 0.488892, 0.444445, 0, 0,
+1083, 0.527781, 0.444445, 0, 0,
+1084, 0.669447, 0.444445, 0, 0,
+1085, 0.516668, 0.444445, 0, 0,
+1086, 0.500002, 0.444445, 0, 0,
+1087, 0.516668, 0.444445, 0, 0,
+1088, 0.516668, 0.444445, 0.194445, 0,
+1089, 0.444446, 0.444445, 0, 0,
+1090, 0.458334, 0.444445, 0, 0.019444,
+1091, 0.461113, 0.444445, 0.194445, 0.013888,
+1092, 0.76667, 0.694445, 0.194445, 0,
+1093, 0.461113, 0.444445, 0, 0,
+1094, 0.5486145, 0.444445, 0.162038, 0,
+1095, 0.537503, 0.444445, 0, 0,
+1096, 0.76667, 0.444445, 0, 0,
+1097, 0.7777815, 0.444445, 0.162038, 0,
+1098, 0.590279, 0.444445, 0, 0,
+1099, 0.683336, 0.444445, 0, 0,
+1100, 0.480557, 0.444445, 0, 0,
+1101, 0.444446, 0.444445, 0, 0,
+1102, 0.730558, 0.444445, 0, 0,
+1103, 0.515279, 0.444445, 0, 0,
+1105, 0.444446, 0.660319, 0, 0,
+1106, 0.488892, 0.694445, 0.194445, 0,
+1108, 0.43889, 0.444445, 0, 0,
+1109, 0.383334, 0.444445, 0, 0,
+1110, 0.23889, 0.679365, 0, 0,
+1112, 0.266668, 0.679365, 0.194445, 0,
+1113, 0.755559, 0.444445, 0, 0,
+1114, 0.765282, 0.444445, 0, 0,
+1115, 0.516668, 0.694445, 0, 0,
+1119, 0.537503, 0.444445, 0.162038, 0,
+1122, 0.7777815, 0.75, 0, 0,
+1123, 0.500002, 0.652727, 0, 0,
+1138, 0.777781, 0.694445, 0, 0,
+1139, 0.500002, 0.444445, 0, 0,
+1140, 0.722226, 0.694445, 0, 0.013888,
+1141, 0.491667, 0.444445, 0, 0.013888
+METRICS_END
+
+LIGTURES_START
+1044, 1032, 1026,
+1044, 1112, 1026,
+1047, 1061, 1046,
+1047, 1093, 1046,
+1050, 1061, 1061,
+1050, 1093, 1061,
+1051, 1032, 1033,
+1051, 1112, 1033,
+1053, 1032, 1034,
+1053, 1112, 1034,
+1057, 1061, 1064,
+1057, 1093, 1064,
+1058, 1057, 1062,
+1058, 1089, 1062,
+1062, 1061, 1063,
+1062, 1093, 1063,
+1064, 1062, 0,
+1064, 1063, 1065,
+1064, 1094, 0,
+1064, 1095, 1065,
+1067, 1040, 1071,
+1067, 1059, 1070,
+1067, 1072, 1071,
+1067, 1091, 1070,
+1076, 1112, 1106,
+1079, 1093, 1078,
+1082, 1093, 1093,
+1083, 1112, 1113,
+1085, 1112, 1114,
+1089, 1093, 1096,
+1090, 1089, 1094,
+1094, 1093, 1095,
+1096, 1094, 0,
+1096, 1095, 1097,
+1099, 1072, 1103,
+1099, 1091, 1102
+LIGTURES_END
+
+KERNS_START
+1026, 1026, -0.083334,
+1026, 1028, -0.027779,
+1026, 1035, -0.083334,
+1026, 1046, -0.027779,
+1026, 1054, -0.027779,
+1026, 1057, -0.027779,
+1026, 1058, -0.083334,
+1026, 1059, -0.027779,
+1026, 1060, -0.027779,
+1026, 1061, -0.027779,
+1026, 1063, -0.083334,
+1026, 1066, -0.083334,
+1026, 1090, -0.027779,
+1026, 1095, -0.083334,
+1026, 1098, -0.027779,
+1026, 1122, -0.083334,
+1026, 1123, -0.027779,
+1026, 1138, -0.027779,
+1026, 1140, -0.083334,
+1030, 1030, 0.027779,
+1033, 1026, -0.083334,
+1033, 1028, -0.027779,
+1033, 1035, -0.083334,
+1033, 1046, -0.027779,
+1033, 1054, -0.027779,
+1033, 1057, -0.027779,
+1033, 1058, -0.083334,
+1033, 1059, -0.027779,
+1033, 1060, -0.027779,
+1033, 1061, -0.027779,
+1033, 1063, -0.083334,
+1033, 1066, -0.083334,
+1033, 1090, -0.027779,
+1033, 1095, -0.083334,
+1033, 1098, -0.027779,
+1033, 1122, -0.083334,
+1033, 1123, -0.027779,
+1033, 1138, -0.027779,
+1033, 1140, -0.083334,
+1034, 1026, -0.083334,
+1034, 1028, -0.027779,
+1034, 1035, -0.083334,
+1034, 1046, -0.027779,
+1034, 1054, -0.027779,
+1034, 1057, -0.027779,
+1034, 1058, -0.083334,
+1034, 1059, -0.027779,
+1034, 1060, -0.027779,
+1034, 1061, -0.027779,
+1034, 1063, -0.083334,
+1034, 1066, -0.083334,
+1034, 1090, -0.027779,
+1034, 1095, -0.083334,
+1034, 1098, -0.027779,
+1034, 1122, -0.083334,
+1034, 1123, -0.027779,
+1034, 1138, -0.027779,
+1034, 1140, -0.083334,
+1040, 1026, -0.083334,
+1040, 1028, -0.027779,
+1040, 1035, -0.083334,
+1040, 1054, -0.027779,
+1040, 1057, -0.027779,
+1040, 1058, -0.083334,
+1040, 1059, -0.027779,
+1040, 1060, -0.027779,
+1040, 1063, -0.083334,
+1040, 1066, -0.083334,
+1040, 1090, -0.027779,
+1040, 1095, -0.083334,
+1040, 1098, -0.027779,
+1040, 1122, -0.083334,
+1040, 1123, -0.027779,
+1040, 1138, -0.027779,
+1040, 1140, -0.083334,
+1043, 1033, -0.055555,
+1043, 1040, -0.083334,
+1043, 1044, -0.083334,
+1043, 1051, -0.055555,
+1043, 1072, -0.083334,
+1043, 1076, -0.083334,
+1043, 1077, -0.083334,
+1043, 1083, -0.083334,
+1043, 1086, -0.083334,
+1043, 1089, -0.083334,
+1043, 1092, -0.083334,
+1043, 1103, -0.083334,
+1043, 1105, -0.083334,
+1043, 1108, -0.083334,
+1043, 1113, -0.083334,
+1043, 1139, -0.083334,
+1046, 1028, -0.027779,
+1046, 1054, -0.027779,
+1046, 1057, -0.027779,
+1046, 1060, -0.027779,
+1046, 1090, -0.027779,
+1046, 1095, -0.027779,
+1046, 1098, -0.027779,
+1046, 1123, -0.027779,
+1046, 1138, -0.027779,
+1050, 1028, -0.027779,
+1050, 1054, -0.027779,
+1050, 1057, -0.027779,
+1050, 1060, -0.027779,
+1050, 1090, -0.027779,
+1050, 1095, -0.027779,
+1050, 1098, -0.027779,
+1050, 1123, -0.027779,
+1050, 1138, -0.027779,
+1054, 1040, -0.027779,
+1054, 1044, -0.027779,
+1054, 1046, -0.027779,
+1054, 1059, -0.027779,
+1054, 1061, -0.027779,
+1054, 1140, -0.027779,
+1056, 1033, -0.083334,
+1056, 1040, -0.083334,
+1056, 1044, -0.083334,
+1056, 1051, -0.083334,
+1056, 1072, -0.027779,
+1056, 1076, -0.083334,
+1056, 1077, -0.027779,
+1056, 1083, -0.083334,
+1056, 1086, -0.027779,
+1056, 1105, -0.027779,
+1056, 1113, -0.083334,
+1056, 1139, -0.027779,
+1058, 1033, -0.055555,
+1058, 1040, -0.083334,
+1058, 1044, -0.083334,
+1058, 1051, -0.055555,
+1058, 1072, -0.083334,
+1058, 1076, -0.083334,
+1058, 1077, -0.083334,
+1058, 1083, -0.083334,
+1058, 1086, -0.083334,
+1058, 1089, -0.083334,
+1058, 1092, -0.083334,
+1058, 1103, -0.083334,
+1058, 1105, -0.083334,
+1058, 1108, -0.083334,
+1058, 1113, -0.083334,
+1058, 1139, -0.083334,
+1059, 1028, -0.027779,
+1059, 1033, -0.055555,
+1059, 1040, -0.027779,
+1059, 1044, -0.055555,
+1059, 1051, -0.055555,
+1059, 1054, -0.027779,
+1059, 1057, -0.027779,
+1059, 1060, -0.027779,
+1059, 1072, -0.027779,
+1059, 1076, -0.083334,
+1059, 1077, -0.027779,
+1059, 1083, -0.083334,
+1059, 1086, -0.027779,
+1059, 1089, -0.027779,
+1059, 1103, -0.083334,
+1059, 1105, -0.027779,
+1059, 1108, -0.027779,
+1059, 1113, -0.083334,
+1059, 1138, -0.027779,
+1059, 1139, -0.027779,
+1060, 1040, -0.027779,
+1060, 1044, -0.027779,
+1060, 1046, -0.027779,
+1060, 1059, -0.027779,
+1060, 1061, -0.027779,
+1060, 1140, -0.027779,
+1061, 1028, -0.027779,
+1061, 1054, -0.027779,
+1061, 1057, -0.027779,
+1061, 1060, -0.027779,
+1061, 1090, -0.027779,
+1061, 1095, -0.027779,
+1061, 1098, -0.027779,
+1061, 1123, -0.027779,
+1061, 1138, -0.027779,
+1066, 1026, -0.083334,
+1066, 1028, -0.027779,
+1066, 1035, -0.083334,
+1066, 1046, -0.027779,
+1066, 1054, -0.027779,
+1066, 1057, -0.027779,
+1066, 1058, -0.083334,
+1066, 1059, -0.027779,
+1066, 1060, -0.027779,
+1066, 1061, -0.027779,
+1066, 1063, -0.083334,
+1066, 1066, -0.083334,
+1066, 1090, -0.027779,
+1066, 1095, -0.083334,
+1066, 1098, -0.027779,
+1066, 1122, -0.083334,
+1066, 1123, -0.027779,
+1066, 1138, -0.027779,
+1066, 1140, -0.083334,
+1068, 1026, -0.083334,
+1068, 1028, -0.027779,
+1068, 1035, -0.083334,
+1068, 1046, -0.027779,
+1068, 1054, -0.027779,
+1068, 1057, -0.027779,
+1068, 1058, -0.083334,
+1068, 1059, -0.027779,
+1068, 1060, -0.027779,
+1068, 1061, -0.027779,
+1068, 1063, -0.083334,
+1068, 1066, -0.083334,
+1068, 1090, -0.027779,
+1068, 1095, -0.083334,
+1068, 1098, -0.027779,
+1068, 1122, -0.083334,
+1068, 1123, -0.027779,
+1068, 1138, -0.027779,
+1068, 1140, -0.083334,
+1069, 1040, -0.027779,
+1069, 1044, -0.027779,
+1069, 1046, -0.027779,
+1069, 1059, -0.027779,
+1069, 1061, -0.027779,
+1069, 1140, -0.027779,
+1070, 1040, -0.027779,
+1070, 1044, -0.027779,
+1070, 1046, -0.027779,
+1070, 1059, -0.027779,
+1070, 1061, -0.027779,
+1070, 1140, -0.027779,
+1072, 1091, -0.027779,
+1072, 1095, -0.027779,
+1073, 1076, -0.027779,
+1073, 1078, -0.027779,
+1073, 1093, -0.027779,
+1073, 1103, -0.027779,
+1075, 1076, -0.027779,
+1075, 1083, -0.027779,
+1075, 1103, -0.027779,
+1075, 1113, -0.027779,
+1078, 1072, -0.027779,
+1078, 1077, -0.027779,
+1078, 1086, -0.027779,
+1078, 1089, -0.027779,
+1078, 1105, -0.027779,
+1078, 1108, -0.027779,
+1078, 1139, -0.027779,
+1082, 1072, -0.027779,
+1082, 1077, -0.027779,
+1082, 1086, -0.027779,
+1082, 1089, -0.027779,
+1082, 1105, -0.027779,
+1082, 1108, -0.027779,
+1082, 1139, -0.027779,
+1086, 1076, -0.027779,
+1086, 1078, -0.027779,
+1086, 1093, -0.027779,
+1086, 1103, -0.027779,
+1088, 1076, -0.027779,
+1088, 1078, -0.027779,
+1088, 1093, -0.027779,
+1088, 1103, -0.027779,
+1089, 1076, -0.027779,
+1089, 1078, -0.027779,
+1089, 1093, -0.027779,
+1089, 1103, -0.027779,
+1090, 1076, -0.027779,
+1090, 1083, -0.027779,
+1090, 1103, -0.027779,
+1090, 1113, -0.027779,
+1091, 1072, -0.027779,
+1091, 1076, -0.055555,
+1091, 1077, -0.027779,
+1091, 1083, -0.055555,
+1091, 1086, -0.027779,
+1091, 1089, -0.027779,
+1091, 1103, -0.027779,
+1091, 1105, -0.027779,
+1091, 1108, -0.027779,
+1091, 1113, -0.055555,
+1091, 1139, -0.027779,
+1092, 1076, -0.027779,
+1092, 1078, -0.027779,
+1092, 1093, -0.027779,
+1092, 1103, -0.027779,
+1093, 1072, -0.027779,
+1093, 1077, -0.027779,
+1093, 1086, -0.027779,
+1093, 1089, -0.027779,
+1093, 1105, -0.027779,
+1093, 1108, -0.027779,
+1093, 1139, -0.027779,
+1098, 1086, -0.027779,
+1098, 1090, -0.027779,
+1098, 1091, -0.055555,
+1098, 1092, -0.027779,
+1098, 1095, -0.083334,
+1098, 1098, -0.027779,
+1098, 1108, -0.027779,
+1098, 1123, -0.027779,
+1098, 1139, -0.027779,
+1098, 1141, -0.055555,
+1100, 1086, -0.027779,
+1100, 1090, -0.027779,
+1100, 1091, -0.055555,
+1100, 1092, -0.027779,
+1100, 1095, -0.083334,
+1100, 1098, -0.027779,
+1100, 1108, -0.027779,
+1100, 1123, -0.027779,
+1100, 1139, -0.027779,
+1100, 1141, -0.055555,
+1101, 1076, -0.027779,
+1101, 1078, -0.027779,
+1101, 1093, -0.027779,
+1101, 1103, -0.027779,
+1102, 1076, -0.027779,
+1102, 1078, -0.027779,
+1102, 1093, -0.027779,
+1102, 1103, -0.027779,
+1113, 1086, -0.027779,
+1113, 1090, -0.027779,
+1113, 1091, -0.055555,
+1113, 1092, -0.027779,
+1113, 1095, -0.083334,
+1113, 1098, -0.027779,
+1113, 1108, -0.027779,
+1113, 1123, -0.027779,
+1113, 1139, -0.027779,
+1113, 1141, -0.055555,
+1114, 1086, -0.027779,
+1114, 1090, -0.027779,
+1114, 1091, -0.055555,
+1114, 1092, -0.027779,
+1114, 1095, -0.083334,
+1114, 1098, -0.027779,
+1114, 1108, -0.027779,
+1114, 1123, -0.027779,
+1114, 1139, -0.027779,
+1114, 1141, -0.055555,
+1122, 1026, -0.083334,
+1122, 1028, -0.027779,
+1122, 1035, -0.083334,
+1122, 1046, -0.027779,
+1122, 1054, -0.027779,
+1122, 1057, -0.027779,
+1122, 1058, -0.083334,
+1122, 1059, -0.027779,
+1122, 1060, -0.027779,
+1122, 1061, -0.027779,
+1122, 1063, -0.083334,
+1122, 1066, -0.083334,
+1122, 1090, -0.027779,
+1122, 1095, -0.083334,
+1122, 1098, -0.027779,
+1122, 1122, -0.083334,
+1122, 1123, -0.027779,
+1122, 1138, -0.027779,
+1122, 1140, -0.083334,
+1123, 1086, -0.027779,
+1123, 1090, -0.027779,
+1123, 1091, -0.055555,
+1123, 1092, -0.027779,
+1123, 1095, -0.083334,
+1123, 1098, -0.027779,
+1123, 1108, -0.027779,
+1123, 1123, -0.027779,
+1123, 1139, -0.027779,
+1123, 1141, -0.055555,
+1138, 1040, -0.027779,
+1138, 1044, -0.027779,
+1138, 1046, -0.027779,
+1138, 1059, -0.027779,
+1138, 1061, -0.027779,
+1138, 1140, -0.027779,
+1139, 1076, -0.027779,
+1139, 1078, -0.027779,
+1139, 1093, -0.027779,
+1139, 1103, -0.027779,
+1140, 1028, -0.027779,
+1140, 1033, -0.055555,
+1140, 1040, -0.083334,
+1140, 1044, -0.055555,
+1140, 1051, -0.055555,
+1140, 1054, -0.027779,
+1140, 1057, -0.027779,
+1140, 1060, -0.027779,
+1140, 1072, -0.027779,
+1140, 1076, -0.083334,
+1140, 1077, -0.027779,
+1140, 1083, -0.083334,
+1140, 1086, -0.027779,
+1140, 1103, -0.083334,
+1140, 1105, -0.027779,
+1140, 1113, -0.083334,
+1140, 1138, -0.027779,
+1140, 1139, -0.027779,
+1141, 1072, -0.027779,
+1141, 1076, -0.055555,
+1141, 1077, -0.027779,
+1141, 1083, -0.055555,
+1141, 1086, -0.027779,
+1141, 1089, -0.027779,
+1141, 1103, -0.027779,
+1141, 1105, -0.027779,
+1141, 1108, -0.027779,
+1141, 1113, -0.055555,
+1141, 1139, -0.027779
+KERNS_END
+
+END
+
+DEF_FONT(wnssi10, cyrillic/wnssi10.ttf, 95)
+
+xHeight(0.444445) quad(1.000003) space(0.333334)
+
+bold(wnssbx10) roman(wnti10) tt(wntt10)
+
+METRICS_START
+171, 0.666669, 0.438889, 0, 0.02018,
+187, 0.666669, 0.438889, 0, 0,
+305, 0.23889, 0.444445, 0, 0.04169,
+774, 0.500002, 0.652727, 0, 0.085962,
+776, 0.500002, 0.660319, 0, 0.059799,
+1025, 0.597224, 0.902727, 0, 0.119829,
+1026, 0.8194475, 0.694445, 0, 0.1337185,
+1028, 0.638891, 0.694445, 0, 0.119829,
+1029, 0.555557, 0.694445, 0, 0.0920515,
+1030, 0.277781, 0.694445, 0, 0.1337185,
+1032, 0.472224, 0.694445, 0, 0.080938,
+1033, 1.037504, 0.694445, 0, 0.02595,
+1034, 1.020838, 0.694445, 0, 0.02595,
+1035, 0.763891, 0.694445, 0, 0.0920515,
+1039, 0.694448, 0.694445, 0.194445, 0.080938,
+1040, 0.66667, 0.694445, 0, 0,
+1041, 0.66667, 0.694445, 0, 0.064273,
+1042, 0.66667, 0.694445, 0, 0.05515,
+1043, 0.541669, 0.694445, 0, 0.1337185,
+1044, 0.727783, 0.694445, 0.194445, 0.080938,
+1045, 0.597224, 0.694445, 0, 0.119829,
+1046, 1.111117, 0.694445, 0, 0.119829,
+1047, 0.611113, 0.694445, 0, 0.082927,
+1048, 0.694448, 0.694445, 0, 0.080938,
+1049, 0.694448, 0.902727, 0, 0.080938,
+1050, 0.694448, 0.694445, 0, 0.119829,
+1051, 0.711116, 0.694445, 0, 0.080938,
+1052, 0.875005, 0.694445, 0, 0.080938,
+1053, 0.694448, 0.694445, 0, 0.080938,
+1054, 0.736113, 0.694445, 0, 0.075546,
+1055, 0.694448, 0.694445, 0, 0.080938,
+1056, 0.638891, 0.694445, 0, 0.082927,
+1057, 0.638891, 0.694445, 0, 0.119829,
+1058, 0.680557, 0.694445, 0, 0.1337185,
+1059, 0.66667, 0.694445, 0, 0.161496,
+1060, 0.833336, 0.694445, 0, 0.075546,
+1061, 0.66667, 0.694445, 0, 0.1337185,
+1062, 0.711116, 0.694445, 0.194445, 0.080938,
+1063, 0.694448, 0.694445, 0, 0.080938,
+1064, 1.083339, 0.694445, 0, 0.080938,
+1065, 1.100006, 0.694445, 0.194445, 0.080938,
+1066, 0.868059, 0.694445, 0, 0.02595,
+1067, 0.888895, 0.694445, 0, 0.080938,
+1068, 0.66667, 0.694445, 0, 0.02595,
+1069, 0.638891, 0.694445, 0, 0.075546,
+1070, 1.04167, 0.694445, 0, 0.075546,
+1071, 0.645836, 0.694445, 0, 0.080938,
+1072, 0.480557, 0.444445, 0, 0.009807,
+1073, 0.500002, 0.694445, 0, 0.094829,
+1074, 0.480557, 0.444445, 0, 0.0389,
+1075, 0.404167, 0.444445, 0, 0.108357,
+1076, 0.538892, 0.444445, 0.162038, 0.04169,
+1077, 0.444446, 0.444445, 0, 0.067778,
+1078, 0.7388935, 0.444445, 0, 0.083357,
+1079, 0.444446, 0.444445, 0, 0.050013,
+1080, 0.537503, 0.444445, 0, 0.04169,
+1081, 0.537503, 0.652727, 0, 0.04169,
+1082, 0.488892, 0.444445, 0, 0.083357,
+1083, 0.527781, 0.444445, 0, 0.04169,
+1084, 0.669447, 0.444445, 0, 0.04169,
+1085, 0.516668, 0.444445, 0, 0.04169,
+1086, 0.500002, 0.444445, 0, 0.066129,
+1087, 0.516668, 0.444445, 0, 0.04169,
+1088, 0.516668, 0.444445, 0.194445, 0.0389,
+1089, 0.444446, 0.444445, 0, 0.083357,
+1090, 0.458334, 0.444445, 0, 0.113913,
+1091, 0.461113, 0.444445, 0.194445, 0.108357,
+1092, 0.76667, 0.694445, 0.194445, 0.0389,
+1093, 0.461113, 0.444445, 0, 0.09169,
+1094, 0.5486145, 0.444445, 0.162038, 0.04169,
+1095, 0.537503, 0.444445, 0, 0.04169,
+1096, 0.76667, 0.444445, 0, 0.04169,
+1097, 0.7777815, 0.444445, 0.162038, 0.04169,
+1098, 0.590279, 0.444445, 0, 0.0389,
+1099, 0.683336, 0.444445, 0, 0.04169,
+1100, 0.480557, 0.444445, 0, 0.0389,
+1101, 0.444446, 0.444445, 0, 0.060573,
+1102, 0.730558, 0.444445, 0, 0.066129,
+1103, 0.515279, 0.444445, 0, 0.04169,
+1105, 0.444446, 0.660319, 0, 0.067778,
+1106, 0.488892, 0.694445, 0.194445, 0.066129,
+1108, 0.43889, 0.444445, 0, 0.083357,
+1109, 0.383334, 0.444445, 0, 0.077802,
+1110, 0.23889, 0.679365, 0, 0.09718,
+1112, 0.266668, 0.679365, 0.194445, 0.091624,
+1113, 0.755559, 0.444445, 0, 0.0389,
+1114, 0.765282, 0.444445, 0, 0.0389,
+1115, 0.516668, 0.694445, 0, 0.017778,
+1119, 0.537503, 0.444445, 0.162038, 0.04169,
+1122, 0.7777815, 0.75, 0, 0.082927,
+1123, 0.500002, 0.652727, 0, 0.030568,
+1138, 0.777781, 0.694445, 0, 0.075546,
+1139, 0.500002, 0.444445, 0, 0.03835,
+1140, 0.722226, 0.694445, 0, 0.161496,
+1141, 0.491667, 0.444445, 0, 0.108357
+METRICS_END
+
+LIGTURES_START
+1044, 1032, 1026,
+1044, 1112, 1026,
+1047, 1061, 1046,
+1047, 1093, 1046,
+1050, 1061, 1061,
+1050, 1093, 1061,
+1051, 1032, 1033,
+1051, 1112, 1033,
+1053, 1032, 1034,
+1053, 1112, 1034,
+1057, 1061, 1064,
+1057, 1093, 1064,
+1058, 1057, 1062,
+1058, 1089, 1062,
+1062, 1061, 1063,
+1062, 1093, 1063,
+1064, 1062, 0,
+1064, 1063, 1065,
+1064, 1094, 0,
+1064, 1095, 1065,
+1067, 1040, 1071,
+1067, 1059, 1070,
+1067, 1072, 1071,
+1067, 1091, 1070,
+1076, 1112, 1106,
+1079, 1093, 1078,
+1082, 1093, 1093,
+1083, 1112, 1113,
+1085, 1112, 1114,
+1089, 1093, 1096,
+1090, 1089, 1094,
+1094, 1093, 1095,
+1096, 1094, 0,
+1096, 1095, 1097,
+1099, 1072, 1103,
+1099, 1091, 1102
+LIGTURES_END
+
+KERNS_START
+1026, 1026, -0.083334,
+1026, 1028, -0.027779,
+1026, 1035, -0.083334,
+1026, 1046, -0.027779,
+1026, 1054, -0.027779,
+1026, 1057, -0.027779,
+1026, 1058, -0.083334,
+1026, 1059, -0.027779,
+1026, 1060, -0.027779,
+1026, 1061, -0.027779,
+1026, 1063, -0.083334,
+1026, 1066, -0.083334,
+1026, 1090, -0.027779,
+1026, 1095, -0.083334,
+1026, 1098, -0.027779,
+1026, 1122, -0.083334,
+1026, 1123, -0.027779,
+1026, 1138, -0.027779,
+1026, 1140, -0.083334,
+1030, 1030, 0.027779,
+1033, 1026, -0.083334,
+1033, 1028, -0.027779,
+1033, 1035, -0.083334,
+1033, 1046, -0.027779,
+1033, 1054, -0.027779,
+1033, 1057, -0.027779,
+1033, 1058, -0.083334,
+1033, 1059, -0.027779,
+1033, 1060, -0.027779,
+1033, 1061, -0.027779,
+1033, 1063, -0.083334,
+1033, 1066, -0.083334,
+1033, 1090, -0.027779,
+1033, 1095, -0.083334,
+1033, 1098, -0.027779,
+1033, 1122, -0.083334,
+1033, 1123, -0.027779,
+1033, 1138, -0.027779,
+1033, 1140, -0.083334,
+1034, 1026, -0.083334,
+1034, 1028, -0.027779,
+1034, 1035, -0.083334,
+1034, 1046, -0.027779,
+1034, 1054, -0.027779,
+1034, 1057, -0.027779,
+1034, 1058, -0.083334,
+1034, 1059, -0.027779,
+1034, 1060, -0.027779,
+1034, 1061, -0.027779,
+1034, 1063, -0.083334,
+1034, 1066, -0.083334,
+1034, 1090, -0.027779,
+1034, 1095, -0.083334,
+1034, 1098, -0.027779,
+1034, 1122, -0.083334,
+1034, 1123, -0.027779,
+1034, 1138, -0.027779,
+1034, 1140, -0.083334,
+1040, 1026, -0.083334,
+1040, 1028, -0.027779,
+1040, 1035, -0.083334,
+1040, 1054, -0.027779,
+1040, 1057, -0.027779,
+1040, 1058, -0.083334,
+1040, 1059, -0.027779,
+1040, 1060, -0.027779,
+1040, 1063, -0.083334,
+1040, 1066, -0.083334,
+1040, 1090, -0.027779,
+1040, 1095, -0.083334,
+1040, 1098, -0.027779,
+1040, 1122, -0.083334,
+1040, 1123, -0.027779,
+1040, 1138, -0.027779,
+1040, 1140, -0.083334,
+1043, 1033, -0.055555,
+1043, 1040, -0.083334,
+1043, 1044, -0.083334,
+1043, 1051, -0.055555,
+1043, 1072, -0.083334,
+1043, 1076, -0.083334,
+1043, 1077, -0.083334,
+1043, 1083, -0.083334,
+1043, 1086, -0.083334,
+1043, 1089, -0.083334,
+1043, 1092, -0.083334,
+1043, 1103, -0.083334,
+1043, 1105, -0.083334,
+1043, 1108, -0.083334,
+1043, 1113, -0.083334,
+1043, 1139, -0.083334,
+1046, 1028, -0.027779,
+1046, 1054, -0.027779,
+1046, 1057, -0.027779,
+1046, 1060, -0.027779,
+1046, 1090, -0.027779,
+1046, 1095, -0.027779,
+1046, 1098, -0.027779,
+1046, 1123, -0.027779,
+1046, 1138, -0.027779,
+1050, 1028, -0.027779,
+1050, 1054, -0.027779,
+1050, 1057, -0.027779,
+1050, 1060, -0.027779,
+1050, 1090, -0.027779,
+1050, 1095, -0.027779,
+1050, 1098, -0.027779,
+1050, 1123, -0.027779,
+1050, 1138, -0.027779,
+1054, 1040, -0.027779,
+1054, 1044, -0.027779,
+1054, 1046, -0.027779,
+1054, 1059, -0.027779,
+1054, 1061, -0.027779,
+1054, 1140, -0.027779,
+1056, 1033, -0.083334,
+1056, 1040, -0.083334,
+1056, 1044, -0.083334,
+1056, 1051, -0.083334,
+1056, 1072, -0.027779,
+1056, 1076, -0.083334,
+1056, 1077, -0.027779,
+1056, 1083, -0.083334,
+1056, 1086, -0.027779,
+1056, 1105, -0.027779,
+1056, 1113, -0.083334,
+1056, 1139, -0.027779,
+1058, 1033, -0.055555,
+1058, 1040, -0.083334,
+1058, 1044, -0.083334,
+1058, 1051, -0.055555,
+1058, 1072, -0.083334,
+1058, 1076, -0.083334,
+1058, 1077, -0.083334,
+1058, 1083, -0.083334,
+1058, 1086, -0.083334,
+1058, 1089, -0.083334,
+1058, 1092, -0.083334,
+1058, 1103, -0.083334,
+1058, 1105, -0.083334,
+1058, 1108, -0.083334,
+1058, 1113, -0.083334,
+1058, 1139, -0.083334,
+1059, 1028, -0.027779,
+1059, 1033, -0.055555,
+1059, 1040, -0.027779,
+1059, 1044, -0.055555,
+1059, 1051, -0.055555,
+1059, 1054, -0.027779,
+1059, 1057, -0.027779,
+1059, 1060, -0.027779,
+1059, 1072, -0.027779,
+1059, 1076, -0.083334,
+1059, 1077, -0.027779,
+1059, 1083, -0.083334,
+1059, 1086, -0.027779,
+1059, 1089, -0.027779,
+1059, 1103, -0.083334,
+1059, 1105, -0.027779,
+1059, 1108, -0.027779,
+1059, 1113, -0.083334,
+1059, 1138, -0.027779,
+1059, 1139, -0.027779,
+1060, 1040, -0.027779,
+1060, 1044, -0.027779,
+1060, 1046, -0.027779,
+1060, 1059, -0.027779,
+1060, 1061, -0.027779,
+1060, 1140, -0.027779,
+1061, 1028, -0.027779,
+1061, 1054, -0.027779,
+1061, 1057, -0.027779,
+1061, 1060, -0.027779,
+1061, 1090, -0.027779,
+1061, 1095, -0.027779,
+1061, 1098, -0.027779,
+1061, 1123, -0.027779,
+1061, 1138, -0.027779,
+1066, 1026, -0.083334,
+1066, 1028, -0.027779,
+1066, 1035, -0.083334,
+1066, 1046, -0.027779,
+1066, 1054, -0.027779,
+1066, 1057, -0.027779,
+1066, 1058, -0.083334,
+1066, 1059, -0.027779,
+1066, 1060, -0.027779,
+1066, 1061, -0.027779,
+1066, 1063, -0.083334,
+1066, 1066, -0.083334,
+1066, 1090, -0.027779,
+1066, 1095, -0.083334,
+1066, 1098, -0.027779,
+1066, 1122, -0.083334,
+1066, 1123, -0.027779,
+1066, 1138, -0.027779,
+1066, 1140, -0.083334,
+1068, 1026, -0.083334,
+1068, 1028, -0.027779,
+1068, 1035, -0.083334,
+1068, 1046, -0.027779,
+1068, 1054, -0.027779,
+1068, 1057, -0.027779,
+1068, 1058, -0.083334,
+1068, 1059, -0.027779,
+1068, 1060, -0.027779,
+1068, 1061, -0.027779,
+1068, 1063, -0.083334,
+1068, 1066, -0.083334,
+1068, 1090, -0.027779,
+1068, 1095, -0.083334,
+1068, 1098, -0.027779,
+1068, 1122, -0.083334,
+1068, 1123, -0.027779,
+1068, 1138, -0.027779,
+1068, 1140, -0.083334,
+1069, 1040, -0.027779,
+1069, 1044, -0.027779,
+1069, 1046, -0.027779,
+1069, 1059, -0.027779,
+1069, 1061, -0.027779,
+1069, 1140, -0.027779,
+1070, 1040, -0.027779,
+1070, 1044, -0.027779,
+1070, 1046, -0.027779,
+1070, 1059, -0.027779,
+1070, 1061, -0.027779,
+1070, 1140, -0.027779,
+1072, 1091, -0.027779,
+1072, 1095, -0.027779,
+1073, 1076, -0.027779,
+1073, 1078, -0.027779,
+1073, 1093, -0.027779,
+1073, 1103, -0.027779,
+1075, 1076, -0.027779,
+1075, 1083, -0.027779,
+1075, 1103, -0.027779,
+1075, 1113, -0.027779,
+1078, 1072, -0.027779,
+1078, 1077, -0.027779,
+1078, 1086, -0.027779,
+1078, 1089, -0.027779,
+1078, 1105, -0.027779,
+1078, 1108, -0.027779,
+1078, 1139, -0.027779,
+1082, 1072, -0.027779,
+1082, 1077, -0.027779,
+1082, 1086, -0.027779,
+1082, 1089, -0.027779,
+1082, 1105, -0.027779,
+1082, 1108, -0.027779,
+1082, 1139, -0.027779,
+1086, 1076, -0.027779,
+1086, 1078, -0.027779,
+1086, 1093, -0.027779,
+1086, 1103, -0.027779,
+1088, 1076, -0.027779,
+1088, 1078, -0.027779,
+1088, 1093, -0.027779,
+1088, 1103, -0.027779,
+1089, 1076, -0.027779,
+1089, 1078, -0.027779,
+1089, 1093, -0.027779,
+1089, 1103, -0.027779,
+1090, 1076, -0.027779,
+1090, 1083, -0.027779,
+1090, 1103, -0.027779,
+1090, 1113, -0.027779,
+1091, 1072, -0.027779,
+1091, 1076, -0.055555,
+1091, 1077, -0.027779,
+1091, 1083, -0.055555,
+1091, 1086, -0.027779,
+1091, 1089, -0.027779,
+1091, 1103, -0.027779,
+1091, 1105, -0.027779,
+1091, 1108, -0.027779,
+1091, 1113, -0.055555,
+1091, 1139, -0.027779,
+1092, 1076, -0.027779,
+1092, 1078, -0.027779,
+1092, 1093, -0.027779,
+1092, 1103, -0.027779,
+1093, 1072, -0.027779,
+1093, 1077, -0.027779,
+1093, 1086, -0.027779,
+1093, 1089, -0.027779,
+1093, 1105, -0.027779,
+1093, 1108, -0.027779,
+1093, 1139, -0.027779,
+1098, 1086, -0.027779,
+1098, 1090, -0.027779,
+1098, 1091, -0.055555,
+1098, 1092, -0.027779,
+1098, 1095, -0.083334,
+1098, 1098, -0.027779,
+1098, 1108, -0.027779,
+1098, 1123, -0.027779,
+1098, 1139, -0.027779,
+1098, 1141, -0.055555,
+1100, 1086, -0.027779,
+1100, 1090, -0.027779,
+1100, 1091, -0.055555,
+1100, 1092, -0.027779,
+1100, 1095, -0.083334,
+1100, 1098, -0.027779,
+1100, 1108, -0.027779,
+1100, 1123, -0.027779,
+1100, 1139, -0.027779,
+1100, 1141, -0.055555,
+1101, 1076, -0.027779,
+1101, 1078, -0.027779,
+1101, 1093, -0.027779,
+1101, 1103, -0.027779,
+1102, 1076, -0.027779,
+1102, 1078, -0.027779,
+1102, 1093, -0.027779,
+1102, 1103, -0.027779,
+1113, 1086, -0.027779,
+1113, 1090, -0.027779,
+1113, 1091, -0.055555,
+1113, 1092, -0.027779,
+1113, 1095, -0.083334,
+1113, 1098, -0.027779,
+1113, 1108, -0.027779,
+1113, 1123, -0.027779,
+1113, 1139, -0.027779,
+1113, 1141, -0.055555,
+1114, 1086, -0.027779,
+1114, 1090, -0.027779,
+1114, 1091, -0.055555,
+1114, 1092, -0.027779,
+1114, 1095, -0.083334,
+1114, 1098, -0.027779,
+1114, 1108, -0.027779,
+1114, 1123, -0.027779,
+1114, 1139, -0.027779,
+1114, 1141, -0.055555,
+1122, 1026, -0.083334,
+1122, 1028, -0.027779,
+1122, 1035, -0.083334,
+1122, 1046, -0.027779,
+1122, 1054, -0.027779,
+1122, 1057, -0.027779,
+1122, 1058, -0.083334,
+1122, 1059, -0.027779,
+1122, 1060, -0.027779,
+1122, 1061, -0.027779,
+1122, 1063, -0.083334,
+1122, 1066, -0.083334,
+1122, 1090, -0.027779,
+1122, 1095, -0.083334,
+1122, 1098, -0.027779,
+1122, 1122, -0.083334,
+1122, 1123, -0.027779,
+1122, 1138, -0.027779,
+1122, 1140, -0.083334,
+1123, 1086, -0.027779,
+1123, 1090, -0.027779,
+1123, 1091, -0.055555,
+1123, 1092, -0.027779,
+1123, 1095, -0.083334,
+1123, 1098, -0.027779,
+1123, 1108, -0.027779,
+1123, 1123, -0.027779,
+1123, 1139, -0.027779,
+1123, 1141, -0.055555,
+1138, 1040, -0.027779,
+1138, 1044, -0.027779,
+1138, 1046, -0.027779,
+1138, 1059, -0.027779,
+1138, 1061, -0.027779,
+1138, 1140, -0.027779,
+1139, 1076, -0.027779,
+1139, 1078, -0.027779,
+1139, 1093, -0.027779,
+1139, 1103, -0.027779,
+1140, 1028, -0.027779,
+1140, 1033, -0.055555,
+1140, 1040, -0.083334,
+1140, 1044, -0.055555,
+1140, 1051, -0.055555,
+1140, 1054, -0.027779,
+1140, 1057, -0.027779,
+1140, 1060, -0.027779,
+1140, 1072, -0.027779,
+1140, 1076, -0.083334,
+1140, 1077, -0.027779,
+1140, 1083, -0.083334,
+1140, 1086, -0.027779,
+1140, 1103, -0.083334,
+1140, 1105, -0.027779,
+1140, 1113, -0.083334,
+1140, 1138, -0.027779,
+1140, 1139, -0.027779,
+1141, 1072, -0.027779,
+1141, 1076, -0.055555,
+1141, 1077, -0.027779,
+1141, 1083, -0.055555,
+1141, 1086, -0.027779,
+1141, 1089, -0.027779,
+1141, 1103, -0.027779,
+1141, 1105, -0.027779,
+1141, 1108, -0.027779,
+1141, 1113, -0.055555,
+1141, 1139, -0.027779
+KERNS_END
+
+END
+
+DEF_FONT(wnssbx10, cyrillic/wnssbx10.ttf, 95)
+
+xHeight(0.458333) quad(1.100006) space(0.366669)
+
+roman(wnbx10) tt(wntt10)
+
+METRICS_START
+171, 0.733337, 0.5, 0, 0,
+187, 0.733337, 0.5, 0, 0,
+305, 0.255557, 0.458333, 0, 0,
+774, 0.550003, 0.6666155, 0, 0,
+776, 0.550003, 0.694445, 0, 0,
+1025, 0.64167, 0.902727, 0, 0,
+1026, 0.886116, 0.694445, 0, 0,
+1028, 0.702782, 0.694445, 0, 0,
+1029, 0.6111145, 0.694445, 0, 0,
+1030, 0.330557, 0.694445, 0, 0,
+1032, 0.519447, 0.694445, 0, 0,
+1033, 1.15834, 0.694445, 0, 0,
+1034, 1.115285, 0.694445, 0, 0,
+1035, 0.840283, 0.694445, 0, 0,
+1039, 0.763893, 0.694445, 0.194445, 0,
+1040, 0.733337, 0.694445, 0, 0,
+1041, 0.733337, 0.694445, 0, 0,
+1042, 0.733337, 0.694445, 0, 0,
+1043, 0.580559, 0.694445, 0, 0,
+1044, 0.850004, 0.694445, 0.194445, 0,
+1045, 0.64167, 0.694445, 0, 0,
+1046, 1.214895, 0.694445, 0, 0,
+1047, 0.672226, 0.694445, 0, 0,
+1048, 0.763893, 0.694445, 0, 0,
+1049, 0.763893, 0.902727, 0, 0,
+1050, 0.763893, 0.694445, 0, 0,
+1051, 0.806949, 0.694445, 0, 0,
+1052, 0.977783, 0.694445, 0, 0,
+1053, 0.763893, 0.694445, 0, 0,
+1054, 0.794449, 0.694445, 0, 0,
+1055, 0.763893, 0.694445, 0, 0,
+1056, 0.702782, 0.694445, 0, 0,
+1057, 0.702782, 0.694445, 0, 0,
+1058, 0.733337, 0.694445, 0, 0,
+1059, 0.733337, 0.694445, 0, 0.015279,
+1060, 0.916672, 0.694445, 0, 0,
+1061, 0.733337, 0.694445, 0, 0,
+1062, 0.806949, 0.694445, 0.194445, 0,
+1063, 0.763893, 0.694445, 0, 0,
+1064, 1.206952, 0.694445, 0, 0,
+1065, 1.250008, 0.694445, 0.194445, 0,
+1066, 0.940283, 0.694445, 0, 0,
+1067, 0.977783, 0.694445, 0, 0,
+1068, 0.733337, 0.694445, 0, 0,
+1069, 0.702782, 0.694445, 0, 0,
+1070, 1.143062, 0.694445, 0, 0,
+1071, 0.702782, 0.694445, 0, 0,
+1072, 0.525003, 0.458333, 0, 0,
+1073, 0.550003, 0.694445, 0, 0,
+1074, 0.525003, 0.458333, 0, 0,
+1075, 0.433336, 0.458333, 0, 0.015279,
+1076, 0.636114, 0.458333, 0.162038, 0,
+1077, 0.511114, 0.458333, 0, 0,
+1078, 0.80556, 0.458333, 0, 0,
+1079, 0.488892, 0.458333, 0, 0.006111,
+1080, 0.59167, 0.458333, 0, 0,
+1081, 0.59167, 0.6666155, 0, 0,
+1082, 0.530559, 0.458333, 0, 0,
+1083, 0.598615, 0.458333, 0, 0,
+1084, 0.744449, 0.458333, 0, 0,
+1085, 0.561114, 0.458333, 0, 0,
+1086, 0.550003, 0.458333, 0, 0,
+1087, 0.561114, 0.458333, 0, 0,
+1088, 0.561114, 0.458333, 0.194445, 0,
+1089, 0.488892, 0.458333, 0, 0,
+1090, 0.488892, 0.458333, 0, 0.02139,
+1091, 0.500003, 0.458333, 0.194445, 0.015279,
+1092, 0.836118, 0.694445, 0.194445, 0,
+1093, 0.500003, 0.458333, 0, 0,
+1094, 0.62917, 0.458333, 0.162038, 0,
+1095, 0.59167, 0.458333, 0, 0,
+1096, 0.836116, 0.458333, 0, 0,
+1097, 0.873616, 0.458333, 0.162038, 0,
+1098, 0.64167, 0.458333, 0, 0,
+1099, 0.744449, 0.458333, 0, 0,
+1100, 0.525003, 0.458333, 0, 0,
+1101, 0.488892, 0.458333, 0, 0,
+1102, 0.800005, 0.458333, 0, 0,
+1103, 0.555559, 0.458333, 0, 0,
+1105, 0.511114, 0.694445, 0, 0,
+1106, 0.530559, 0.694445, 0.194445, 0,
+1108, 0.48278, 0.458333, 0, 0,
+1109, 0.421669, 0.458333, 0, 0,
+1110, 0.255557, 0.694445, 0, 0,
+1112, 0.286113, 0.694445, 0.194445, 0,
+1113, 0.852783, 0.458333, 0, 0,
+1114, 0.845839, 0.458333, 0, 0,
+1115, 0.561114, 0.694445, 0, 0,
+1119, 0.59167, 0.458333, 0.162038, 0,
+1122, 0.85556, 0.75, 0, 0,
+1123, 0.550003, 0.6666155, 0, 0,
+1138, 0.85556, 0.694445, 0, 0,
+1139, 0.550003, 0.458333, 0, 0,
+1140, 0.794449, 0.694445, 0, 0.015279,
+1141, 0.562503, 0.458333, 0, 0.015279
+METRICS_END
+
+LIGTURES_START
+1044, 1032, 1026,
+1044, 1112, 1026,
+1047, 1061, 1046,
+1047, 1093, 1046,
+1050, 1061, 1061,
+1050, 1093, 1061,
+1051, 1032, 1033,
+1051, 1112, 1033,
+1053, 1032, 1034,
+1053, 1112, 1034,
+1057, 1061, 1064,
+1057, 1093, 1064,
+1058, 1057, 1062,
+1058, 1089, 1062,
+1062, 1061, 1063,
+1062, 1093, 1063,
+1064, 1062, 0,
+1064, 1063, 1065,
+1064, 1094, 0,
+1064, 1095, 1065,
+1067, 1040, 1071,
+1067, 1059, 1070,
+1067, 1072, 1071,
+1067, 1091, 1070,
+1076, 1112, 1106,
+1079, 1093, 1078,
+1082, 1093, 1093,
+1083, 1112, 1113,
+1085, 1112, 1114,
+1089, 1093, 1096,
+1090, 1089, 1094,
+1094, 1093, 1095,
+1096, 1094, 0,
+1096, 1095, 1097,
+1099, 1072, 1103,
+1099, 1091, 1102
+LIGTURES_END
+
+KERNS_START
+1026, 1026, -0.091667,
+1026, 1028, -0.030556,
+1026, 1035, -0.091667,
+1026, 1046, -0.030556,
+1026, 1054, -0.030556,
+1026, 1057, -0.030556,
+1026, 1058, -0.091667,
+1026, 1059, -0.030556,
+1026, 1060, -0.030556,
+1026, 1061, -0.030556,
+1026, 1063, -0.091667,
+1026, 1066, -0.091667,
+1026, 1090, -0.030556,
+1026, 1095, -0.091667,
+1026, 1098, -0.030556,
+1026, 1122, -0.091667,
+1026, 1123, -0.030556,
+1026, 1138, -0.030556,
+1026, 1140, -0.091667,
+1030, 1030, 0.030556,
+1033, 1026, -0.091667,
+1033, 1028, -0.030556,
+1033, 1035, -0.091667,
+1033, 1046, -0.030556,
+1033, 1054, -0.030556,
+1033, 1057, -0.030556,
+1033, 1058, -0.091667,
+1033, 1059, -0.030556,
+1033, 1060, -0.030556,
+1033, 1061, -0.030556,
+1033, 1063, -0.091667,
+1033, 1066, -0.091667,
+1033, 1090, -0.030556,
+1033, 1095, -0.091667,
+1033, 1098, -0.030556,
+1033, 1122, -0.091667,
+1033, 1123, -0.030556,
+1033, 1138, -0.030556,
+1033, 1140, -0.091667,
+1034, 1026, -0.091667,
+1034, 1028, -0.030556,
+1034, 1035, -0.091667,
+1034, 1046, -0.030556,
+1034, 1054, -0.030556,
+1034, 1057, -0.030556,
+1034, 1058, -0.091667,
+1034, 1059, -0.030556,
+1034, 1060, -0.030556,
+1034, 1061, -0.030556,
+1034, 1063, -0.091667,
+1034, 1066, -0.091667,
+1034, 1090, -0.030556,
+1034, 1095, -0.091667,
+1034, 1098, -0.030556,
+1034, 1122, -0.091667,
+1034, 1123, -0.030556,
+1034, 1138, -0.030556,
+1034, 1140, -0.091667,
+1040, 1026, -0.091667,
+1040, 1028, -0.030556,
+1040, 1035, -0.091667,
+1040, 1054, -0.030556,
+1040, 1057, -0.030556,
+1040, 1058, -0.091667,
+1040, 1059, -0.030556,
+1040, 1060, -0.030556,
+1040, 1063, -0.091667,
+1040, 1066, -0.091667,
+1040, 1090, -0.030556,
+1040, 1095, -0.091667,
+1040, 1098, -0.030556,
+1040, 1122, -0.091667,
+1040, 1123, -0.030556,
+1040, 1138, -0.030556,
+1040, 1140, -0.091667,
+1043, 1033, -0.061111,
+1043, 1040, -0.091667,
+1043, 1044, -0.091667,
+1043, 1051, -0.061111,
+1043, 1072, -0.091667,
+1043, 1076, -0.091667,
+1043, 1077, -0.091667,
+1043, 1083, -0.091667,
+1043, 1086, -0.091667,
+1043, 1089, -0.091667,
+1043, 1092, -0.091667,
+1043, 1103, -0.091667,
+1043, 1105, -0.091667,
+1043, 1108, -0.091667,
+1043, 1113, -0.091667,
+1043, 1139, -0.091667,
+1046, 1028, -0.030556,
+1046, 1054, -0.030556,
+1046, 1057, -0.030556,
+1046, 1060, -0.030556,
+1046, 1090, -0.030556,
+1046, 1095, -0.030556,
+1046, 1098, -0.030556,
+1046, 1123, -0.030556,
+1046, 1138, -0.030556,
+1050, 1028, -0.030556,
+1050, 1054, -0.030556,
+1050, 1057, -0.030556,
+1050, 1060, -0.030556,
+1050, 1090, -0.030556,
+1050, 1095, -0.030556,
+1050, 1098, -0.030556,
+1050, 1123, -0.030556,
+1050, 1138, -0.030556,
+1054, 1040, -0.030556,
+1054, 1044, -0.030556,
+1054, 1046, -0.030556,
+1054, 1059, -0.030556,
+1054, 1061, -0.030556,
+1054, 1140, -0.030556,
+1056, 1033, -0.091667,
+1056, 1040, -0.091667,
+1056, 1044, -0.091667,
+1056, 1051, -0.091667,
+1056, 1072, -0.030556,
+1056, 1076, -0.091667,
+1056, 1077, -0.030556,
+1056, 1083, -0.091667,
+1056, 1086, -0.030556,
+1056, 1105, -0.030556,
+1056, 1113, -0.091667,
+1056, 1139, -0.030556,
+1058, 1033, -0.061111,
+1058, 1040, -0.091667,
+1058, 1044, -0.091667,
+1058, 1051, -0.061111,
+1058, 1072, -0.091667,
+1058, 1076, -0.091667,
+1058, 1077, -0.091667,
+1058, 1083, -0.091667,
+1058, 1086, -0.091667,
+1058, 1089, -0.091667,
+1058, 1092, -0.091667,
+1058, 1103, -0.091667,
+1058, 1105, -0.091667,
+1058, 1108, -0.091667,
+1058, 1113, -0.091667,
+1058, 1139, -0.091667,
+1059, 1028, -0.030556,
+1059, 1033, -0.061111,
+1059, 1040, -0.030556,
+1059, 1044, -0.061111,
+1059, 1051, -0.061111,
+1059, 1054, -0.030556,
+1059, 1057, -0.030556,
+1059, 1060, -0.030556,
+1059, 1072, -0.030556,
+1059, 1076, -0.091667,
+1059, 1077, -0.030556,
+1059, 1083, -0.091667,
+1059, 1086, -0.030556,
+1059, 1089, -0.030556,
+1059, 1103, -0.091667,
+1059, 1105, -0.030556,
+1059, 1108, -0.030556,
+1059, 1113, -0.091667,
+1059, 1138, -0.030556,
+1059, 1139, -0.030556,
+1060, 1040, -0.030556,
+1060, 1044, -0.030556,
+1060, 1046, -0.030556,
+1060, 1059, -0.030556,
+1060, 1061, -0.030556,
+1060, 1140, -0.030556,
+1061, 1028, -0.030556,
+1061, 1054, -0.030556,
+1061, 1057, -0.030556,
+1061, 1060, -0.030556,
+1061, 1090, -0.030556,
+1061, 1095, -0.030556,
+1061, 1098, -0.030556,
+1061, 1123, -0.030556,
+1061, 1138, -0.030556,
+1066, 1026, -0.091667,
+1066, 1028, -0.030556,
+1066, 1035, -0.091667,
+1066, 1046, -0.030556,
+1066, 1054, -0.030556,
+1066, 1057, -0.030556,
+1066, 1058, -0.091667,
+1066, 1059, -0.030556,
+1066, 1060, -0.030556,
+1066, 1061, -0.030556,
+1066, 1063, -0.091667,
+1066, 1066, -0.091667,
+1066, 1090, -0.030556,
+1066, 1095, -0.091667,
+1066, 1098, -0.030556,
+1066, 1122, -0.091667,
+1066, 1123, -0.030556,
+1066, 1138, -0.030556,
+1066, 1140, -0.091667,
+1068, 1026, -0.091667,
+1068, 1028, -0.030556,
+1068, 1035, -0.091667,
+1068, 1046, -0.030556,
+1068, 1054, -0.030556,
+1068, 1057, -0.030556,
+1068, 1058, -0.091667,
+1068, 1059, -0.030556,
+1068, 1060, -0.030556,
+1068, 1061, -0.030556,
+1068, 1063, -0.091667,
+1068, 1066, -0.091667,
+1068, 1090, -0.030556,
+1068, 1095, -0.091667,
+1068, 1098, -0.030556,
+1068, 1122, -0.091667,
+1068, 1123, -0.030556,
+1068, 1138, -0.030556,
+1068, 1140, -0.091667,
+1069, 1040, -0.030556,
+1069, 1044, -0.030556,
+1069, 1046, -0.030556,
+1069, 1059, -0.030556,
+1069, 1061, -0.030556,
+1069, 1140, -0.030556,
+1070, 1040, -0.030556,
+1070, 1044, -0.030556,
+1070, 1046, -0.030556,
+1070, 1059, -0.030556,
+1070, 1061, -0.030556,
+1070, 1140, -0.030556,
+1072, 1091, -0.030556,
+1072, 1095, -0.030556,
+1073, 1076, -0.030556,
+1073, 1078, -0.030556,
+1073, 1093, -0.030556,
+1073, 1103, -0.030556,
+1075, 1076, -0.030556,
+1075, 1083, -0.030556,
+1075, 1103, -0.030556,
+1075, 1113, -0.030556,
+1078, 1072, -0.030556,
+1078, 1077, -0.030556,
+1078, 1086, -0.030556,
+1078, 1089, -0.030556,
+1078, 1105, -0.030556,
+1078, 1108, -0.030556,
+1078, 1139, -0.030556,
+1082, 1072, -0.030556,
+1082, 1077, -0.030556,
+1082, 1086, -0.030556,
+1082, 1089, -0.030556,
+1082, 1105, -0.030556,
+1082, 1108, -0.030556,
+1082, 1139, -0.030556,
+1086, 1076, -0.030556,
+1086, 1078, -0.030556,
+1086, 1093, -0.030556,
+1086, 1103, -0.030556,
+1088, 1076, -0.030556,
+1088, 1078, -0.030556,
+1088, 1093, -0.030556,
+1088, 1103, -0.030556,
+1089, 1076, -0.030556,
+1089, 1078, -0.030556,
+1089, 1093, -0.030556,
+1089, 1103, -0.030556,
+1090, 1076, -0.030556,
+1090, 1083, -0.030556,
+1090, 1103, -0.030556,
+1090, 1113, -0.030556,
+1091, 1072, -0.030556,
+1091, 1076, -0.061111,
+1091, 1077, -0.030556,
+1091, 1083, -0.061111,
+1091, 1086, -0.030556,
+1091, 1089, -0.030556,
+1091, 1103, -0.030556,
+1091, 1105, -0.030556,
+1091, 1108, -0.030556,
+1091, 1113, -0.061111,
+1091, 1139, -0.030556,
+1092, 1076, -0.030556,
+1092, 1078, -0.030556,
+1092, 1093, -0.030556,
+1092, 1103, -0.030556,
+1093, 1072, -0.030556,
+1093, 1077, -0.030556,
+1093, 1086, -0.030556,
+1093, 1089, -0.030556,
+1093, 1105, -0.030556,
+1093, 1108, -0.030556,
+1093, 1139, -0.030556,
+1098, 1086, -0.030556,
+1098, 1090, -0.030556,
+1098, 1091, -0.061111,
+1098, 1092, -0.030556,
+1098, 1095, -0.091667,
+1098, 1098, -0.030556,
+1098, 1108, -0.030556,
+1098, 1123, -0.030556,
+1098, 1139, -0.030556,
+1098, 1141, -0.061111,
+1100, 1086, -0.030556,
+1100, 1090, -0.030556,
+1100, 1091, -0.061111,
+1100, 1092, -0.030556,
+1100, 1095, -0.091667,
+1100, 1098, -0.030556,
+1100, 1108, -0.030556,
+1100, 1123, -0.030556,
+1100, 1139, -0.030556,
+1100, 1141, -0.061111,
+1101, 1076, -0.030556,
+1101, 1078, -0.030556,
+1101, 1093, -0.030556,
+1101, 1103, -0.030556,
+1102, 1076, -0.030556,
+1102, 1078, -0.030556,
+1102, 1093, -0.030556,
+1102, 1103, -0.030556,
+1113, 1086, -0.030556,
+1113, 1090, -0.030556,
+1113, 1091, -0.061111,
+1113, 1092, -0.030556,
+1113, 1095, -0.091667,
+1113, 1098, -0.030556,
+1113, 1108, -0.030556,
+1113, 1123, -0.030556,
+1113, 1139, -0.030556,
+1113, 1141, -0.061111,
+1114, 1086, -0.030556,
+1114, 1090, -0.030556,
+1114, 1091, -0.061111,
+1114, 1092, -0.030556,
+1114, 1095, -0.091667,
+1114, 1098, -0.030556,
+1114, 1108, -0.030556,
+1114, 1123, -0.030556,
+1114, 1139, -0.030556,
+1114, 1141, -0.061111,
+1122, 1026, -0.091667,
+1122, 1028, -0.030556,
+1122, 1035, -0.091667,
+1122, 1046, -0.030556,
+1122, 1054, -0.030556,
+1122, 1057, -0.030556,
+1122, 1058, -0.091667,
+1122, 1059, -0.030556,
+1122, 1060, -0.030556,
+1122, 1061, -0.030556,
+1122, 1063, -0.091667,
+1122, 1066, -0.091667,
+1122, 1090, -0.030556,
+1122, 1095, -0.091667,
+1122, 1098, -0.030556,
+1122, 1122, -0.091667,
+1122, 1123, -0.030556,
+1122, 1138, -0.030556,
+1122, 1140, -0.091667,
+1123, 1086, -0.030556,
+1123, 1090, -0.030556,
+1123, 1091, -0.061111,
+1123, 1092, -0.030556,
+1123, 1095, -0.091667,
+1123, 1098, -0.030556,
+1123, 1108, -0.030556,
+1123, 1123, -0.030556,
+1123, 1139, -0.030556,
+1123, 1141, -0.061111,
+1138, 1040, -0.030556,
+1138, 1044, -0.030556,
+1138, 1046, -0.030556,
+1138, 1059, -0.030556,
+1138, 1061, -0.030556,
+1138, 1140, -0.030556,
+1139, 1076, -0.030556,
+1139, 1078, -0.030556,
+1139, 1093, -0.030556,
+1139, 1103, -0.030556,
+1140, 1028, -0.030556,
+1140, 1033, -0.061111,
+1140, 1040, -0.091667,
+1140, 1044, -0.061111,
+1140, 1051, -0.061111,
+1140, 1054, -0.030556,
+1140, 1057, -0.030556,
+1140, 1060, -0.030556,
+1140, 1072, -0.030556,
+1140, 1076, -0.091667,
+1140, 1077, -0.030556,
+1140, 1083, -0.091667,
+1140, 1086, -0.030556,
+1140, 1103, -0.091667,
+1140, 1105, -0.030556,
+1140, 1113, -0.091667,
+1140, 1138, -0.030556,
+1140, 1139, -0.030556,
+1141, 1072, -0.030556,
+1141, 1076, -0.061111,
+1141, 1077, -0.030556,
+1141, 1083, -0.061111,
+1141, 1086, -0.030556,
+1141, 1089, -0.030556,
+1141, 1103, -0.030556,
+1141, 1105, -0.030556,
+1141, 1108, -0.030556,
+1141, 1113, -0.061111,
+1141, 1139, -0.030556
+KERNS_END
+
+END
+
+DEF_FONT(wnbx10, cyrillic/wnbx10.ttf, 95)
+
+xHeight(0.444445) quad(1.149994) space(0.383331)
+
+ss(wnssbx10) tt(wntt10) it(wnbxti10)
+
+METRICS_START
+171, 0.6388855, 0.472223, 0, 0,
+187, 0.6388855, 0.472223, 0, 0,
+305, 0.319443, 0.444445, 0, 0,
+774, 0.574997, 0.652727, 0, 0,
+776, 0.574997, 0.686111, 0, 0,
+1025, 0.755551, 0.894394, 0, 0,
+1026, 0.959717, 0.686111, 0, 0,
+1028, 0.830551, 0.686111, 0, 0,
+1029, 0.6388855, 0.686111, 0, 0,
+1030, 0.43611, 0.686111, 0, 0,
+1032, 0.594441, 0.686111, 0, 0,
+1033, 1.234021, 0.686111, 0, 0,
+1034, 1.234021, 0.686111, 0, 0,
+1035, 0.8784685, 0.686111, 0, 0,
+1039, 0.901384, 0.686111, 0.194445, 0,
+1040, 0.86944, 0.686111, 0, 0,
+1041, 0.818051, 0.686111, 0, 0,
+1042, 0.818051, 0.686111, 0, 0,
+1043, 0.691663, 0.686111, 0, 0,
+1044, 0.901384, 0.686111, 0.194445, 0,
+1045, 0.755551, 0.686111, 0, 0,
+1046, 1.366656, 0.686111, 0, 0,
+1047, 0.702774, 0.686111, 0, 0,
+1048, 0.901384, 0.686111, 0, 0,
+1049, 0.901384, 0.894394, 0, 0,
+1050, 0.901384, 0.686111, 0, 0,
+1051, 0.901384, 0.686111, 0, 0,
+1052, 1.091661, 0.686111, 0, 0,
+1053, 0.901384, 0.686111, 0, 0,
+1054, 0.863884, 0.686111, 0, 0,
+1055, 0.901384, 0.686111, 0, 0,
+1056, 0.786107, 0.686111, 0, 0,
+1057, 0.830551, 0.686111, 0, 0,
+1058, 0.799995, 0.686111, 0, 0,
+1059, 0.86944, 0.686111, 0, 0.015973,
+1060, 0.958328, 0.686111, 0, 0,
+1061, 0.86944, 0.686111, 0, 0,
+1062, 0.901384, 0.686111, 0.194445, 0,
+1063, 0.901384, 0.686111, 0, 0,
+1064, 1.3312435, 0.686111, 0, 0,
+1065, 1.3312435, 0.686111, 0.194445, 0,
+1066, 1.006938, 0.686111, 0, 0,
+1067, 1.124994, 0.686111, 0, 0,
+1068, 0.818051, 0.686111, 0, 0,
+1069, 0.830551, 0.686111, 0, 0,
+1070, 1.273605, 0.686111, 0, 0,
+1071, 0.901384, 0.686111, 0, 0,
+1072, 0.559024, 0.444445, 0, 0,
+1073, 0.574997, 0.694445, 0, 0,
+1074, 0.574997, 0.444445, 0, 0,
+1075, 0.49583, 0.444445, 0, 0,
+1076, 0.6388855, 0.444445, 0.162038, 0,
+1077, 0.5270815, 0.444445, 0, 0,
+1078, 0.958328, 0.444445, 0, 0,
+1079, 0.511108, 0.444445, 0, 0.006389,
+1080, 0.6388855, 0.444445, 0, 0,
+1081, 0.6388855, 0.652727, 0, 0,
+1082, 0.6388855, 0.444445, 0, 0,
+1083, 0.6388855, 0.444445, 0, 0,
+1084, 0.766663, 0.444445, 0, 0,
+1085, 0.6388855, 0.444445, 0, 0,
+1086, 0.574997, 0.444445, 0, 0,
+1087, 0.6388855, 0.444445, 0, 0,
+1088, 0.6388855, 0.444445, 0.194445, 0,
+1089, 0.511108, 0.444445, 0, 0,
+1090, 0.544441, 0.444445, 0, 0,
+1091, 0.606941, 0.444445, 0.194445, 0.015973,
+1092, 0.89444, 0.694445, 0.194445, 0,
+1093, 0.606941, 0.444445, 0, 0,
+1094, 0.6388855, 0.444445, 0.162038, 0,
+1095, 0.6388855, 0.444445, 0, 0,
+1096, 0.941663, 0.444445, 0, 0,
+1097, 0.941663, 0.444445, 0.162038, 0,
+1098, 0.687495, 0.444445, 0, 0,
+1099, 0.830551, 0.444445, 0, 0,
+1100, 0.574997, 0.444445, 0, 0,
+1101, 0.511108, 0.444445, 0, 0,
+1102, 0.862495, 0.444445, 0, 0,
+1103, 0.6076355, 0.444445, 0, 0,
+1105, 0.5270815, 0.686111, 0, 0,
+1106, 0.606941, 0.694445, 0.194445, 0,
+1108, 0.50472, 0.444445, 0, 0,
+1109, 0.4536085, 0.444445, 0, 0,
+1110, 0.319443, 0.694445, 0, 0,
+1112, 0.351387, 0.694445, 0.194445, 0,
+1113, 0.86319, 0.444445, 0, 0,
+1114, 0.86319, 0.444445, 0, 0,
+1115, 0.6388855, 0.694445, 0, 0,
+1119, 0.6388855, 0.444445, 0.162038, 0,
+1122, 0.945828, 0.75, 0, 0,
+1123, 0.574997, 0.652727, 0, 0,
+1138, 0.89444, 0.686111, 0, 0,
+1139, 0.511108, 0.444445, 0, 0,
+1140, 0.945828, 0.686111, 0, 0.015973,
+1141, 0.685414, 0.444445, 0, 0.015973
+METRICS_END
+
+LIGTURES_START
+1044, 1032, 1026,
+1044, 1112, 1026,
+1047, 1061, 1046,
+1047, 1093, 1046,
+1050, 1061, 1061,
+1050, 1093, 1061,
+1051, 1032, 1033,
+1051, 1112, 1033,
+1053, 1032, 1034,
+1053, 1112, 1034,
+1057, 1061, 1064,
+1057, 1093, 1064,
+1058, 1057, 1062,
+1058, 1089, 1062,
+1062, 1061, 1063,
+1062, 1093, 1063,
+1064, 1062, 0,
+1064, 1063, 1065,
+1064, 1094, 0,
+1064, 1095, 1065,
+1067, 1040, 1071,
+1067, 1059, 1070,
+1067, 1072, 1071,
+1067, 1091, 1070,
+1076, 1112, 1106,
+1079, 1093, 1078,
+1082, 1093, 1093,
+1083, 1112, 1113,
+1085, 1112, 1114,
+1089, 1093, 1096,
+1090, 1089, 1094,
+1094, 1093, 1095,
+1096, 1094, 0,
+1096, 1095, 1097,
+1099, 1072, 1103,
+1099, 1091, 1102
+LIGTURES_END
+
+KERNS_START
+1026, 1026, -0.095833,
+1026, 1028, -0.031944,
+1026, 1035, -0.095833,
+1026, 1046, -0.031944,
+1026, 1054, -0.031944,
+1026, 1057, -0.031944,
+1026, 1058, -0.095833,
+1026, 1059, -0.095833,
+1026, 1060, -0.031944,
+1026, 1061, -0.031944,
+1026, 1063, -0.095833,
+1026, 1066, -0.095833,
+1026, 1090, -0.031944,
+1026, 1095, -0.095833,
+1026, 1098, -0.031944,
+1026, 1122, -0.095833,
+1026, 1123, -0.031944,
+1026, 1138, -0.031944,
+1026, 1140, -0.127777,
+1030, 1030, 0.031944,
+1033, 1026, -0.095833,
+1033, 1028, -0.031944,
+1033, 1035, -0.095833,
+1033, 1046, -0.031944,
+1033, 1054, -0.031944,
+1033, 1057, -0.031944,
+1033, 1058, -0.095833,
+1033, 1059, -0.095833,
+1033, 1060, -0.031944,
+1033, 1061, -0.031944,
+1033, 1063, -0.095833,
+1033, 1066, -0.095833,
+1033, 1090, -0.031944,
+1033, 1095, -0.095833,
+1033, 1098, -0.031944,
+1033, 1122, -0.095833,
+1033, 1123, -0.031944,
+1033, 1138, -0.031944,
+1033, 1140, -0.127777,
+1034, 1026, -0.095833,
+1034, 1028, -0.031944,
+1034, 1035, -0.095833,
+1034, 1046, -0.031944,
+1034, 1054, -0.031944,
+1034, 1057, -0.031944,
+1034, 1058, -0.095833,
+1034, 1059, -0.095833,
+1034, 1060, -0.031944,
+1034, 1061, -0.031944,
+1034, 1063, -0.095833,
+1034, 1066, -0.095833,
+1034, 1090, -0.031944,
+1034, 1095, -0.095833,
+1034, 1098, -0.031944,
+1034, 1122, -0.095833,
+1034, 1123, -0.031944,
+1034, 1138, -0.031944,
+1034, 1140, -0.127777,
+1040, 1026, -0.095833,
+1040, 1028, -0.031944,
+1040, 1035, -0.095833,
+1040, 1054, -0.031944,
+1040, 1057, -0.031944,
+1040, 1058, -0.095833,
+1040, 1059, -0.095833,
+1040, 1060, -0.031944,
+1040, 1063, -0.095833,
+1040, 1066, -0.095833,
+1040, 1090, -0.031944,
+1040, 1095, -0.095833,
+1040, 1098, -0.031944,
+1040, 1122, -0.095833,
+1040, 1123, -0.031944,
+1040, 1138, -0.031944,
+1040, 1140, -0.127777,
+1043, 1033, -0.031944,
+1043, 1040, -0.095833,
+1043, 1044, -0.095833,
+1043, 1051, -0.031944,
+1043, 1071, -0.095833,
+1043, 1072, -0.095833,
+1043, 1076, -0.095833,
+1043, 1077, -0.095833,
+1043, 1083, -0.095833,
+1043, 1086, -0.095833,
+1043, 1089, -0.095833,
+1043, 1092, -0.095833,
+1043, 1103, -0.095833,
+1043, 1105, -0.095833,
+1043, 1108, -0.095833,
+1043, 1113, -0.095833,
+1043, 1139, -0.095833,
+1046, 1028, -0.031944,
+1046, 1054, -0.031944,
+1046, 1057, -0.031944,
+1046, 1060, -0.031944,
+1046, 1090, -0.031944,
+1046, 1095, -0.031944,
+1046, 1098, -0.031944,
+1046, 1123, -0.031944,
+1046, 1138, -0.031944,
+1050, 1028, -0.031944,
+1050, 1054, -0.031944,
+1050, 1057, -0.031944,
+1050, 1060, -0.031944,
+1050, 1090, -0.031944,
+1050, 1095, -0.031944,
+1050, 1098, -0.031944,
+1050, 1123, -0.031944,
+1050, 1138, -0.031944,
+1054, 1040, -0.031944,
+1054, 1044, -0.031944,
+1054, 1046, -0.031944,
+1054, 1059, -0.031944,
+1054, 1061, -0.031944,
+1054, 1071, -0.031944,
+1054, 1140, -0.031944,
+1056, 1033, -0.095833,
+1056, 1040, -0.095833,
+1056, 1044, -0.095833,
+1056, 1051, -0.095833,
+1056, 1071, -0.095833,
+1056, 1072, -0.031944,
+1056, 1076, -0.095833,
+1056, 1077, -0.031944,
+1056, 1083, -0.095833,
+1056, 1086, -0.031944,
+1056, 1105, -0.031944,
+1056, 1113, -0.095833,
+1056, 1139, -0.031944,
+1058, 1033, -0.031944,
+1058, 1040, -0.095833,
+1058, 1044, -0.095833,
+1058, 1051, -0.031944,
+1058, 1071, -0.095833,
+1058, 1072, -0.095833,
+1058, 1076, -0.095833,
+1058, 1077, -0.095833,
+1058, 1083, -0.095833,
+1058, 1086, -0.095833,
+1058, 1089, -0.095833,
+1058, 1092, -0.095833,
+1058, 1103, -0.095833,
+1058, 1105, -0.095833,
+1058, 1108, -0.095833,
+1058, 1113, -0.095833,
+1058, 1139, -0.095833,
+1059, 1028, -0.031944,
+1059, 1033, -0.063889,
+1059, 1040, -0.095833,
+1059, 1044, -0.063889,
+1059, 1051, -0.063889,
+1059, 1054, -0.031944,
+1059, 1057, -0.031944,
+1059, 1060, -0.031944,
+1059, 1071, -0.095833,
+1059, 1072, -0.095833,
+1059, 1076, -0.095833,
+1059, 1077, -0.095833,
+1059, 1083, -0.095833,
+1059, 1086, -0.095833,
+1059, 1089, -0.095833,
+1059, 1103, -0.095833,
+1059, 1105, -0.095833,
+1059, 1108, -0.095833,
+1059, 1113, -0.095833,
+1059, 1138, -0.031944,
+1059, 1139, -0.095833,
+1060, 1040, -0.031944,
+1060, 1044, -0.031944,
+1060, 1046, -0.031944,
+1060, 1059, -0.031944,
+1060, 1061, -0.031944,
+1060, 1071, -0.031944,
+1060, 1140, -0.031944,
+1061, 1028, -0.031944,
+1061, 1054, -0.031944,
+1061, 1057, -0.031944,
+1061, 1060, -0.031944,
+1061, 1090, -0.031944,
+1061, 1095, -0.031944,
+1061, 1098, -0.031944,
+1061, 1123, -0.031944,
+1061, 1138, -0.031944,
+1066, 1026, -0.095833,
+1066, 1028, -0.031944,
+1066, 1035, -0.095833,
+1066, 1046, -0.031944,
+1066, 1054, -0.031944,
+1066, 1057, -0.031944,
+1066, 1058, -0.095833,
+1066, 1059, -0.095833,
+1066, 1060, -0.031944,
+1066, 1061, -0.031944,
+1066, 1063, -0.095833,
+1066, 1066, -0.095833,
+1066, 1090, -0.031944,
+1066, 1095, -0.095833,
+1066, 1098, -0.031944,
+1066, 1122, -0.095833,
+1066, 1123, -0.031944,
+1066, 1138, -0.031944,
+1066, 1140, -0.127777,
+1068, 1026, -0.095833,
+1068, 1028, -0.031944,
+1068, 1035, -0.095833,
+1068, 1046, -0.031944,
+1068, 1054, -0.031944,
+1068, 1057, -0.031944,
+1068, 1058, -0.095833,
+1068, 1059, -0.095833,
+1068, 1060, -0.031944,
+1068, 1061, -0.031944,
+1068, 1063, -0.095833,
+1068, 1066, -0.095833,
+1068, 1090, -0.031944,
+1068, 1095, -0.095833,
+1068, 1098, -0.031944,
+1068, 1122, -0.095833,
+1068, 1123, -0.031944,
+1068, 1138, -0.031944,
+1068, 1140, -0.127777,
+1069, 1040, -0.031944,
+1069, 1044, -0.031944,
+1069, 1046, -0.031944,
+1069, 1059, -0.031944,
+1069, 1061, -0.031944,
+1069, 1071, -0.031944,
+1069, 1140, -0.031944,
+1070, 1040, -0.031944,
+1070, 1044, -0.031944,
+1070, 1046, -0.031944,
+1070, 1059, -0.031944,
+1070, 1061, -0.031944,
+1070, 1071, -0.031944,
+1070, 1140, -0.031944,
+1072, 1091, -0.031944,
+1072, 1095, -0.031944,
+1072, 1141, -0.031944,
+1073, 1076, -0.031944,
+1073, 1078, -0.031944,
+1073, 1093, -0.031944,
+1073, 1103, -0.031944,
+1075, 1072, -0.031944,
+1075, 1076, -0.031944,
+1075, 1083, -0.031944,
+1075, 1103, -0.031944,
+1075, 1113, -0.031944,
+1078, 1072, -0.031944,
+1078, 1077, -0.031944,
+1078, 1086, -0.031944,
+1078, 1089, -0.031944,
+1078, 1105, -0.031944,
+1078, 1108, -0.031944,
+1078, 1139, -0.031944,
+1082, 1072, -0.031944,
+1082, 1077, -0.031944,
+1082, 1086, -0.031944,
+1082, 1089, -0.031944,
+1082, 1105, -0.031944,
+1082, 1108, -0.031944,
+1082, 1139, -0.031944,
+1086, 1076, -0.031944,
+1086, 1078, -0.031944,
+1086, 1093, -0.031944,
+1086, 1103, -0.031944,
+1088, 1076, -0.031944,
+1088, 1078, -0.031944,
+1088, 1093, -0.031944,
+1088, 1103, -0.031944,
+1089, 1076, -0.031944,
+1089, 1078, -0.031944,
+1089, 1093, -0.031944,
+1089, 1103, -0.031944,
+1090, 1072, -0.031944,
+1090, 1076, -0.031944,
+1090, 1083, -0.031944,
+1090, 1103, -0.031944,
+1090, 1113, -0.031944,
+1091, 1072, -0.031944,
+1091, 1076, -0.063889,
+1091, 1077, -0.031944,
+1091, 1083, -0.063889,
+1091, 1086, -0.031944,
+1091, 1089, -0.031944,
+1091, 1103, -0.031944,
+1091, 1105, -0.031944,
+1091, 1108, -0.031944,
+1091, 1113, -0.063889,
+1091, 1139, -0.031944,
+1092, 1076, -0.031944,
+1092, 1078, -0.031944,
+1092, 1093, -0.031944,
+1092, 1103, -0.031944,
+1093, 1072, -0.031944,
+1093, 1077, -0.031944,
+1093, 1086, -0.031944,
+1093, 1089, -0.031944,
+1093, 1105, -0.031944,
+1093, 1108, -0.031944,
+1093, 1139, -0.031944,
+1098, 1086, -0.031944,
+1098, 1090, -0.031944,
+1098, 1091, -0.063889,
+1098, 1092, -0.031944,
+1098, 1095, -0.095833,
+1098, 1098, -0.031944,
+1098, 1108, -0.031944,
+1098, 1123, -0.031944,
+1098, 1139, -0.031944,
+1098, 1141, -0.063889,
+1100, 1086, -0.031944,
+1100, 1090, -0.031944,
+1100, 1091, -0.063889,
+1100, 1092, -0.031944,
+1100, 1095, -0.095833,
+1100, 1098, -0.031944,
+1100, 1108, -0.031944,
+1100, 1123, -0.031944,
+1100, 1139, -0.031944,
+1100, 1141, -0.063889,
+1101, 1076, -0.031944,
+1101, 1078, -0.031944,
+1101, 1093, -0.031944,
+1101, 1103, -0.031944,
+1102, 1076, -0.031944,
+1102, 1078, -0.031944,
+1102, 1093, -0.031944,
+1102, 1103, -0.031944,
+1113, 1086, -0.031944,
+1113, 1090, -0.031944,
+1113, 1091, -0.063889,
+1113, 1092, -0.031944,
+1113, 1095, -0.095833,
+1113, 1098, -0.031944,
+1113, 1108, -0.031944,
+1113, 1123, -0.031944,
+1113, 1139, -0.031944,
+1113, 1141, -0.063889,
+1114, 1086, -0.031944,
+1114, 1090, -0.031944,
+1114, 1091, -0.063889,
+1114, 1092, -0.031944,
+1114, 1095, -0.095833,
+1114, 1098, -0.031944,
+1114, 1108, -0.031944,
+1114, 1123, -0.031944,
+1114, 1139, -0.031944,
+1114, 1141, -0.063889,
+1122, 1026, -0.095833,
+1122, 1028, -0.031944,
+1122, 1035, -0.095833,
+1122, 1046, -0.031944,
+1122, 1054, -0.031944,
+1122, 1057, -0.031944,
+1122, 1058, -0.095833,
+1122, 1059, -0.095833,
+1122, 1060, -0.031944,
+1122, 1061, -0.031944,
+1122, 1063, -0.095833,
+1122, 1066, -0.095833,
+1122, 1090, -0.031944,
+1122, 1095, -0.095833,
+1122, 1098, -0.031944,
+1122, 1122, -0.095833,
+1122, 1123, -0.031944,
+1122, 1138, -0.031944,
+1122, 1140, -0.127777,
+1123, 1086, -0.031944,
+1123, 1090, -0.031944,
+1123, 1091, -0.063889,
+1123, 1092, -0.031944,
+1123, 1095, -0.095833,
+1123, 1098, -0.031944,
+1123, 1108, -0.031944,
+1123, 1123, -0.031944,
+1123, 1139, -0.031944,
+1123, 1141, -0.063889,
+1138, 1040, -0.031944,
+1138, 1044, -0.031944,
+1138, 1046, -0.031944,
+1138, 1059, -0.031944,
+1138, 1061, -0.031944,
+1138, 1071, -0.031944,
+1138, 1140, -0.031944,
+1139, 1076, -0.031944,
+1139, 1078, -0.031944,
+1139, 1093, -0.031944,
+1139, 1103, -0.031944,
+1140, 1028, -0.031944,
+1140, 1040, -0.127777,
+1140, 1054, -0.031944,
+1140, 1057, -0.031944,
+1140, 1060, -0.031944,
+1140, 1071, -0.127777,
+1140, 1072, -0.095833,
+1140, 1076, -0.127777,
+1140, 1077, -0.095833,
+1140, 1083, -0.127777,
+1140, 1086, -0.095833,
+1140, 1103, -0.127777,
+1140, 1105, -0.095833,
+1140, 1113, -0.127777,
+1140, 1138, -0.031944,
+1140, 1139, -0.095833,
+1141, 1072, -0.031944,
+1141, 1076, -0.063889,
+1141, 1077, -0.031944,
+1141, 1083, -0.063889,
+1141, 1086, -0.031944,
+1141, 1089, -0.031944,
+1141, 1103, -0.031944,
+1141, 1105, -0.031944,
+1141, 1108, -0.031944,
+1141, 1113, -0.063889,
+1141, 1139, -0.031944
+KERNS_END
+
+END
+
+DEF_FONT(wnbxti10, cyrillic/wnbxti10.ttf, 95)
+
+xHeight(0.444445) quad(1.182211) space(0.414441)
+
+roman(wnbx10) ss(wnssbx10) tt(wntt10)
+
+METRICS_START
+171, 0.649994, 0.472223, 0, 0.008611,
+187, 0.649994, 0.472223, 0, 0,
+305, 0.355553, 0.444445, 0, 0.094261,
+774, 0.591105, 0.652727, 0, 0.092905,
+776, 0.591105, 0.686111, 0, 0.112642,
+1025, 0.756659, 0.894394, 0, 0.114306,
+1026, 0.943324, 0.686111, 0, 0.12903,
+1028, 0.826658, 0.686111, 0, 0.142084,
+1029, 0.649994, 0.686111, 0, 0.11264,
+1030, 0.471664, 0.686111, 0, 0.156807,
+1032, 0.61055, 0.686111, 0, 0.145001,
+1033, 1.198877, 0.686111, 0, 0.032991,
+1034, 1.198877, 0.686111, 0, 0.032991,
+1035, 0.870825, 0.686111, 0, 0.084864,
+1039, 0.894992, 0.686111, 0.194445, 0.172084,
+1040, 0.865547, 0.686111, 0, 0,
+1041, 0.81666, 0.686111, 0, 0.055418,
+1042, 0.81666, 0.686111, 0, 0.069758,
+1043, 0.697771, 0.686111, 0, 0.12903,
+1044, 0.894992, 0.686111, 0.194445, 0.172084,
+1045, 0.756659, 0.686111, 0, 0.114306,
+1046, 1.318319, 0.686111, 0, 0.142084,
+1047, 0.708882, 0.686111, 0, 0.099202,
+1048, 0.894992, 0.686111, 0, 0.172084,
+1049, 0.894992, 0.894394, 0, 0.172084,
+1050, 0.894992, 0.686111, 0, 0.142084,
+1051, 0.894992, 0.686111, 0, 0.172084,
+1052, 1.072767, 0.686111, 0, 0.172084,
+1053, 0.894992, 0.686111, 0, 0.172084,
+1054, 0.854991, 0.686111, 0, 0.090625,
+1055, 0.894992, 0.686111, 0, 0.172084,
+1056, 0.787214, 0.686111, 0, 0.099202,
+1057, 0.826658, 0.686111, 0, 0.142084,
+1058, 0.796103, 0.686111, 0, 0.12903,
+1059, 0.865547, 0.686111, 0, 0.186251,
+1060, 0.944435, 0.686111, 0, 0.090625,
+1061, 0.865547, 0.686111, 0, 0.156807,
+1062, 0.894992, 0.686111, 0.194445, 0.172084,
+1063, 0.894992, 0.686111, 0, 0.172084,
+1064, 1.293599, 0.686111, 0, 0.172084,
+1065, 1.293599, 0.686111, 0.194445, 0.172084,
+1066, 0.988047, 0.686111, 0, 0.032991,
+1067, 1.101102, 0.686111, 0, 0.172084,
+1068, 0.81666, 0.686111, 0, 0.032991,
+1069, 0.826658, 0.686111, 0, 0.090625,
+1070, 1.236933, 0.686111, 0, 0.090625,
+1071, 0.894992, 0.686111, 0, 0.172084,
+1072, 0.570494, 0.444445, 0, 0.094261,
+1073, 0.549883, 0.694445, 0, 0.167501,
+1074, 0.570494, 0.444445, 0, 0.085002,
+1075, 0.488052, 0.444445, 0, 0.085002,
+1076, 0.549883, 0.694445, 0, 0.112694,
+1077, 0.511606, 0.444445, 0, 0.085002,
+1078, 1.209432, 0.444445, 0, 0.052223,
+1079, 0.532217, 0.444445, 0, 0.052223,
+1080, 0.649994, 0.444445, 0, 0.094261,
+1081, 0.649994, 0.652727, 0, 0.094261,
+1082, 0.591105, 0.444445, 0, 0.111112,
+1083, 0.62055, 0.444445, 0, 0.094261,
+1084, 0.856104, 0.444445, 0, 0.094261,
+1085, 0.649994, 0.444445, 0, 0.094261,
+1086, 0.549883, 0.444445, 0, 0.078611,
+1087, 0.649994, 0.444445, 0, 0.094261,
+1088, 0.585216, 0.444445, 0.194445, 0.078611,
+1089, 0.511606, 0.444445, 0, 0.052223,
+1090, 0.944435, 0.444445, 0, 0.094261,
+1091, 0.591105, 0.444445, 0.194445, 0.105001,
+1092, 0.785437, 0.694445, 0.194445, 0.078611,
+1093, 0.648885, 0.444445, 0, 0.1258335,
+1094, 0.655884, 0.444445, 0.194445, 0.094261,
+1095, 0.62055, 0.444445, 0, 0.094261,
+1096, 0.944435, 0.444445, 0, 0.094261,
+1097, 0.950325, 0.444445, 0.194445, 0.094261,
+1098, 0.561663, 0.444445, 0, 0.078611,
+1099, 0.767771, 0.444445, 0, 0.094261,
+1100, 0.591105, 0.444445, 0, 0.078611,
+1101, 0.511606, 0.444445, 0, 0.078611,
+1102, 0.835492, 0.444445, 0, 0.078611,
+1103, 0.62055, 0.444445, 0, 0.094261,
+1105, 0.511606, 0.686111, 0, 0.085002,
+1106, 0.532217, 0.694445, 0.194445, 0.077777,
+1108, 0.511606, 0.444445, 0, 0.081667,
+1109, 0.486941, 0.444445, 0, 0.081667,
+1110, 0.355553, 0.693255, 0, 0.113872,
+1112, 0.355553, 0.693255, 0.194445, 0.167204,
+1113, 0.797215, 0.444445, 0, 0.078611,
+1114, 0.82666, 0.444445, 0, 0.078611,
+1115, 0.591105, 0.694445, 0, 0.094261,
+1119, 0.62055, 0.444445, 0.194445, 0.094261,
+1122, 0.934436, 0.75, 0, 0.099202,
+1123, 0.826658, 0.444445, 0, 0.078611,
+1138, 0.885547, 0.686111, 0, 0.090625,
+1139, 0.532217, 0.444445, 0, 0.078611,
+1140, 0.934436, 0.686111, 0, 0.186251,
+1141, 0.723051, 0.444445, 0, 0.1258335
+METRICS_END
+
+LIGTURES_START
+1044, 1032, 1026,
+1044, 1112, 1026,
+1047, 1061, 1046,
+1047, 1093, 1046,
+1050, 1061, 1061,
+1050, 1093, 1061,
+1051, 1032, 1033,
+1051, 1112, 1033,
+1053, 1032, 1034,
+1053, 1112, 1034,
+1057, 1061, 1064,
+1057, 1093, 1064,
+1058, 1057, 1062,
+1058, 1089, 1062,
+1062, 1061, 1063,
+1062, 1093, 1063,
+1064, 1062, 0,
+1064, 1063, 1065,
+1064, 1094, 0,
+1064, 1095, 1065,
+1067, 1040, 1071,
+1067, 1059, 1070,
+1067, 1072, 1071,
+1067, 1091, 1070,
+1076, 1112, 1106,
+1079, 1093, 1078,
+1082, 1093, 1093,
+1083, 1112, 1113,
+1085, 1112, 1114,
+1089, 1093, 1096,
+1090, 1089, 1094,
+1094, 1093, 1095,
+1096, 1094, 0,
+1096, 1095, 1097,
+1099, 1072, 1103,
+1099, 1091, 1102
+LIGTURES_END
+
+KERNS_START
+1026, 1026, -0.088333,
+1026, 1028, -0.029445,
+1026, 1035, -0.088333,
+1026, 1046, -0.029445,
+1026, 1054, -0.029445,
+1026, 1057, -0.029445,
+1026, 1058, -0.088333,
+1026, 1059, -0.088333,
+1026, 1060, -0.029445,
+1026, 1061, -0.029445,
+1026, 1063, -0.088333,
+1026, 1066, -0.088333,
+1026, 1080, -0.029445,
+1026, 1081, -0.029445,
+1026, 1082, -0.029445,
+1026, 1085, -0.029445,
+1026, 1087, -0.029445,
+1026, 1090, -0.029445,
+1026, 1091, -0.029445,
+1026, 1094, -0.029445,
+1026, 1096, -0.029445,
+1026, 1097, -0.029445,
+1026, 1098, -0.029445,
+1026, 1099, -0.029445,
+1026, 1100, -0.029445,
+1026, 1102, -0.029445,
+1026, 1110, -0.029445,
+1026, 1114, -0.029445,
+1026, 1122, -0.088333,
+1026, 1123, -0.029445,
+1026, 1138, -0.029445,
+1026, 1140, -0.117777,
+1026, 1141, -0.029445,
+1030, 1030, 0.029445,
+1033, 1026, -0.088333,
+1033, 1028, -0.029445,
+1033, 1035, -0.088333,
+1033, 1046, -0.029445,
+1033, 1054, -0.029445,
+1033, 1057, -0.029445,
+1033, 1058, -0.088333,
+1033, 1059, -0.088333,
+1033, 1060, -0.029445,
+1033, 1061, -0.029445,
+1033, 1063, -0.088333,
+1033, 1066, -0.088333,
+1033, 1080, -0.029445,
+1033, 1081, -0.029445,
+1033, 1082, -0.029445,
+1033, 1085, -0.029445,
+1033, 1087, -0.029445,
+1033, 1090, -0.029445,
+1033, 1091, -0.029445,
+1033, 1094, -0.029445,
+1033, 1096, -0.029445,
+1033, 1097, -0.029445,
+1033, 1098, -0.029445,
+1033, 1099, -0.029445,
+1033, 1100, -0.029445,
+1033, 1102, -0.029445,
+1033, 1110, -0.029445,
+1033, 1114, -0.029445,
+1033, 1122, -0.088333,
+1033, 1123, -0.029445,
+1033, 1138, -0.029445,
+1033, 1140, -0.117777,
+1033, 1141, -0.029445,
+1034, 1026, -0.088333,
+1034, 1028, -0.029445,
+1034, 1035, -0.088333,
+1034, 1046, -0.029445,
+1034, 1054, -0.029445,
+1034, 1057, -0.029445,
+1034, 1058, -0.088333,
+1034, 1059, -0.088333,
+1034, 1060, -0.029445,
+1034, 1061, -0.029445,
+1034, 1063, -0.088333,
+1034, 1066, -0.088333,
+1034, 1080, -0.029445,
+1034, 1081, -0.029445,
+1034, 1082, -0.029445,
+1034, 1085, -0.029445,
+1034, 1087, -0.029445,
+1034, 1090, -0.029445,
+1034, 1091, -0.029445,
+1034, 1094, -0.029445,
+1034, 1096, -0.029445,
+1034, 1097, -0.029445,
+1034, 1098, -0.029445,
+1034, 1099, -0.029445,
+1034, 1100, -0.029445,
+1034, 1102, -0.029445,
+1034, 1110, -0.029445,
+1034, 1114, -0.029445,
+1034, 1122, -0.088333,
+1034, 1123, -0.029445,
+1034, 1138, -0.029445,
+1034, 1140, -0.117777,
+1034, 1141, -0.029445,
+1040, 1026, -0.088333,
+1040, 1028, -0.029445,
+1040, 1035, -0.088333,
+1040, 1054, -0.029445,
+1040, 1057, -0.029445,
+1040, 1058, -0.088333,
+1040, 1059, -0.088333,
+1040, 1060, -0.029445,
+1040, 1063, -0.088333,
+1040, 1066, -0.088333,
+1040, 1080, -0.029445,
+1040, 1081, -0.029445,
+1040, 1082, -0.029445,
+1040, 1085, -0.029445,
+1040, 1087, -0.029445,
+1040, 1090, -0.029445,
+1040, 1091, -0.029445,
+1040, 1094, -0.029445,
+1040, 1096, -0.029445,
+1040, 1097, -0.029445,
+1040, 1098, -0.029445,
+1040, 1099, -0.029445,
+1040, 1100, -0.029445,
+1040, 1102, -0.029445,
+1040, 1110, -0.029445,
+1040, 1114, -0.029445,
+1040, 1122, -0.088333,
+1040, 1123, -0.029445,
+1040, 1138, -0.029445,
+1040, 1140, -0.117777,
+1040, 1141, -0.029445,
+1043, 1033, -0.029445,
+1043, 1040, -0.088333,
+1043, 1044, -0.088333,
+1043, 1051, -0.029445,
+1043, 1071, -0.088333,
+1043, 1072, -0.088333,
+1043, 1077, -0.088333,
+1043, 1080, -0.088333,
+1043, 1081, -0.088333,
+1043, 1083, -0.088333,
+1043, 1084, -0.088333,
+1043, 1086, -0.088333,
+1043, 1089, -0.088333,
+1043, 1091, -0.088333,
+1043, 1092, -0.088333,
+1043, 1094, -0.088333,
+1043, 1096, -0.088333,
+1043, 1097, -0.088333,
+1043, 1098, -0.088333,
+1043, 1099, -0.088333,
+1043, 1100, -0.088333,
+1043, 1105, -0.088333,
+1043, 1108, -0.088333,
+1043, 1113, -0.088333,
+1043, 1139, -0.088333,
+1043, 1141, -0.088333,
+1046, 1028, -0.029445,
+1046, 1054, -0.029445,
+1046, 1057, -0.029445,
+1046, 1060, -0.029445,
+1046, 1095, -0.029445,
+1046, 1138, -0.029445,
+1050, 1028, -0.029445,
+1050, 1054, -0.029445,
+1050, 1057, -0.029445,
+1050, 1060, -0.029445,
+1050, 1095, -0.029445,
+1050, 1138, -0.029445,
+1054, 1040, -0.029445,
+1054, 1044, -0.029445,
+1054, 1046, -0.029445,
+1054, 1059, -0.029445,
+1054, 1061, -0.029445,
+1054, 1071, -0.029445,
+1054, 1140, -0.029445,
+1056, 1033, -0.088333,
+1056, 1040, -0.088333,
+1056, 1044, -0.088333,
+1056, 1051, -0.088333,
+1056, 1071, -0.088333,
+1056, 1072, -0.029445,
+1056, 1076, -0.088333,
+1056, 1077, -0.029445,
+1056, 1083, -0.088333,
+1056, 1086, -0.029445,
+1056, 1105, -0.029445,
+1056, 1113, -0.088333,
+1056, 1139, -0.029445,
+1058, 1033, -0.029445,
+1058, 1040, -0.088333,
+1058, 1044, -0.088333,
+1058, 1051, -0.029445,
+1058, 1071, -0.088333,
+1058, 1072, -0.088333,
+1058, 1077, -0.088333,
+1058, 1080, -0.088333,
+1058, 1081, -0.088333,
+1058, 1083, -0.088333,
+1058, 1084, -0.088333,
+1058, 1086, -0.088333,
+1058, 1089, -0.088333,
+1058, 1091, -0.088333,
+1058, 1092, -0.088333,
+1058, 1094, -0.088333,
+1058, 1096, -0.088333,
+1058, 1097, -0.088333,
+1058, 1098, -0.088333,
+1058, 1099, -0.088333,
+1058, 1100, -0.088333,
+1058, 1105, -0.088333,
+1058, 1108, -0.088333,
+1058, 1113, -0.088333,
+1058, 1139, -0.088333,
+1058, 1141, -0.088333,
+1059, 1028, -0.029445,
+1059, 1033, -0.058888,
+1059, 1040, -0.088333,
+1059, 1044, -0.058888,
+1059, 1051, -0.058888,
+1059, 1054, -0.029445,
+1059, 1057, -0.029445,
+1059, 1060, -0.029445,
+1059, 1071, -0.088333,
+1059, 1072, -0.088333,
+1059, 1077, -0.088333,
+1059, 1080, -0.117777,
+1059, 1081, -0.117777,
+1059, 1083, -0.117777,
+1059, 1084, -0.117777,
+1059, 1086, -0.088333,
+1059, 1089, -0.088333,
+1059, 1091, -0.117777,
+1059, 1094, -0.117777,
+1059, 1096, -0.117777,
+1059, 1097, -0.117777,
+1059, 1098, -0.117777,
+1059, 1099, -0.117777,
+1059, 1100, -0.117777,
+1059, 1105, -0.088333,
+1059, 1108, -0.088333,
+1059, 1113, -0.117777,
+1059, 1138, -0.029445,
+1059, 1139, -0.088333,
+1059, 1141, -0.117777,
+1060, 1040, -0.029445,
+1060, 1044, -0.029445,
+1060, 1046, -0.029445,
+1060, 1059, -0.029445,
+1060, 1061, -0.029445,
+1060, 1071, -0.029445,
+1060, 1140, -0.029445,
+1061, 1028, -0.029445,
+1061, 1054, -0.029445,
+1061, 1057, -0.029445,
+1061, 1060, -0.029445,
+1061, 1095, -0.029445,
+1061, 1138, -0.029445,
+1066, 1026, -0.088333,
+1066, 1028, -0.029445,
+1066, 1035, -0.088333,
+1066, 1046, -0.029445,
+1066, 1054, -0.029445,
+1066, 1057, -0.029445,
+1066, 1058, -0.088333,
+1066, 1059, -0.088333,
+1066, 1060, -0.029445,
+1066, 1061, -0.029445,
+1066, 1063, -0.088333,
+1066, 1066, -0.088333,
+1066, 1080, -0.029445,
+1066, 1081, -0.029445,
+1066, 1082, -0.029445,
+1066, 1085, -0.029445,
+1066, 1087, -0.029445,
+1066, 1090, -0.029445,
+1066, 1091, -0.029445,
+1066, 1094, -0.029445,
+1066, 1096, -0.029445,
+1066, 1097, -0.029445,
+1066, 1098, -0.029445,
+1066, 1099, -0.029445,
+1066, 1100, -0.029445,
+1066, 1102, -0.029445,
+1066, 1110, -0.029445,
+1066, 1114, -0.029445,
+1066, 1122, -0.088333,
+1066, 1123, -0.029445,
+1066, 1138, -0.029445,
+1066, 1140, -0.117777,
+1066, 1141, -0.029445,
+1068, 1026, -0.088333,
+1068, 1028, -0.029445,
+1068, 1035, -0.088333,
+1068, 1046, -0.029445,
+1068, 1054, -0.029445,
+1068, 1057, -0.029445,
+1068, 1058, -0.088333,
+1068, 1059, -0.088333,
+1068, 1060, -0.029445,
+1068, 1061, -0.029445,
+1068, 1063, -0.088333,
+1068, 1066, -0.088333,
+1068, 1080, -0.029445,
+1068, 1081, -0.029445,
+1068, 1082, -0.029445,
+1068, 1085, -0.029445,
+1068, 1087, -0.029445,
+1068, 1090, -0.029445,
+1068, 1091, -0.029445,
+1068, 1094, -0.029445,
+1068, 1096, -0.029445,
+1068, 1097, -0.029445,
+1068, 1098, -0.029445,
+1068, 1099, -0.029445,
+1068, 1100, -0.029445,
+1068, 1102, -0.029445,
+1068, 1110, -0.029445,
+1068, 1114, -0.029445,
+1068, 1122, -0.088333,
+1068, 1123, -0.029445,
+1068, 1138, -0.029445,
+1068, 1140, -0.117777,
+1068, 1141, -0.029445,
+1069, 1040, -0.029445,
+1069, 1044, -0.029445,
+1069, 1046, -0.029445,
+1069, 1059, -0.029445,
+1069, 1061, -0.029445,
+1069, 1071, -0.029445,
+1069, 1140, -0.029445,
+1070, 1040, -0.029445,
+1070, 1044, -0.029445,
+1070, 1046, -0.029445,
+1070, 1059, -0.029445,
+1070, 1061, -0.029445,
+1070, 1071, -0.029445,
+1070, 1140, -0.029445,
+1073, 1072, -0.058888,
+1073, 1083, -0.029445,
+1073, 1084, -0.029445,
+1073, 1092, -0.058888,
+1073, 1113, -0.029445,
+1077, 1072, -0.058888,
+1077, 1083, -0.029445,
+1077, 1084, -0.029445,
+1077, 1092, -0.058888,
+1077, 1113, -0.029445,
+1083, 1083, -0.029445,
+1083, 1084, -0.029445,
+1083, 1095, -0.088333,
+1083, 1098, -0.029445,
+1083, 1113, -0.029445,
+1083, 1141, -0.029445,
+1086, 1072, -0.058888,
+1086, 1083, -0.029445,
+1086, 1084, -0.029445,
+1086, 1092, -0.058888,
+1086, 1113, -0.029445,
+1088, 1072, -0.058888,
+1088, 1083, -0.029445,
+1088, 1084, -0.029445,
+1088, 1092, -0.058888,
+1088, 1113, -0.029445,
+1089, 1072, -0.058888,
+1089, 1083, -0.029445,
+1089, 1084, -0.029445,
+1089, 1092, -0.058888,
+1089, 1113, -0.029445,
+1092, 1072, -0.058888,
+1092, 1083, -0.029445,
+1092, 1084, -0.029445,
+1092, 1092, -0.058888,
+1092, 1113, -0.029445,
+1098, 1083, -0.029445,
+1098, 1084, -0.029445,
+1098, 1086, -0.029445,
+1098, 1092, -0.029445,
+1098, 1095, -0.088333,
+1098, 1098, -0.029445,
+1098, 1108, -0.029445,
+1098, 1113, -0.029445,
+1098, 1139, -0.029445,
+1098, 1141, -0.029445,
+1100, 1083, -0.029445,
+1100, 1084, -0.029445,
+1100, 1086, -0.029445,
+1100, 1092, -0.029445,
+1100, 1095, -0.088333,
+1100, 1098, -0.029445,
+1100, 1108, -0.029445,
+1100, 1113, -0.029445,
+1100, 1139, -0.029445,
+1100, 1141, -0.029445,
+1101, 1072, -0.058888,
+1101, 1083, -0.029445,
+1101, 1084, -0.029445,
+1101, 1092, -0.058888,
+1101, 1113, -0.029445,
+1102, 1072, -0.058888,
+1102, 1083, -0.029445,
+1102, 1084, -0.029445,
+1102, 1092, -0.058888,
+1102, 1113, -0.029445,
+1105, 1072, -0.058888,
+1105, 1083, -0.029445,
+1105, 1084, -0.029445,
+1105, 1092, -0.058888,
+1105, 1113, -0.029445,
+1113, 1083, -0.029445,
+1113, 1084, -0.029445,
+1113, 1086, -0.029445,
+1113, 1092, -0.029445,
+1113, 1095, -0.088333,
+1113, 1098, -0.029445,
+1113, 1108, -0.029445,
+1113, 1113, -0.029445,
+1113, 1139, -0.029445,
+1113, 1141, -0.029445,
+1114, 1083, -0.029445,
+1114, 1084, -0.029445,
+1114, 1086, -0.029445,
+1114, 1092, -0.029445,
+1114, 1095, -0.088333,
+1114, 1098, -0.029445,
+1114, 1108, -0.029445,
+1114, 1113, -0.029445,
+1114, 1139, -0.029445,
+1114, 1141, -0.029445,
+1122, 1026, -0.088333,
+1122, 1028, -0.029445,
+1122, 1035, -0.088333,
+1122, 1046, -0.029445,
+1122, 1054, -0.029445,
+1122, 1057, -0.029445,
+1122, 1058, -0.088333,
+1122, 1059, -0.088333,
+1122, 1060, -0.029445,
+1122, 1061, -0.029445,
+1122, 1063, -0.088333,
+1122, 1066, -0.088333,
+1122, 1080, -0.029445,
+1122, 1081, -0.029445,
+1122, 1082, -0.029445,
+1122, 1085, -0.029445,
+1122, 1087, -0.029445,
+1122, 1090, -0.029445,
+1122, 1091, -0.029445,
+1122, 1094, -0.029445,
+1122, 1096, -0.029445,
+1122, 1097, -0.029445,
+1122, 1098, -0.029445,
+1122, 1099, -0.029445,
+1122, 1100, -0.029445,
+1122, 1102, -0.029445,
+1122, 1110, -0.029445,
+1122, 1114, -0.029445,
+1122, 1122, -0.088333,
+1122, 1123, -0.029445,
+1122, 1138, -0.029445,
+1122, 1140, -0.117777,
+1122, 1141, -0.029445,
+1123, 1083, -0.029445,
+1123, 1084, -0.029445,
+1123, 1086, -0.029445,
+1123, 1092, -0.029445,
+1123, 1095, -0.088333,
+1123, 1098, -0.029445,
+1123, 1108, -0.029445,
+1123, 1113, -0.029445,
+1123, 1139, -0.029445,
+1123, 1141, -0.029445,
+1138, 1040, -0.029445,
+1138, 1044, -0.029445,
+1138, 1046, -0.029445,
+1138, 1059, -0.029445,
+1138, 1061, -0.029445,
+1138, 1071, -0.029445,
+1138, 1140, -0.029445,
+1139, 1072, -0.058888,
+1139, 1083, -0.029445,
+1139, 1084, -0.029445,
+1139, 1092, -0.058888,
+1139, 1113, -0.029445,
+1140, 1028, -0.029445,
+1140, 1040, -0.117777,
+1140, 1054, -0.029445,
+1140, 1057, -0.029445,
+1140, 1060, -0.029445,
+1140, 1071, -0.117777,
+1140, 1072, -0.088333,
+1140, 1077, -0.088333,
+1140, 1080, -0.117777,
+1140, 1081, -0.117777,
+1140, 1083, -0.117777,
+1140, 1084, -0.117777,
+1140, 1086, -0.088333,
+1140, 1091, -0.117777,
+1140, 1094, -0.117777,
+1140, 1096, -0.117777,
+1140, 1097, -0.117777,
+1140, 1098, -0.117777,
+1140, 1099, -0.117777,
+1140, 1100, -0.117777,
+1140, 1105, -0.088333,
+1140, 1113, -0.117777,
+1140, 1138, -0.029445,
+1140, 1139, -0.088333,
+1140, 1141, -0.117777,
+1141, 1083, -0.088333,
+1141, 1084, -0.088333,
+1141, 1113, -0.088333
+KERNS_END
+
+END
+
+DECL_FONT_SET(Cyrillic)
+
+DEF_FONT_SET(Cyrillic)
+
+REG_FONT(wnr10)
+REG_FONT(wnti10)
+REG_FONT(wntt10)
+REG_FONT(wnss10)
+REG_FONT(wnssi10)
+REG_FONT(wnssbx10)
+REG_FONT(wnbx10)
+REG_FONT(wnbxti10)
+
+END_DEF_FONT_SET
+
+DEF_ALPHABET(Cyrillic)
+
+SYMBOLS_START
+sym(ordinary, "dotlessi")
+sym(accent, "cyrbreve")
+sym(accent, "cyrddot")
+sym(ordinary, "CYRA")
+sym(ordinary, "CYRB")
+sym(ordinary, "CYRV")
+sym(ordinary, "CYRG")
+sym(ordinary, "CYRD")
+sym(ordinary, "CYRE")
+sym(ordinary, "CYRYO")
+sym(ordinary, "CYRZH")
+sym(ordinary, "CYRZ")
+sym(ordinary, "CYRE")
+sym(ordinary, "CYRI")
+sym(ordinary, "CYRIO")
+sym(ordinary, "CYRK")
+sym(ordinary, "CYRL")
+sym(ordinary, "CYRM")
+sym(ordinary, "CYRN")
+sym(ordinary, "CYRO")
+sym(ordinary, "CYRP")
+sym(ordinary, "CYRR")
+sym(ordinary, "CYRS")
+sym(ordinary, "CYRT")
+sym(ordinary, "CYRU")
+sym(ordinary, "CYRF")
+sym(ordinary, "CYRH")
+sym(ordinary, "CYRC")
+sym(ordinary, "CYRCH")
+sym(ordinary, "CYRSH")
+sym(ordinary, "CYRSHCH")
+sym(ordinary, "CYRHRDSN")
+sym(ordinary, "CYRY")
+sym(ordinary, "CYRSFTSN")
+sym(ordinary, "CYREREV")
+sym(ordinary, "CYRYU")
+sym(ordinary, "CYRYA")
+sym(ordinary, "cyra")
+sym(ordinary, "cyrb")
+sym(ordinary, "cyrv")
+sym(ordinary, "cyrg")
+sym(ordinary, "cyrd")
+sym(ordinary, "cyre")
+sym(ordinary, "cyryo")
+sym(ordinary, "cyrzh")
+sym(ordinary, "cyrz")
+sym(ordinary, "cyre")
+sym(ordinary, "cyri")
+sym(ordinary, "cyrio")
+sym(ordinary, "cyrk")
+sym(ordinary, "cyrl")
+sym(ordinary, "cyrm")
+sym(ordinary, "cyrn")
+sym(ordinary, "cyro")
+sym(ordinary, "cyrp")
+sym(ordinary, "cyrr")
+sym(ordinary, "cyrs")
+sym(ordinary, "cyrt")
+sym(ordinary, "cyru")
+sym(ordinary, "cyrf")
+sym(ordinary, "cyrh")
+sym(ordinary, "cyrc")
+sym(ordinary, "cyrch")
+sym(ordinary, "cyrsh")
+sym(ordinary, "cyrshch")
+sym(ordinary, "cyrhrdsn")
+sym(ordinary, "cyry")
+sym(ordinary, "cyrsftsn")
+sym(ordinary, "cyrerev")
+sym(ordinary, "cyryu")
+sym(ordinary, "cyrya")
+sym(ordinary, "CYRIE")
+sym(ordinary, "CYRII")
+sym(ordinary, "cyrie")
+sym(ordinary, "cyrii")
+sym(ordinary, "CYRDJE")
+sym(ordinary, "CYRDZE")
+sym(ordinary, "CYRJE")
+sym(ordinary, "CYRLJE")
+sym(ordinary, "CYRNJE")
+sym(ordinary, "CYRTSHE")
+sym(ordinary, "CYRDZHE")
+sym(ordinary, "CYRIZH")
+sym(ordinary, "CYRYAT")
+sym(ordinary, "CYRFITA")
+sym(ordinary, "cyrdje")
+sym(ordinary, "cyrdze")
+sym(ordinary, "cyrje")
+sym(ordinary, "cyrlje")
+sym(ordinary, "cyrnje")
+sym(ordinary, "cyrtshe")
+sym(ordinary, "cyrdzhe")
+sym(ordinary, "cyrizh")
+sym(ordinary, "cyryat")
+sym(ordinary, "cyrfita")
+SYMBOLS_END
+
+SYMBOL_MAPPINGS_START
+M(305, "dotlessi", nullptr)
+M(1040, "CYRA", nullptr)
+M(1041, "CYRB", nullptr)
+M(1042, "CYRV", nullptr)
+M(1043, "CYRG", nullptr)
+M(1044, "CYRD", nullptr)
+M(1045, "CYRE", nullptr)
+M(1025, "CYRYO", nullptr)
+M(1046, "CYRZH", nullptr)
+M(1047, "CYRZ", nullptr)
+M(1048, "CYRI", nullptr)
+M(1049, "CYRIO", nullptr)
+M(1050, "CYRK", nullptr)
+M(1051, "CYRL", nullptr)
+M(1052, "CYRM", nullptr)
+M(1053, "CYRN", nullptr)
+M(1054, "CYRO", nullptr)
+M(1055, "CYRP", nullptr)
+M(1056, "CYRR", nullptr)
+M(1057, "CYRS", nullptr)
+M(1058, "CYRT", nullptr)
+M(1059, "CYRU", nullptr)
+M(1060, "CYRF", nullptr)
+M(1061, "CYRH", nullptr)
+M(1062, "CYRC", nullptr)
+M(1063, "CYRCH", nullptr)
+M(1064, "CYRSH", nullptr)
+M(1065, "CYRSHCH", nullptr)
+M(1066, "CYRHRDSN", nullptr)
+M(1067, "CYRY", nullptr)
+M(1068, "CYRSFTSN", nullptr)
+M(1069, "CYREREV", nullptr)
+M(1070, "CYRYU", nullptr)
+M(1071, "CYRYA", nullptr)
+M(1072, "cyra", nullptr)
+M(1073, "cyrb", nullptr)
+M(1074, "cyrv", nullptr)
+M(1075, "cyrg", nullptr)
+M(1076, "cyrd", nullptr)
+M(1077, "cyre", nullptr)
+M(1105, "cyryo", nullptr)
+M(1078, "cyrzh", nullptr)
+M(1079, "cyrz", nullptr)
+M(1080, "cyri", nullptr)
+M(1081, "cyrio", nullptr)
+M(1082, "cyrk", nullptr)
+M(1083, "cyrl", nullptr)
+M(1084, "cyrm", nullptr)
+M(1085, "cyrn", nullptr)
+M(1086, "cyro", nullptr)
+M(1087, "cyrp", nullptr)
+M(1088, "cyrr", nullptr)
+M(1089, "cyrs", nullptr)
+M(1090, "cyrt", nullptr)
+M(1091, "cyru", nullptr)
+M(1092, "cyrf", nullptr)
+M(1093, "cyrh", nullptr)
+M(1094, "cyrc", nullptr)
+M(1095, "cyrch", nullptr)
+M(1096, "cyrsh", nullptr)
+M(1097, "cyrshch", nullptr)
+M(1098, "cyrhrdsn", nullptr)
+M(1099, "cyry", nullptr)
+M(1100, "cyrsftsn", nullptr)
+M(1101, "cyrerev", nullptr)
+M(1102, "cyryu", nullptr)
+M(1103, "cyrya", nullptr)
+M(1028, "CYRIE", nullptr)
+M(1030, "CYRII", nullptr)
+M(1108, "cyrie", nullptr)
+M(1110, "cyrii", nullptr)
+M(1026, "CYRDJE", nullptr)
+M(1029, "CYRDZE", nullptr)
+M(1032, "CYRJE", nullptr)
+M(1033, "CYRLJE", nullptr)
+M(1034, "CYRNJE", nullptr)
+M(1035, "CYRTSHE", nullptr)
+M(1039, "CYRDZHE", nullptr)
+M(1140, "CYRIZH", nullptr)
+M(1122, "CYRYAT", nullptr)
+M(1138, "CYRFITA", nullptr)
+M(1106, "cyrdje", nullptr)
+M(1109, "cyrdze", nullptr)
+M(1112, "cyrje", nullptr)
+M(1113, "cyrlje", nullptr)
+M(1114, "cyrnje", nullptr)
+M(1115, "cyrtshe", nullptr)
+M(1119, "cyrdzhe", nullptr)
+M(1141, "cyrizh", nullptr)
+M(1123, "cyryat", nullptr)
+M(1139, "cyrfita", nullptr)
+SYMBOL_MAPPINGS_END
+
+FORMULA_MAPPINGS_START
+M(1024, "\\`\\CYRE", nullptr)
+M(1027, "\\'\\CYRG", nullptr)
+M(1031, "\\cyrddot\\CYRII", nullptr)
+M(1111, "\\cyrddot\\dotlessi", nullptr)
+M(1027, "\\'\\CYRG", nullptr)
+M(1027, "\\'\\CYRK", nullptr)
+M(1037, "\\`\\CYRI", nullptr)
+M(1038, "\\cyrbreve\\CYRU", nullptr)
+M(1104, "\\`\\cyre", nullptr)
+M(1107, "\\'\\cyrg", nullptr)
+M(1116, "\\'\\cyrk", nullptr)
+M(1117, "\\`\\cyri", nullptr)
+M(1118, "\\cyrbreve\\cyru", nullptr)
+FORMULA_MAPPINGS_END
+
+FONT_ID(wnr10)
+
+CHARS_START
+E(wnr10, 305, "dotlessi")
+E(wnr10, 1040, "CYRA")
+E(wnr10, 1041, "CYRB")
+E(wnr10, 1042, "CYRV")
+E(wnr10, 1043, "CYRG")
+E(wnr10, 1044, "CYRD")
+E(wnr10, 1045, "CYRE")
+E(wnr10, 1025, "CYRYO")
+E(wnr10, 1046, "CYRZH")
+E(wnr10, 1047, "CYRZ")
+E(wnr10, 1048, "CYRI")
+E(wnr10, 1049, "CYRIO")
+E(wnr10, 1050, "CYRK")
+E(wnr10, 1051, "CYRL")
+E(wnr10, 1052, "CYRM")
+E(wnr10, 1053, "CYRN")
+E(wnr10, 1054, "CYRO")
+E(wnr10, 1055, "CYRP")
+E(wnr10, 1056, "CYRR")
+E(wnr10, 1057, "CYRS")
+E(wnr10, 1058, "CYRT")
+E(wnr10, 1059, "CYRU")
+E(wnr10, 1060, "CYRF")
+E(wnr10, 1061, "CYRH")
+E(wnr10, 1062, "CYRC")
+E(wnr10, 1063, "CYRCH")
+E(wnr10, 1064, "CYRSH")
+E(wnr10, 1065, "CYRSHCH")
+E(wnr10, 1066, "CYRHRDSN")
+E(wnr10, 1067, "CYRY")
+E(wnr10, 1068, "CYRSFTSN")
+E(wnr10, 1069, "CYREREV")
+E(wnr10, 1070, "CYRYU")
+E(wnr10, 1071, "CYRYA")
+E(wnr10, 1072, "cyra")
+E(wnr10, 1073, "cyrb")
+E(wnr10, 1074, "cyrv")
+E(wnr10, 1075, "cyrg")
+E(wnr10, 1076, "cyrd")
+E(wnr10, 1077, "cyre")
+E(wnr10, 1105, "cyryo")
+E(wnr10, 1078, "cyrzh")
+E(wnr10, 1079, "cyrz")
+E(wnr10, 1080, "cyri")
+E(wnr10, 1081, "cyrio")
+E(wnr10, 1082, "cyrk")
+E(wnr10, 1083, "cyrl")
+E(wnr10, 1084, "cyrm")
+E(wnr10, 1085, "cyrn")
+E(wnr10, 1086, "cyro")
+E(wnr10, 1087, "cyrp")
+E(wnr10, 1088, "cyrr")
+E(wnr10, 1089, "cyrs")
+E(wnr10, 1090, "cyrt")
+E(wnr10, 1091, "cyru")
+E(wnr10, 1092, "cyrf")
+E(wnr10, 1093, "cyrh")
+E(wnr10, 1094, "cyrc")
+E(wnr10, 1095, "cyrch")
+E(wnr10, 1096, "cyrsh")
+E(wnr10, 1097, "cyrshch")
+E(wnr10, 1098, "cyrhrdsn")
+E(wnr10, 1099, "cyry")
+E(wnr10, 1100, "cyrsftsn")
+E(wnr10, 1101, "cyrerev")
+E(wnr10, 1102, "cyryu")
+E(wnr10, 1103, "cyrya")
+E(wnr10, 1028, "CYRIE")
+E(wnr10, 1030, "CYRII")
+E(wnr10, 1108, "cyrie")
+E(wnr10, 1110, "cyrii")
+E(wnr10, 1026, "CYRDJE")
+E(wnr10, 1029, "CYRDZE")
+E(wnr10, 1032, "CYRJE")
+E(wnr10, 1033, "CYRLJE")
+E(wnr10, 1034, "CYRNJE")
+E(wnr10, 1035, "CYRTSHE")
+E(wnr10, 1039, "CYRDZHE")
+E(wnr10, 1140, "CYRIZH")
+E(wnr10, 1122, "CYRYAT")
+E(wnr10, 1138, "CYRFITA")
+E(wnr10, 1106, "cyrdje")
+E(wnr10, 1109, "cyrdze")
+E(wnr10, 1112, "cyrje")
+E(wnr10, 1113, "cyrlje")
+E(wnr10, 1114, "cyrnje")
+E(wnr10, 1115, "cyrtshe")
+E(wnr10, 1119, "cyrdzhe")
+E(wnr10, 1141, "cyrizh")
+E(wnr10, 1123, "cyryat")
+E(wnr10, 1139, "cyrfita")
+E(wnr10, 774, "cyrbreve")
+E(wnr10, 776, "cyrddot")
+CHARS_END
+
+END_DEF_ALPHABET
@@ -0,0 +1,7566 @@
+// Generated by prebuilt/alphabet_def.py from res/greek, do not edit
+#include "res/alphabet_def.res.h"
+
+CHECK_ALPHABET_DEF_VERSION(1)
+
+DEF_FONT(fcmbipg, greek/fcmbipg.ttf, 204)
+
+xHeight(0.451) quad(1) space(0.355)
+
+ss(fcsbpg) tt(fctrpg)
+
+METRICS_START
+32, 0.355, 0.0, 0, 0,
+168, 0.255, 0.644, 0, 0.216,
+884, 0.224, 0.714, 0, 0.144,
+885, 0.224, 0.005, 0.215, 0,
+890, 0.128, -0.032, 0.211, 0.064,
+900, 0.192, 0.714, 0, 0.15,
+901, 0.319, 0.714, 0, 0.206,
+903, 0.319, 0.446, 0, 0.021,
+912, 0.287, 0.714, 0.006, 0.188,
+913, 0.869, 0.7, 0, 0,
+914, 0.818, 0.689, 0, 0.046,
+915, 0.691, 0.681, 0, 0.102,
+916, 0.958, 0.699, 0, 0,
+917, 0.755, 0.681, 0, 0.086,
+918, 0.703, 0.688, 0, 0.115,
+919, 0.9, 0.687, 0, 0.144,
+920, 0.894, 0.699, 0.011, 0.04,
+921, 0.436, 0.687, 0, 0.15,
+922, 0.901, 0.687, 0, 0.119,
+923, 0.805, 0.699, 0, 0,
+924, 1.091, 0.688, 0, 0.143,
+925, 0.9, 0.687, 0, 0.144,
+926, 0.766, 0.676, 0, 0.117,
+927, 0.864, 0.699, 0.011, 0.041,
+928, 0.9, 0.681, 0, 0.142,
+929, 0.786, 0.687, 0, 0.073,
+931, 0.83, 0.688, 0, 0.089,
+932, 0.8, 0.676, 0, 0.118,
+933, 0.805, 0.687, 0, 0.166,
+934, 0.83, 0.687, 0, 0.031,
+935, 0.869, 0.687, 0, 0.101,
+936, 0.894, 0.687, 0, 0.077,
+937, 0.83, 0.698, 0, 0.065,
+938, 0.436, 0.893, 0, 0.219,
+939, 0.805, 0.893, 0, 0.166,
+940, 0.639, 0.714, 0.006, 0,
+941, 0.447, 0.714, 0.006, 0.055,
+942, 0.594, 0.713, 0.214, 0.026,
+943, 0.287, 0.714, 0.006, 0.101,
+944, 0.575, 0.738, 0.005, 0.07,
+945, 0.639, 0.452, 0.006, 0,
+946, 0.511, 0.702, 0.212, 0.082,
+947, 0.575, 0.46, 0.224, 0.058,
+948, 0.537, 0.702, 0.005, 0.029,
+949, 0.447, 0.451, 0.006, 0.051,
+950, 0.479, 0.696, 0.188, 0.06,
+951, 0.594, 0.452, 0.214, 0.026,
+952, 0.591, 0.702, 0.006, 0.075,
+953, 0.287, 0.445, 0.006, 0.011,
+954, 0.607, 0.458, 0.006, 0.063,
+955, 0.517, 0.701, 0.006, 0.014,
+956, 0.575, 0.445, 0.235, 0.001,
+957, 0.479, 0.451, 0.01, 0.06,
+958, 0.479, 0.696, 0.188, 0.031,
+959, 0.543, 0.452, 0.006, 0.019,
+960, 0.655, 0.452, 0.006, 0.076,
+961, 0.543, 0.451, 0.212, 0.022,
+962, 0.479, 0.452, 0.159, 0.034,
+963, 0.575, 0.476, 0.005, 0.076,
+964, 0.527, 0.484, 0.005, 0.074,
+965, 0.594, 0.462, 0.005, 0.018,
+966, 0.671, 0.452, 0.218, 0.031,
+967, 0.543, 0.452, 0.217, 0.022,
+968, 0.639, 0.454, 0.213, 0.042,
+969, 0.766, 0.446, 0.006, 0,
+970, 0.287, 0.638, 0.006, 0.192,
+971, 0.575, 0.638, 0.005, 0.071,
+972, 0.543, 0.714, 0.006, 0.019,
+973, 0.575, 0.713, 0.005, 0.037,
+974, 0.766, 0.713, 0.006, 0,
+984, 0.575, 0.694, 0.003, 0.096,
+985, 0.575, 0.451, 0.222, 0.003,
+986, 0.894, 0.677, 0, 0.118,
+987, 0.575, 0.504, 0.106, 0.08,
+988, 0.723, 0.681, 0, 0.102,
+989, 0.575, 0.696, 0, 0.14,
+991, 0.447, 0.696, 0.211, 0.047,
+992, 0.881, 0.705, 0, 0,
+993, 0.83, 0.701, 0.028, 0,
+7936, 0.639, 0.695, 0.006, 0,
+7937, 0.639, 0.696, 0.006, 0,
+7938, 0.639, 0.713, 0.006, 0,
+7939, 0.639, 0.713, 0.006, 0,
+7940, 0.639, 0.713, 0.006, 0,
+7941, 0.639, 0.714, 0.006, 0,
+7942, 0.639, 0.724, 0.006, 0.037,
+7943, 0.639, 0.724, 0.006, 0.037,
+7952, 0.447, 0.695, 0.006, 0.051,
+7953, 0.447, 0.696, 0.006, 0.051,
+7954, 0.447, 0.713, 0.006, 0.061,
+7955, 0.447, 0.714, 0.006, 0.061,
+7956, 0.447, 0.714, 0.006, 0.102,
+7957, 0.447, 0.713, 0.006, 0.102,
+7968, 0.594, 0.695, 0.214, 0.026,
+7969, 0.594, 0.696, 0.214, 0.026,
+7970, 0.594, 0.713, 0.214, 0.026,
+7971, 0.594, 0.714, 0.214, 0.026,
+7972, 0.594, 0.714, 0.214, 0.026,
+7973, 0.594, 0.713, 0.214, 0.026,
+7974, 0.594, 0.723, 0.214, 0.066,
+7975, 0.594, 0.723, 0.214, 0.066,
+7984, 0.287, 0.695, 0.006, 0.102,
+7985, 0.287, 0.696, 0.006, 0.072,
+7986, 0.287, 0.713, 0.006, 0.108,
+7987, 0.287, 0.714, 0.006, 0.108,
+7988, 0.287, 0.714, 0.006, 0.149,
+7989, 0.287, 0.713, 0.006, 0.149,
+7990, 0.287, 0.724, 0.006, 0.2,
+7991, 0.287, 0.724, 0.006, 0.2,
+8000, 0.543, 0.695, 0.006, 0.024,
+8001, 0.543, 0.696, 0.006, 0.019,
+8002, 0.543, 0.713, 0.006, 0.019,
+8003, 0.543, 0.714, 0.006, 0.019,
+8004, 0.543, 0.714, 0.006, 0.054,
+8005, 0.543, 0.713, 0.006, 0.054,
+8016, 0.575, 0.695, 0.005, 0.037,
+8017, 0.575, 0.696, 0.005, 0.037,
+8018, 0.575, 0.714, 0.005, 0.037,
+8019, 0.575, 0.714, 0.005, 0.037,
+8020, 0.575, 0.713, 0.005, 0.037,
+8021, 0.575, 0.714, 0.005, 0.037,
+8022, 0.575, 0.724, 0.005, 0.081,
+8023, 0.575, 0.724, 0.005, 0.081,
+8032, 0.766, 0.695, 0.006, 0,
+8033, 0.766, 0.696, 0.006, 0,
+8034, 0.766, 0.713, 0.006, 0,
+8035, 0.766, 0.714, 0.006, 0,
+8036, 0.766, 0.714, 0.006, 0,
+8037, 0.766, 0.714, 0.006, 0,
+8038, 0.766, 0.724, 0.006, 0.027,
+8039, 0.766, 0.724, 0.006, 0.027,
+8048, 0.639, 0.713, 0.006, 0,
+8050, 0.447, 0.714, 0.006, 0.051,
+8052, 0.594, 0.714, 0.214, 0.026,
+8054, 0.287, 0.714, 0.006, 0.018,
+8056, 0.543, 0.714, 0.006, 0.019,
+8058, 0.575, 0.714, 0.005, 0.037,
+8060, 0.766, 0.714, 0.006, 0,
+8064, 0.639, 0.695, 0.211, 0,
+8065, 0.639, 0.696, 0.211, 0,
+8066, 0.639, 0.713, 0.211, 0,
+8067, 0.639, 0.713, 0.211, 0,
+8068, 0.639, 0.713, 0.211, 0,
+8069, 0.639, 0.714, 0.211, 0,
+8070, 0.639, 0.724, 0.211, 0.037,
+8071, 0.639, 0.724, 0.211, 0.037,
+8080, 0.594, 0.695, 0.214, 0.026,
+8081, 0.594, 0.696, 0.214, 0.026,
+8082, 0.594, 0.713, 0.214, 0.026,
+8083, 0.594, 0.714, 0.214, 0.026,
+8084, 0.594, 0.714, 0.214, 0.026,
+8085, 0.594, 0.713, 0.214, 0.026,
+8086, 0.594, 0.723, 0.214, 0.066,
+8087, 0.594, 0.723, 0.214, 0.066,
+8096, 0.766, 0.695, 0.211, 0,
+8097, 0.766, 0.696, 0.211, 0,
+8098, 0.766, 0.713, 0.211, 0,
+8099, 0.766, 0.714, 0.211, 0,
+8100, 0.766, 0.714, 0.211, 0,
+8101, 0.766, 0.714, 0.211, 0,
+8102, 0.766, 0.724, 0.211, 0.027,
+8103, 0.766, 0.724, 0.211, 0.027,
+8114, 0.639, 0.713, 0.211, 0,
+8115, 0.639, 0.452, 0.211, 0,
+8116, 0.639, 0.714, 0.211, 0,
+8118, 0.639, 0.636, 0.006, 0.011,
+8119, 0.639, 0.636, 0.211, 0.011,
+8124, 0.869, 0.7, 0.211, 0,
+8126, 0.255, 0.157, 0.155, 0.006,
+8127, 0.255, 0.695, 0, 0.168,
+8128, 0.383, 0.635, 0, 0.16,
+8129, 0.511, 0.723, 0, 0.122,
+8130, 0.594, 0.714, 0.214, 0.026,
+8131, 0.594, 0.452, 0.214, 0.026,
+8132, 0.594, 0.713, 0.214, 0.026,
+8134, 0.594, 0.636, 0.214, 0.04,
+8135, 0.594, 0.636, 0.214, 0.04,
+8140, 0.9, 0.687, 0.211, 0.144,
+8141, 0.319, 0.713, 0, 0.125,
+8142, 0.319, 0.714, 0, 0.166,
+8143, 0.383, 0.724, 0, 0.186,
+8146, 0.287, 0.714, 0.006, 0.188,
+8150, 0.287, 0.636, 0.006, 0.174,
+8151, 0.287, 0.724, 0.006, 0.2,
+8157, 0.319, 0.714, 0, 0.125,
+8158, 0.319, 0.713, 0, 0.166,
+8159, 0.383, 0.724, 0, 0.186,
+8162, 0.575, 0.739, 0.005, 0.07,
+8164, 0.543, 0.695, 0.212, 0.024,
+8165, 0.543, 0.696, 0.212, 0.022,
+8166, 0.575, 0.636, 0.005, 0.055,
+8167, 0.575, 0.724, 0.005, 0.081,
+8173, 0.319, 0.714, 0, 0.206,
+8175, 0.192, 0.714, 0, 0.131,
+8178, 0.766, 0.714, 0.211, 0,
+8179, 0.766, 0.446, 0.211, 0,
+8180, 0.766, 0.713, 0.211, 0,
+8182, 0.766, 0.635, 0.006, 0.001,
+8183, 0.766, 0.635, 0.211, 0.001,
+8188, 0.83, 0.698, 0.211, 0.065,
+8190, 0.255, 0.696, 0, 0.106,
+8217, 0.319, 0.696, 0, 0.095,
+9001, 0.473, 0.751, 0.25, 0.091,
+9002, 0.473, 0.751, 0.25, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.128,
+900, 927, -0.064,
+900, 937, -0.032,
+900, 8124, -0.128,
+900, 8188, -0.032,
+912, 947, -0.08,
+912, 951, -0.019,
+912, 952, -0.038,
+912, 954, -0.064,
+912, 957, -0.064,
+912, 959, -0.032,
+912, 962, -0.032,
+912, 963, -0.032,
+912, 964, -0.096,
+912, 967, -0.064,
+912, 972, -0.032,
+912, 993, -0.192,
+912, 8000, -0.032,
+912, 8001, -0.032,
+912, 8004, -0.032,
+912, 8005, -0.032,
+912, 8056, -0.032,
+913, 920, -0.096,
+913, 927, -0.096,
+913, 932, -0.096,
+913, 933, -0.16,
+913, 934, -0.096,
+913, 936, -0.141,
+913, 939, -0.16,
+913, 957, -0.112,
+915, 913, -0.153,
+915, 916, -0.128,
+915, 923, -0.141,
+915, 8124, -0.153,
+916, 927, -0.038,
+916, 933, -0.16,
+916, 939, -0.16,
+920, 913, -0.096,
+920, 933, -0.096,
+920, 939, -0.096,
+920, 8124, -0.096,
+922, 927, -0.096,
+923, 927, -0.038,
+923, 933, -0.115,
+923, 939, -0.115,
+925, 913, -0.096,
+925, 8124, -0.096,
+927, 913, -0.096,
+927, 931, -0.064,
+927, 8124, -0.096,
+929, 913, -0.192,
+929, 8124, -0.192,
+931, 913, -0.032,
+931, 8124, -0.032,
+932, 913, -0.096,
+932, 8124, -0.096,
+933, 913, -0.16,
+933, 916, -0.16,
+933, 923, -0.16,
+933, 8124, -0.16,
+934, 913, -0.096,
+934, 8124, -0.096,
+936, 913, -0.141,
+936, 8124, -0.141,
+939, 913, -0.16,
+939, 916, -0.16,
+939, 923, -0.16,
+939, 8124, -0.16,
+940, 947, -0.096,
+940, 952, -0.096,
+940, 957, -0.096,
+940, 959, -0.032,
+940, 960, -0.051,
+940, 964, -0.096,
+940, 965, -0.096,
+940, 967, -0.096,
+940, 968, -0.032,
+940, 972, -0.032,
+940, 973, -0.096,
+940, 8056, -0.032,
+940, 8058, -0.096,
+941, 940, -0.032,
+941, 945, -0.032,
+941, 948, -0.032,
+941, 963, -0.032,
+941, 965, -0.032,
+941, 967, -0.01,
+941, 973, -0.032,
+941, 993, -0.192,
+941, 8048, -0.032,
+941, 8058, -0.032,
+941, 8114, -0.032,
+941, 8115, -0.032,
+941, 8116, -0.032,
+941, 8118, -0.032,
+941, 8119, -0.032,
+941, 8166, -0.032,
+942, 957, -0.032,
+942, 965, -0.032,
+942, 973, -0.032,
+942, 8058, -0.032,
+942, 8166, -0.032,
+943, 947, -0.08,
+943, 951, -0.019,
+943, 952, -0.038,
+943, 954, -0.064,
+943, 957, -0.064,
+943, 959, -0.032,
+943, 962, -0.032,
+943, 963, -0.032,
+943, 964, -0.096,
+943, 967, -0.064,
+943, 972, -0.032,
+943, 993, -0.192,
+943, 8000, -0.032,
+943, 8001, -0.032,
+943, 8004, -0.032,
+943, 8005, -0.032,
+943, 8056, -0.032,
+944, 952, -0.032,
+944, 956, -0.013,
+944, 957, -0.045,
+944, 967, -0.032,
+944, 968, 0.032,
+944, 993, -0.192,
+945, 947, -0.096,
+945, 952, -0.096,
+945, 957, -0.109,
+945, 959, -0.032,
+945, 960, -0.051,
+945, 964, -0.096,
+945, 965, -0.096,
+945, 967, -0.096,
+945, 968, -0.032,
+945, 972, -0.032,
+945, 973, -0.096,
+945, 993, -0.255,
+945, 8016, -0.096,
+945, 8018, -0.096,
+945, 8020, -0.096,
+945, 8021, -0.096,
+945, 8022, -0.096,
+945, 8023, -0.096,
+945, 8056, -0.032,
+945, 8058, -0.096,
+945, 8166, -0.096,
+946, 941, 0.032,
+946, 943, 0.032,
+946, 949, 0.032,
+946, 953, 0.032,
+946, 959, 0.032,
+946, 964, 0.032,
+946, 966, 0.032,
+946, 967, -0.032,
+946, 968, 0.064,
+946, 972, 0.032,
+946, 993, -0.064,
+946, 8050, 0.032,
+946, 8054, 0.032,
+946, 8056, 0.032,
+946, 8150, 0.032,
+947, 967, 0.019,
+947, 993, -0.192,
+948, 940, -0.032,
+948, 945, -0.032,
+948, 947, -0.096,
+948, 956, -0.051,
+948, 957, -0.045,
+948, 960, -0.032,
+948, 965, -0.032,
+948, 967, -0.019,
+948, 973, -0.032,
+948, 993, -0.192,
+948, 8048, -0.032,
+948, 8058, -0.032,
+948, 8114, -0.032,
+948, 8115, -0.032,
+948, 8116, -0.032,
+948, 8118, -0.032,
+948, 8119, -0.032,
+948, 8166, -0.032,
+949, 940, -0.032,
+949, 945, -0.032,
+949, 948, -0.032,
+949, 963, -0.032,
+949, 965, -0.032,
+949, 967, -0.01,
+949, 973, -0.032,
+949, 993, -0.192,
+949, 8048, -0.032,
+949, 8058, -0.032,
+949, 8114, -0.032,
+949, 8115, -0.032,
+949, 8116, -0.032,
+949, 8118, -0.032,
+949, 8119, -0.032,
+949, 8166, -0.032,
+950, 940, -0.096,
+950, 941, -0.096,
+950, 942, -0.096,
+950, 945, -0.096,
+950, 947, -0.128,
+950, 948, -0.064,
+950, 949, -0.096,
+950, 951, -0.096,
+950, 952, -0.064,
+950, 956, -0.064,
+950, 957, -0.102,
+950, 959, -0.096,
+950, 960, -0.096,
+950, 963, -0.096,
+950, 964, -0.096,
+950, 965, -0.096,
+950, 966, -0.096,
+950, 967, -0.096,
+950, 968, -0.032,
+950, 969, -0.096,
+950, 972, -0.096,
+950, 973, -0.096,
+950, 974, -0.096,
+950, 993, -0.064,
+950, 8048, -0.096,
+950, 8050, -0.096,
+950, 8052, -0.096,
+950, 8056, -0.096,
+950, 8058, -0.096,
+950, 8060, -0.096,
+950, 8114, -0.096,
+950, 8115, -0.096,
+950, 8116, -0.096,
+950, 8118, -0.096,
+950, 8119, -0.096,
+950, 8130, -0.096,
+950, 8131, -0.096,
+950, 8132, -0.096,
+950, 8134, -0.096,
+950, 8135, -0.096,
+950, 8166, -0.096,
+950, 8178, -0.096,
+950, 8179, -0.096,
+950, 8180, -0.096,
+950, 8182, -0.096,
+950, 8183, -0.096,
+951, 957, -0.032,
+951, 965, -0.032,
+951, 973, -0.032,
+951, 993, -0.192,
+951, 8058, -0.032,
+951, 8166, -0.032,
+952, 941, 0.032,
+952, 943, 0.032,
+952, 949, 0.032,
+952, 953, 0.032,
+952, 968, 0.032,
+952, 993, -0.064,
+952, 8050, 0.032,
+952, 8054, 0.032,
+952, 8150, 0.032,
+953, 947, -0.08,
+953, 951, -0.019,
+953, 952, -0.038,
+953, 954, -0.064,
+953, 957, -0.064,
+953, 959, -0.032,
+953, 962, -0.032,
+953, 963, -0.032,
+953, 964, -0.096,
+953, 967, -0.064,
+953, 972, -0.032,
+953, 993, -0.192,
+953, 8000, -0.032,
+953, 8001, -0.032,
+953, 8004, -0.032,
+953, 8005, -0.032,
+953, 8056, -0.032,
+954, 946, 0.032,
+954, 957, -0.032,
+954, 993, -0.192,
+955, 940, -0.016,
+955, 945, -0.016,
+955, 947, -0.16,
+955, 952, -0.051,
+955, 956, 0.016,
+955, 957, -0.096,
+955, 963, -0.032,
+955, 964, -0.032,
+955, 965, -0.064,
+955, 967, -0.064,
+955, 973, -0.064,
+955, 993, -0.192,
+955, 8048, -0.016,
+955, 8058, -0.064,
+955, 8114, -0.016,
+955, 8115, -0.016,
+955, 8116, -0.016,
+955, 8118, -0.016,
+955, 8119, -0.016,
+955, 8166, -0.064,
+956, 940, -0.064,
+956, 945, -0.064,
+956, 947, -0.096,
+956, 950, -0.032,
+956, 952, -0.07,
+956, 957, -0.096,
+956, 959, -0.032,
+956, 960, -0.032,
+956, 963, -0.032,
+956, 965, -0.064,
+956, 966, -0.032,
+956, 967, -0.067,
+956, 969, -0.032,
+956, 972, -0.032,
+956, 973, -0.064,
+956, 974, -0.032,
+956, 993, -0.255,
+956, 8048, -0.064,
+956, 8056, -0.032,
+956, 8058, -0.064,
+956, 8060, -0.032,
+956, 8114, -0.064,
+956, 8115, -0.064,
+956, 8116, -0.064,
+956, 8118, -0.064,
+956, 8119, -0.064,
+956, 8166, -0.064,
+956, 8178, -0.032,
+956, 8179, -0.032,
+956, 8180, -0.032,
+956, 8182, -0.032,
+956, 8183, -0.032,
+957, 940, -0.026,
+957, 945, -0.026,
+957, 955, -0.051,
+957, 957, -0.032,
+957, 959, -0.032,
+957, 961, -0.006,
+957, 969, 0.01,
+957, 972, -0.032,
+957, 974, 0.01,
+957, 993, -0.192,
+957, 8048, -0.026,
+957, 8056, -0.032,
+957, 8060, 0.01,
+957, 8114, -0.026,
+957, 8115, -0.026,
+957, 8116, -0.026,
+957, 8118, -0.026,
+957, 8119, -0.026,
+957, 8178, 0.01,
+957, 8179, 0.01,
+957, 8180, 0.01,
+957, 8182, 0.01,
+957, 8183, 0.01,
+958, 940, -0.032,
+958, 941, -0.064,
+958, 945, -0.032,
+958, 947, -0.045,
+958, 949, -0.064,
+958, 959, -0.064,
+958, 963, -0.064,
+958, 964, -0.032,
+958, 965, -0.032,
+958, 966, -0.045,
+958, 967, -0.032,
+958, 972, -0.064,
+958, 973, -0.032,
+958, 993, -0.064,
+958, 8048, -0.032,
+958, 8050, -0.064,
+958, 8056, -0.064,
+958, 8058, -0.032,
+958, 8114, -0.032,
+958, 8115, -0.032,
+958, 8116, -0.032,
+958, 8118, -0.032,
+958, 8119, -0.032,
+958, 8166, -0.032,
+959, 947, -0.032,
+959, 955, -0.032,
+959, 956, -0.013,
+959, 957, -0.045,
+959, 964, -0.038,
+959, 965, -0.064,
+959, 967, -0.032,
+959, 973, -0.064,
+959, 993, -0.192,
+959, 8058, -0.064,
+959, 8166, -0.064,
+960, 943, 0.032,
+960, 953, 0.032,
+960, 954, 0.032,
+960, 959, -0.064,
+960, 968, 0.032,
+960, 972, -0.064,
+960, 993, -0.192,
+960, 8054, 0.032,
+960, 8056, -0.064,
+960, 8150, 0.032,
+961, 943, 0.032,
+961, 947, -0.064,
+961, 950, 0.032,
+961, 953, 0.032,
+961, 957, -0.057,
+961, 959, 0.032,
+961, 963, 0.032,
+961, 967, -0.013,
+961, 968, 0.019,
+961, 972, 0.032,
+961, 993, -0.192,
+961, 8054, 0.032,
+961, 8056, 0.032,
+961, 8150, 0.032,
+963, 940, -0.051,
+963, 945, -0.051,
+963, 959, -0.032,
+963, 961, -0.032,
+963, 969, -0.032,
+963, 972, -0.032,
+963, 974, -0.032,
+963, 993, -0.192,
+963, 8048, -0.051,
+963, 8056, -0.032,
+963, 8060, -0.032,
+963, 8114, -0.051,
+963, 8115, -0.051,
+963, 8116, -0.051,
+963, 8118, -0.051,
+963, 8119, -0.051,
+963, 8164, -0.032,
+963, 8165, -0.032,
+963, 8178, -0.032,
+963, 8179, -0.032,
+963, 8180, -0.032,
+963, 8182, -0.032,
+963, 8183, -0.032,
+964, 940, -0.032,
+964, 941, -0.032,
+964, 945, -0.032,
+964, 949, -0.032,
+964, 959, -0.032,
+964, 967, -0.032,
+964, 969, -0.032,
+964, 972, -0.032,
+964, 974, -0.032,
+964, 993, -0.192,
+964, 8048, -0.032,
+964, 8050, -0.032,
+964, 8056, -0.032,
+964, 8060, -0.032,
+964, 8114, -0.032,
+964, 8115, -0.032,
+964, 8116, -0.032,
+964, 8118, -0.032,
+964, 8119, -0.032,
+964, 8178, -0.032,
+964, 8179, -0.032,
+964, 8180, -0.032,
+964, 8182, -0.032,
+964, 8183, -0.032,
+965, 952, -0.032,
+965, 956, -0.013,
+965, 957, -0.045,
+965, 967, -0.032,
+965, 968, 0.032,
+965, 993, -0.192,
+966, 942, -0.032,
+966, 947, -0.064,
+966, 951, -0.032,
+966, 956, -0.045,
+966, 957, -0.045,
+966, 964, -0.032,
+966, 965, -0.064,
+966, 967, -0.013,
+966, 973, -0.064,
+966, 993, -0.192,
+966, 8052, -0.032,
+966, 8058, -0.064,
+966, 8130, -0.032,
+966, 8131, -0.032,
+966, 8132, -0.032,
+966, 8134, -0.064,
+966, 8135, -0.064,
+966, 8166, -0.064,
+967, 940, -0.077,
+967, 941, -0.032,
+967, 942, -0.067,
+967, 943, -0.032,
+967, 945, -0.077,
+967, 947, -0.051,
+967, 948, -0.077,
+967, 949, -0.032,
+967, 951, -0.067,
+967, 952, -0.064,
+967, 953, -0.032,
+967, 954, -0.064,
+967, 955, -0.077,
+967, 957, -0.096,
+967, 958, -0.051,
+967, 959, -0.096,
+967, 960, -0.051,
+967, 961, -0.051,
+967, 963, -0.045,
+967, 964, -0.051,
+967, 965, -0.051,
+967, 966, -0.096,
+967, 968, -0.032,
+967, 969, -0.077,
+967, 972, -0.096,
+967, 973, -0.051,
+967, 974, -0.077,
+967, 993, -0.192,
+967, 8048, -0.077,
+967, 8050, -0.032,
+967, 8052, -0.067,
+967, 8054, -0.032,
+967, 8056, -0.096,
+967, 8058, -0.051,
+967, 8060, -0.077,
+967, 8114, -0.077,
+967, 8115, -0.077,
+967, 8116, -0.077,
+967, 8118, -0.077,
+967, 8119, -0.077,
+967, 8130, -0.067,
+967, 8131, -0.067,
+967, 8132, -0.067,
+967, 8134, -0.067,
+967, 8135, -0.067,
+967, 8150, -0.032,
+967, 8166, -0.051,
+967, 8178, -0.077,
+967, 8179, -0.077,
+967, 8180, -0.077,
+967, 8182, -0.077,
+967, 8183, -0.077,
+968, 947, -0.045,
+968, 965, -0.064,
+968, 967, -0.006,
+968, 973, -0.064,
+968, 993, -0.192,
+968, 8058, -0.064,
+968, 8166, -0.064,
+969, 941, 0.032,
+969, 947, -0.128,
+969, 949, 0.032,
+969, 956, -0.032,
+969, 957, -0.032,
+969, 958, 0.032,
+969, 964, -0.054,
+969, 965, -0.032,
+969, 967, -0.032,
+969, 973, -0.032,
+969, 993, -0.192,
+969, 8050, 0.032,
+969, 8058, -0.032,
+969, 8166, -0.032,
+970, 947, -0.08,
+970, 951, -0.019,
+970, 952, -0.038,
+970, 954, -0.064,
+970, 957, -0.064,
+970, 959, -0.032,
+970, 962, -0.032,
+970, 963, -0.032,
+970, 964, -0.096,
+970, 967, -0.064,
+970, 972, -0.032,
+970, 993, -0.192,
+970, 8000, -0.032,
+970, 8001, -0.032,
+970, 8004, -0.032,
+970, 8005, -0.032,
+970, 8056, -0.032,
+971, 952, -0.032,
+971, 956, -0.013,
+971, 957, -0.045,
+971, 967, -0.032,
+971, 968, 0.032,
+971, 993, -0.192,
+972, 947, -0.032,
+972, 955, -0.032,
+972, 956, -0.013,
+972, 957, -0.045,
+972, 964, -0.038,
+972, 965, -0.064,
+972, 967, -0.032,
+972, 973, -0.064,
+972, 993, -0.192,
+972, 8058, -0.064,
+972, 8166, -0.064,
+973, 952, -0.032,
+973, 956, -0.013,
+973, 957, -0.045,
+973, 967, -0.032,
+973, 968, 0.032,
+973, 993, -0.192,
+974, 941, 0.032,
+974, 947, -0.128,
+974, 949, 0.032,
+974, 956, -0.032,
+974, 957, -0.032,
+974, 958, 0.032,
+974, 964, -0.054,
+974, 965, -0.032,
+974, 967, -0.032,
+974, 973, -0.032,
+974, 8050, 0.032,
+974, 8058, -0.032,
+974, 8166, -0.032,
+985, 993, -0.255,
+987, 993, -0.192,
+991, 993, -0.192,
+993, 993, -0.192,
+7936, 947, -0.096,
+7936, 952, -0.096,
+7936, 957, -0.096,
+7936, 959, -0.032,
+7936, 960, -0.051,
+7936, 964, -0.096,
+7936, 965, -0.096,
+7936, 967, -0.096,
+7936, 968, -0.032,
+7936, 972, -0.032,
+7936, 973, -0.096,
+7936, 8056, -0.032,
+7936, 8058, -0.096,
+7937, 947, -0.096,
+7937, 952, -0.096,
+7937, 957, -0.096,
+7937, 959, -0.032,
+7937, 960, -0.051,
+7937, 964, -0.096,
+7937, 965, -0.096,
+7937, 967, -0.096,
+7937, 968, -0.032,
+7937, 972, -0.032,
+7937, 973, -0.096,
+7937, 8056, -0.032,
+7937, 8058, -0.096,
+7938, 947, -0.096,
+7938, 952, -0.096,
+7938, 957, -0.096,
+7938, 959, -0.032,
+7938, 960, -0.051,
+7938, 964, -0.096,
+7938, 965, -0.096,
+7938, 967, -0.096,
+7938, 968, -0.032,
+7938, 972, -0.032,
+7938, 973, -0.096,
+7938, 8056, -0.032,
+7938, 8058, -0.096,
+7939, 947, -0.096,
+7939, 952, -0.096,
+7939, 957, -0.096,
+7939, 959, -0.032,
+7939, 960, -0.051,
+7939, 964, -0.096,
+7939, 965, -0.096,
+7939, 967, -0.096,
+7939, 968, -0.032,
+7939, 972, -0.032,
+7939, 973, -0.096,
+7939, 8056, -0.032,
+7939, 8058, -0.096,
+7940, 947, -0.096,
+7940, 952, -0.096,
+7940, 957, -0.096,
+7940, 959, -0.032,
+7940, 960, -0.051,
+7940, 964, -0.096,
+7940, 965, -0.096,
+7940, 967, -0.096,
+7940, 968, -0.032,
+7940, 972, -0.032,
+7940, 973, -0.096,
+7940, 8056, -0.032,
+7940, 8058, -0.096,
+7941, 947, -0.096,
+7941, 952, -0.096,
+7941, 957, -0.051,
+7941, 959, -0.032,
+7941, 960, -0.051,
+7941, 964, -0.096,
+7941, 965, -0.096,
+7941, 967, -0.096,
+7941, 968, -0.032,
+7941, 972, -0.032,
+7941, 973, -0.096,
+7941, 8056, -0.032,
+7941, 8058, -0.096,
+7942, 947, -0.096,
+7942, 952, -0.096,
+7942, 957, -0.096,
+7942, 959, -0.032,
+7942, 960, -0.051,
+7942, 964, -0.096,
+7942, 965, -0.096,
+7942, 967, -0.096,
+7942, 968, -0.032,
+7942, 972, -0.032,
+7942, 973, -0.096,
+7942, 8056, -0.032,
+7942, 8058, -0.096,
+7943, 947, -0.096,
+7943, 952, -0.096,
+7943, 957, -0.096,
+7943, 959, -0.032,
+7943, 960, -0.051,
+7943, 964, -0.096,
+7943, 965, -0.096,
+7943, 967, -0.096,
+7943, 968, -0.032,
+7943, 972, -0.032,
+7943, 973, -0.096,
+7943, 8056, -0.032,
+7943, 8058, -0.096,
+7952, 940, -0.032,
+7952, 945, -0.032,
+7952, 948, -0.032,
+7952, 963, -0.032,
+7952, 965, -0.032,
+7952, 967, -0.01,
+7952, 973, -0.032,
+7952, 993, -0.192,
+7952, 8048, -0.032,
+7952, 8058, -0.032,
+7952, 8114, -0.032,
+7952, 8115, -0.032,
+7952, 8116, -0.032,
+7952, 8118, -0.032,
+7952, 8119, -0.032,
+7952, 8166, -0.032,
+7953, 940, -0.032,
+7953, 945, -0.032,
+7953, 948, -0.032,
+7953, 963, -0.032,
+7953, 965, -0.032,
+7953, 967, -0.01,
+7953, 973, -0.032,
+7953, 993, -0.192,
+7953, 8048, -0.032,
+7953, 8058, -0.032,
+7953, 8114, -0.032,
+7953, 8115, -0.032,
+7953, 8116, -0.032,
+7953, 8118, -0.032,
+7953, 8119, -0.032,
+7953, 8166, -0.032,
+7954, 940, -0.032,
+7954, 945, -0.032,
+7954, 948, -0.032,
+7954, 963, -0.032,
+7954, 965, -0.032,
+7954, 967, -0.01,
+7954, 973, -0.032,
+7954, 993, -0.192,
+7954, 8048, -0.032,
+7954, 8058, -0.032,
+7954, 8114, -0.032,
+7954, 8115, -0.032,
+7954, 8116, -0.032,
+7954, 8118, -0.032,
+7954, 8119, -0.032,
+7954, 8166, -0.032,
+7955, 940, -0.032,
+7955, 945, -0.032,
+7955, 948, -0.032,
+7955, 963, -0.032,
+7955, 965, -0.032,
+7955, 967, -0.01,
+7955, 973, -0.032,
+7955, 993, -0.192,
+7955, 8048, -0.032,
+7955, 8058, -0.032,
+7955, 8114, -0.032,
+7955, 8115, -0.032,
+7955, 8116, -0.032,
+7955, 8118, -0.032,
+7955, 8119, -0.032,
+7955, 8166, -0.032,
+7956, 940, -0.032,
+7956, 945, -0.032,
+7956, 948, -0.032,
+7956, 963, -0.032,
+7956, 965, -0.032,
+7956, 967, -0.01,
+7956, 973, -0.032,
+7956, 993, -0.192,
+7956, 8048, -0.032,
+7956, 8058, -0.032,
+7956, 8114, -0.032,
+7956, 8115, -0.032,
+7956, 8116, -0.032,
+7956, 8118, -0.032,
+7956, 8119, -0.032,
+7956, 8166, -0.032,
+7957, 940, -0.032,
+7957, 945, -0.032,
+7957, 948, -0.032,
+7957, 963, -0.032,
+7957, 965, -0.032,
+7957, 967, -0.01,
+7957, 973, -0.032,
+7957, 993, -0.192,
+7957, 8048, -0.032,
+7957, 8058, -0.032,
+7957, 8114, -0.032,
+7957, 8115, -0.032,
+7957, 8116, -0.032,
+7957, 8118, -0.032,
+7957, 8119, -0.032,
+7957, 8166, -0.032,
+7968, 957, -0.032,
+7968, 965, -0.032,
+7968, 973, -0.032,
+7968, 8058, -0.032,
+7968, 8166, -0.032,
+7969, 957, -0.032,
+7969, 965, -0.032,
+7969, 973, -0.032,
+7969, 8058, -0.032,
+7969, 8166, -0.032,
+7970, 957, -0.032,
+7970, 965, -0.032,
+7970, 973, -0.032,
+7970, 8058, -0.032,
+7970, 8166, -0.032,
+7971, 957, -0.032,
+7971, 965, -0.032,
+7971, 973, -0.032,
+7971, 8058, -0.032,
+7971, 8166, -0.032,
+7972, 957, -0.032,
+7972, 965, -0.032,
+7972, 973, -0.032,
+7972, 8058, -0.032,
+7972, 8166, -0.032,
+7973, 957, -0.032,
+7973, 965, -0.032,
+7973, 973, -0.032,
+7973, 8058, -0.032,
+7973, 8166, -0.032,
+7974, 957, -0.032,
+7974, 965, -0.032,
+7974, 973, -0.032,
+7974, 8058, -0.032,
+7974, 8166, -0.032,
+7975, 957, -0.032,
+7975, 965, -0.032,
+7975, 973, -0.032,
+7975, 8058, -0.032,
+7975, 8166, -0.032,
+7984, 947, -0.08,
+7984, 951, -0.019,
+7984, 952, -0.038,
+7984, 954, -0.064,
+7984, 957, -0.064,
+7984, 959, -0.032,
+7984, 962, -0.032,
+7984, 963, -0.032,
+7984, 964, -0.096,
+7984, 967, -0.064,
+7984, 972, -0.032,
+7984, 993, -0.192,
+7984, 8000, -0.032,
+7984, 8001, -0.032,
+7984, 8004, -0.032,
+7984, 8005, -0.032,
+7984, 8056, -0.032,
+7985, 947, -0.08,
+7985, 951, -0.019,
+7985, 952, -0.038,
+7985, 954, -0.064,
+7985, 957, -0.064,
+7985, 959, -0.032,
+7985, 962, -0.032,
+7985, 963, -0.032,
+7985, 964, -0.096,
+7985, 967, -0.064,
+7985, 972, -0.032,
+7985, 993, -0.192,
+7985, 8000, -0.032,
+7985, 8001, -0.032,
+7985, 8004, -0.032,
+7985, 8005, -0.032,
+7985, 8056, -0.032,
+7988, 947, -0.08,
+7988, 951, -0.019,
+7988, 952, -0.038,
+7988, 954, -0.064,
+7988, 957, -0.064,
+7988, 959, -0.032,
+7988, 962, -0.032,
+7988, 963, -0.032,
+7988, 964, -0.096,
+7988, 967, -0.064,
+7988, 972, -0.032,
+7988, 993, -0.192,
+7988, 8000, -0.032,
+7988, 8001, -0.032,
+7988, 8004, -0.032,
+7988, 8005, -0.032,
+7988, 8056, -0.032,
+7989, 947, -0.08,
+7989, 951, -0.019,
+7989, 952, -0.038,
+7989, 954, -0.064,
+7989, 957, -0.064,
+7989, 959, -0.032,
+7989, 962, -0.032,
+7989, 963, -0.032,
+7989, 964, -0.096,
+7989, 967, -0.064,
+7989, 972, -0.032,
+7989, 993, -0.192,
+7989, 8000, -0.032,
+7989, 8001, -0.032,
+7989, 8004, -0.032,
+7989, 8005, -0.032,
+7989, 8056, -0.032,
+7990, 947, -0.08,
+7990, 951, -0.019,
+7990, 952, -0.038,
+7990, 954, -0.064,
+7990, 957, -0.064,
+7990, 959, -0.032,
+7990, 962, -0.032,
+7990, 963, -0.032,
+7990, 964, -0.096,
+7990, 967, -0.064,
+7990, 972, -0.032,
+7990, 993, -0.192,
+7990, 8000, -0.032,
+7990, 8001, -0.032,
+7990, 8004, -0.032,
+7990, 8005, -0.032,
+7990, 8056, -0.032,
+7991, 947, -0.08,
+7991, 951, -0.019,
+7991, 952, -0.038,
+7991, 954, -0.064,
+7991, 957, -0.064,
+7991, 959, -0.032,
+7991, 962, -0.032,
+7991, 963, -0.032,
+7991, 964, -0.096,
+7991, 967, -0.064,
+7991, 972, -0.032,
+7991, 993, -0.192,
+7991, 8000, -0.032,
+7991, 8001, -0.032,
+7991, 8004, -0.032,
+7991, 8005, -0.032,
+7991, 8056, -0.032,
+8000, 947, -0.032,
+8000, 955, -0.032,
+8000, 956, -0.013,
+8000, 957, -0.045,
+8000, 964, -0.038,
+8000, 965, -0.064,
+8000, 967, -0.032,
+8000, 973, -0.064,
+8000, 993, -0.192,
+8000, 8058, -0.064,
+8000, 8166, -0.064,
+8001, 947, -0.032,
+8001, 955, -0.032,
+8001, 956, -0.013,
+8001, 957, -0.045,
+8001, 964, -0.038,
+8001, 965, -0.064,
+8001, 967, -0.032,
+8001, 973, -0.064,
+8001, 993, -0.192,
+8001, 8058, -0.064,
+8001, 8166, -0.064,
+8002, 947, -0.032,
+8002, 955, -0.032,
+8002, 956, -0.013,
+8002, 957, -0.045,
+8002, 964, -0.038,
+8002, 965, -0.064,
+8002, 967, -0.032,
+8002, 973, -0.064,
+8002, 993, -0.192,
+8002, 8058, -0.064,
+8002, 8166, -0.064,
+8003, 947, -0.032,
+8003, 955, -0.032,
+8003, 956, -0.013,
+8003, 957, -0.045,
+8003, 964, -0.038,
+8003, 965, -0.064,
+8003, 967, -0.032,
+8003, 973, -0.064,
+8003, 993, -0.192,
+8003, 8058, -0.064,
+8003, 8166, -0.064,
+8004, 947, -0.032,
+8004, 955, -0.032,
+8004, 956, -0.013,
+8004, 957, -0.045,
+8004, 964, -0.038,
+8004, 965, -0.064,
+8004, 967, -0.032,
+8004, 973, -0.064,
+8004, 993, -0.192,
+8004, 8058, -0.064,
+8004, 8166, -0.064,
+8005, 947, -0.032,
+8005, 955, -0.032,
+8005, 956, -0.013,
+8005, 957, -0.045,
+8005, 964, -0.038,
+8005, 965, -0.064,
+8005, 967, -0.032,
+8005, 973, -0.064,
+8005, 993, -0.192,
+8005, 8058, -0.064,
+8005, 8166, -0.064,
+8016, 952, -0.032,
+8016, 956, -0.013,
+8016, 957, -0.045,
+8016, 967, -0.032,
+8016, 968, 0.032,
+8016, 993, -0.192,
+8017, 952, -0.032,
+8017, 956, -0.013,
+8017, 957, -0.045,
+8017, 967, -0.032,
+8017, 968, 0.032,
+8017, 993, -0.192,
+8018, 952, -0.032,
+8018, 956, -0.013,
+8018, 957, -0.045,
+8018, 967, -0.032,
+8018, 968, 0.032,
+8018, 993, -0.192,
+8019, 952, -0.032,
+8019, 956, -0.013,
+8019, 957, -0.045,
+8019, 967, -0.032,
+8019, 968, 0.032,
+8019, 993, -0.192,
+8020, 952, -0.032,
+8020, 956, -0.013,
+8020, 957, -0.045,
+8020, 967, -0.032,
+8020, 968, 0.032,
+8020, 993, -0.192,
+8021, 952, -0.032,
+8021, 956, -0.013,
+8021, 957, -0.045,
+8021, 967, -0.032,
+8021, 968, 0.032,
+8021, 993, -0.192,
+8022, 952, -0.032,
+8022, 956, -0.013,
+8022, 957, -0.045,
+8022, 967, -0.032,
+8022, 968, 0.032,
+8022, 993, -0.192,
+8023, 952, -0.032,
+8023, 956, -0.013,
+8023, 957, -0.045,
+8023, 967, -0.032,
+8023, 968, 0.032,
+8023, 993, -0.192,
+8032, 941, 0.032,
+8032, 947, -0.128,
+8032, 949, 0.032,
+8032, 956, -0.032,
+8032, 957, -0.032,
+8032, 958, 0.032,
+8032, 964, -0.054,
+8032, 965, -0.032,
+8032, 967, -0.032,
+8032, 973, -0.032,
+8032, 8050, 0.032,
+8032, 8058, -0.032,
+8032, 8166, -0.032,
+8033, 941, 0.032,
+8033, 947, -0.128,
+8033, 949, 0.032,
+8033, 956, -0.032,
+8033, 957, -0.032,
+8033, 958, 0.032,
+8033, 964, -0.054,
+8033, 965, -0.032,
+8033, 967, -0.032,
+8033, 973, -0.032,
+8033, 8050, 0.032,
+8033, 8058, -0.032,
+8033, 8166, -0.032,
+8034, 941, 0.032,
+8034, 947, -0.128,
+8034, 949, 0.032,
+8034, 956, -0.032,
+8034, 957, -0.032,
+8034, 958, 0.032,
+8034, 964, -0.054,
+8034, 965, -0.032,
+8034, 967, -0.032,
+8034, 973, -0.032,
+8034, 8050, 0.032,
+8034, 8058, -0.032,
+8034, 8166, -0.032,
+8035, 941, 0.032,
+8035, 947, -0.128,
+8035, 949, 0.032,
+8035, 956, -0.032,
+8035, 957, -0.032,
+8035, 958, 0.032,
+8035, 964, -0.054,
+8035, 965, -0.032,
+8035, 967, -0.032,
+8035, 973, -0.032,
+8035, 8050, 0.032,
+8035, 8058, -0.032,
+8035, 8166, -0.032,
+8036, 941, 0.032,
+8036, 947, -0.128,
+8036, 949, 0.032,
+8036, 956, -0.032,
+8036, 957, -0.032,
+8036, 958, 0.032,
+8036, 964, -0.054,
+8036, 965, -0.032,
+8036, 967, -0.032,
+8036, 973, -0.032,
+8036, 8050, 0.032,
+8036, 8058, -0.032,
+8036, 8166, -0.032,
+8037, 941, 0.032,
+8037, 947, -0.128,
+8037, 949, 0.032,
+8037, 956, -0.032,
+8037, 957, -0.032,
+8037, 958, 0.032,
+8037, 964, -0.054,
+8037, 965, -0.032,
+8037, 967, -0.032,
+8037, 973, -0.032,
+8037, 8050, 0.032,
+8037, 8058, -0.032,
+8037, 8166, -0.032,
+8038, 941, 0.032,
+8038, 947, -0.128,
+8038, 949, 0.032,
+8038, 956, -0.032,
+8038, 957, -0.032,
+8038, 958, 0.032,
+8038, 964, -0.054,
+8038, 965, -0.032,
+8038, 967, -0.032,
+8038, 973, -0.032,
+8038, 8050, 0.032,
+8038, 8058, -0.032,
+8038, 8166, -0.032,
+8039, 941, 0.032,
+8039, 947, -0.128,
+8039, 949, 0.032,
+8039, 956, -0.032,
+8039, 957, -0.032,
+8039, 958, 0.032,
+8039, 964, -0.054,
+8039, 965, -0.032,
+8039, 967, -0.032,
+8039, 973, -0.032,
+8039, 8050, 0.032,
+8039, 8058, -0.032,
+8039, 8166, -0.032,
+8048, 947, -0.096,
+8048, 952, -0.096,
+8048, 957, -0.096,
+8048, 959, -0.032,
+8048, 960, -0.051,
+8048, 964, -0.096,
+8048, 965, -0.096,
+8048, 967, -0.096,
+8048, 968, -0.032,
+8048, 972, -0.032,
+8048, 973, -0.096,
+8048, 8056, -0.032,
+8048, 8058, -0.096,
+8050, 940, -0.032,
+8050, 945, -0.032,
+8050, 948, -0.032,
+8050, 963, -0.032,
+8050, 965, -0.032,
+8050, 967, -0.01,
+8050, 973, -0.032,
+8050, 993, -0.192,
+8050, 8048, -0.032,
+8050, 8058, -0.032,
+8050, 8114, -0.032,
+8050, 8115, -0.032,
+8050, 8116, -0.032,
+8050, 8118, -0.032,
+8050, 8119, -0.032,
+8050, 8166, -0.032,
+8052, 957, -0.032,
+8052, 965, -0.032,
+8052, 973, -0.032,
+8052, 8058, -0.032,
+8052, 8166, -0.032,
+8054, 947, -0.08,
+8054, 951, -0.019,
+8054, 952, -0.038,
+8054, 954, -0.064,
+8054, 957, -0.064,
+8054, 959, -0.032,
+8054, 962, -0.032,
+8054, 963, -0.032,
+8054, 964, -0.096,
+8054, 967, -0.064,
+8054, 972, -0.032,
+8054, 993, -0.192,
+8054, 8000, -0.032,
+8054, 8001, -0.032,
+8054, 8004, -0.032,
+8054, 8005, -0.032,
+8054, 8056, -0.032,
+8056, 947, -0.032,
+8056, 955, -0.032,
+8056, 956, -0.013,
+8056, 957, -0.045,
+8056, 964, -0.038,
+8056, 965, -0.064,
+8056, 967, -0.032,
+8056, 973, -0.064,
+8056, 993, -0.192,
+8056, 8058, -0.064,
+8056, 8166, -0.064,
+8058, 952, -0.032,
+8058, 956, -0.013,
+8058, 957, -0.045,
+8058, 967, -0.032,
+8058, 968, 0.032,
+8058, 993, -0.192,
+8060, 941, 0.032,
+8060, 947, -0.128,
+8060, 949, 0.032,
+8060, 956, -0.032,
+8060, 957, -0.032,
+8060, 958, 0.032,
+8060, 964, -0.054,
+8060, 965, -0.032,
+8060, 967, -0.032,
+8060, 973, -0.032,
+8060, 8050, 0.032,
+8060, 8058, -0.032,
+8060, 8166, -0.032,
+8064, 947, -0.096,
+8064, 952, -0.096,
+8064, 957, -0.096,
+8064, 959, -0.032,
+8064, 960, -0.051,
+8064, 964, -0.096,
+8064, 965, -0.096,
+8064, 967, -0.096,
+8064, 968, -0.032,
+8064, 972, -0.032,
+8064, 973, -0.096,
+8064, 8056, -0.032,
+8064, 8058, -0.096,
+8065, 947, -0.096,
+8065, 952, -0.096,
+8065, 957, -0.096,
+8065, 959, -0.032,
+8065, 960, -0.051,
+8065, 964, -0.096,
+8065, 965, -0.096,
+8065, 967, -0.096,
+8065, 968, -0.032,
+8065, 972, -0.032,
+8065, 973, -0.096,
+8065, 8056, -0.032,
+8065, 8058, -0.096,
+8066, 947, -0.096,
+8066, 952, -0.096,
+8066, 957, -0.096,
+8066, 959, -0.032,
+8066, 960, -0.051,
+8066, 964, -0.096,
+8066, 965, -0.096,
+8066, 967, -0.096,
+8066, 968, -0.032,
+8066, 972, -0.032,
+8066, 973, -0.096,
+8066, 8056, -0.032,
+8066, 8058, -0.096,
+8067, 947, -0.096,
+8067, 952, -0.096,
+8067, 957, -0.096,
+8067, 959, -0.032,
+8067, 960, -0.051,
+8067, 964, -0.096,
+8067, 965, -0.096,
+8067, 967, -0.096,
+8067, 968, -0.032,
+8067, 972, -0.032,
+8067, 973, -0.096,
+8067, 8056, -0.032,
+8067, 8058, -0.096,
+8068, 947, -0.096,
+8068, 952, -0.096,
+8068, 957, -0.096,
+8068, 959, -0.032,
+8068, 960, -0.051,
+8068, 964, -0.096,
+8068, 965, -0.096,
+8068, 967, -0.096,
+8068, 968, -0.032,
+8068, 972, -0.032,
+8068, 973, -0.096,
+8068, 8056, -0.032,
+8068, 8058, -0.096,
+8069, 947, -0.096,
+8069, 952, -0.096,
+8069, 957, -0.051,
+8069, 959, -0.032,
+8069, 960, -0.051,
+8069, 964, -0.096,
+8069, 965, -0.096,
+8069, 967, -0.096,
+8069, 968, -0.032,
+8069, 972, -0.032,
+8069, 973, -0.096,
+8069, 8056, -0.032,
+8069, 8058, -0.096,
+8070, 947, -0.096,
+8070, 952, -0.096,
+8070, 957, -0.096,
+8070, 959, -0.032,
+8070, 960, -0.051,
+8070, 964, -0.096,
+8070, 965, -0.096,
+8070, 967, -0.096,
+8070, 968, -0.032,
+8070, 972, -0.032,
+8070, 973, -0.096,
+8070, 8056, -0.032,
+8070, 8058, -0.096,
+8071, 947, -0.096,
+8071, 952, -0.096,
+8071, 957, -0.096,
+8071, 959, -0.032,
+8071, 960, -0.051,
+8071, 964, -0.096,
+8071, 965, -0.096,
+8071, 967, -0.096,
+8071, 968, -0.032,
+8071, 972, -0.032,
+8071, 973, -0.096,
+8071, 8056, -0.032,
+8071, 8058, -0.096,
+8080, 957, -0.032,
+8080, 965, -0.032,
+8080, 973, -0.032,
+8080, 8058, -0.032,
+8080, 8166, -0.032,
+8081, 957, -0.032,
+8081, 965, -0.032,
+8081, 973, -0.032,
+8081, 8058, -0.032,
+8081, 8166, -0.032,
+8082, 957, -0.032,
+8082, 965, -0.032,
+8082, 973, -0.032,
+8082, 8058, -0.032,
+8082, 8166, -0.032,
+8083, 957, -0.032,
+8083, 965, -0.032,
+8083, 973, -0.032,
+8083, 8058, -0.032,
+8083, 8166, -0.032,
+8084, 957, -0.032,
+8084, 965, -0.032,
+8084, 973, -0.032,
+8084, 8058, -0.032,
+8084, 8166, -0.032,
+8085, 957, -0.032,
+8085, 965, -0.032,
+8085, 973, -0.032,
+8085, 8058, -0.032,
+8085, 8166, -0.032,
+8086, 957, -0.032,
+8086, 965, -0.032,
+8086, 973, -0.032,
+8086, 8058, -0.032,
+8086, 8166, -0.032,
+8087, 957, -0.032,
+8087, 965, -0.032,
+8087, 973, -0.032,
+8087, 8058, -0.032,
+8087, 8166, -0.032,
+8096, 941, 0.032,
+8096, 947, -0.128,
+8096, 949, 0.032,
+8096, 956, -0.032,
+8096, 957, -0.032,
+8096, 958, 0.032,
+8096, 964, -0.054,
+8096, 965, -0.032,
+8096, 967, -0.032,
+8096, 973, -0.032,
+8096, 8050, 0.032,
+8096, 8058, -0.032,
+8096, 8166, -0.032,
+8097, 941, 0.032,
+8097, 947, -0.128,
+8097, 949, 0.032,
+8097, 956, -0.032,
+8097, 957, -0.032,
+8097, 958, 0.032,
+8097, 964, -0.054,
+8097, 965, -0.032,
+8097, 967, -0.032,
+8097, 973, -0.032,
+8097, 8050, 0.032,
+8097, 8058, -0.032,
+8097, 8166, -0.032,
+8098, 941, 0.032,
+8098, 947, -0.128,
+8098, 949, 0.032,
+8098, 956, -0.032,
+8098, 957, -0.032,
+8098, 958, 0.032,
+8098, 964, -0.054,
+8098, 965, -0.032,
+8098, 967, -0.032,
+8098, 973, -0.032,
+8098, 8050, 0.032,
+8098, 8058, -0.032,
+8098, 8166, -0.032,
+8099, 941, 0.032,
+8099, 947, -0.128,
+8099, 949, 0.032,
+8099, 956, -0.032,
+8099, 957, -0.032,
+8099, 958, 0.032,
+8099, 964, -0.054,
+8099, 965, -0.032,
+8099, 967, -0.032,
+8099, 973, -0.032,
+8099, 8050, 0.032,
+8099, 8058, -0.032,
+8099, 8166, -0.032,
+8100, 941, 0.032,
+8100, 947, -0.128,
+8100, 949, 0.032,
+8100, 956, -0.032,
+8100, 957, -0.032,
+8100, 958, 0.032,
+8100, 964, -0.054,
+8100, 965, -0.032,
+8100, 967, -0.032,
+8100, 973, -0.032,
+8100, 8050, 0.032,
+8100, 8058, -0.032,
+8100, 8166, -0.032,
+8101, 941, 0.032,
+8101, 947, -0.128,
+8101, 949, 0.032,
+8101, 956, -0.032,
+8101, 957, -0.032,
+8101, 958, 0.032,
+8101, 964, -0.054,
+8101, 965, -0.032,
+8101, 967, -0.032,
+8101, 973, -0.032,
+8101, 8050, 0.032,
+8101, 8058, -0.032,
+8101, 8166, -0.032,
+8102, 941, 0.032,
+8102, 947, -0.128,
+8102, 949, 0.032,
+8102, 956, -0.032,
+8102, 957, -0.032,
+8102, 958, 0.032,
+8102, 964, -0.054,
+8102, 965, -0.032,
+8102, 967, -0.032,
+8102, 973, -0.032,
+8102, 8050, 0.032,
+8102, 8058, -0.032,
+8102, 8166, -0.032,
+8103, 941, 0.032,
+8103, 947, -0.128,
+8103, 949, 0.032,
+8103, 956, -0.032,
+8103, 957, -0.032,
+8103, 958, 0.032,
+8103, 964, -0.054,
+8103, 965, -0.032,
+8103, 967, -0.032,
+8103, 973, -0.032,
+8103, 8050, 0.032,
+8103, 8058, -0.032,
+8103, 8166, -0.032,
+8114, 947, -0.096,
+8114, 952, -0.096,
+8114, 957, -0.096,
+8114, 959, -0.032,
+8114, 960, -0.051,
+8114, 964, -0.096,
+8114, 965, -0.096,
+8114, 967, -0.096,
+8114, 968, -0.032,
+8114, 972, -0.032,
+8114, 973, -0.096,
+8114, 8056, -0.032,
+8114, 8058, -0.096,
+8115, 947, -0.096,
+8115, 952, -0.096,
+8115, 957, -0.109,
+8115, 959, -0.032,
+8115, 960, -0.051,
+8115, 964, -0.096,
+8115, 965, -0.096,
+8115, 967, -0.096,
+8115, 968, -0.032,
+8115, 972, -0.032,
+8115, 973, -0.096,
+8115, 993, -0.255,
+8115, 8016, -0.096,
+8115, 8018, -0.096,
+8115, 8020, -0.096,
+8115, 8021, -0.096,
+8115, 8022, -0.096,
+8115, 8023, -0.096,
+8115, 8056, -0.032,
+8115, 8058, -0.096,
+8115, 8166, -0.096,
+8116, 947, -0.096,
+8116, 952, -0.096,
+8116, 957, -0.096,
+8116, 959, -0.032,
+8116, 960, -0.051,
+8116, 964, -0.096,
+8116, 965, -0.096,
+8116, 967, -0.096,
+8116, 968, -0.032,
+8116, 972, -0.032,
+8116, 973, -0.096,
+8116, 8056, -0.032,
+8116, 8058, -0.096,
+8118, 947, -0.096,
+8118, 952, -0.096,
+8118, 957, -0.096,
+8118, 959, -0.032,
+8118, 960, -0.051,
+8118, 964, -0.096,
+8118, 965, -0.096,
+8118, 967, -0.096,
+8118, 968, -0.032,
+8118, 972, -0.032,
+8118, 973, -0.096,
+8118, 8056, -0.032,
+8118, 8058, -0.096,
+8119, 947, -0.096,
+8119, 952, -0.096,
+8119, 957, -0.096,
+8119, 959, -0.032,
+8119, 960, -0.051,
+8119, 964, -0.096,
+8119, 965, -0.096,
+8119, 967, -0.096,
+8119, 968, -0.032,
+8119, 972, -0.032,
+8119, 973, -0.096,
+8119, 8056, -0.032,
+8119, 8058, -0.096,
+8124, 920, -0.096,
+8124, 927, -0.096,
+8124, 932, -0.096,
+8124, 933, -0.16,
+8124, 934, -0.096,
+8124, 936, -0.141,
+8124, 939, -0.16,
+8124, 957, -0.112,
+8127, 913, -0.16,
+8127, 927, -0.064,
+8127, 937, -0.032,
+8127, 8124, -0.16,
+8127, 8188, -0.032,
+8128, 913, -0.128,
+8128, 8124, -0.128,
+8130, 957, -0.032,
+8130, 965, -0.032,
+8130, 973, -0.032,
+8130, 8058, -0.032,
+8130, 8166, -0.032,
+8131, 957, -0.032,
+8131, 965, -0.032,
+8131, 973, -0.032,
+8131, 993, -0.192,
+8131, 8058, -0.032,
+8131, 8166, -0.032,
+8132, 957, -0.032,
+8132, 965, -0.032,
+8132, 973, -0.032,
+8132, 8058, -0.032,
+8132, 8166, -0.032,
+8134, 957, -0.032,
+8134, 965, -0.032,
+8134, 973, -0.032,
+8134, 8058, -0.032,
+8134, 8166, -0.032,
+8135, 957, -0.032,
+8135, 965, -0.032,
+8135, 973, -0.032,
+8135, 8058, -0.032,
+8135, 8166, -0.032,
+8141, 913, -0.096,
+8141, 927, -0.032,
+8141, 8124, -0.096,
+8142, 913, -0.096,
+8142, 927, -0.032,
+8142, 8124, -0.096,
+8143, 913, -0.128,
+8143, 8124, -0.128,
+8146, 947, -0.08,
+8146, 951, -0.019,
+8146, 952, -0.038,
+8146, 954, -0.064,
+8146, 957, -0.064,
+8146, 959, -0.032,
+8146, 962, -0.032,
+8146, 963, -0.032,
+8146, 964, -0.096,
+8146, 967, -0.064,
+8146, 972, -0.032,
+8146, 993, -0.192,
+8146, 8000, -0.032,
+8146, 8001, -0.032,
+8146, 8004, -0.032,
+8146, 8005, -0.032,
+8146, 8056, -0.032,
+8150, 947, -0.08,
+8150, 951, -0.019,
+8150, 952, -0.038,
+8150, 954, -0.064,
+8150, 957, -0.064,
+8150, 959, -0.032,
+8150, 962, -0.032,
+8150, 963, -0.032,
+8150, 964, -0.096,
+8150, 967, -0.064,
+8150, 972, -0.032,
+8150, 993, -0.192,
+8150, 8000, -0.032,
+8150, 8001, -0.032,
+8150, 8004, -0.032,
+8150, 8005, -0.032,
+8150, 8056, -0.032,
+8151, 947, -0.08,
+8151, 951, -0.019,
+8151, 952, -0.038,
+8151, 954, -0.064,
+8151, 957, -0.064,
+8151, 959, -0.032,
+8151, 962, -0.032,
+8151, 963, -0.032,
+8151, 964, -0.096,
+8151, 967, -0.064,
+8151, 972, -0.032,
+8151, 993, -0.192,
+8151, 8000, -0.032,
+8151, 8001, -0.032,
+8151, 8004, -0.032,
+8151, 8005, -0.032,
+8151, 8056, -0.032,
+8157, 913, -0.096,
+8157, 927, -0.032,
+8157, 8124, -0.096,
+8158, 913, -0.096,
+8158, 927, -0.032,
+8158, 8124, -0.096,
+8159, 913, -0.128,
+8159, 8124, -0.128,
+8162, 952, -0.032,
+8162, 956, -0.013,
+8162, 957, -0.045,
+8162, 967, -0.032,
+8162, 968, 0.032,
+8162, 993, -0.192,
+8164, 943, 0.032,
+8164, 947, -0.064,
+8164, 950, 0.032,
+8164, 953, 0.032,
+8164, 957, -0.057,
+8164, 959, 0.032,
+8164, 963, 0.032,
+8164, 967, -0.013,
+8164, 968, 0.019,
+8164, 972, 0.032,
+8164, 993, -0.192,
+8164, 8054, 0.032,
+8164, 8056, 0.032,
+8164, 8150, 0.032,
+8165, 943, 0.032,
+8165, 947, -0.064,
+8165, 950, 0.032,
+8165, 953, 0.032,
+8165, 957, -0.057,
+8165, 959, 0.032,
+8165, 963, 0.032,
+8165, 967, -0.013,
+8165, 968, 0.019,
+8165, 972, 0.032,
+8165, 993, -0.192,
+8165, 8054, 0.032,
+8165, 8056, 0.032,
+8165, 8150, 0.032,
+8166, 952, -0.032,
+8166, 956, -0.013,
+8166, 957, -0.045,
+8166, 967, -0.032,
+8166, 968, 0.032,
+8166, 993, -0.192,
+8167, 952, -0.032,
+8167, 956, -0.013,
+8167, 957, -0.045,
+8167, 967, -0.032,
+8167, 968, 0.032,
+8167, 993, -0.192,
+8175, 913, -0.128,
+8175, 927, -0.064,
+8175, 937, -0.032,
+8175, 8124, -0.128,
+8175, 8188, -0.032,
+8178, 941, 0.032,
+8178, 947, -0.128,
+8178, 949, 0.032,
+8178, 956, -0.032,
+8178, 957, -0.032,
+8178, 958, 0.032,
+8178, 964, -0.054,
+8178, 965, -0.032,
+8178, 967, -0.032,
+8178, 973, -0.032,
+8178, 8050, 0.032,
+8178, 8058, -0.032,
+8178, 8166, -0.032,
+8179, 941, 0.032,
+8179, 947, -0.128,
+8179, 949, 0.032,
+8179, 956, -0.032,
+8179, 957, -0.032,
+8179, 958, 0.032,
+8179, 964, -0.054,
+8179, 965, -0.032,
+8179, 967, -0.032,
+8179, 973, -0.032,
+8179, 993, -0.192,
+8179, 8050, 0.032,
+8179, 8058, -0.032,
+8179, 8166, -0.032,
+8180, 941, 0.032,
+8180, 947, -0.128,
+8180, 949, 0.032,
+8180, 956, -0.032,
+8180, 957, -0.032,
+8180, 958, 0.032,
+8180, 964, -0.054,
+8180, 965, -0.032,
+8180, 967, -0.032,
+8180, 973, -0.032,
+8180, 8050, 0.032,
+8180, 8058, -0.032,
+8180, 8166, -0.032,
+8182, 941, 0.032,
+8182, 947, -0.128,
+8182, 949, 0.032,
+8182, 956, -0.032,
+8182, 957, -0.032,
+8182, 958, 0.032,
+8182, 964, -0.054,
+8182, 965, -0.032,
+8182, 967, -0.032,
+8182, 973, -0.032,
+8182, 8050, 0.032,
+8182, 8058, -0.032,
+8182, 8166, -0.032,
+8183, 941, 0.032,
+8183, 947, -0.128,
+8183, 949, 0.032,
+8183, 956, -0.032,
+8183, 957, -0.032,
+8183, 958, 0.032,
+8183, 964, -0.054,
+8183, 965, -0.032,
+8183, 967, -0.032,
+8183, 973, -0.032,
+8183, 8050, 0.032,
+8183, 8058, -0.032,
+8183, 8166, -0.032,
+8190, 913, -0.192,
+8190, 927, -0.064,
+8190, 937, -0.032,
+8190, 8124, -0.192,
+8190, 8188, -0.032
+KERNS_END
+
+END
+
+DEF_FONT(fcmbpg, greek/fcmbpg.ttf, 205)
+
+xHeight(0.451) quad(1) space(0.319)
+
+ss(fcsbpg) tt(fctrpg) it(fcmbipg)
+
+METRICS_START
+32, 0.319, 0.0, 0, 0,
+168, 0.255, 0.645, 0, 0.061,
+884, 0.224, 0.712, 0, 0,
+885, 0.224, 0.007, 0.216, 0,
+890, 0.128, -0.053, 0.241, 0,
+900, 0.192, 0.712, 0, 0,
+901, 0.319, 0.711, 0, 0.031,
+903, 0.319, 0.445, 0, 0,
+912, 0.287, 0.711, 0.007, 0.028,
+913, 0.869, 0.7, 0, 0,
+914, 0.818, 0.688, 0, 0,
+915, 0.691, 0.681, 0, 0,
+916, 0.958, 0.699, 0, 0,
+917, 0.755, 0.681, 0, 0,
+918, 0.703, 0.687, 0, 0,
+919, 0.9, 0.687, 0, 0,
+920, 0.894, 0.699, 0.011, 0,
+921, 0.436, 0.687, 0, 0,
+922, 0.901, 0.687, 0, 0,
+923, 0.805, 0.7, 0, 0,
+924, 1.091, 0.688, 0, 0,
+925, 0.9, 0.687, 0, 0,
+926, 0.766, 0.676, 0, 0,
+927, 0.864, 0.699, 0.011, 0,
+928, 0.9, 0.681, 0, 0,
+929, 0.786, 0.688, 0, 0,
+931, 0.83, 0.687, 0, 0,
+932, 0.8, 0.676, 0, 0,
+933, 0.894, 0.699, 0, 0,
+934, 0.83, 0.687, 0, 0,
+935, 0.869, 0.687, 0, 0,
+936, 0.894, 0.687, 0, 0,
+937, 0.83, 0.698, 0, 0,
+938, 0.436, 0.893, 0, 0,
+939, 0.894, 0.892, 0, 0,
+940, 0.575, 0.711, 0.006, 0.029,
+941, 0.495, 0.711, 0.01, 0,
+942, 0.575, 0.712, 0.26, 0,
+943, 0.287, 0.711, 0.007, 0,
+944, 0.575, 0.712, 0.006, 0,
+945, 0.575, 0.452, 0.006, 0.029,
+946, 0.575, 0.701, 0.269, 0,
+947, 0.639, 0.452, 0.2, 0,
+948, 0.543, 0.704, 0.006, 0,
+949, 0.495, 0.456, 0.01, 0,
+950, 0.543, 0.707, 0.207, 0,
+951, 0.575, 0.456, 0.26, 0,
+952, 0.519, 0.706, 0.012, 0,
+953, 0.287, 0.452, 0.007, 0,
+954, 0.607, 0.457, 0.011, 0,
+955, 0.575, 0.698, 0.005, 0,
+956, 0.622, 0.457, 0.257, 0,
+957, 0.543, 0.452, 0.005, 0,
+958, 0.543, 0.707, 0.206, 0,
+959, 0.607, 0.452, 0.006, 0,
+960, 0.591, 0.446, 0.021, 0,
+961, 0.543, 0.452, 0.256, 0,
+962, 0.511, 0.451, 0.125, 0,
+963, 0.655, 0.446, 0.006, 0,
+964, 0.527, 0.446, 0.006, 0,
+965, 0.575, 0.468, 0.006, 0,
+966, 0.671, 0.462, 0.268, 0,
+967, 0.639, 0.452, 0.256, 0,
+968, 0.671, 0.711, 0.268, 0,
+969, 0.766, 0.457, 0.006, 0,
+970, 0.287, 0.641, 0.007, 0.054,
+971, 0.575, 0.641, 0.006, 0,
+972, 0.607, 0.711, 0.006, 0,
+973, 0.575, 0.712, 0.006, 0,
+974, 0.766, 0.712, 0.006, 0,
+977, 0.655, 0.701, 0.006, 0,
+984, 0.575, 0.693, 0.003, 0,
+985, 0.575, 0.64, 0.094, 0,
+986, 0.894, 0.677, 0, 0,
+987, 0.575, 0.457, 0.024, 0,
+988, 0.723, 0.681, 0, 0,
+989, 0.575, 0.446, 0.265, 0,
+991, 0.447, 0.618, 0.144, 0,
+992, 0.881, 0.706, 0, 0,
+993, 0.83, 0.696, 0.01, 0,
+7936, 0.575, 0.696, 0.006, 0.029,
+7937, 0.575, 0.696, 0.006, 0.029,
+7938, 0.575, 0.711, 0.006, 0.029,
+7939, 0.575, 0.711, 0.006, 0.029,
+7940, 0.575, 0.711, 0.006, 0.029,
+7941, 0.575, 0.711, 0.006, 0.029,
+7942, 0.575, 0.696, 0.006, 0.029,
+7943, 0.575, 0.696, 0.006, 0.029,
+7952, 0.495, 0.696, 0.01, 0,
+7953, 0.495, 0.696, 0.01, 0,
+7954, 0.495, 0.711, 0.01, 0,
+7955, 0.495, 0.711, 0.01, 0,
+7956, 0.495, 0.711, 0.01, 0,
+7957, 0.495, 0.711, 0.01, 0,
+7968, 0.575, 0.696, 0.26, 0,
+7969, 0.575, 0.696, 0.26, 0,
+7970, 0.575, 0.712, 0.26, 0,
+7971, 0.575, 0.712, 0.26, 0,
+7972, 0.575, 0.712, 0.26, 0,
+7973, 0.575, 0.712, 0.26, 0,
+7974, 0.575, 0.696, 0.26, 0,
+7975, 0.575, 0.696, 0.26, 0,
+7984, 0.287, 0.696, 0.007, 0,
+7985, 0.287, 0.696, 0.007, 0,
+7986, 0.287, 0.711, 0.007, 0,
+7987, 0.287, 0.711, 0.007, 0,
+7988, 0.287, 0.711, 0.007, 0.001,
+7989, 0.287, 0.711, 0.007, 0.001,
+7990, 0.287, 0.696, 0.007, 0.029,
+7991, 0.287, 0.696, 0.007, 0.029,
+8000, 0.607, 0.696, 0.006, 0,
+8001, 0.607, 0.696, 0.006, 0,
+8002, 0.607, 0.711, 0.006, 0,
+8003, 0.607, 0.711, 0.006, 0,
+8004, 0.607, 0.711, 0.006, 0,
+8005, 0.607, 0.711, 0.006, 0,
+8016, 0.575, 0.696, 0.006, 0,
+8017, 0.575, 0.696, 0.006, 0,
+8018, 0.575, 0.712, 0.006, 0,
+8019, 0.575, 0.712, 0.006, 0,
+8020, 0.575, 0.712, 0.006, 0,
+8021, 0.575, 0.712, 0.006, 0,
+8022, 0.575, 0.696, 0.006, 0,
+8023, 0.575, 0.696, 0.006, 0,
+8032, 0.766, 0.696, 0.006, 0,
+8033, 0.766, 0.696, 0.006, 0,
+8034, 0.766, 0.712, 0.006, 0,
+8035, 0.766, 0.712, 0.006, 0,
+8036, 0.766, 0.712, 0.006, 0,
+8037, 0.766, 0.712, 0.006, 0,
+8038, 0.766, 0.696, 0.006, 0,
+8039, 0.766, 0.696, 0.006, 0,
+8048, 0.575, 0.711, 0.006, 0.029,
+8050, 0.495, 0.711, 0.01, 0,
+8052, 0.575, 0.712, 0.26, 0,
+8054, 0.287, 0.711, 0.007, 0,
+8056, 0.607, 0.711, 0.006, 0,
+8058, 0.575, 0.712, 0.006, 0,
+8060, 0.766, 0.712, 0.006, 0,
+8064, 0.575, 0.696, 0.241, 0.029,
+8065, 0.575, 0.696, 0.241, 0.029,
+8066, 0.575, 0.711, 0.241, 0.029,
+8067, 0.575, 0.711, 0.241, 0.029,
+8068, 0.575, 0.711, 0.241, 0.029,
+8069, 0.575, 0.711, 0.241, 0.029,
+8070, 0.575, 0.696, 0.241, 0.029,
+8071, 0.575, 0.696, 0.241, 0.029,
+8080, 0.575, 0.696, 0.26, 0,
+8081, 0.575, 0.696, 0.26, 0,
+8082, 0.575, 0.712, 0.26, 0,
+8083, 0.575, 0.712, 0.26, 0,
+8084, 0.575, 0.712, 0.26, 0,
+8085, 0.575, 0.712, 0.26, 0,
+8086, 0.575, 0.696, 0.26, 0,
+8087, 0.575, 0.696, 0.26, 0,
+8096, 0.766, 0.696, 0.241, 0,
+8097, 0.766, 0.696, 0.241, 0,
+8098, 0.766, 0.712, 0.241, 0,
+8099, 0.766, 0.712, 0.241, 0,
+8100, 0.766, 0.712, 0.241, 0,
+8101, 0.766, 0.712, 0.241, 0,
+8102, 0.766, 0.696, 0.241, 0,
+8103, 0.766, 0.696, 0.241, 0,
+8114, 0.575, 0.711, 0.241, 0.029,
+8115, 0.575, 0.452, 0.241, 0.029,
+8116, 0.575, 0.711, 0.241, 0.029,
+8118, 0.575, 0.641, 0.006, 0.029,
+8119, 0.575, 0.641, 0.241, 0.029,
+8124, 0.869, 0.7, 0.241, 0,
+8126, 0.255, 0.157, 0.155, 0,
+8127, 0.255, 0.696, 0, 0,
+8128, 0.383, 0.641, 0, 0,
+8129, 0.511, 0.696, 0, 0,
+8130, 0.575, 0.712, 0.26, 0,
+8131, 0.575, 0.456, 0.26, 0,
+8132, 0.575, 0.712, 0.26, 0,
+8134, 0.575, 0.641, 0.26, 0,
+8135, 0.575, 0.641, 0.26, 0,
+8140, 0.9, 0.687, 0.241, 0,
+8141, 0.319, 0.711, 0, 0,
+8142, 0.319, 0.711, 0, 0.004,
+8143, 0.383, 0.696, 0, 0,
+8146, 0.287, 0.711, 0.007, 0.028,
+8150, 0.287, 0.641, 0.007, 0.029,
+8151, 0.287, 0.696, 0.007, 0.029,
+8157, 0.319, 0.711, 0, 0,
+8158, 0.319, 0.711, 0, 0.004,
+8159, 0.383, 0.696, 0, 0,
+8162, 0.575, 0.712, 0.006, 0,
+8164, 0.543, 0.696, 0.256, 0,
+8165, 0.543, 0.696, 0.256, 0,
+8166, 0.575, 0.641, 0.006, 0,
+8167, 0.575, 0.696, 0.006, 0,
+8173, 0.319, 0.711, 0, 0.031,
+8175, 0.192, 0.712, 0, 0,
+8178, 0.766, 0.712, 0.241, 0,
+8179, 0.766, 0.457, 0.241, 0,
+8180, 0.766, 0.712, 0.241, 0,
+8182, 0.766, 0.641, 0.006, 0,
+8183, 0.766, 0.641, 0.241, 0,
+8188, 0.83, 0.698, 0.241, 0,
+8190, 0.255, 0.696, 0, 0,
+8217, 0.319, 0.696, 0, 0,
+9001, 0.447, 0.751, 0.251, 0,
+9002, 0.447, 0.751, 0.251, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.128,
+900, 927, -0.064,
+900, 937, -0.032,
+900, 8124, -0.128,
+900, 8188, -0.032,
+912, 947, -0.032,
+912, 951, -0.019,
+912, 952, -0.019,
+912, 957, -0.064,
+912, 959, -0.032,
+912, 962, -0.032,
+912, 963, -0.032,
+912, 964, -0.032,
+912, 967, -0.032,
+912, 977, -0.019,
+913, 920, -0.096,
+913, 927, -0.096,
+913, 932, -0.096,
+913, 933, -0.16,
+913, 934, -0.096,
+913, 936, -0.141,
+913, 939, -0.16,
+915, 913, -0.153,
+915, 916, -0.128,
+915, 923, -0.141,
+915, 8124, -0.153,
+916, 927, -0.038,
+916, 933, -0.16,
+916, 939, -0.16,
+920, 913, -0.096,
+920, 8124, -0.096,
+922, 927, -0.096,
+923, 927, -0.038,
+923, 933, -0.115,
+923, 939, -0.115,
+925, 913, -0.096,
+925, 8124, -0.096,
+927, 913, -0.096,
+927, 931, -0.064,
+927, 8124, -0.096,
+929, 913, -0.192,
+929, 8124, -0.192,
+931, 913, -0.032,
+931, 8124, -0.032,
+932, 913, -0.096,
+932, 8124, -0.096,
+933, 913, -0.16,
+933, 916, -0.16,
+933, 923, -0.16,
+933, 8124, -0.16,
+934, 913, -0.096,
+934, 8124, -0.096,
+936, 913, -0.141,
+936, 8124, -0.141,
+939, 913, -0.16,
+939, 916, -0.16,
+939, 923, -0.16,
+939, 8124, -0.16,
+943, 947, -0.032,
+943, 951, -0.019,
+943, 952, -0.031,
+943, 957, -0.064,
+943, 959, -0.032,
+943, 962, -0.032,
+943, 963, -0.032,
+943, 964, -0.032,
+943, 967, -0.032,
+943, 977, -0.019,
+953, 947, -0.032,
+953, 951, -0.019,
+953, 952, -0.031,
+953, 957, -0.064,
+953, 959, -0.032,
+953, 962, -0.032,
+953, 963, -0.032,
+953, 964, -0.032,
+953, 967, -0.032,
+953, 977, -0.019,
+959, 947, -0.032,
+959, 955, -0.032,
+959, 957, -0.026,
+959, 964, -0.026,
+959, 967, -0.032,
+964, 940, -0.032,
+964, 945, -0.032,
+964, 959, -0.032,
+964, 969, -0.032,
+964, 972, -0.032,
+964, 974, -0.032,
+964, 7936, -0.032,
+964, 7937, -0.032,
+964, 7940, -0.032,
+964, 7941, -0.032,
+964, 7942, -0.032,
+964, 7943, -0.032,
+964, 8000, -0.032,
+964, 8001, -0.032,
+964, 8004, -0.032,
+964, 8005, -0.032,
+964, 8032, -0.032,
+964, 8033, -0.032,
+964, 8036, -0.032,
+964, 8037, -0.032,
+964, 8038, -0.032,
+964, 8039, -0.032,
+964, 8048, -0.032,
+964, 8056, -0.032,
+964, 8060, -0.032,
+964, 8064, -0.032,
+964, 8065, -0.032,
+964, 8068, -0.032,
+964, 8069, -0.032,
+964, 8070, -0.032,
+964, 8071, -0.032,
+964, 8096, -0.032,
+964, 8097, -0.032,
+964, 8100, -0.032,
+964, 8101, -0.032,
+964, 8102, -0.032,
+964, 8103, -0.032,
+964, 8114, -0.032,
+964, 8116, -0.032,
+964, 8118, -0.032,
+964, 8119, -0.032,
+964, 8178, -0.032,
+964, 8180, -0.032,
+964, 8182, -0.032,
+964, 8183, -0.032,
+970, 947, -0.032,
+970, 951, -0.019,
+970, 952, -0.019,
+970, 957, -0.064,
+970, 959, -0.032,
+970, 962, -0.032,
+970, 963, -0.032,
+970, 964, -0.032,
+970, 967, -0.032,
+970, 977, -0.019,
+972, 947, -0.032,
+972, 955, -0.032,
+972, 957, -0.026,
+972, 964, -0.026,
+972, 967, -0.032,
+7984, 947, -0.032,
+7984, 951, -0.019,
+7984, 952, -0.031,
+7984, 957, -0.064,
+7984, 959, -0.032,
+7984, 962, -0.032,
+7984, 963, -0.032,
+7984, 964, -0.032,
+7984, 967, -0.032,
+7984, 977, -0.019,
+7985, 947, -0.032,
+7985, 951, -0.019,
+7985, 952, -0.031,
+7985, 957, -0.064,
+7985, 959, -0.032,
+7985, 962, -0.032,
+7985, 963, -0.032,
+7985, 964, -0.032,
+7985, 967, -0.032,
+7985, 977, -0.019,
+7988, 947, -0.032,
+7988, 951, -0.019,
+7988, 952, -0.019,
+7988, 957, -0.064,
+7988, 959, -0.032,
+7988, 962, -0.032,
+7988, 963, -0.032,
+7988, 964, -0.032,
+7988, 967, -0.032,
+7988, 977, -0.019,
+7989, 947, -0.032,
+7989, 951, -0.019,
+7989, 952, -0.019,
+7989, 957, -0.064,
+7989, 959, -0.032,
+7989, 962, -0.032,
+7989, 963, -0.032,
+7989, 964, -0.032,
+7989, 967, -0.032,
+7989, 977, -0.019,
+7990, 947, -0.032,
+7990, 951, -0.019,
+7990, 952, -0.019,
+7990, 957, -0.064,
+7990, 959, -0.032,
+7990, 962, -0.032,
+7990, 963, -0.032,
+7990, 964, -0.032,
+7990, 967, -0.032,
+7990, 977, -0.019,
+7991, 947, -0.032,
+7991, 951, -0.019,
+7991, 952, -0.019,
+7991, 957, -0.064,
+7991, 959, -0.032,
+7991, 962, -0.032,
+7991, 963, -0.032,
+7991, 964, -0.032,
+7991, 967, -0.032,
+7991, 977, -0.019,
+8000, 947, -0.032,
+8000, 955, -0.032,
+8000, 957, -0.026,
+8000, 964, -0.026,
+8000, 967, -0.032,
+8001, 947, -0.032,
+8001, 955, -0.032,
+8001, 957, -0.026,
+8001, 964, -0.026,
+8001, 967, -0.032,
+8004, 947, -0.032,
+8004, 955, -0.032,
+8004, 957, -0.026,
+8004, 964, -0.026,
+8004, 967, -0.032,
+8005, 947, -0.032,
+8005, 955, -0.032,
+8005, 957, -0.026,
+8005, 964, -0.026,
+8005, 967, -0.032,
+8054, 947, -0.032,
+8054, 951, -0.019,
+8054, 952, -0.019,
+8054, 957, -0.064,
+8054, 959, -0.032,
+8054, 962, -0.032,
+8054, 963, -0.032,
+8054, 964, -0.032,
+8054, 967, -0.032,
+8054, 977, -0.019,
+8056, 947, -0.032,
+8056, 955, -0.032,
+8056, 957, -0.026,
+8056, 964, -0.026,
+8056, 967, -0.032,
+8124, 920, -0.096,
+8124, 927, -0.096,
+8124, 932, -0.096,
+8124, 933, -0.16,
+8124, 934, -0.096,
+8124, 936, -0.141,
+8124, 939, -0.16,
+8127, 913, -0.16,
+8127, 927, -0.064,
+8127, 937, -0.032,
+8127, 8124, -0.16,
+8127, 8188, -0.032,
+8128, 913, -0.128,
+8128, 8124, -0.128,
+8141, 913, -0.096,
+8141, 927, -0.032,
+8141, 8124, -0.096,
+8142, 913, -0.096,
+8142, 927, -0.032,
+8142, 8124, -0.096,
+8143, 913, -0.128,
+8143, 8124, -0.128,
+8146, 947, -0.032,
+8146, 951, -0.019,
+8146, 952, -0.031,
+8146, 957, -0.064,
+8146, 959, -0.032,
+8146, 962, -0.032,
+8146, 963, -0.032,
+8146, 964, -0.032,
+8146, 967, -0.032,
+8146, 977, -0.019,
+8150, 947, -0.032,
+8150, 951, -0.019,
+8150, 952, -0.019,
+8150, 957, -0.064,
+8150, 959, -0.032,
+8150, 962, -0.032,
+8150, 963, -0.032,
+8150, 964, -0.032,
+8150, 967, -0.032,
+8150, 977, -0.019,
+8151, 947, -0.032,
+8151, 951, -0.019,
+8151, 952, -0.019,
+8151, 957, -0.064,
+8151, 959, -0.032,
+8151, 962, -0.032,
+8151, 963, -0.032,
+8151, 964, -0.032,
+8151, 967, -0.032,
+8151, 977, -0.019,
+8157, 913, -0.096,
+8157, 927, -0.032,
+8157, 8124, -0.096,
+8158, 913, -0.096,
+8158, 927, -0.032,
+8158, 8124, -0.096,
+8159, 913, -0.128,
+8159, 8124, -0.128,
+8175, 913, -0.128,
+8175, 927, -0.064,
+8175, 937, -0.032,
+8175, 8124, -0.128,
+8175, 8188, -0.032,
+8190, 913, -0.192,
+8190, 927, -0.064,
+8190, 937, -0.032,
+8190, 8124, -0.192,
+8190, 8188, -0.032
+KERNS_END
+
+END
+
+DEF_FONT(fcmripg, greek/fcmripg.ttf, 204)
+
+xHeight(0.441) quad(1) space(0.307)
+
+bold(fcmbipg) roman(fcmrpg) ss(fcsropg) tt(fctrpg)
+
+METRICS_START
+32, 0.307, 0.0, 0, 0,
+168, 0.222, 0.609, 0, 0.192,
+884, 0.194, 0.702, 0, 0.145,
+885, 0.194, 0.003, 0.216, 0,
+890, 0.111, -0.043, 0.211, 0.009,
+900, 0.167, 0.702, 0, 0.152,
+901, 0.278, 0.702, 0, 0.155,
+903, 0.278, 0.431, 0, 0.017,
+912, 0.25, 0.702, 0.011, 0.13,
+913, 0.75, 0.717, 0, 0,
+914, 0.708, 0.685, 0, 0.058,
+915, 0.625, 0.681, 0, 0.111,
+916, 0.833, 0.718, 0, 0,
+917, 0.68, 0.681, 0, 0.098,
+918, 0.611, 0.685, 0, 0.124,
+919, 0.75, 0.684, 0, 0.148,
+920, 0.778, 0.706, 0.022, 0.049,
+921, 0.361, 0.684, 0, 0.154,
+922, 0.778, 0.684, 0, 0.126,
+923, 0.694, 0.717, 0, 0,
+924, 0.916, 0.684, 0, 0.144,
+925, 0.75, 0.684, 0, 0.148,
+926, 0.667, 0.678, 0, 0.125,
+927, 0.778, 0.706, 0.022, 0.049,
+928, 0.75, 0.681, 0, 0.148,
+929, 0.68, 0.685, 0, 0.083,
+931, 0.722, 0.685, 0, 0.099,
+932, 0.722, 0.678, 0, 0.125,
+933, 0.694, 0.684, 0, 0.172,
+934, 0.722, 0.684, 0, 0.041,
+935, 0.75, 0.684, 0, 0.117,
+936, 0.778, 0.685, 0, 0.089,
+937, 0.722, 0.706, 0, 0.074,
+938, 0.361, 0.834, 0, 0.171,
+939, 0.694, 0.833, 0, 0.172,
+940, 0.555, 0.702, 0.011, 0,
+941, 0.389, 0.702, 0.011, 0.067,
+942, 0.517, 0.702, 0.214, 0.035,
+943, 0.25, 0.702, 0.011, 0.097,
+944, 0.5, 0.729, 0.011, 0.045,
+945, 0.555, 0.443, 0.011, 0,
+946, 0.444, 0.707, 0.212, 0.093,
+947, 0.5, 0.447, 0.217, 0.067,
+948, 0.467, 0.707, 0.01, 0.033,
+949, 0.389, 0.442, 0.011, 0.052,
+950, 0.417, 0.696, 0.156, 0.082,
+951, 0.517, 0.443, 0.214, 0.035,
+952, 0.514, 0.707, 0.011, 0.065,
+953, 0.25, 0.431, 0.011, 0.002,
+954, 0.528, 0.447, 0.011, 0.053,
+955, 0.45, 0.707, 0.011, 0.011,
+956, 0.5, 0.432, 0.222, 0.002,
+957, 0.417, 0.442, 0.02, 0.068,
+958, 0.417, 0.696, 0.155, 0.036,
+959, 0.472, 0.443, 0.011, 0.025,
+960, 0.569, 0.434, 0.011, 0.068,
+961, 0.472, 0.442, 0.212, 0.028,
+962, 0.417, 0.443, 0.13, 0.048,
+963, 0.5, 0.451, 0.011, 0.081,
+964, 0.458, 0.454, 0.011, 0.075,
+965, 0.517, 0.443, 0.011, 0.024,
+966, 0.583, 0.443, 0.223, 0.037,
+967, 0.472, 0.442, 0.223, 0.031,
+968, 0.555, 0.444, 0.226, 0.045,
+969, 0.667, 0.432, 0.011, 0.019,
+970, 0.25, 0.637, 0.011, 0.147,
+971, 0.5, 0.637, 0.011, 0.06,
+972, 0.472, 0.702, 0.011, 0.027,
+973, 0.5, 0.702, 0.011, 0.041,
+974, 0.667, 0.702, 0.011, 0.019,
+984, 0.5, 0.695, 0.001, 0.103,
+985, 0.5, 0.443, 0.217, 0.011,
+986, 0.778, 0.679, 0, 0.125,
+987, 0.5, 0.496, 0.106, 0.086,
+988, 0.653, 0.681, 0, 0.111,
+989, 0.5, 0.695, 0, 0.146,
+991, 0.389, 0.695, 0.211, 0.046,
+992, 0.766, 0.695, 0, 0,
+993, 0.722, 0.706, 0.029, 0,
+7936, 0.555, 0.696, 0.011, 0,
+7937, 0.555, 0.696, 0.011, 0,
+7938, 0.555, 0.702, 0.011, 0,
+7939, 0.555, 0.702, 0.011, 0,
+7940, 0.555, 0.702, 0.011, 0.012,
+7941, 0.555, 0.702, 0.011, 0.012,
+7942, 0.555, 0.723, 0.011, 0.055,
+7943, 0.555, 0.723, 0.011, 0.055,
+7952, 0.389, 0.696, 0.011, 0.052,
+7953, 0.389, 0.696, 0.011, 0.052,
+7954, 0.389, 0.702, 0.011, 0.073,
+7955, 0.389, 0.702, 0.011, 0.073,
+7956, 0.389, 0.702, 0.011, 0.117,
+7957, 0.389, 0.702, 0.011, 0.117,
+7968, 0.517, 0.696, 0.214, 0.035,
+7969, 0.517, 0.696, 0.214, 0.035,
+7970, 0.517, 0.702, 0.214, 0.035,
+7971, 0.517, 0.702, 0.214, 0.035,
+7972, 0.517, 0.702, 0.214, 0.041,
+7973, 0.517, 0.702, 0.214, 0.041,
+7974, 0.517, 0.723, 0.214, 0.085,
+7975, 0.517, 0.723, 0.214, 0.085,
+7984, 0.25, 0.696, 0.011, 0.107,
+7985, 0.25, 0.696, 0.011, 0.065,
+7986, 0.25, 0.702, 0.011, 0.102,
+7987, 0.25, 0.702, 0.011, 0.102,
+7988, 0.25, 0.702, 0.011, 0.148,
+7989, 0.25, 0.702, 0.011, 0.148,
+7990, 0.25, 0.723, 0.011, 0.191,
+7991, 0.25, 0.723, 0.011, 0.191,
+8000, 0.472, 0.696, 0.011, 0.05,
+8001, 0.472, 0.696, 0.011, 0.025,
+8002, 0.472, 0.702, 0.011, 0.031,
+8003, 0.472, 0.702, 0.011, 0.031,
+8004, 0.472, 0.701, 0.011, 0.077,
+8005, 0.472, 0.701, 0.011, 0.077,
+8016, 0.5, 0.696, 0.011, 0.041,
+8017, 0.5, 0.696, 0.011, 0.041,
+8018, 0.5, 0.702, 0.011, 0.041,
+8019, 0.5, 0.702, 0.011, 0.041,
+8020, 0.5, 0.702, 0.011, 0.059,
+8021, 0.5, 0.702, 0.011, 0.059,
+8022, 0.5, 0.723, 0.011, 0.103,
+8023, 0.5, 0.723, 0.011, 0.103,
+8032, 0.667, 0.696, 0.011, 0.019,
+8033, 0.667, 0.696, 0.011, 0.019,
+8034, 0.667, 0.702, 0.011, 0.019,
+8035, 0.667, 0.702, 0.011, 0.019,
+8036, 0.667, 0.702, 0.011, 0.019,
+8037, 0.667, 0.702, 0.011, 0.019,
+8038, 0.667, 0.724, 0.011, 0.05,
+8039, 0.667, 0.724, 0.011, 0.05,
+8048, 0.555, 0.702, 0.011, 0,
+8050, 0.389, 0.702, 0.011, 0.052,
+8052, 0.517, 0.702, 0.214, 0.035,
+8054, 0.25, 0.702, 0.011, 0.007,
+8056, 0.472, 0.702, 0.011, 0.025,
+8058, 0.5, 0.702, 0.011, 0.041,
+8060, 0.667, 0.702, 0.011, 0.019,
+8064, 0.555, 0.696, 0.211, 0,
+8065, 0.555, 0.696, 0.211, 0,
+8066, 0.555, 0.702, 0.211, 0,
+8067, 0.555, 0.702, 0.211, 0,
+8068, 0.555, 0.702, 0.211, 0.012,
+8069, 0.555, 0.702, 0.211, 0.012,
+8070, 0.555, 0.723, 0.211, 0.055,
+8071, 0.555, 0.723, 0.211, 0.055,
+8080, 0.517, 0.696, 0.214, 0.035,
+8081, 0.517, 0.696, 0.214, 0.035,
+8082, 0.517, 0.702, 0.214, 0.035,
+8083, 0.517, 0.702, 0.214, 0.035,
+8084, 0.517, 0.702, 0.214, 0.041,
+8085, 0.517, 0.702, 0.214, 0.041,
+8086, 0.517, 0.723, 0.214, 0.085,
+8087, 0.517, 0.723, 0.214, 0.085,
+8096, 0.667, 0.696, 0.211, 0.019,
+8097, 0.667, 0.696, 0.211, 0.019,
+8098, 0.667, 0.702, 0.211, 0.019,
+8099, 0.667, 0.702, 0.211, 0.019,
+8100, 0.667, 0.702, 0.211, 0.019,
+8101, 0.667, 0.702, 0.211, 0.019,
+8102, 0.667, 0.724, 0.211, 0.05,
+8103, 0.667, 0.724, 0.211, 0.05,
+8114, 0.555, 0.702, 0.211, 0,
+8115, 0.555, 0.443, 0.211, 0,
+8116, 0.555, 0.702, 0.211, 0,
+8118, 0.555, 0.615, 0.011, 0.026,
+8119, 0.555, 0.615, 0.211, 0.026,
+8124, 0.75, 0.717, 0.211, 0,
+8126, 0.222, 0.158, 0.156, 0.012,
+8127, 0.222, 0.696, 0, 0.175,
+8128, 0.333, 0.615, 0, 0.16,
+8129, 0.444, 0.723, 0, 0.134,
+8130, 0.517, 0.702, 0.214, 0.035,
+8131, 0.517, 0.443, 0.214, 0.035,
+8132, 0.517, 0.702, 0.214, 0.035,
+8134, 0.517, 0.616, 0.214, 0.056,
+8135, 0.517, 0.616, 0.214, 0.056,
+8140, 0.75, 0.684, 0.211, 0.148,
+8141, 0.278, 0.702, 0, 0.128,
+8142, 0.278, 0.701, 0, 0.174,
+8143, 0.333, 0.723, 0, 0.189,
+8146, 0.25, 0.702, 0.011, 0.13,
+8150, 0.25, 0.615, 0.011, 0.162,
+8151, 0.25, 0.723, 0.011, 0.191,
+8157, 0.278, 0.702, 0, 0.128,
+8158, 0.278, 0.701, 0, 0.174,
+8159, 0.333, 0.723, 0, 0.189,
+8162, 0.5, 0.729, 0.011, 0.045,
+8164, 0.472, 0.696, 0.212, 0.05,
+8165, 0.472, 0.696, 0.212, 0.028,
+8166, 0.5, 0.616, 0.011, 0.074,
+8167, 0.5, 0.723, 0.011, 0.103,
+8173, 0.278, 0.702, 0, 0.155,
+8175, 0.167, 0.702, 0, 0.116,
+8178, 0.667, 0.702, 0.211, 0.019,
+8179, 0.667, 0.432, 0.211, 0.019,
+8180, 0.667, 0.702, 0.211, 0.019,
+8182, 0.667, 0.615, 0.011, 0.021,
+8183, 0.667, 0.615, 0.211, 0.021,
+8188, 0.722, 0.706, 0.211, 0.074,
+8190, 0.222, 0.696, 0, 0.105,
+8217, 0.278, 0.695, 0, 0.093,
+9001, 0.409, 0.751, 0.249, 0.106,
+9002, 0.409, 0.751, 0.249, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.111,
+900, 927, -0.056,
+900, 937, -0.028,
+900, 8124, -0.111,
+900, 8188, -0.028,
+912, 947, -0.069,
+912, 951, -0.017,
+912, 952, -0.033,
+912, 954, -0.056,
+912, 957, -0.056,
+912, 959, -0.028,
+912, 962, -0.028,
+912, 963, -0.028,
+912, 964, -0.083,
+912, 967, -0.056,
+912, 972, -0.028,
+912, 993, -0.167,
+912, 8000, -0.028,
+912, 8001, -0.028,
+912, 8004, -0.028,
+912, 8005, -0.028,
+912, 8056, -0.028,
+913, 920, -0.083,
+913, 927, -0.083,
+913, 932, -0.083,
+913, 933, -0.139,
+913, 934, -0.083,
+913, 936, -0.122,
+913, 939, -0.139,
+913, 957, -0.097,
+915, 913, -0.133,
+915, 916, -0.111,
+915, 923, -0.122,
+915, 8124, -0.133,
+916, 927, -0.033,
+916, 933, -0.139,
+916, 939, -0.139,
+920, 913, -0.083,
+920, 933, -0.083,
+920, 939, -0.083,
+920, 8124, -0.083,
+922, 927, -0.083,
+923, 927, -0.033,
+923, 933, -0.1,
+923, 939, -0.1,
+925, 913, -0.083,
+925, 8124, -0.083,
+927, 913, -0.083,
+927, 931, -0.056,
+927, 8124, -0.083,
+929, 913, -0.167,
+929, 8124, -0.167,
+931, 913, -0.028,
+931, 8124, -0.028,
+932, 913, -0.083,
+932, 8124, -0.083,
+933, 913, -0.139,
+933, 916, -0.139,
+933, 923, -0.139,
+933, 8124, -0.139,
+934, 913, -0.083,
+934, 8124, -0.083,
+936, 913, -0.122,
+936, 8124, -0.122,
+939, 913, -0.139,
+939, 916, -0.139,
+939, 923, -0.139,
+939, 8124, -0.139,
+940, 947, -0.083,
+940, 952, -0.083,
+940, 957, -0.083,
+940, 959, -0.028,
+940, 960, -0.044,
+940, 964, -0.083,
+940, 965, -0.083,
+940, 967, -0.083,
+940, 968, -0.028,
+940, 972, -0.028,
+940, 973, -0.083,
+940, 8056, -0.028,
+940, 8058, -0.083,
+941, 940, -0.028,
+941, 945, -0.028,
+941, 948, -0.028,
+941, 963, -0.028,
+941, 965, -0.028,
+941, 967, -0.008,
+941, 973, -0.028,
+941, 993, -0.167,
+941, 8048, -0.028,
+941, 8058, -0.028,
+941, 8114, -0.028,
+941, 8115, -0.028,
+941, 8116, -0.028,
+941, 8118, -0.028,
+941, 8119, -0.028,
+941, 8166, -0.028,
+942, 957, -0.028,
+942, 965, -0.028,
+942, 973, -0.028,
+942, 8058, -0.028,
+942, 8166, -0.028,
+943, 947, -0.069,
+943, 951, -0.017,
+943, 952, -0.033,
+943, 954, -0.056,
+943, 957, -0.056,
+943, 959, -0.028,
+943, 962, -0.028,
+943, 963, -0.028,
+943, 964, -0.083,
+943, 967, -0.056,
+943, 972, -0.028,
+943, 993, -0.167,
+943, 8000, -0.028,
+943, 8001, -0.028,
+943, 8004, -0.028,
+943, 8005, -0.028,
+943, 8056, -0.028,
+944, 952, -0.028,
+944, 956, -0.011,
+944, 957, -0.039,
+944, 967, -0.028,
+944, 968, 0.028,
+944, 993, -0.167,
+945, 947, -0.083,
+945, 952, -0.083,
+945, 957, -0.094,
+945, 959, -0.028,
+945, 960, -0.044,
+945, 964, -0.083,
+945, 965, -0.083,
+945, 967, -0.083,
+945, 968, -0.028,
+945, 972, -0.028,
+945, 973, -0.083,
+945, 993, -0.222,
+945, 8016, -0.083,
+945, 8018, -0.083,
+945, 8020, -0.083,
+945, 8021, -0.083,
+945, 8022, -0.083,
+945, 8023, -0.083,
+945, 8056, -0.028,
+945, 8058, -0.083,
+945, 8166, -0.083,
+946, 941, 0.028,
+946, 943, 0.028,
+946, 949, 0.028,
+946, 953, 0.028,
+946, 959, 0.028,
+946, 964, 0.028,
+946, 966, 0.028,
+946, 967, -0.028,
+946, 968, 0.056,
+946, 972, 0.028,
+946, 993, -0.056,
+946, 8050, 0.028,
+946, 8054, 0.028,
+946, 8056, 0.028,
+946, 8150, 0.028,
+947, 967, 0.017,
+947, 993, -0.167,
+948, 940, -0.028,
+948, 945, -0.028,
+948, 947, -0.083,
+948, 956, -0.044,
+948, 957, -0.039,
+948, 960, -0.028,
+948, 965, -0.028,
+948, 967, -0.017,
+948, 973, -0.028,
+948, 993, -0.167,
+948, 8048, -0.028,
+948, 8058, -0.028,
+948, 8114, -0.028,
+948, 8115, -0.028,
+948, 8116, -0.028,
+948, 8118, -0.028,
+948, 8119, -0.028,
+948, 8166, -0.028,
+949, 940, -0.028,
+949, 945, -0.028,
+949, 948, -0.028,
+949, 963, -0.028,
+949, 965, -0.028,
+949, 967, -0.008,
+949, 973, -0.028,
+949, 993, -0.167,
+949, 8048, -0.028,
+949, 8058, -0.028,
+949, 8114, -0.028,
+949, 8115, -0.028,
+949, 8116, -0.028,
+949, 8118, -0.028,
+949, 8119, -0.028,
+949, 8166, -0.028,
+950, 940, -0.083,
+950, 941, -0.083,
+950, 942, -0.083,
+950, 945, -0.083,
+950, 947, -0.111,
+950, 948, -0.056,
+950, 949, -0.083,
+950, 951, -0.083,
+950, 952, -0.056,
+950, 956, -0.056,
+950, 957, -0.089,
+950, 959, -0.083,
+950, 960, -0.083,
+950, 963, -0.083,
+950, 964, -0.083,
+950, 965, -0.083,
+950, 966, -0.083,
+950, 967, -0.083,
+950, 968, -0.028,
+950, 969, -0.083,
+950, 972, -0.083,
+950, 973, -0.083,
+950, 974, -0.083,
+950, 993, -0.056,
+950, 8048, -0.083,
+950, 8050, -0.083,
+950, 8052, -0.083,
+950, 8056, -0.083,
+950, 8058, -0.083,
+950, 8060, -0.083,
+950, 8114, -0.083,
+950, 8115, -0.083,
+950, 8116, -0.083,
+950, 8118, -0.083,
+950, 8119, -0.083,
+950, 8130, -0.083,
+950, 8131, -0.083,
+950, 8132, -0.083,
+950, 8134, -0.083,
+950, 8135, -0.083,
+950, 8166, -0.083,
+950, 8178, -0.083,
+950, 8179, -0.083,
+950, 8180, -0.083,
+950, 8182, -0.083,
+950, 8183, -0.083,
+951, 957, -0.028,
+951, 965, -0.028,
+951, 973, -0.028,
+951, 993, -0.167,
+951, 8058, -0.028,
+951, 8166, -0.028,
+952, 941, 0.028,
+952, 943, 0.028,
+952, 949, 0.028,
+952, 953, 0.028,
+952, 968, 0.028,
+952, 993, -0.056,
+952, 8050, 0.028,
+952, 8054, 0.028,
+952, 8150, 0.028,
+953, 947, -0.069,
+953, 951, -0.017,
+953, 952, -0.033,
+953, 954, -0.056,
+953, 957, -0.056,
+953, 959, -0.028,
+953, 962, -0.028,
+953, 963, -0.028,
+953, 964, -0.083,
+953, 967, -0.056,
+953, 972, -0.028,
+953, 993, -0.167,
+953, 8000, -0.028,
+953, 8001, -0.028,
+953, 8004, -0.028,
+953, 8005, -0.028,
+953, 8056, -0.028,
+954, 946, 0.028,
+954, 957, -0.028,
+954, 993, -0.167,
+955, 940, -0.014,
+955, 945, -0.014,
+955, 947, -0.139,
+955, 952, -0.044,
+955, 956, 0.014,
+955, 957, -0.083,
+955, 963, -0.028,
+955, 964, -0.028,
+955, 965, -0.056,
+955, 967, -0.056,
+955, 973, -0.056,
+955, 993, -0.167,
+955, 8048, -0.014,
+955, 8058, -0.056,
+955, 8114, -0.014,
+955, 8115, -0.014,
+955, 8116, -0.014,
+955, 8118, -0.014,
+955, 8119, -0.014,
+955, 8166, -0.056,
+956, 940, -0.056,
+956, 945, -0.056,
+956, 947, -0.083,
+956, 950, -0.028,
+956, 952, -0.061,
+956, 957, -0.083,
+956, 959, -0.028,
+956, 960, -0.028,
+956, 963, -0.028,
+956, 965, -0.056,
+956, 966, -0.028,
+956, 967, -0.058,
+956, 969, -0.028,
+956, 972, -0.028,
+956, 973, -0.056,
+956, 974, -0.028,
+956, 993, -0.222,
+956, 8048, -0.056,
+956, 8056, -0.028,
+956, 8058, -0.056,
+956, 8060, -0.028,
+956, 8114, -0.056,
+956, 8115, -0.056,
+956, 8116, -0.056,
+956, 8118, -0.056,
+956, 8119, -0.056,
+956, 8166, -0.056,
+956, 8178, -0.028,
+956, 8179, -0.028,
+956, 8180, -0.028,
+956, 8182, -0.028,
+956, 8183, -0.028,
+957, 940, -0.022,
+957, 945, -0.022,
+957, 955, -0.044,
+957, 957, -0.028,
+957, 959, -0.028,
+957, 961, -0.006,
+957, 969, 0.008,
+957, 972, -0.028,
+957, 974, 0.008,
+957, 993, -0.167,
+957, 8048, -0.022,
+957, 8056, -0.028,
+957, 8060, 0.008,
+957, 8114, -0.022,
+957, 8115, -0.022,
+957, 8116, -0.022,
+957, 8118, -0.022,
+957, 8119, -0.022,
+957, 8178, 0.008,
+957, 8179, 0.008,
+957, 8180, 0.008,
+957, 8182, 0.008,
+957, 8183, 0.008,
+958, 940, -0.028,
+958, 941, -0.056,
+958, 945, -0.028,
+958, 947, -0.039,
+958, 949, -0.056,
+958, 959, -0.056,
+958, 963, -0.056,
+958, 964, -0.028,
+958, 965, -0.028,
+958, 966, -0.039,
+958, 967, -0.028,
+958, 972, -0.056,
+958, 973, -0.028,
+958, 993, -0.056,
+958, 8048, -0.028,
+958, 8050, -0.056,
+958, 8056, -0.056,
+958, 8058, -0.028,
+958, 8114, -0.028,
+958, 8115, -0.028,
+958, 8116, -0.028,
+958, 8118, -0.028,
+958, 8119, -0.028,
+958, 8166, -0.028,
+959, 947, -0.028,
+959, 955, -0.028,
+959, 956, -0.011,
+959, 957, -0.039,
+959, 964, -0.033,
+959, 965, -0.056,
+959, 967, -0.028,
+959, 973, -0.056,
+959, 993, -0.167,
+959, 8058, -0.056,
+959, 8166, -0.056,
+960, 943, 0.028,
+960, 953, 0.028,
+960, 954, 0.028,
+960, 959, -0.056,
+960, 968, 0.028,
+960, 972, -0.056,
+960, 993, -0.167,
+960, 8054, 0.028,
+960, 8056, -0.056,
+960, 8150, 0.028,
+961, 943, 0.028,
+961, 947, -0.056,
+961, 950, 0.028,
+961, 953, 0.028,
+961, 957, -0.05,
+961, 959, 0.028,
+961, 963, 0.028,
+961, 967, -0.011,
+961, 968, 0.017,
+961, 972, 0.028,
+961, 993, -0.167,
+961, 8054, 0.028,
+961, 8056, 0.028,
+961, 8150, 0.028,
+963, 940, -0.044,
+963, 945, -0.044,
+963, 959, -0.028,
+963, 961, -0.028,
+963, 969, -0.028,
+963, 972, -0.028,
+963, 974, -0.028,
+963, 993, -0.167,
+963, 8048, -0.044,
+963, 8056, -0.028,
+963, 8060, -0.028,
+963, 8114, -0.044,
+963, 8115, -0.044,
+963, 8116, -0.044,
+963, 8118, -0.044,
+963, 8119, -0.044,
+963, 8164, -0.028,
+963, 8165, -0.028,
+963, 8178, -0.028,
+963, 8179, -0.028,
+963, 8180, -0.028,
+963, 8182, -0.028,
+963, 8183, -0.028,
+964, 940, -0.028,
+964, 941, -0.028,
+964, 945, -0.028,
+964, 949, -0.028,
+964, 959, -0.028,
+964, 967, -0.028,
+964, 969, -0.028,
+964, 972, -0.028,
+964, 974, -0.028,
+964, 993, -0.167,
+964, 8048, -0.028,
+964, 8050, -0.028,
+964, 8056, -0.028,
+964, 8060, -0.028,
+964, 8114, -0.028,
+964, 8115, -0.028,
+964, 8116, -0.028,
+964, 8118, -0.028,
+964, 8119, -0.028,
+964, 8178, -0.028,
+964, 8179, -0.028,
+964, 8180, -0.028,
+964, 8182, -0.028,
+964, 8183, -0.028,
+965, 952, -0.028,
+965, 956, -0.011,
+965, 957, -0.039,
+965, 967, -0.028,
+965, 968, 0.028,
+965, 993, -0.167,
+966, 942, -0.028,
+966, 947, -0.056,
+966, 951, -0.028,
+966, 956, -0.039,
+966, 957, -0.039,
+966, 964, -0.028,
+966, 965, -0.056,
+966, 967, -0.011,
+966, 973, -0.056,
+966, 993, -0.167,
+966, 8052, -0.028,
+966, 8058, -0.056,
+966, 8130, -0.028,
+966, 8131, -0.028,
+966, 8132, -0.028,
+966, 8134, -0.056,
+966, 8135, -0.056,
+966, 8166, -0.056,
+967, 940, -0.067,
+967, 941, -0.028,
+967, 942, -0.058,
+967, 943, -0.028,
+967, 945, -0.067,
+967, 947, -0.044,
+967, 948, -0.067,
+967, 949, -0.028,
+967, 951, -0.058,
+967, 952, -0.056,
+967, 953, -0.028,
+967, 954, -0.056,
+967, 955, -0.067,
+967, 957, -0.083,
+967, 958, -0.044,
+967, 959, -0.083,
+967, 960, -0.044,
+967, 961, -0.044,
+967, 963, -0.039,
+967, 964, -0.044,
+967, 965, -0.044,
+967, 966, -0.083,
+967, 968, -0.028,
+967, 969, -0.067,
+967, 972, -0.083,
+967, 973, -0.044,
+967, 974, -0.067,
+967, 993, -0.167,
+967, 8048, -0.067,
+967, 8050, -0.028,
+967, 8052, -0.058,
+967, 8054, -0.028,
+967, 8056, -0.083,
+967, 8058, -0.044,
+967, 8060, -0.067,
+967, 8114, -0.067,
+967, 8115, -0.067,
+967, 8116, -0.067,
+967, 8118, -0.067,
+967, 8119, -0.067,
+967, 8130, -0.058,
+967, 8131, -0.058,
+967, 8132, -0.058,
+967, 8134, -0.058,
+967, 8135, -0.058,
+967, 8150, -0.028,
+967, 8166, -0.044,
+967, 8178, -0.067,
+967, 8179, -0.067,
+967, 8180, -0.067,
+967, 8182, -0.067,
+967, 8183, -0.067,
+968, 947, -0.039,
+968, 965, -0.056,
+968, 967, -0.006,
+968, 973, -0.056,
+968, 993, -0.167,
+968, 8058, -0.056,
+968, 8166, -0.056,
+969, 941, 0.028,
+969, 947, -0.111,
+969, 949, 0.028,
+969, 956, -0.028,
+969, 957, -0.028,
+969, 958, 0.028,
+969, 964, -0.047,
+969, 965, -0.028,
+969, 967, -0.028,
+969, 973, -0.028,
+969, 993, -0.167,
+969, 8050, 0.028,
+969, 8058, -0.028,
+969, 8166, -0.028,
+970, 947, -0.069,
+970, 951, -0.017,
+970, 952, -0.033,
+970, 954, -0.056,
+970, 957, -0.056,
+970, 959, -0.028,
+970, 962, -0.028,
+970, 963, -0.028,
+970, 964, -0.083,
+970, 967, -0.056,
+970, 972, -0.028,
+970, 993, -0.167,
+970, 8000, -0.028,
+970, 8001, -0.028,
+970, 8004, -0.028,
+970, 8005, -0.028,
+970, 8056, -0.028,
+971, 952, -0.028,
+971, 956, -0.011,
+971, 957, -0.039,
+971, 967, -0.028,
+971, 968, 0.028,
+971, 993, -0.167,
+972, 947, -0.028,
+972, 955, -0.028,
+972, 956, -0.011,
+972, 957, -0.039,
+972, 964, -0.033,
+972, 965, -0.056,
+972, 967, -0.028,
+972, 973, -0.056,
+972, 993, -0.167,
+972, 8058, -0.056,
+972, 8166, -0.056,
+973, 952, -0.028,
+973, 956, -0.011,
+973, 957, -0.039,
+973, 967, -0.028,
+973, 968, 0.028,
+973, 993, -0.167,
+974, 941, 0.028,
+974, 947, -0.111,
+974, 949, 0.028,
+974, 956, -0.028,
+974, 957, -0.028,
+974, 958, 0.028,
+974, 964, -0.047,
+974, 965, -0.028,
+974, 967, -0.028,
+974, 973, -0.028,
+974, 8050, 0.028,
+974, 8058, -0.028,
+974, 8166, -0.028,
+985, 993, -0.222,
+987, 993, -0.167,
+991, 993, -0.167,
+993, 993, -0.167,
+7936, 947, -0.083,
+7936, 952, -0.083,
+7936, 957, -0.083,
+7936, 959, -0.028,
+7936, 960, -0.044,
+7936, 964, -0.083,
+7936, 965, -0.083,
+7936, 967, -0.083,
+7936, 968, -0.028,
+7936, 972, -0.028,
+7936, 973, -0.083,
+7936, 8056, -0.028,
+7936, 8058, -0.083,
+7937, 947, -0.083,
+7937, 952, -0.083,
+7937, 957, -0.083,
+7937, 959, -0.028,
+7937, 960, -0.044,
+7937, 964, -0.083,
+7937, 965, -0.083,
+7937, 967, -0.083,
+7937, 968, -0.028,
+7937, 972, -0.028,
+7937, 973, -0.083,
+7937, 8056, -0.028,
+7937, 8058, -0.083,
+7938, 947, -0.083,
+7938, 952, -0.083,
+7938, 957, -0.083,
+7938, 959, -0.028,
+7938, 960, -0.044,
+7938, 964, -0.083,
+7938, 965, -0.083,
+7938, 967, -0.083,
+7938, 968, -0.028,
+7938, 972, -0.028,
+7938, 973, -0.083,
+7938, 8056, -0.028,
+7938, 8058, -0.083,
+7939, 947, -0.083,
+7939, 952, -0.083,
+7939, 957, -0.083,
+7939, 959, -0.028,
+7939, 960, -0.044,
+7939, 964, -0.083,
+7939, 965, -0.083,
+7939, 967, -0.083,
+7939, 968, -0.028,
+7939, 972, -0.028,
+7939, 973, -0.083,
+7939, 8056, -0.028,
+7939, 8058, -0.083,
+7940, 947, -0.083,
+7940, 952, -0.083,
+7940, 957, -0.083,
+7940, 959, -0.028,
+7940, 960, -0.044,
+7940, 964, -0.083,
+7940, 965, -0.083,
+7940, 967, -0.083,
+7940, 968, -0.028,
+7940, 972, -0.028,
+7940, 973, -0.083,
+7940, 8056, -0.028,
+7940, 8058, -0.083,
+7941, 947, -0.083,
+7941, 952, -0.083,
+7941, 957, -0.044,
+7941, 959, -0.028,
+7941, 960, -0.044,
+7941, 964, -0.083,
+7941, 965, -0.083,
+7941, 967, -0.083,
+7941, 968, -0.028,
+7941, 972, -0.028,
+7941, 973, -0.083,
+7941, 8056, -0.028,
+7941, 8058, -0.083,
+7942, 947, -0.083,
+7942, 952, -0.083,
+7942, 957, -0.083,
+7942, 959, -0.028,
+7942, 960, -0.044,
+7942, 964, -0.083,
+7942, 965, -0.083,
+7942, 967, -0.083,
+7942, 968, -0.028,
+7942, 972, -0.028,
+7942, 973, -0.083,
+7942, 8056, -0.028,
+7942, 8058, -0.083,
+7943, 947, -0.083,
+7943, 952, -0.083,
+7943, 957, -0.083,
+7943, 959, -0.028,
+7943, 960, -0.044,
+7943, 964, -0.083,
+7943, 965, -0.083,
+7943, 967, -0.083,
+7943, 968, -0.028,
+7943, 972, -0.028,
+7943, 973, -0.083,
+7943, 8056, -0.028,
+7943, 8058, -0.083,
+7952, 940, -0.028,
+7952, 945, -0.028,
+7952, 948, -0.028,
+7952, 963, -0.028,
+7952, 965, -0.028,
+7952, 967, -0.008,
+7952, 973, -0.028,
+7952, 993, -0.167,
+7952, 8048, -0.028,
+7952, 8058, -0.028,
+7952, 8114, -0.028,
+7952, 8115, -0.028,
+7952, 8116, -0.028,
+7952, 8118, -0.028,
+7952, 8119, -0.028,
+7952, 8166, -0.028,
+7953, 940, -0.028,
+7953, 945, -0.028,
+7953, 948, -0.028,
+7953, 963, -0.028,
+7953, 965, -0.028,
+7953, 967, -0.008,
+7953, 973, -0.028,
+7953, 993, -0.167,
+7953, 8048, -0.028,
+7953, 8058, -0.028,
+7953, 8114, -0.028,
+7953, 8115, -0.028,
+7953, 8116, -0.028,
+7953, 8118, -0.028,
+7953, 8119, -0.028,
+7953, 8166, -0.028,
+7954, 940, -0.028,
+7954, 945, -0.028,
+7954, 948, -0.028,
+7954, 963, -0.028,
+7954, 965, -0.028,
+7954, 967, -0.008,
+7954, 973, -0.028,
+7954, 993, -0.167,
+7954, 8048, -0.028,
+7954, 8058, -0.028,
+7954, 8114, -0.028,
+7954, 8115, -0.028,
+7954, 8116, -0.028,
+7954, 8118, -0.028,
+7954, 8119, -0.028,
+7954, 8166, -0.028,
+7955, 940, -0.028,
+7955, 945, -0.028,
+7955, 948, -0.028,
+7955, 963, -0.028,
+7955, 965, -0.028,
+7955, 967, -0.008,
+7955, 973, -0.028,
+7955, 993, -0.167,
+7955, 8048, -0.028,
+7955, 8058, -0.028,
+7955, 8114, -0.028,
+7955, 8115, -0.028,
+7955, 8116, -0.028,
+7955, 8118, -0.028,
+7955, 8119, -0.028,
+7955, 8166, -0.028,
+7956, 940, -0.028,
+7956, 945, -0.028,
+7956, 948, -0.028,
+7956, 963, -0.028,
+7956, 965, -0.028,
+7956, 967, -0.008,
+7956, 973, -0.028,
+7956, 993, -0.167,
+7956, 8048, -0.028,
+7956, 8058, -0.028,
+7956, 8114, -0.028,
+7956, 8115, -0.028,
+7956, 8116, -0.028,
+7956, 8118, -0.028,
+7956, 8119, -0.028,
+7956, 8166, -0.028,
+7957, 940, -0.028,
+7957, 945, -0.028,
+7957, 948, -0.028,
+7957, 963, -0.028,
+7957, 965, -0.028,
+7957, 967, -0.008,
+7957, 973, -0.028,
+7957, 993, -0.167,
+7957, 8048, -0.028,
+7957, 8058, -0.028,
+7957, 8114, -0.028,
+7957, 8115, -0.028,
+7957, 8116, -0.028,
+7957, 8118, -0.028,
+7957, 8119, -0.028,
+7957, 8166, -0.028,
+7968, 957, -0.028,
+7968, 965, -0.028,
+7968, 973, -0.028,
+7968, 8058, -0.028,
+7968, 8166, -0.028,
+7969, 957, -0.028,
+7969, 965, -0.028,
+7969, 973, -0.028,
+7969, 8058, -0.028,
+7969, 8166, -0.028,
+7970, 957, -0.028,
+7970, 965, -0.028,
+7970, 973, -0.028,
+7970, 8058, -0.028,
+7970, 8166, -0.028,
+7971, 957, -0.028,
+7971, 965, -0.028,
+7971, 973, -0.028,
+7971, 8058, -0.028,
+7971, 8166, -0.028,
+7972, 957, -0.028,
+7972, 965, -0.028,
+7972, 973, -0.028,
+7972, 8058, -0.028,
+7972, 8166, -0.028,
+7973, 957, -0.028,
+7973, 965, -0.028,
+7973, 973, -0.028,
+7973, 8058, -0.028,
+7973, 8166, -0.028,
+7974, 957, -0.028,
+7974, 965, -0.028,
+7974, 973, -0.028,
+7974, 8058, -0.028,
+7974, 8166, -0.028,
+7975, 957, -0.028,
+7975, 965, -0.028,
+7975, 973, -0.028,
+7975, 8058, -0.028,
+7975, 8166, -0.028,
+7984, 947, -0.069,
+7984, 951, -0.017,
+7984, 952, -0.033,
+7984, 954, -0.056,
+7984, 957, -0.056,
+7984, 959, -0.028,
+7984, 962, -0.028,
+7984, 963, -0.028,
+7984, 964, -0.083,
+7984, 967, -0.056,
+7984, 972, -0.028,
+7984, 993, -0.167,
+7984, 8000, -0.028,
+7984, 8001, -0.028,
+7984, 8004, -0.028,
+7984, 8005, -0.028,
+7984, 8056, -0.028,
+7985, 947, -0.069,
+7985, 951, -0.017,
+7985, 952, -0.033,
+7985, 954, -0.056,
+7985, 957, -0.056,
+7985, 959, -0.028,
+7985, 962, -0.028,
+7985, 963, -0.028,
+7985, 964, -0.083,
+7985, 967, -0.056,
+7985, 972, -0.028,
+7985, 993, -0.167,
+7985, 8000, -0.028,
+7985, 8001, -0.028,
+7985, 8004, -0.028,
+7985, 8005, -0.028,
+7985, 8056, -0.028,
+7988, 947, -0.069,
+7988, 951, -0.017,
+7988, 952, -0.033,
+7988, 954, -0.056,
+7988, 957, -0.056,
+7988, 959, -0.028,
+7988, 962, -0.028,
+7988, 963, -0.028,
+7988, 964, -0.083,
+7988, 967, -0.056,
+7988, 972, -0.028,
+7988, 993, -0.167,
+7988, 8000, -0.028,
+7988, 8001, -0.028,
+7988, 8004, -0.028,
+7988, 8005, -0.028,
+7988, 8056, -0.028,
+7989, 947, -0.069,
+7989, 951, -0.017,
+7989, 952, -0.033,
+7989, 954, -0.056,
+7989, 957, -0.056,
+7989, 959, -0.028,
+7989, 962, -0.028,
+7989, 963, -0.028,
+7989, 964, -0.083,
+7989, 967, -0.056,
+7989, 972, -0.028,
+7989, 993, -0.167,
+7989, 8000, -0.028,
+7989, 8001, -0.028,
+7989, 8004, -0.028,
+7989, 8005, -0.028,
+7989, 8056, -0.028,
+7990, 947, -0.069,
+7990, 951, -0.017,
+7990, 952, -0.033,
+7990, 954, -0.056,
+7990, 957, -0.056,
+7990, 959, -0.028,
+7990, 962, -0.028,
+7990, 963, -0.028,
+7990, 964, -0.083,
+7990, 967, -0.056,
+7990, 972, -0.028,
+7990, 993, -0.167,
+7990, 8000, -0.028,
+7990, 8001, -0.028,
+7990, 8004, -0.028,
+7990, 8005, -0.028,
+7990, 8056, -0.028,
+7991, 947, -0.069,
+7991, 951, -0.017,
+7991, 952, -0.033,
+7991, 954, -0.056,
+7991, 957, -0.056,
+7991, 959, -0.028,
+7991, 962, -0.028,
+7991, 963, -0.028,
+7991, 964, -0.083,
+7991, 967, -0.056,
+7991, 972, -0.028,
+7991, 993, -0.167,
+7991, 8000, -0.028,
+7991, 8001, -0.028,
+7991, 8004, -0.028,
+7991, 8005, -0.028,
+7991, 8056, -0.028,
+8000, 947, -0.028,
+8000, 955, -0.028,
+8000, 956, -0.011,
+8000, 957, -0.039,
+8000, 964, -0.033,
+8000, 965, -0.056,
+8000, 967, -0.028,
+8000, 973, -0.056,
+8000, 993, -0.167,
+8000, 8058, -0.056,
+8000, 8166, -0.056,
+8001, 947, -0.028,
+8001, 955, -0.028,
+8001, 956, -0.011,
+8001, 957, -0.039,
+8001, 964, -0.033,
+8001, 965, -0.056,
+8001, 967, -0.028,
+8001, 973, -0.056,
+8001, 993, -0.167,
+8001, 8058, -0.056,
+8001, 8166, -0.056,
+8002, 947, -0.028,
+8002, 955, -0.028,
+8002, 956, -0.011,
+8002, 957, -0.039,
+8002, 964, -0.033,
+8002, 965, -0.056,
+8002, 967, -0.028,
+8002, 973, -0.056,
+8002, 993, -0.167,
+8002, 8058, -0.056,
+8002, 8166, -0.056,
+8003, 947, -0.028,
+8003, 955, -0.028,
+8003, 956, -0.011,
+8003, 957, -0.039,
+8003, 964, -0.033,
+8003, 965, -0.056,
+8003, 967, -0.028,
+8003, 973, -0.056,
+8003, 993, -0.167,
+8003, 8058, -0.056,
+8003, 8166, -0.056,
+8004, 947, -0.028,
+8004, 955, -0.028,
+8004, 956, -0.011,
+8004, 957, -0.039,
+8004, 964, -0.033,
+8004, 965, -0.056,
+8004, 967, -0.028,
+8004, 973, -0.056,
+8004, 993, -0.167,
+8004, 8058, -0.056,
+8004, 8166, -0.056,
+8005, 947, -0.028,
+8005, 955, -0.028,
+8005, 956, -0.011,
+8005, 957, -0.039,
+8005, 964, -0.033,
+8005, 965, -0.056,
+8005, 967, -0.028,
+8005, 973, -0.056,
+8005, 993, -0.167,
+8005, 8058, -0.056,
+8005, 8166, -0.056,
+8016, 952, -0.028,
+8016, 956, -0.011,
+8016, 957, -0.039,
+8016, 967, -0.028,
+8016, 968, 0.028,
+8016, 993, -0.167,
+8017, 952, -0.028,
+8017, 956, -0.011,
+8017, 957, -0.039,
+8017, 967, -0.028,
+8017, 968, 0.028,
+8017, 993, -0.167,
+8018, 952, -0.028,
+8018, 956, -0.011,
+8018, 957, -0.039,
+8018, 967, -0.028,
+8018, 968, 0.028,
+8018, 993, -0.167,
+8019, 952, -0.028,
+8019, 956, -0.011,
+8019, 957, -0.039,
+8019, 967, -0.028,
+8019, 968, 0.028,
+8019, 993, -0.167,
+8020, 952, -0.028,
+8020, 956, -0.011,
+8020, 957, -0.039,
+8020, 967, -0.028,
+8020, 968, 0.028,
+8020, 993, -0.167,
+8021, 952, -0.028,
+8021, 956, -0.011,
+8021, 957, -0.039,
+8021, 967, -0.028,
+8021, 968, 0.028,
+8021, 993, -0.167,
+8022, 952, -0.028,
+8022, 956, -0.011,
+8022, 957, -0.039,
+8022, 967, -0.028,
+8022, 968, 0.028,
+8022, 993, -0.167,
+8023, 952, -0.028,
+8023, 956, -0.011,
+8023, 957, -0.039,
+8023, 967, -0.028,
+8023, 968, 0.028,
+8023, 993, -0.167,
+8032, 941, 0.028,
+8032, 947, -0.111,
+8032, 949, 0.028,
+8032, 956, -0.028,
+8032, 957, -0.028,
+8032, 958, 0.028,
+8032, 964, -0.047,
+8032, 965, -0.028,
+8032, 967, -0.028,
+8032, 973, -0.028,
+8032, 8050, 0.028,
+8032, 8058, -0.028,
+8032, 8166, -0.028,
+8033, 941, 0.028,
+8033, 947, -0.111,
+8033, 949, 0.028,
+8033, 956, -0.028,
+8033, 957, -0.028,
+8033, 958, 0.028,
+8033, 964, -0.047,
+8033, 965, -0.028,
+8033, 967, -0.028,
+8033, 973, -0.028,
+8033, 8050, 0.028,
+8033, 8058, -0.028,
+8033, 8166, -0.028,
+8034, 941, 0.028,
+8034, 947, -0.111,
+8034, 949, 0.028,
+8034, 956, -0.028,
+8034, 957, -0.028,
+8034, 958, 0.028,
+8034, 964, -0.047,
+8034, 965, -0.028,
+8034, 967, -0.028,
+8034, 973, -0.028,
+8034, 8050, 0.028,
+8034, 8058, -0.028,
+8034, 8166, -0.028,
+8035, 941, 0.028,
+8035, 947, -0.111,
+8035, 949, 0.028,
+8035, 956, -0.028,
+8035, 957, -0.028,
+8035, 958, 0.028,
+8035, 964, -0.047,
+8035, 965, -0.028,
+8035, 967, -0.028,
+8035, 973, -0.028,
+8035, 8050, 0.028,
+8035, 8058, -0.028,
+8035, 8166, -0.028,
+8036, 941, 0.028,
+8036, 947, -0.111,
+8036, 949, 0.028,
+8036, 956, -0.028,
+8036, 957, -0.028,
+8036, 958, 0.028,
+8036, 964, -0.047,
+8036, 965, -0.028,
+8036, 967, -0.028,
+8036, 973, -0.028,
+8036, 8050, 0.028,
+8036, 8058, -0.028,
+8036, 8166, -0.028,
+8037, 941, 0.028,
+8037, 947, -0.111,
+8037, 949, 0.028,
+8037, 956, -0.028,
+8037, 957, -0.028,
+8037, 958, 0.028,
+8037, 964, -0.047,
+8037, 965, -0.028,
+8037, 967, -0.028,
+8037, 973, -0.028,
+8037, 8050, 0.028,
+8037, 8058, -0.028,
+8037, 8166, -0.028,
+8038, 941, 0.028,
+8038, 947, -0.111,
+8038, 949, 0.028,
+8038, 956, -0.028,
+8038, 957, -0.028,
+8038, 958, 0.028,
+8038, 964, -0.047,
+8038, 965, -0.028,
+8038, 967, -0.028,
+8038, 973, -0.028,
+8038, 8050, 0.028,
+8038, 8058, -0.028,
+8038, 8166, -0.028,
+8039, 941, 0.028,
+8039, 947, -0.111,
+8039, 949, 0.028,
+8039, 956, -0.028,
+8039, 957, -0.028,
+8039, 958, 0.028,
+8039, 964, -0.047,
+8039, 965, -0.028,
+8039, 967, -0.028,
+8039, 973, -0.028,
+8039, 8050, 0.028,
+8039, 8058, -0.028,
+8039, 8166, -0.028,
+8048, 947, -0.083,
+8048, 952, -0.083,
+8048, 957, -0.083,
+8048, 959, -0.028,
+8048, 960, -0.044,
+8048, 964, -0.083,
+8048, 965, -0.083,
+8048, 967, -0.083,
+8048, 968, -0.028,
+8048, 972, -0.028,
+8048, 973, -0.083,
+8048, 8056, -0.028,
+8048, 8058, -0.083,
+8050, 940, -0.028,
+8050, 945, -0.028,
+8050, 948, -0.028,
+8050, 963, -0.028,
+8050, 965, -0.028,
+8050, 967, -0.008,
+8050, 973, -0.028,
+8050, 993, -0.167,
+8050, 8048, -0.028,
+8050, 8058, -0.028,
+8050, 8114, -0.028,
+8050, 8115, -0.028,
+8050, 8116, -0.028,
+8050, 8118, -0.028,
+8050, 8119, -0.028,
+8050, 8166, -0.028,
+8052, 957, -0.028,
+8052, 965, -0.028,
+8052, 973, -0.028,
+8052, 8058, -0.028,
+8052, 8166, -0.028,
+8054, 947, -0.069,
+8054, 951, -0.017,
+8054, 952, -0.033,
+8054, 954, -0.056,
+8054, 957, -0.056,
+8054, 959, -0.028,
+8054, 962, -0.028,
+8054, 963, -0.028,
+8054, 964, -0.083,
+8054, 967, -0.056,
+8054, 972, -0.028,
+8054, 993, -0.167,
+8054, 8000, -0.028,
+8054, 8001, -0.028,
+8054, 8004, -0.028,
+8054, 8005, -0.028,
+8054, 8056, -0.028,
+8056, 947, -0.028,
+8056, 955, -0.028,
+8056, 956, -0.011,
+8056, 957, -0.039,
+8056, 964, -0.033,
+8056, 965, -0.056,
+8056, 967, -0.028,
+8056, 973, -0.056,
+8056, 993, -0.167,
+8056, 8058, -0.056,
+8056, 8166, -0.056,
+8058, 952, -0.028,
+8058, 956, -0.011,
+8058, 957, -0.039,
+8058, 967, -0.028,
+8058, 968, 0.028,
+8058, 993, -0.167,
+8060, 941, 0.028,
+8060, 947, -0.111,
+8060, 949, 0.028,
+8060, 956, -0.028,
+8060, 957, -0.028,
+8060, 958, 0.028,
+8060, 964, -0.047,
+8060, 965, -0.028,
+8060, 967, -0.028,
+8060, 973, -0.028,
+8060, 8050, 0.028,
+8060, 8058, -0.028,
+8060, 8166, -0.028,
+8064, 947, -0.083,
+8064, 952, -0.083,
+8064, 957, -0.083,
+8064, 959, -0.028,
+8064, 960, -0.044,
+8064, 964, -0.083,
+8064, 965, -0.083,
+8064, 967, -0.083,
+8064, 968, -0.028,
+8064, 972, -0.028,
+8064, 973, -0.083,
+8064, 8056, -0.028,
+8064, 8058, -0.083,
+8065, 947, -0.083,
+8065, 952, -0.083,
+8065, 957, -0.083,
+8065, 959, -0.028,
+8065, 960, -0.044,
+8065, 964, -0.083,
+8065, 965, -0.083,
+8065, 967, -0.083,
+8065, 968, -0.028,
+8065, 972, -0.028,
+8065, 973, -0.083,
+8065, 8056, -0.028,
+8065, 8058, -0.083,
+8066, 947, -0.083,
+8066, 952, -0.083,
+8066, 957, -0.083,
+8066, 959, -0.028,
+8066, 960, -0.044,
+8066, 964, -0.083,
+8066, 965, -0.083,
+8066, 967, -0.083,
+8066, 968, -0.028,
+8066, 972, -0.028,
+8066, 973, -0.083,
+8066, 8056, -0.028,
+8066, 8058, -0.083,
+8067, 947, -0.083,
+8067, 952, -0.083,
+8067, 957, -0.083,
+8067, 959, -0.028,
+8067, 960, -0.044,
+8067, 964, -0.083,
+8067, 965, -0.083,
+8067, 967, -0.083,
+8067, 968, -0.028,
+8067, 972, -0.028,
+8067, 973, -0.083,
+8067, 8056, -0.028,
+8067, 8058, -0.083,
+8068, 947, -0.083,
+8068, 952, -0.083,
+8068, 957, -0.083,
+8068, 959, -0.028,
+8068, 960, -0.044,
+8068, 964, -0.083,
+8068, 965, -0.083,
+8068, 967, -0.083,
+8068, 968, -0.028,
+8068, 972, -0.028,
+8068, 973, -0.083,
+8068, 8056, -0.028,
+8068, 8058, -0.083,
+8069, 947, -0.083,
+8069, 952, -0.083,
+8069, 957, -0.044,
+8069, 959, -0.028,
+8069, 960, -0.044,
+8069, 964, -0.083,
+8069, 965, -0.083,
+8069, 967, -0.083,
+8069, 968, -0.028,
+8069, 972, -0.028,
+8069, 973, -0.083,
+8069, 8056, -0.028,
+8069, 8058, -0.083,
+8070, 947, -0.083,
+8070, 952, -0.083,
+8070, 957, -0.083,
+8070, 959, -0.028,
+8070, 960, -0.044,
+8070, 964, -0.083,
+8070, 965, -0.083,
+8070, 967, -0.083,
+8070, 968, -0.028,
+8070, 972, -0.028,
+8070, 973, -0.083,
+8070, 8056, -0.028,
+8070, 8058, -0.083,
+8071, 947, -0.083,
+8071, 952, -0.083,
+8071, 957, -0.083,
+8071, 959, -0.028,
+8071, 960, -0.044,
+8071, 964, -0.083,
+8071, 965, -0.083,
+8071, 967, -0.083,
+8071, 968, -0.028,
+8071, 972, -0.028,
+8071, 973, -0.083,
+8071, 8056, -0.028,
+8071, 8058, -0.083,
+8080, 957, -0.028,
+8080, 965, -0.028,
+8080, 973, -0.028,
+8080, 8058, -0.028,
+8080, 8166, -0.028,
+8081, 957, -0.028,
+8081, 965, -0.028,
+8081, 973, -0.028,
+8081, 8058, -0.028,
+8081, 8166, -0.028,
+8082, 957, -0.028,
+8082, 965, -0.028,
+8082, 973, -0.028,
+8082, 8058, -0.028,
+8082, 8166, -0.028,
+8083, 957, -0.028,
+8083, 965, -0.028,
+8083, 973, -0.028,
+8083, 8058, -0.028,
+8083, 8166, -0.028,
+8084, 957, -0.028,
+8084, 965, -0.028,
+8084, 973, -0.028,
+8084, 8058, -0.028,
+8084, 8166, -0.028,
+8085, 957, -0.028,
+8085, 965, -0.028,
+8085, 973, -0.028,
+8085, 8058, -0.028,
+8085, 8166, -0.028,
+8086, 957, -0.028,
+8086, 965, -0.028,
+8086, 973, -0.028,
+8086, 8058, -0.028,
+8086, 8166, -0.028,
+8087, 957, -0.028,
+8087, 965, -0.028,
+8087, 973, -0.028,
+8087, 8058, -0.028,
+8087, 8166, -0.028,
+8096, 941, 0.028,
+8096, 947, -0.111,
+8096, 949, 0.028,
+8096, 956, -0.028,
+8096, 957, -0.028,
+8096, 958, 0.028,
+8096, 964, -0.047,
+8096, 965, -0.028,
+8096, 967, -0.028,
+8096, 973, -0.028,
+8096, 8050, 0.028,
+8096, 8058, -0.028,
+8096, 8166, -0.028,
+8097, 941, 0.028,
+8097, 947, -0.111,
+8097, 949, 0.028,
+8097, 956, -0.028,
+8097, 957, -0.028,
+8097, 958, 0.028,
+8097, 964, -0.047,
+8097, 965, -0.028,
+8097, 967, -0.028,
+8097, 973, -0.028,
+8097, 8050, 0.028,
+8097, 8058, -0.028,
+8097, 8166, -0.028,
+8098, 941, 0.028,
+8098, 947, -0.111,
+8098, 949, 0.028,
+8098, 956, -0.028,
+8098, 957, -0.028,
+8098, 958, 0.028,
+8098, 964, -0.047,
+8098, 965, -0.028,
+8098, 967, -0.028,
+8098, 973, -0.028,
+8098, 8050, 0.028,
+8098, 8058, -0.028,
+8098, 8166, -0.028,
+8099, 941, 0.028,
+8099, 947, -0.111,
+8099, 949, 0.028,
+8099, 956, -0.028,
+8099, 957, -0.028,
+8099, 958, 0.028,
+8099, 964, -0.047,
+8099, 965, -0.028,
+8099, 967, -0.028,
+8099, 973, -0.028,
+8099, 8050, 0.028,
+8099, 8058, -0.028,
+8099, 8166, -0.028,
+8100, 941, 0.028,
+8100, 947, -0.111,
+8100, 949, 0.028,
+8100, 956, -0.028,
+8100, 957, -0.028,
+8100, 958, 0.028,
+8100, 964, -0.047,
+8100, 965, -0.028,
+8100, 967, -0.028,
+8100, 973, -0.028,
+8100, 8050, 0.028,
+8100, 8058, -0.028,
+8100, 8166, -0.028,
+8101, 941, 0.028,
+8101, 947, -0.111,
+8101, 949, 0.028,
+8101, 956, -0.028,
+8101, 957, -0.028,
+8101, 958, 0.028,
+8101, 964, -0.047,
+8101, 965, -0.028,
+8101, 967, -0.028,
+8101, 973, -0.028,
+8101, 8050, 0.028,
+8101, 8058, -0.028,
+8101, 8166, -0.028,
+8102, 941, 0.028,
+8102, 947, -0.111,
+8102, 949, 0.028,
+8102, 956, -0.028,
+8102, 957, -0.028,
+8102, 958, 0.028,
+8102, 964, -0.047,
+8102, 965, -0.028,
+8102, 967, -0.028,
+8102, 973, -0.028,
+8102, 8050, 0.028,
+8102, 8058, -0.028,
+8102, 8166, -0.028,
+8103, 941, 0.028,
+8103, 947, -0.111,
+8103, 949, 0.028,
+8103, 956, -0.028,
+8103, 957, -0.028,
+8103, 958, 0.028,
+8103, 964, -0.047,
+8103, 965, -0.028,
+8103, 967, -0.028,
+8103, 973, -0.028,
+8103, 8050, 0.028,
+8103, 8058, -0.028,
+8103, 8166, -0.028,
+8114, 947, -0.083,
+8114, 952, -0.083,
+8114, 957, -0.083,
+8114, 959, -0.028,
+8114, 960, -0.044,
+8114, 964, -0.083,
+8114, 965, -0.083,
+8114, 967, -0.083,
+8114, 968, -0.028,
+8114, 972, -0.028,
+8114, 973, -0.083,
+8114, 8056, -0.028,
+8114, 8058, -0.083,
+8115, 947, -0.083,
+8115, 952, -0.083,
+8115, 957, -0.094,
+8115, 959, -0.028,
+8115, 960, -0.044,
+8115, 964, -0.083,
+8115, 965, -0.083,
+8115, 967, -0.083,
+8115, 968, -0.028,
+8115, 972, -0.028,
+8115, 973, -0.083,
+8115, 993, -0.222,
+8115, 8016, -0.083,
+8115, 8018, -0.083,
+8115, 8020, -0.083,
+8115, 8021, -0.083,
+8115, 8022, -0.083,
+8115, 8023, -0.083,
+8115, 8056, -0.028,
+8115, 8058, -0.083,
+8115, 8166, -0.083,
+8116, 947, -0.083,
+8116, 952, -0.083,
+8116, 957, -0.083,
+8116, 959, -0.028,
+8116, 960, -0.044,
+8116, 964, -0.083,
+8116, 965, -0.083,
+8116, 967, -0.083,
+8116, 968, -0.028,
+8116, 972, -0.028,
+8116, 973, -0.083,
+8116, 8056, -0.028,
+8116, 8058, -0.083,
+8118, 947, -0.083,
+8118, 952, -0.083,
+8118, 957, -0.083,
+8118, 959, -0.028,
+8118, 960, -0.044,
+8118, 964, -0.083,
+8118, 965, -0.083,
+8118, 967, -0.083,
+8118, 968, -0.028,
+8118, 972, -0.028,
+8118, 973, -0.083,
+8118, 8056, -0.028,
+8118, 8058, -0.083,
+8119, 947, -0.083,
+8119, 952, -0.083,
+8119, 957, -0.083,
+8119, 959, -0.028,
+8119, 960, -0.044,
+8119, 964, -0.083,
+8119, 965, -0.083,
+8119, 967, -0.083,
+8119, 968, -0.028,
+8119, 972, -0.028,
+8119, 973, -0.083,
+8119, 8056, -0.028,
+8119, 8058, -0.083,
+8124, 920, -0.083,
+8124, 927, -0.083,
+8124, 932, -0.083,
+8124, 933, -0.139,
+8124, 934, -0.083,
+8124, 936, -0.122,
+8124, 939, -0.139,
+8124, 957, -0.097,
+8127, 913, -0.139,
+8127, 927, -0.056,
+8127, 937, -0.028,
+8127, 8124, -0.139,
+8127, 8188, -0.028,
+8128, 913, -0.111,
+8128, 8124, -0.111,
+8130, 957, -0.028,
+8130, 965, -0.028,
+8130, 973, -0.028,
+8130, 8058, -0.028,
+8130, 8166, -0.028,
+8131, 957, -0.028,
+8131, 965, -0.028,
+8131, 973, -0.028,
+8131, 993, -0.167,
+8131, 8058, -0.028,
+8131, 8166, -0.028,
+8132, 957, -0.028,
+8132, 965, -0.028,
+8132, 973, -0.028,
+8132, 8058, -0.028,
+8132, 8166, -0.028,
+8134, 957, -0.028,
+8134, 965, -0.028,
+8134, 973, -0.028,
+8134, 8058, -0.028,
+8134, 8166, -0.028,
+8135, 957, -0.028,
+8135, 965, -0.028,
+8135, 973, -0.028,
+8135, 8058, -0.028,
+8135, 8166, -0.028,
+8141, 913, -0.083,
+8141, 927, -0.028,
+8141, 8124, -0.083,
+8142, 913, -0.083,
+8142, 927, -0.028,
+8142, 8124, -0.083,
+8143, 913, -0.111,
+8143, 8124, -0.111,
+8146, 947, -0.069,
+8146, 951, -0.017,
+8146, 952, -0.033,
+8146, 954, -0.056,
+8146, 957, -0.056,
+8146, 959, -0.028,
+8146, 962, -0.028,
+8146, 963, -0.028,
+8146, 964, -0.083,
+8146, 967, -0.056,
+8146, 972, -0.028,
+8146, 993, -0.167,
+8146, 8000, -0.028,
+8146, 8001, -0.028,
+8146, 8004, -0.028,
+8146, 8005, -0.028,
+8146, 8056, -0.028,
+8150, 947, -0.069,
+8150, 951, -0.017,
+8150, 952, -0.033,
+8150, 954, -0.056,
+8150, 957, -0.056,
+8150, 959, -0.028,
+8150, 962, -0.028,
+8150, 963, -0.028,
+8150, 964, -0.083,
+8150, 967, -0.056,
+8150, 972, -0.028,
+8150, 993, -0.167,
+8150, 8000, -0.028,
+8150, 8001, -0.028,
+8150, 8004, -0.028,
+8150, 8005, -0.028,
+8150, 8056, -0.028,
+8151, 947, -0.069,
+8151, 951, -0.017,
+8151, 952, -0.033,
+8151, 954, -0.056,
+8151, 957, -0.056,
+8151, 959, -0.028,
+8151, 962, -0.028,
+8151, 963, -0.028,
+8151, 964, -0.083,
+8151, 967, -0.056,
+8151, 972, -0.028,
+8151, 993, -0.167,
+8151, 8000, -0.028,
+8151, 8001, -0.028,
+8151, 8004, -0.028,
+8151, 8005, -0.028,
+8151, 8056, -0.028,
+8157, 913, -0.083,
+8157, 927, -0.028,
+8157, 8124, -0.083,
+8158, 913, -0.083,
+8158, 927, -0.028,
+8158, 8124, -0.083,
+8159, 913, -0.111,
+8159, 8124, -0.111,
+8162, 952, -0.028,
+8162, 956, -0.011,
+8162, 957, -0.039,
+8162, 967, -0.028,
+8162, 968, 0.028,
+8162, 993, -0.167,
+8164, 943, 0.028,
+8164, 947, -0.056,
+8164, 950, 0.028,
+8164, 953, 0.028,
+8164, 957, -0.05,
+8164, 959, 0.028,
+8164, 963, 0.028,
+8164, 967, -0.011,
+8164, 968, 0.017,
+8164, 972, 0.028,
+8164, 993, -0.167,
+8164, 8054, 0.028,
+8164, 8056, 0.028,
+8164, 8150, 0.028,
+8165, 943, 0.028,
+8165, 947, -0.056,
+8165, 950, 0.028,
+8165, 953, 0.028,
+8165, 957, -0.05,
+8165, 959, 0.028,
+8165, 963, 0.028,
+8165, 967, -0.011,
+8165, 968, 0.017,
+8165, 972, 0.028,
+8165, 993, -0.167,
+8165, 8054, 0.028,
+8165, 8056, 0.028,
+8165, 8150, 0.028,
+8166, 952, -0.028,
+8166, 956, -0.011,
+8166, 957, -0.039,
+8166, 967, -0.028,
+8166, 968, 0.028,
+8166, 993, -0.167,
+8167, 952, -0.028,
+8167, 956, -0.011,
+8167, 957, -0.039,
+8167, 967, -0.028,
+8167, 968, 0.028,
+8167, 993, -0.167,
+8175, 913, -0.111,
+8175, 927, -0.056,
+8175, 937, -0.028,
+8175, 8124, -0.111,
+8175, 8188, -0.028,
+8178, 941, 0.028,
+8178, 947, -0.111,
+8178, 949, 0.028,
+8178, 956, -0.028,
+8178, 957, -0.028,
+8178, 958, 0.028,
+8178, 964, -0.047,
+8178, 965, -0.028,
+8178, 967, -0.028,
+8178, 973, -0.028,
+8178, 8050, 0.028,
+8178, 8058, -0.028,
+8178, 8166, -0.028,
+8179, 941, 0.028,
+8179, 947, -0.111,
+8179, 949, 0.028,
+8179, 956, -0.028,
+8179, 957, -0.028,
+8179, 958, 0.028,
+8179, 964, -0.047,
+8179, 965, -0.028,
+8179, 967, -0.028,
+8179, 973, -0.028,
+8179, 993, -0.167,
+8179, 8050, 0.028,
+8179, 8058, -0.028,
+8179, 8166, -0.028,
+8180, 941, 0.028,
+8180, 947, -0.111,
+8180, 949, 0.028,
+8180, 956, -0.028,
+8180, 957, -0.028,
+8180, 958, 0.028,
+8180, 964, -0.047,
+8180, 965, -0.028,
+8180, 967, -0.028,
+8180, 973, -0.028,
+8180, 8050, 0.028,
+8180, 8058, -0.028,
+8180, 8166, -0.028,
+8182, 941, 0.028,
+8182, 947, -0.111,
+8182, 949, 0.028,
+8182, 956, -0.028,
+8182, 957, -0.028,
+8182, 958, 0.028,
+8182, 964, -0.047,
+8182, 965, -0.028,
+8182, 967, -0.028,
+8182, 973, -0.028,
+8182, 8050, 0.028,
+8182, 8058, -0.028,
+8182, 8166, -0.028,
+8183, 941, 0.028,
+8183, 947, -0.111,
+8183, 949, 0.028,
+8183, 956, -0.028,
+8183, 957, -0.028,
+8183, 958, 0.028,
+8183, 964, -0.047,
+8183, 965, -0.028,
+8183, 967, -0.028,
+8183, 973, -0.028,
+8183, 8050, 0.028,
+8183, 8058, -0.028,
+8183, 8166, -0.028,
+8190, 913, -0.167,
+8190, 927, -0.056,
+8190, 937, -0.028,
+8190, 8124, -0.167,
+8190, 8188, -0.028
+KERNS_END
+
+END
+
+DEF_FONT(fcmrpg, greek/fcmrpg.ttf, 205)
+
+xHeight(0.443) quad(1) space(0.278)
+
+bold(fcmbpg) ss(fcsrpg) tt(fctrpg) it(fcmripg)
+
+METRICS_START
+32, 0.278, 0.0, 0, 0,
+168, 0.222, 0.603, 0, 0.041,
+884, 0.194, 0.701, 0, 0,
+885, 0.194, 0.003, 0.217, 0,
+890, 0.111, -0.063, 0.228, 0,
+900, 0.167, 0.701, 0, 0,
+901, 0.278, 0.701, 0, 0,
+903, 0.278, 0.431, 0, 0,
+912, 0.25, 0.701, 0.012, 0,
+913, 0.75, 0.717, 0, 0,
+914, 0.708, 0.685, 0, 0,
+915, 0.625, 0.681, 0, 0,
+916, 0.833, 0.718, 0, 0,
+917, 0.68, 0.681, 0, 0,
+918, 0.611, 0.685, 0, 0,
+919, 0.75, 0.684, 0, 0,
+920, 0.778, 0.706, 0.021, 0,
+921, 0.361, 0.684, 0, 0,
+922, 0.778, 0.684, 0, 0,
+923, 0.694, 0.718, 0, 0,
+924, 0.916, 0.684, 0, 0,
+925, 0.75, 0.684, 0, 0,
+926, 0.667, 0.678, 0, 0,
+927, 0.778, 0.706, 0.021, 0,
+928, 0.75, 0.681, 0, 0,
+929, 0.68, 0.685, 0, 0,
+931, 0.722, 0.684, 0, 0,
+932, 0.722, 0.678, 0, 0,
+933, 0.778, 0.707, 0, 0,
+934, 0.722, 0.684, 0, 0,
+935, 0.75, 0.684, 0, 0,
+936, 0.778, 0.684, 0, 0,
+937, 0.722, 0.706, 0, 0,
+938, 0.361, 0.833, 0, 0,
+939, 0.778, 0.833, 0, 0,
+940, 0.5, 0.702, 0.011, 0.001,
+941, 0.43, 0.701, 0.021, 0,
+942, 0.5, 0.701, 0.271, 0,
+943, 0.25, 0.701, 0.012, 0,
+944, 0.5, 0.702, 0.01, 0,
+945, 0.5, 0.443, 0.011, 0.001,
+946, 0.5, 0.706, 0.276, 0,
+947, 0.555, 0.442, 0.2, 0,
+948, 0.472, 0.7, 0.01, 0,
+949, 0.43, 0.454, 0.021, 0,
+950, 0.472, 0.718, 0.139, 0,
+951, 0.5, 0.454, 0.271, 0,
+952, 0.472, 0.717, 0.022, 0,
+953, 0.25, 0.443, 0.012, 0,
+954, 0.528, 0.454, 0.022, 0,
+955, 0.5, 0.697, 0.01, 0,
+956, 0.519, 0.453, 0.26, 0,
+957, 0.472, 0.443, 0.01, 0,
+958, 0.472, 0.717, 0.139, 0,
+959, 0.528, 0.443, 0.011, 0,
+960, 0.514, 0.432, 0.018, 0,
+961, 0.472, 0.442, 0.261, 0,
+962, 0.444, 0.443, 0.125, 0,
+963, 0.569, 0.432, 0.01, 0,
+964, 0.458, 0.432, 0.01, 0,
+965, 0.5, 0.457, 0.01, 0,
+966, 0.583, 0.455, 0.275, 0,
+967, 0.555, 0.444, 0.262, 0,
+968, 0.583, 0.72, 0.276, 0,
+969, 0.667, 0.453, 0.011, 0,
+970, 0.25, 0.626, 0.012, 0,
+971, 0.5, 0.626, 0.01, 0,
+972, 0.528, 0.701, 0.011, 0,
+973, 0.5, 0.702, 0.01, 0,
+974, 0.667, 0.701, 0.011, 0,
+977, 0.569, 0.707, 0.011, 0,
+984, 0.5, 0.695, 0.001, 0,
+985, 0.5, 0.599, 0.063, 0,
+986, 0.778, 0.679, 0, 0,
+987, 0.5, 0.454, 0.027, 0,
+988, 0.653, 0.681, 0, 0,
+989, 0.5, 0.432, 0.257, 0,
+991, 0.389, 0.595, 0.138, 0,
+992, 0.766, 0.695, 0, 0,
+993, 0.722, 0.696, 0.022, 0,
+7936, 0.5, 0.696, 0.011, 0.001,
+7937, 0.5, 0.696, 0.011, 0.001,
+7938, 0.5, 0.702, 0.011, 0.001,
+7939, 0.5, 0.702, 0.011, 0.001,
+7940, 0.5, 0.701, 0.011, 0.001,
+7941, 0.5, 0.701, 0.011, 0.001,
+7942, 0.5, 0.696, 0.011, 0.001,
+7943, 0.5, 0.696, 0.011, 0.001,
+7952, 0.43, 0.696, 0.021, 0,
+7953, 0.43, 0.696, 0.021, 0,
+7954, 0.43, 0.701, 0.021, 0,
+7955, 0.43, 0.701, 0.021, 0,
+7956, 0.43, 0.701, 0.021, 0,
+7957, 0.43, 0.701, 0.021, 0,
+7968, 0.5, 0.696, 0.271, 0,
+7969, 0.5, 0.696, 0.271, 0,
+7970, 0.5, 0.701, 0.271, 0,
+7971, 0.5, 0.701, 0.271, 0,
+7972, 0.5, 0.701, 0.271, 0,
+7973, 0.5, 0.701, 0.271, 0,
+7974, 0.5, 0.696, 0.271, 0,
+7975, 0.5, 0.696, 0.271, 0,
+7984, 0.25, 0.696, 0.012, 0,
+7985, 0.25, 0.696, 0.012, 0,
+7986, 0.25, 0.701, 0.012, 0,
+7987, 0.25, 0.701, 0.012, 0,
+7988, 0.25, 0.701, 0.012, 0,
+7989, 0.25, 0.701, 0.012, 0,
+7990, 0.25, 0.696, 0.012, 0.008,
+7991, 0.25, 0.696, 0.012, 0.008,
+8000, 0.528, 0.696, 0.011, 0,
+8001, 0.528, 0.696, 0.011, 0,
+8002, 0.528, 0.701, 0.011, 0,
+8003, 0.528, 0.701, 0.011, 0,
+8004, 0.528, 0.701, 0.011, 0,
+8005, 0.528, 0.701, 0.011, 0,
+8016, 0.5, 0.696, 0.01, 0,
+8017, 0.5, 0.696, 0.01, 0,
+8018, 0.5, 0.701, 0.01, 0,
+8019, 0.5, 0.701, 0.01, 0,
+8020, 0.5, 0.701, 0.01, 0,
+8021, 0.5, 0.701, 0.01, 0,
+8022, 0.5, 0.696, 0.01, 0,
+8023, 0.5, 0.696, 0.01, 0,
+8032, 0.667, 0.696, 0.011, 0,
+8033, 0.667, 0.696, 0.011, 0,
+8034, 0.667, 0.702, 0.011, 0,
+8035, 0.667, 0.702, 0.011, 0,
+8036, 0.667, 0.701, 0.011, 0,
+8037, 0.667, 0.701, 0.011, 0,
+8038, 0.667, 0.696, 0.011, 0,
+8039, 0.667, 0.696, 0.011, 0,
+8048, 0.5, 0.701, 0.011, 0.001,
+8050, 0.43, 0.701, 0.021, 0,
+8052, 0.5, 0.701, 0.271, 0,
+8054, 0.25, 0.701, 0.012, 0,
+8056, 0.528, 0.701, 0.011, 0,
+8058, 0.5, 0.701, 0.01, 0,
+8060, 0.667, 0.701, 0.011, 0,
+8064, 0.5, 0.696, 0.228, 0.001,
+8065, 0.5, 0.696, 0.228, 0.001,
+8066, 0.5, 0.702, 0.228, 0.001,
+8067, 0.5, 0.702, 0.228, 0.001,
+8068, 0.5, 0.701, 0.228, 0.001,
+8069, 0.5, 0.701, 0.228, 0.001,
+8070, 0.5, 0.696, 0.228, 0.001,
+8071, 0.5, 0.696, 0.228, 0.001,
+8080, 0.5, 0.696, 0.271, 0,
+8081, 0.5, 0.696, 0.271, 0,
+8082, 0.5, 0.701, 0.271, 0,
+8083, 0.5, 0.701, 0.271, 0,
+8084, 0.5, 0.701, 0.271, 0,
+8085, 0.5, 0.701, 0.271, 0,
+8086, 0.5, 0.696, 0.271, 0,
+8087, 0.5, 0.696, 0.271, 0,
+8096, 0.667, 0.696, 0.228, 0,
+8097, 0.667, 0.696, 0.228, 0,
+8098, 0.667, 0.702, 0.228, 0,
+8099, 0.667, 0.702, 0.228, 0,
+8100, 0.667, 0.701, 0.228, 0,
+8101, 0.667, 0.701, 0.228, 0,
+8102, 0.667, 0.696, 0.228, 0,
+8103, 0.667, 0.696, 0.228, 0,
+8114, 0.5, 0.701, 0.228, 0.001,
+8115, 0.5, 0.443, 0.228, 0.001,
+8116, 0.5, 0.702, 0.228, 0.001,
+8118, 0.5, 0.627, 0.011, 0.001,
+8119, 0.5, 0.627, 0.228, 0.001,
+8124, 0.75, 0.717, 0.228, 0,
+8126, 0.222, 0.158, 0.156, 0,
+8127, 0.222, 0.696, 0, 0,
+8128, 0.333, 0.627, 0, 0,
+8129, 0.444, 0.696, 0, 0,
+8130, 0.5, 0.701, 0.271, 0,
+8131, 0.5, 0.454, 0.271, 0,
+8132, 0.5, 0.701, 0.271, 0,
+8134, 0.5, 0.627, 0.271, 0,
+8135, 0.5, 0.627, 0.271, 0,
+8140, 0.75, 0.684, 0.228, 0,
+8141, 0.278, 0.701, 0, 0.016,
+8142, 0.278, 0.701, 0, 0.012,
+8143, 0.333, 0.696, 0, 0,
+8146, 0.25, 0.701, 0.012, 0,
+8150, 0.25, 0.627, 0.012, 0.008,
+8151, 0.25, 0.696, 0.012, 0.008,
+8157, 0.278, 0.701, 0, 0.016,
+8158, 0.278, 0.701, 0, 0.012,
+8159, 0.333, 0.696, 0, 0,
+8162, 0.5, 0.701, 0.01, 0,
+8164, 0.472, 0.696, 0.261, 0,
+8165, 0.472, 0.696, 0.261, 0,
+8166, 0.5, 0.627, 0.01, 0,
+8167, 0.5, 0.696, 0.01, 0,
+8173, 0.278, 0.701, 0, 0,
+8175, 0.167, 0.701, 0, 0,
+8178, 0.667, 0.701, 0.228, 0,
+8179, 0.667, 0.453, 0.228, 0,
+8180, 0.667, 0.701, 0.228, 0,
+8182, 0.667, 0.628, 0.011, 0,
+8183, 0.667, 0.628, 0.228, 0,
+8188, 0.722, 0.706, 0.228, 0,
+8190, 0.222, 0.696, 0, 0,
+8217, 0.278, 0.695, 0, 0,
+9001, 0.389, 0.751, 0.249, 0,
+9002, 0.389, 0.751, 0.25, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.111,
+900, 927, -0.056,
+900, 937, -0.028,
+900, 8124, -0.111,
+900, 8188, -0.028,
+912, 947, -0.028,
+912, 951, -0.017,
+912, 952, -0.017,
+912, 957, -0.056,
+912, 959, -0.028,
+912, 962, -0.028,
+912, 963, -0.028,
+912, 964, -0.028,
+912, 967, -0.028,
+912, 977, -0.017,
+913, 920, -0.083,
+913, 927, -0.083,
+913, 932, -0.083,
+913, 933, -0.139,
+913, 934, -0.083,
+913, 936, -0.122,
+913, 939, -0.139,
+915, 913, -0.133,
+915, 916, -0.111,
+915, 923, -0.122,
+915, 8124, -0.133,
+916, 927, -0.033,
+916, 933, -0.139,
+916, 939, -0.139,
+920, 913, -0.083,
+920, 8124, -0.083,
+922, 927, -0.083,
+923, 927, -0.033,
+923, 933, -0.1,
+923, 939, -0.1,
+925, 913, -0.083,
+925, 8124, -0.083,
+927, 913, -0.083,
+927, 931, -0.056,
+927, 8124, -0.083,
+929, 913, -0.167,
+929, 8124, -0.167,
+931, 913, -0.028,
+931, 8124, -0.028,
+932, 913, -0.083,
+932, 8124, -0.083,
+933, 913, -0.139,
+933, 916, -0.139,
+933, 923, -0.139,
+933, 8124, -0.139,
+934, 913, -0.083,
+934, 8124, -0.083,
+936, 913, -0.122,
+936, 8124, -0.122,
+939, 913, -0.139,
+939, 916, -0.139,
+939, 923, -0.139,
+939, 8124, -0.139,
+943, 947, -0.028,
+943, 951, -0.017,
+943, 952, -0.028,
+943, 957, -0.056,
+943, 959, -0.028,
+943, 962, -0.028,
+943, 963, -0.028,
+943, 964, -0.028,
+943, 967, -0.028,
+943, 977, -0.017,
+953, 947, -0.028,
+953, 951, -0.017,
+953, 952, -0.028,
+953, 957, -0.056,
+953, 959, -0.028,
+953, 962, -0.028,
+953, 963, -0.028,
+953, 964, -0.028,
+953, 967, -0.028,
+953, 977, -0.017,
+959, 947, -0.028,
+959, 955, -0.028,
+959, 957, -0.022,
+959, 964, -0.022,
+959, 967, -0.028,
+964, 940, -0.028,
+964, 945, -0.028,
+964, 959, -0.028,
+964, 969, -0.028,
+964, 972, -0.028,
+964, 974, -0.028,
+964, 7936, -0.028,
+964, 7937, -0.028,
+964, 7940, -0.028,
+964, 7941, -0.028,
+964, 7942, -0.028,
+964, 7943, -0.028,
+964, 8000, -0.028,
+964, 8001, -0.028,
+964, 8004, -0.028,
+964, 8005, -0.028,
+964, 8032, -0.028,
+964, 8033, -0.028,
+964, 8036, -0.028,
+964, 8037, -0.028,
+964, 8038, -0.028,
+964, 8039, -0.028,
+964, 8048, -0.028,
+964, 8056, -0.028,
+964, 8060, -0.028,
+964, 8064, -0.028,
+964, 8065, -0.028,
+964, 8068, -0.028,
+964, 8069, -0.028,
+964, 8070, -0.028,
+964, 8071, -0.028,
+964, 8096, -0.028,
+964, 8097, -0.028,
+964, 8100, -0.028,
+964, 8101, -0.028,
+964, 8102, -0.028,
+964, 8103, -0.028,
+964, 8114, -0.028,
+964, 8116, -0.028,
+964, 8118, -0.028,
+964, 8119, -0.028,
+964, 8178, -0.028,
+964, 8180, -0.028,
+964, 8182, -0.028,
+964, 8183, -0.028,
+970, 947, -0.028,
+970, 951, -0.017,
+970, 952, -0.017,
+970, 957, -0.056,
+970, 959, -0.028,
+970, 962, -0.028,
+970, 963, -0.028,
+970, 964, -0.028,
+970, 967, -0.028,
+970, 977, -0.017,
+972, 947, -0.028,
+972, 955, -0.028,
+972, 957, -0.022,
+972, 964, -0.022,
+972, 967, -0.028,
+7984, 947, -0.028,
+7984, 951, -0.017,
+7984, 952, -0.028,
+7984, 957, -0.056,
+7984, 959, -0.028,
+7984, 962, -0.028,
+7984, 963, -0.028,
+7984, 964, -0.028,
+7984, 967, -0.028,
+7984, 977, -0.017,
+7985, 947, -0.028,
+7985, 951, -0.017,
+7985, 952, -0.028,
+7985, 957, -0.056,
+7985, 959, -0.028,
+7985, 962, -0.028,
+7985, 963, -0.028,
+7985, 964, -0.028,
+7985, 967, -0.028,
+7985, 977, -0.017,
+7988, 947, -0.028,
+7988, 951, -0.017,
+7988, 952, -0.017,
+7988, 957, -0.056,
+7988, 959, -0.028,
+7988, 962, -0.028,
+7988, 963, -0.028,
+7988, 964, -0.028,
+7988, 967, -0.028,
+7988, 977, -0.017,
+7989, 947, -0.028,
+7989, 951, -0.017,
+7989, 952, -0.017,
+7989, 957, -0.056,
+7989, 959, -0.028,
+7989, 962, -0.028,
+7989, 963, -0.028,
+7989, 964, -0.028,
+7989, 967, -0.028,
+7989, 977, -0.017,
+7990, 947, -0.028,
+7990, 951, -0.017,
+7990, 952, -0.017,
+7990, 957, -0.056,
+7990, 959, -0.028,
+7990, 962, -0.028,
+7990, 963, -0.028,
+7990, 964, -0.028,
+7990, 967, -0.028,
+7990, 977, -0.017,
+7991, 947, -0.028,
+7991, 951, -0.017,
+7991, 952, -0.017,
+7991, 957, -0.056,
+7991, 959, -0.028,
+7991, 962, -0.028,
+7991, 963, -0.028,
+7991, 964, -0.028,
+7991, 967, -0.028,
+7991, 977, -0.017,
+8000, 947, -0.028,
+8000, 955, -0.028,
+8000, 957, -0.022,
+8000, 964, -0.022,
+8000, 967, -0.028,
+8001, 947, -0.028,
+8001, 955, -0.028,
+8001, 957, -0.022,
+8001, 964, -0.022,
+8001, 967, -0.028,
+8004, 947, -0.028,
+8004, 955, -0.028,
+8004, 957, -0.022,
+8004, 964, -0.022,
+8004, 967, -0.028,
+8005, 947, -0.028,
+8005, 955, -0.028,
+8005, 957, -0.022,
+8005, 964, -0.022,
+8005, 967, -0.028,
+8054, 947, -0.028,
+8054, 951, -0.017,
+8054, 952, -0.017,
+8054, 957, -0.056,
+8054, 959, -0.028,
+8054, 962, -0.028,
+8054, 963, -0.028,
+8054, 964, -0.028,
+8054, 967, -0.028,
+8054, 977, -0.017,
+8056, 947, -0.028,
+8056, 955, -0.028,
+8056, 957, -0.022,
+8056, 964, -0.022,
+8056, 967, -0.028,
+8124, 920, -0.083,
+8124, 927, -0.083,
+8124, 932, -0.083,
+8124, 933, -0.139,
+8124, 934, -0.083,
+8124, 936, -0.122,
+8124, 939, -0.139,
+8127, 913, -0.139,
+8127, 927, -0.056,
+8127, 937, -0.028,
+8127, 8124, -0.139,
+8127, 8188, -0.028,
+8128, 913, -0.111,
+8128, 8124, -0.111,
+8141, 913, -0.083,
+8141, 927, -0.028,
+8141, 8124, -0.083,
+8142, 913, -0.083,
+8142, 927, -0.028,
+8142, 8124, -0.083,
+8143, 913, -0.111,
+8143, 8124, -0.111,
+8146, 947, -0.028,
+8146, 951, -0.017,
+8146, 952, -0.028,
+8146, 957, -0.056,
+8146, 959, -0.028,
+8146, 962, -0.028,
+8146, 963, -0.028,
+8146, 964, -0.028,
+8146, 967, -0.028,
+8146, 977, -0.017,
+8150, 947, -0.028,
+8150, 951, -0.017,
+8150, 952, -0.017,
+8150, 957, -0.056,
+8150, 959, -0.028,
+8150, 962, -0.028,
+8150, 963, -0.028,
+8150, 964, -0.028,
+8150, 967, -0.028,
+8150, 977, -0.017,
+8151, 947, -0.028,
+8151, 951, -0.017,
+8151, 952, -0.017,
+8151, 957, -0.056,
+8151, 959, -0.028,
+8151, 962, -0.028,
+8151, 963, -0.028,
+8151, 964, -0.028,
+8151, 967, -0.028,
+8151, 977, -0.017,
+8157, 913, -0.083,
+8157, 927, -0.028,
+8157, 8124, -0.083,
+8158, 913, -0.083,
+8158, 927, -0.028,
+8158, 8124, -0.083,
+8159, 913, -0.111,
+8159, 8124, -0.111,
+8175, 913, -0.111,
+8175, 927, -0.056,
+8175, 937, -0.028,
+8175, 8124, -0.111,
+8175, 8188, -0.028,
+8190, 913, -0.167,
+8190, 927, -0.056,
+8190, 937, -0.028,
+8190, 8124, -0.167,
+8190, 8188, -0.028
+KERNS_END
+
+END
+
+DEF_FONT(fcsbpg, greek/fcsbpg.ttf, 204)
+
+xHeight(0.472) quad(1) space(0.255)
+
+roman(fcmbpg) tt(fctrpg) it(fcsropg)
+
+METRICS_START
+32, 0.255, 0.0, 0, 0,
+168, 0.244, 0.63, 0, 0.056,
+884, 0.214, 0.695, 0, 0,
+885, 0.214, 0.001, 0.188, 0,
+890, 0.122, -0.067, 0.247, 0,
+900, 0.183, 0.695, 0, 0,
+901, 0.305, 0.695, 0, 0,
+903, 0.305, 0.459, 0, 0,
+912, 0.275, 0.695, 0.01, 0,
+913, 0.733, 0.687, 0, 0,
+914, 0.733, 0.687, 0, 0,
+915, 0.58, 0.684, 0, 0,
+916, 0.916, 0.687, 0, 0,
+917, 0.642, 0.684, 0, 0,
+918, 0.672, 0.687, 0, 0,
+919, 0.794, 0.687, 0, 0,
+920, 0.855, 0.709, 0.022, 0,
+921, 0.308, 0.687, 0, 0,
+922, 0.764, 0.687, 0, 0,
+923, 0.672, 0.687, 0, 0,
+924, 0.978, 0.687, 0, 0,
+925, 0.794, 0.687, 0, 0,
+926, 0.733, 0.681, 0, 0,
+927, 0.794, 0.71, 0.022, 0,
+928, 0.794, 0.684, 0, 0,
+929, 0.703, 0.687, 0, 0,
+931, 0.794, 0.687, 0, 0,
+932, 0.733, 0.681, 0, 0,
+933, 0.855, 0.709, 0, 0,
+934, 0.794, 0.687, 0, 0,
+935, 0.733, 0.687, 0, 0,
+936, 0.855, 0.687, 0, 0,
+937, 0.794, 0.709, 0, 0,
+938, 0.308, 0.847, 0, 0.01,
+939, 0.855, 0.847, 0, 0,
+940, 0.55, 0.695, 0.011, 0.061,
+941, 0.473, 0.695, 0.022, 0,
+942, 0.55, 0.695, 0.272, 0,
+943, 0.275, 0.695, 0.01, 0,
+944, 0.55, 0.695, 0.011, 0,
+945, 0.55, 0.471, 0.011, 0.061,
+946, 0.55, 0.706, 0.271, 0,
+947, 0.611, 0.471, 0.228, 0,
+948, 0.519, 0.707, 0.011, 0,
+949, 0.473, 0.482, 0.022, 0,
+950, 0.519, 0.718, 0.186, 0,
+951, 0.55, 0.482, 0.272, 0,
+952, 0.626, 0.706, 0.011, 0,
+953, 0.275, 0.47, 0.01, 0,
+954, 0.58, 0.487, 0.027, 0,
+955, 0.55, 0.697, 0.01, 0,
+956, 0.586, 0.482, 0.266, 0.001,
+957, 0.519, 0.472, 0.01, 0,
+958, 0.519, 0.718, 0.186, 0,
+959, 0.58, 0.471, 0.011, 0,
+960, 0.565, 0.459, 0.011, 0.027,
+961, 0.519, 0.471, 0.266, 0,
+962, 0.489, 0.471, 0.125, 0,
+963, 0.626, 0.459, 0.012, 0,
+964, 0.504, 0.46, 0.011, 0,
+965, 0.55, 0.492, 0.01, 0,
+966, 0.642, 0.486, 0.272, 0,
+967, 0.611, 0.473, 0.263, 0,
+968, 0.642, 0.718, 0.272, 0,
+969, 0.733, 0.481, 0.011, 0,
+970, 0.275, 0.641, 0.01, 0.001,
+971, 0.55, 0.64, 0.01, 0,
+972, 0.58, 0.695, 0.011, 0,
+973, 0.55, 0.695, 0.01, 0,
+974, 0.733, 0.695, 0.011, 0,
+984, 0.55, 0.698, 0, 0,
+985, 0.55, 0.646, 0.077, 0,
+986, 0.855, 0.682, 0.001, 0,
+987, 0.55, 0.481, 0, 0,
+988, 0.611, 0.684, 0, 0,
+989, 0.55, 0.461, 0.249, 0,
+991, 0.428, 0.577, 0.075, 0,
+992, 0.703, 0.686, 0, 0,
+993, 0.794, 0.695, 0, 0,
+7936, 0.55, 0.696, 0.011, 0.061,
+7937, 0.55, 0.696, 0.011, 0.061,
+7938, 0.55, 0.696, 0.011, 0.061,
+7939, 0.55, 0.696, 0.011, 0.061,
+7940, 0.55, 0.696, 0.011, 0.061,
+7941, 0.55, 0.696, 0.011, 0.061,
+7942, 0.55, 0.695, 0.011, 0.061,
+7943, 0.55, 0.695, 0.011, 0.061,
+7952, 0.473, 0.696, 0.022, 0,
+7953, 0.473, 0.696, 0.022, 0,
+7954, 0.473, 0.696, 0.022, 0,
+7955, 0.473, 0.696, 0.022, 0,
+7956, 0.473, 0.696, 0.022, 0,
+7957, 0.473, 0.696, 0.022, 0,
+7968, 0.55, 0.696, 0.272, 0,
+7969, 0.55, 0.696, 0.272, 0,
+7970, 0.55, 0.696, 0.272, 0,
+7971, 0.55, 0.696, 0.272, 0,
+7972, 0.55, 0.696, 0.272, 0,
+7973, 0.55, 0.696, 0.272, 0,
+7974, 0.55, 0.695, 0.272, 0,
+7975, 0.55, 0.695, 0.272, 0,
+7984, 0.275, 0.696, 0.01, 0,
+7985, 0.275, 0.696, 0.01, 0,
+7986, 0.275, 0.696, 0.01, 0,
+7987, 0.275, 0.696, 0.01, 0,
+7988, 0.275, 0.696, 0.01, 0,
+7989, 0.275, 0.696, 0.01, 0,
+7990, 0.275, 0.696, 0.01, 0.016,
+7991, 0.275, 0.696, 0.01, 0.016,
+8000, 0.58, 0.696, 0.011, 0,
+8001, 0.58, 0.696, 0.011, 0,
+8002, 0.58, 0.696, 0.011, 0,
+8003, 0.58, 0.696, 0.011, 0,
+8004, 0.58, 0.696, 0.011, 0,
+8005, 0.58, 0.696, 0.011, 0,
+8016, 0.55, 0.696, 0.01, 0,
+8017, 0.55, 0.696, 0.01, 0,
+8018, 0.55, 0.696, 0.01, 0,
+8019, 0.55, 0.696, 0.01, 0,
+8020, 0.55, 0.696, 0.01, 0,
+8021, 0.55, 0.696, 0.01, 0,
+8022, 0.55, 0.695, 0.01, 0,
+8023, 0.55, 0.695, 0.01, 0,
+8032, 0.733, 0.696, 0.011, 0,
+8033, 0.733, 0.696, 0.011, 0,
+8034, 0.733, 0.696, 0.011, 0,
+8035, 0.733, 0.696, 0.011, 0,
+8036, 0.733, 0.696, 0.011, 0,
+8037, 0.733, 0.696, 0.011, 0,
+8038, 0.733, 0.695, 0.011, 0,
+8039, 0.733, 0.695, 0.011, 0,
+8048, 0.55, 0.695, 0.011, 0.061,
+8050, 0.473, 0.695, 0.022, 0,
+8052, 0.55, 0.695, 0.272, 0,
+8054, 0.275, 0.695, 0.01, 0,
+8056, 0.58, 0.695, 0.011, 0,
+8058, 0.55, 0.695, 0.01, 0,
+8060, 0.733, 0.695, 0.011, 0,
+8064, 0.55, 0.696, 0.247, 0.061,
+8065, 0.55, 0.696, 0.247, 0.061,
+8066, 0.55, 0.696, 0.247, 0.061,
+8067, 0.55, 0.696, 0.247, 0.061,
+8068, 0.55, 0.696, 0.247, 0.061,
+8069, 0.55, 0.696, 0.247, 0.061,
+8070, 0.55, 0.695, 0.247, 0.061,
+8071, 0.55, 0.695, 0.247, 0.061,
+8080, 0.55, 0.696, 0.272, 0,
+8081, 0.55, 0.696, 0.272, 0,
+8082, 0.55, 0.696, 0.272, 0,
+8083, 0.55, 0.696, 0.272, 0,
+8084, 0.55, 0.696, 0.272, 0,
+8085, 0.55, 0.696, 0.272, 0,
+8086, 0.55, 0.695, 0.272, 0,
+8087, 0.55, 0.695, 0.272, 0,
+8096, 0.733, 0.696, 0.247, 0,
+8097, 0.733, 0.696, 0.247, 0,
+8098, 0.733, 0.696, 0.247, 0,
+8099, 0.733, 0.696, 0.247, 0,
+8100, 0.733, 0.696, 0.247, 0,
+8101, 0.733, 0.696, 0.247, 0,
+8102, 0.733, 0.695, 0.247, 0,
+8103, 0.733, 0.695, 0.247, 0,
+8114, 0.55, 0.695, 0.247, 0.061,
+8115, 0.55, 0.471, 0.247, 0.061,
+8116, 0.55, 0.695, 0.247, 0.061,
+8118, 0.55, 0.64, 0.011, 0.061,
+8119, 0.55, 0.64, 0.247, 0.061,
+8124, 0.733, 0.687, 0.247, 0,
+8126, 0.244, 0.155, 0.153, 0,
+8127, 0.244, 0.696, 0, 0,
+8128, 0.367, 0.64, 0, 0,
+8129, 0.489, 0.696, 0, 0,
+8130, 0.55, 0.695, 0.272, 0,
+8131, 0.55, 0.482, 0.272, 0,
+8132, 0.55, 0.695, 0.272, 0,
+8134, 0.55, 0.64, 0.272, 0,
+8135, 0.55, 0.64, 0.272, 0,
+8140, 0.794, 0.687, 0.247, 0,
+8141, 0.305, 0.696, 0, 0,
+8142, 0.305, 0.696, 0, 0,
+8143, 0.367, 0.696, 0, 0,
+8146, 0.275, 0.695, 0.01, 0,
+8150, 0.275, 0.64, 0.01, 0.016,
+8151, 0.275, 0.696, 0.01, 0.016,
+8157, 0.305, 0.696, 0, 0,
+8158, 0.305, 0.696, 0, 0,
+8159, 0.367, 0.696, 0, 0,
+8162, 0.55, 0.695, 0.01, 0,
+8164, 0.519, 0.696, 0.266, 0,
+8165, 0.519, 0.696, 0.266, 0,
+8166, 0.55, 0.64, 0.01, 0,
+8167, 0.55, 0.695, 0.01, 0,
+8173, 0.305, 0.695, 0, 0,
+8175, 0.183, 0.695, 0, 0,
+8178, 0.733, 0.695, 0.247, 0,
+8179, 0.733, 0.481, 0.247, 0,
+8180, 0.733, 0.695, 0.247, 0,
+8182, 0.733, 0.641, 0.011, 0,
+8183, 0.733, 0.641, 0.247, 0,
+8188, 0.794, 0.709, 0.247, 0,
+8190, 0.244, 0.696, 0, 0,
+8217, 0.305, 0.696, 0, 0,
+9001, 0.428, 0.751, 0.25, 0,
+9002, 0.428, 0.751, 0.25, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.122,
+900, 927, -0.061,
+900, 937, -0.031,
+900, 8124, -0.122,
+900, 8188, -0.031,
+912, 947, -0.031,
+912, 951, -0.018,
+912, 952, -0.018,
+912, 957, -0.061,
+912, 959, -0.031,
+912, 962, -0.031,
+912, 963, -0.031,
+912, 964, -0.031,
+912, 967, -0.031,
+913, 920, -0.092,
+913, 927, -0.092,
+913, 932, -0.092,
+913, 933, -0.153,
+913, 934, -0.092,
+913, 936, -0.134,
+913, 939, -0.153,
+915, 913, -0.147,
+915, 916, -0.122,
+915, 923, -0.134,
+915, 8124, -0.147,
+916, 927, -0.037,
+916, 933, -0.153,
+916, 939, -0.153,
+920, 913, -0.092,
+920, 8124, -0.092,
+922, 927, -0.092,
+923, 927, -0.037,
+923, 933, -0.11,
+923, 939, -0.11,
+925, 913, -0.092,
+925, 8124, -0.092,
+927, 913, -0.092,
+927, 931, -0.061,
+927, 8124, -0.092,
+929, 913, -0.183,
+929, 8124, -0.183,
+931, 913, -0.031,
+931, 8124, -0.031,
+932, 913, -0.092,
+932, 8124, -0.092,
+933, 913, -0.153,
+933, 916, -0.153,
+933, 923, -0.153,
+933, 8124, -0.153,
+934, 913, -0.092,
+934, 8124, -0.092,
+936, 913, -0.134,
+936, 8124, -0.134,
+939, 913, -0.153,
+939, 916, -0.153,
+939, 923, -0.153,
+939, 8124, -0.153,
+943, 947, -0.031,
+943, 951, -0.018,
+943, 952, -0.018,
+943, 957, -0.061,
+943, 959, -0.031,
+943, 962, -0.031,
+943, 963, -0.031,
+943, 964, -0.031,
+943, 967, -0.031,
+953, 947, -0.031,
+953, 951, -0.018,
+953, 952, -0.018,
+953, 957, -0.061,
+953, 959, -0.031,
+953, 962, -0.031,
+953, 963, -0.031,
+953, 964, -0.031,
+953, 967, -0.031,
+959, 947, -0.031,
+959, 955, -0.031,
+959, 957, -0.024,
+959, 964, -0.024,
+959, 967, -0.031,
+964, 940, -0.031,
+964, 945, -0.031,
+964, 959, -0.031,
+964, 969, -0.031,
+964, 972, -0.031,
+964, 974, -0.031,
+964, 7936, -0.031,
+964, 7937, -0.031,
+964, 7940, -0.031,
+964, 7941, -0.031,
+964, 7942, -0.031,
+964, 7943, -0.031,
+964, 8000, -0.031,
+964, 8001, -0.031,
+964, 8004, -0.031,
+964, 8005, -0.031,
+964, 8032, -0.031,
+964, 8033, -0.031,
+964, 8036, -0.031,
+964, 8037, -0.031,
+964, 8038, -0.031,
+964, 8039, -0.031,
+964, 8048, -0.031,
+964, 8056, -0.031,
+964, 8060, -0.031,
+964, 8064, -0.031,
+964, 8065, -0.031,
+964, 8068, -0.031,
+964, 8069, -0.031,
+964, 8070, -0.031,
+964, 8071, -0.031,
+964, 8096, -0.031,
+964, 8097, -0.031,
+964, 8100, -0.031,
+964, 8101, -0.031,
+964, 8102, -0.031,
+964, 8103, -0.031,
+964, 8114, -0.031,
+964, 8116, -0.031,
+964, 8118, -0.031,
+964, 8119, -0.031,
+964, 8178, -0.031,
+964, 8180, -0.031,
+964, 8182, -0.031,
+964, 8183, -0.031,
+970, 947, -0.031,
+970, 951, -0.018,
+970, 952, -0.018,
+970, 957, -0.061,
+970, 959, -0.031,
+970, 962, -0.031,
+970, 963, -0.031,
+970, 964, -0.031,
+970, 967, -0.031,
+972, 947, -0.031,
+972, 955, -0.031,
+972, 957, -0.024,
+972, 964, -0.024,
+972, 967, -0.031,
+7984, 947, -0.031,
+7984, 951, -0.018,
+7984, 952, -0.018,
+7984, 957, -0.061,
+7984, 959, -0.031,
+7984, 962, -0.031,
+7984, 963, -0.031,
+7984, 964, -0.031,
+7984, 967, -0.031,
+7985, 947, -0.031,
+7985, 951, -0.018,
+7985, 952, -0.018,
+7985, 957, -0.061,
+7985, 959, -0.031,
+7985, 962, -0.031,
+7985, 963, -0.031,
+7985, 964, -0.031,
+7985, 967, -0.031,
+7988, 947, -0.031,
+7988, 951, -0.018,
+7988, 952, -0.018,
+7988, 957, -0.061,
+7988, 959, -0.031,
+7988, 962, -0.031,
+7988, 963, -0.031,
+7988, 964, -0.031,
+7988, 967, -0.031,
+7989, 947, -0.031,
+7989, 951, -0.018,
+7989, 952, -0.018,
+7989, 957, -0.061,
+7989, 959, -0.031,
+7989, 962, -0.031,
+7989, 963, -0.031,
+7989, 964, -0.031,
+7989, 967, -0.031,
+7990, 947, -0.031,
+7990, 951, -0.018,
+7990, 952, -0.018,
+7990, 957, -0.061,
+7990, 959, -0.031,
+7990, 962, -0.031,
+7990, 963, -0.031,
+7990, 964, -0.031,
+7990, 967, -0.031,
+7991, 947, -0.031,
+7991, 951, -0.018,
+7991, 952, -0.018,
+7991, 957, -0.061,
+7991, 959, -0.031,
+7991, 962, -0.031,
+7991, 963, -0.031,
+7991, 964, -0.031,
+7991, 967, -0.031,
+8000, 947, -0.031,
+8000, 955, -0.031,
+8000, 957, -0.024,
+8000, 964, -0.024,
+8000, 967, -0.031,
+8001, 947, -0.031,
+8001, 955, -0.031,
+8001, 957, -0.024,
+8001, 964, -0.024,
+8001, 967, -0.031,
+8004, 947, -0.031,
+8004, 955, -0.031,
+8004, 957, -0.024,
+8004, 964, -0.024,
+8004, 967, -0.031,
+8005, 947, -0.031,
+8005, 955, -0.031,
+8005, 957, -0.024,
+8005, 964, -0.024,
+8005, 967, -0.031,
+8054, 947, -0.031,
+8054, 951, -0.018,
+8054, 952, -0.018,
+8054, 957, -0.061,
+8054, 959, -0.031,
+8054, 962, -0.031,
+8054, 963, -0.031,
+8054, 964, -0.031,
+8054, 967, -0.031,
+8056, 947, -0.031,
+8056, 955, -0.031,
+8056, 957, -0.024,
+8056, 964, -0.024,
+8056, 967, -0.031,
+8124, 920, -0.092,
+8124, 927, -0.092,
+8124, 932, -0.092,
+8124, 933, -0.153,
+8124, 934, -0.092,
+8124, 936, -0.134,
+8124, 939, -0.153,
+8127, 913, -0.153,
+8127, 927, -0.061,
+8127, 937, -0.031,
+8127, 8124, -0.153,
+8127, 8188, -0.031,
+8128, 913, -0.122,
+8128, 8124, -0.122,
+8141, 913, -0.092,
+8141, 927, -0.031,
+8141, 8124, -0.092,
+8142, 913, -0.092,
+8142, 927, -0.031,
+8142, 8124, -0.092,
+8143, 913, -0.122,
+8143, 8124, -0.122,
+8146, 947, -0.031,
+8146, 951, -0.018,
+8146, 952, -0.018,
+8146, 957, -0.061,
+8146, 959, -0.031,
+8146, 962, -0.031,
+8146, 963, -0.031,
+8146, 964, -0.031,
+8146, 967, -0.031,
+8150, 947, -0.031,
+8150, 951, -0.018,
+8150, 952, -0.018,
+8150, 957, -0.061,
+8150, 959, -0.031,
+8150, 962, -0.031,
+8150, 963, -0.031,
+8150, 964, -0.031,
+8150, 967, -0.031,
+8151, 947, -0.031,
+8151, 951, -0.018,
+8151, 952, -0.018,
+8151, 957, -0.061,
+8151, 959, -0.031,
+8151, 962, -0.031,
+8151, 963, -0.031,
+8151, 964, -0.031,
+8151, 967, -0.031,
+8157, 913, -0.092,
+8157, 927, -0.031,
+8157, 8124, -0.092,
+8158, 913, -0.092,
+8158, 927, -0.031,
+8158, 8124, -0.092,
+8159, 913, -0.122,
+8159, 8124, -0.122,
+8175, 913, -0.122,
+8175, 927, -0.061,
+8175, 937, -0.031,
+8175, 8124, -0.122,
+8175, 8188, -0.031,
+8190, 913, -0.183,
+8190, 927, -0.061,
+8190, 937, -0.031,
+8190, 8124, -0.183,
+8190, 8188, -0.031
+KERNS_END
+
+END
+
+DEF_FONT(fcsropg, greek/fcsropg.ttf, 204)
+
+xHeight(0.444) quad(1) space(0.239)
+
+bold(fcsbpg) roman(fcmripg) tt(fctrpg)
+
+METRICS_START
+32, 0.239, 0.0, 0, 0,
+168, 0.222, 0.603, 0, 0.17,
+884, 0.194, 0.695, 0, 0.14,
+885, 0.194, 0.001, 0.21, 0.003,
+890, 0.111, -0.064, 0.238, 0,
+900, 0.167, 0.695, 0, 0.145,
+901, 0.278, 0.695, 0, 0.117,
+903, 0.278, 0.431, 0, 0,
+912, 0.25, 0.695, 0.011, 0.099,
+913, 0.667, 0.685, 0, 0,
+914, 0.667, 0.685, 0, 0.028,
+915, 0.542, 0.681, 0, 0.101,
+916, 0.833, 0.684, 0, 0,
+917, 0.597, 0.681, 0, 0.088,
+918, 0.611, 0.684, 0, 0.089,
+919, 0.708, 0.684, 0, 0.049,
+920, 0.778, 0.707, 0.022, 0.026,
+921, 0.278, 0.684, 0, 0.049,
+922, 0.694, 0.684, 0, 0.089,
+923, 0.611, 0.684, 0, 0,
+924, 0.875, 0.684, 0, 0.044,
+925, 0.708, 0.684, 0, 0.047,
+926, 0.667, 0.679, 0, 0.096,
+927, 0.736, 0.706, 0.021, 0.026,
+928, 0.708, 0.681, 0, 0.048,
+929, 0.639, 0.685, 0, 0.051,
+931, 0.722, 0.684, 0, 0.089,
+932, 0.68, 0.679, 0, 0.107,
+933, 0.778, 0.707, 0, 0.064,
+934, 0.722, 0.684, 0, 0.021,
+935, 0.667, 0.684, 0, 0.088,
+936, 0.778, 0.684, 0, 0.072,
+937, 0.722, 0.706, 0, 0.046,
+938, 0.278, 0.833, 0, 0.168,
+939, 0.778, 0.833, 0, 0.064,
+940, 0.5, 0.695, 0.011, 0.065,
+941, 0.43, 0.695, 0.022, 0.042,
+942, 0.5, 0.695, 0.272, 0.022,
+943, 0.25, 0.695, 0.011, 0.099,
+944, 0.5, 0.695, 0.011, 0.013,
+945, 0.5, 0.443, 0.011, 0.065,
+946, 0.5, 0.706, 0.272, 0.03,
+947, 0.555, 0.443, 0.216, 0.044,
+948, 0.472, 0.652, 0.01, 0.05,
+949, 0.43, 0.453, 0.022, 0.042,
+950, 0.472, 0.718, 0.153, 0.089,
+951, 0.5, 0.453, 0.272, 0.011,
+952, 0.569, 0.707, 0.012, 0.031,
+953, 0.25, 0.443, 0.011, 0,
+954, 0.528, 0.458, 0.026, 0.05,
+955, 0.5, 0.698, 0.011, 0,
+956, 0.522, 0.453, 0.267, 0.018,
+957, 0.472, 0.443, 0.01, 0.022,
+958, 0.472, 0.718, 0.152, 0.088,
+959, 0.528, 0.442, 0.011, 0.009,
+960, 0.514, 0.432, 0.011, 0.048,
+961, 0.472, 0.443, 0.266, 0.009,
+962, 0.444, 0.443, 0.124, 0.044,
+963, 0.569, 0.431, 0.01, 0.061,
+964, 0.458, 0.432, 0.011, 0.048,
+965, 0.5, 0.456, 0.011, 0.013,
+966, 0.583, 0.454, 0.272, 0.012,
+967, 0.555, 0.445, 0.263, 0.051,
+968, 0.583, 0.718, 0.272, 0.021,
+969, 0.667, 0.453, 0.011, 0.01,
+970, 0.25, 0.626, 0.011, 0.12,
+971, 0.5, 0.626, 0.011, 0.013,
+972, 0.528, 0.695, 0.011, 0.009,
+973, 0.5, 0.695, 0.011, 0.013,
+974, 0.667, 0.695, 0.011, 0.01,
+984, 0.5, 0.695, 0, 0.072,
+985, 0.5, 0.601, 0.064, 0.042,
+986, 0.778, 0.679, 0, 0,
+987, 0.5, 0.454, 0, 0.04,
+988, 0.569, 0.681, 0, 0.101,
+989, 0.5, 0.432, 0.25, 0.028,
+991, 0.389, 0.563, 0.106, 0.005,
+992, 0.639, 0.683, 0, 0,
+993, 0.722, 0.696, 0, 0,
+7936, 0.5, 0.696, 0.011, 0.065,
+7937, 0.5, 0.696, 0.011, 0.065,
+7938, 0.5, 0.696, 0.011, 0.065,
+7939, 0.5, 0.696, 0.011, 0.065,
+7940, 0.5, 0.696, 0.011, 0.065,
+7941, 0.5, 0.696, 0.011, 0.065,
+7942, 0.5, 0.695, 0.011, 0.067,
+7943, 0.5, 0.695, 0.011, 0.067,
+7952, 0.43, 0.696, 0.022, 0.042,
+7953, 0.43, 0.696, 0.022, 0.042,
+7954, 0.43, 0.696, 0.022, 0.048,
+7955, 0.43, 0.696, 0.022, 0.048,
+7956, 0.43, 0.696, 0.022, 0.083,
+7957, 0.43, 0.696, 0.022, 0.083,
+7968, 0.5, 0.696, 0.272, 0.011,
+7969, 0.5, 0.696, 0.272, 0.011,
+7970, 0.5, 0.696, 0.272, 0.029,
+7971, 0.5, 0.696, 0.272, 0.029,
+7972, 0.5, 0.696, 0.272, 0.064,
+7973, 0.5, 0.696, 0.272, 0.064,
+7974, 0.5, 0.696, 0.272, 0.079,
+7975, 0.5, 0.696, 0.272, 0.079,
+7984, 0.25, 0.696, 0.011, 0.071,
+7985, 0.25, 0.696, 0.011, 0.022,
+7986, 0.25, 0.696, 0.011, 0.106,
+7987, 0.25, 0.696, 0.011, 0.106,
+7988, 0.25, 0.696, 0.011, 0.141,
+7989, 0.25, 0.696, 0.011, 0.141,
+7990, 0.25, 0.696, 0.011, 0.155,
+7991, 0.25, 0.696, 0.011, 0.155,
+8000, 0.528, 0.696, 0.011, 0.009,
+8001, 0.528, 0.696, 0.011, 0.009,
+8002, 0.528, 0.696, 0.011, 0.009,
+8003, 0.528, 0.696, 0.011, 0.009,
+8004, 0.528, 0.696, 0.011, 0.034,
+8005, 0.528, 0.696, 0.011, 0.034,
+8016, 0.5, 0.696, 0.011, 0.013,
+8017, 0.5, 0.696, 0.011, 0.013,
+8018, 0.5, 0.696, 0.011, 0.013,
+8019, 0.5, 0.696, 0.011, 0.013,
+8020, 0.5, 0.696, 0.011, 0.013,
+8021, 0.5, 0.696, 0.011, 0.013,
+8022, 0.5, 0.696, 0.011, 0.026,
+8023, 0.5, 0.696, 0.011, 0.026,
+8032, 0.667, 0.696, 0.011, 0.01,
+8033, 0.667, 0.696, 0.011, 0.01,
+8034, 0.667, 0.696, 0.011, 0.01,
+8035, 0.667, 0.696, 0.011, 0.01,
+8036, 0.667, 0.696, 0.011, 0.01,
+8037, 0.667, 0.696, 0.011, 0.01,
+8038, 0.667, 0.695, 0.011, 0.035,
+8039, 0.667, 0.695, 0.011, 0.035,
+8048, 0.5, 0.695, 0.011, 0.065,
+8050, 0.43, 0.695, 0.022, 0.042,
+8052, 0.5, 0.695, 0.272, 0.011,
+8054, 0.25, 0.695, 0.011, 0.011,
+8056, 0.528, 0.695, 0.011, 0.009,
+8058, 0.5, 0.695, 0.011, 0.013,
+8060, 0.667, 0.695, 0.011, 0.01,
+8064, 0.5, 0.696, 0.238, 0.065,
+8065, 0.5, 0.696, 0.238, 0.065,
+8066, 0.5, 0.696, 0.238, 0.065,
+8067, 0.5, 0.696, 0.238, 0.065,
+8068, 0.5, 0.696, 0.238, 0.065,
+8069, 0.5, 0.696, 0.238, 0.065,
+8070, 0.5, 0.695, 0.238, 0.067,
+8071, 0.5, 0.695, 0.238, 0.067,
+8080, 0.5, 0.696, 0.272, 0.011,
+8081, 0.5, 0.696, 0.272, 0.011,
+8082, 0.5, 0.696, 0.272, 0.029,
+8083, 0.5, 0.696, 0.272, 0.029,
+8084, 0.5, 0.696, 0.272, 0.064,
+8085, 0.5, 0.696, 0.272, 0.064,
+8086, 0.5, 0.696, 0.272, 0.079,
+8087, 0.5, 0.696, 0.272, 0.079,
+8096, 0.667, 0.696, 0.238, 0.01,
+8097, 0.667, 0.696, 0.238, 0.01,
+8098, 0.667, 0.696, 0.238, 0.01,
+8099, 0.667, 0.696, 0.238, 0.01,
+8100, 0.667, 0.696, 0.238, 0.01,
+8101, 0.667, 0.696, 0.238, 0.01,
+8102, 0.667, 0.695, 0.238, 0.035,
+8103, 0.667, 0.695, 0.238, 0.035,
+8114, 0.5, 0.695, 0.238, 0.065,
+8115, 0.5, 0.443, 0.238, 0.065,
+8116, 0.5, 0.695, 0.238, 0.065,
+8118, 0.5, 0.627, 0.011, 0.065,
+8119, 0.5, 0.627, 0.238, 0.065,
+8124, 0.667, 0.685, 0.238, 0,
+8126, 0.222, 0.158, 0.156, 0,
+8127, 0.222, 0.696, 0, 0.117,
+8128, 0.333, 0.627, 0, 0.132,
+8129, 0.444, 0.695, 0, 0.091,
+8130, 0.5, 0.695, 0.272, 0.011,
+8131, 0.5, 0.453, 0.272, 0.011,
+8132, 0.5, 0.695, 0.272, 0.022,
+8134, 0.5, 0.626, 0.272, 0.064,
+8135, 0.5, 0.626, 0.272, 0.064,
+8140, 0.708, 0.684, 0.238, 0.049,
+8141, 0.278, 0.696, 0, 0.124,
+8142, 0.278, 0.696, 0, 0.159,
+8143, 0.333, 0.695, 0, 0.146,
+8146, 0.25, 0.695, 0.011, 0.08,
+8150, 0.25, 0.627, 0.011, 0.141,
+8151, 0.25, 0.696, 0.011, 0.155,
+8157, 0.278, 0.696, 0, 0.124,
+8158, 0.278, 0.696, 0, 0.159,
+8159, 0.333, 0.695, 0, 0.146,
+8162, 0.5, 0.695, 0.011, 0.013,
+8164, 0.472, 0.696, 0.266, 0.009,
+8165, 0.472, 0.696, 0.266, 0.009,
+8166, 0.5, 0.627, 0.011, 0.013,
+8167, 0.5, 0.696, 0.011, 0.026,
+8173, 0.278, 0.695, 0, 0.098,
+8175, 0.167, 0.695, 0, 0.112,
+8178, 0.667, 0.695, 0.238, 0.01,
+8179, 0.667, 0.453, 0.238, 0.01,
+8180, 0.667, 0.695, 0.238, 0.01,
+8182, 0.667, 0.627, 0.011, 0.021,
+8183, 0.667, 0.627, 0.238, 0.021,
+8188, 0.722, 0.706, 0.238, 0.046,
+8190, 0.222, 0.696, 0, 0.068,
+8217, 0.278, 0.695, 0, 0.057,
+9001, 0.389, 0.752, 0.249, 0.099,
+9002, 0.389, 0.751, 0.249, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.111,
+900, 927, -0.056,
+900, 937, -0.028,
+900, 8124, -0.111,
+900, 8188, -0.028,
+912, 947, -0.028,
+912, 951, -0.017,
+912, 952, -0.017,
+912, 957, -0.056,
+912, 959, -0.028,
+912, 962, -0.028,
+912, 963, -0.028,
+912, 964, -0.028,
+912, 967, -0.028,
+913, 920, -0.083,
+913, 927, -0.083,
+913, 932, -0.083,
+913, 933, -0.139,
+913, 934, -0.083,
+913, 936, -0.122,
+913, 939, -0.139,
+915, 913, -0.133,
+915, 916, -0.111,
+915, 923, -0.122,
+915, 8124, -0.133,
+916, 927, -0.033,
+916, 933, -0.139,
+916, 939, -0.139,
+920, 913, -0.083,
+920, 8124, -0.083,
+922, 927, -0.083,
+923, 927, -0.033,
+923, 933, -0.1,
+923, 939, -0.1,
+925, 913, -0.083,
+925, 8124, -0.083,
+927, 913, -0.083,
+927, 931, -0.056,
+927, 8124, -0.083,
+929, 913, -0.167,
+929, 8124, -0.167,
+931, 913, -0.028,
+931, 8124, -0.028,
+932, 913, -0.083,
+932, 8124, -0.083,
+933, 913, -0.139,
+933, 916, -0.139,
+933, 923, -0.139,
+933, 8124, -0.139,
+934, 913, -0.083,
+934, 8124, -0.083,
+936, 913, -0.122,
+936, 8124, -0.122,
+939, 913, -0.139,
+939, 916, -0.139,
+939, 923, -0.139,
+939, 8124, -0.139,
+943, 947, -0.028,
+943, 951, -0.017,
+943, 952, -0.017,
+943, 957, -0.056,
+943, 959, -0.028,
+943, 962, -0.028,
+943, 963, -0.028,
+943, 964, -0.028,
+943, 967, -0.028,
+953, 947, -0.028,
+953, 951, -0.017,
+953, 952, -0.017,
+953, 957, -0.056,
+953, 959, -0.028,
+953, 962, -0.028,
+953, 963, -0.028,
+953, 964, -0.028,
+953, 967, -0.028,
+959, 947, -0.028,
+959, 955, -0.028,
+959, 957, -0.022,
+959, 964, -0.022,
+959, 967, -0.028,
+964, 940, -0.028,
+964, 945, -0.028,
+964, 959, -0.028,
+964, 969, -0.028,
+964, 972, -0.028,
+964, 974, -0.028,
+964, 7936, -0.028,
+964, 7937, -0.028,
+964, 7940, -0.028,
+964, 7941, -0.028,
+964, 7942, -0.028,
+964, 7943, -0.028,
+964, 8000, -0.028,
+964, 8001, -0.028,
+964, 8004, -0.028,
+964, 8005, -0.028,
+964, 8032, -0.028,
+964, 8033, -0.028,
+964, 8036, -0.028,
+964, 8037, -0.028,
+964, 8038, -0.028,
+964, 8039, -0.028,
+964, 8048, -0.028,
+964, 8056, -0.028,
+964, 8060, -0.028,
+964, 8064, -0.028,
+964, 8065, -0.028,
+964, 8068, -0.028,
+964, 8069, -0.028,
+964, 8070, -0.028,
+964, 8071, -0.028,
+964, 8096, -0.028,
+964, 8097, -0.028,
+964, 8100, -0.028,
+964, 8101, -0.028,
+964, 8102, -0.028,
+964, 8103, -0.028,
+964, 8114, -0.028,
+964, 8116, -0.028,
+964, 8118, -0.028,
+964, 8119, -0.028,
+964, 8178, -0.028,
+964, 8180, -0.028,
+964, 8182, -0.028,
+964, 8183, -0.028,
+970, 947, -0.028,
+970, 951, -0.017,
+970, 952, -0.017,
+970, 957, -0.056,
+970, 959, -0.028,
+970, 962, -0.028,
+970, 963, -0.028,
+970, 964, -0.028,
+970, 967, -0.028,
+972, 947, -0.028,
+972, 955, -0.028,
+972, 957, -0.022,
+972, 964, -0.022,
+972, 967, -0.028,
+7984, 947, -0.028,
+7984, 951, -0.017,
+7984, 952, -0.017,
+7984, 957, -0.056,
+7984, 959, -0.028,
+7984, 962, -0.028,
+7984, 963, -0.028,
+7984, 964, -0.028,
+7984, 967, -0.028,
+7985, 947, -0.028,
+7985, 951, -0.017,
+7985, 952, -0.017,
+7985, 957, -0.056,
+7985, 959, -0.028,
+7985, 962, -0.028,
+7985, 963, -0.028,
+7985, 964, -0.028,
+7985, 967, -0.028,
+7988, 947, -0.028,
+7988, 951, -0.017,
+7988, 952, -0.017,
+7988, 957, -0.056,
+7988, 959, -0.028,
+7988, 962, -0.028,
+7988, 963, -0.028,
+7988, 964, -0.028,
+7988, 967, -0.028,
+7989, 947, -0.028,
+7989, 951, -0.017,
+7989, 952, -0.017,
+7989, 957, -0.056,
+7989, 959, -0.028,
+7989, 962, -0.028,
+7989, 963, -0.028,
+7989, 964, -0.028,
+7989, 967, -0.028,
+7990, 947, -0.028,
+7990, 951, -0.017,
+7990, 952, -0.017,
+7990, 957, -0.056,
+7990, 959, -0.028,
+7990, 962, -0.028,
+7990, 963, -0.028,
+7990, 964, -0.028,
+7990, 967, -0.028,
+7991, 947, -0.028,
+7991, 951, -0.017,
+7991, 952, -0.017,
+7991, 957, -0.056,
+7991, 959, -0.028,
+7991, 962, -0.028,
+7991, 963, -0.028,
+7991, 964, -0.028,
+7991, 967, -0.028,
+8000, 947, -0.028,
+8000, 955, -0.028,
+8000, 957, -0.022,
+8000, 964, -0.022,
+8000, 967, -0.028,
+8001, 947, -0.028,
+8001, 955, -0.028,
+8001, 957, -0.022,
+8001, 964, -0.022,
+8001, 967, -0.028,
+8004, 947, -0.028,
+8004, 955, -0.028,
+8004, 957, -0.022,
+8004, 964, -0.022,
+8004, 967, -0.028,
+8005, 947, -0.028,
+8005, 955, -0.028,
+8005, 957, -0.022,
+8005, 964, -0.022,
+8005, 967, -0.028,
+8054, 947, -0.028,
+8054, 951, -0.017,
+8054, 952, -0.017,
+8054, 957, -0.056,
+8054, 959, -0.028,
+8054, 962, -0.028,
+8054, 963, -0.028,
+8054, 964, -0.028,
+8054, 967, -0.028,
+8056, 947, -0.028,
+8056, 955, -0.028,
+8056, 957, -0.022,
+8056, 964, -0.022,
+8056, 967, -0.028,
+8124, 920, -0.083,
+8124, 927, -0.083,
+8124, 932, -0.083,
+8124, 933, -0.139,
+8124, 934, -0.083,
+8124, 936, -0.122,
+8124, 939, -0.139,
+8127, 913, -0.139,
+8127, 927, -0.056,
+8127, 937, -0.028,
+8127, 8124, -0.139,
+8127, 8188, -0.028,
+8128, 913, -0.111,
+8128, 8124, -0.111,
+8141, 913, -0.083,
+8141, 927, -0.028,
+8141, 8124, -0.083,
+8142, 913, -0.083,
+8142, 927, -0.028,
+8142, 8124, -0.083,
+8143, 913, -0.111,
+8143, 8124, -0.111,
+8146, 947, -0.028,
+8146, 951, -0.017,
+8146, 952, -0.017,
+8146, 957, -0.056,
+8146, 959, -0.028,
+8146, 962, -0.028,
+8146, 963, -0.028,
+8146, 964, -0.028,
+8146, 967, -0.028,
+8150, 947, -0.028,
+8150, 951, -0.017,
+8150, 952, -0.017,
+8150, 957, -0.056,
+8150, 959, -0.028,
+8150, 962, -0.028,
+8150, 963, -0.028,
+8150, 964, -0.028,
+8150, 967, -0.028,
+8151, 947, -0.028,
+8151, 951, -0.017,
+8151, 952, -0.017,
+8151, 957, -0.056,
+8151, 959, -0.028,
+8151, 962, -0.028,
+8151, 963, -0.028,
+8151, 964, -0.028,
+8151, 967, -0.028,
+8157, 913, -0.083,
+8157, 927, -0.028,
+8157, 8124, -0.083,
+8158, 913, -0.083,
+8158, 927, -0.028,
+8158, 8124, -0.083,
+8159, 913, -0.111,
+8159, 8124, -0.111,
+8175, 913, -0.111,
+8175, 927, -0.056,
+8175, 937, -0.028,
+8175, 8124, -0.111,
+8175, 8188, -0.028,
+8190, 913, -0.167,
+8190, 927, -0.056,
+8190, 937, -0.028,
+8190, 8124, -0.167,
+8190, 8188, -0.028
+KERNS_END
+
+END
+
+DEF_FONT(fcsrpg, greek/fcsrpg.ttf, 204)
+
+xHeight(0.443) quad(1) space(0.239)
+
+bold(fcsbpg) tt(fctrpg) it(fcsropg)
+
+METRICS_START
+32, 0.239, 0.0, 0, 0,
+168, 0.222, 0.603, 0, 0.052,
+884, 0.194, 0.695, 0, 0,
+885, 0.194, 0.001, 0.21, 0.003,
+890, 0.111, -0.064, 0.238, 0,
+900, 0.167, 0.695, 0, 0,
+901, 0.278, 0.695, 0, 0,
+903, 0.278, 0.431, 0, 0,
+912, 0.25, 0.695, 0.01, 0,
+913, 0.667, 0.685, 0, 0,
+914, 0.667, 0.684, 0, 0,
+915, 0.542, 0.681, 0, 0,
+916, 0.833, 0.685, 0, 0,
+917, 0.597, 0.681, 0, 0,
+918, 0.611, 0.684, 0, 0,
+919, 0.708, 0.684, 0, 0,
+920, 0.778, 0.706, 0.021, 0,
+921, 0.278, 0.684, 0, 0,
+922, 0.694, 0.684, 0, 0,
+923, 0.611, 0.685, 0, 0,
+924, 0.875, 0.684, 0, 0,
+925, 0.708, 0.684, 0, 0,
+926, 0.667, 0.678, 0, 0,
+927, 0.736, 0.707, 0.021, 0,
+928, 0.708, 0.681, 0, 0,
+929, 0.639, 0.685, 0, 0,
+931, 0.722, 0.684, 0, 0,
+932, 0.68, 0.678, 0, 0,
+933, 0.778, 0.707, 0, 0,
+934, 0.722, 0.684, 0, 0,
+935, 0.667, 0.684, 0, 0,
+936, 0.778, 0.684, 0, 0,
+937, 0.722, 0.707, 0, 0,
+938, 0.278, 0.833, 0, 0.001,
+939, 0.778, 0.833, 0, 0,
+940, 0.5, 0.695, 0.011, 0.045,
+941, 0.43, 0.695, 0.022, 0,
+942, 0.5, 0.695, 0.271, 0,
+943, 0.25, 0.695, 0.01, 0,
+944, 0.5, 0.695, 0.01, 0,
+945, 0.5, 0.443, 0.011, 0.045,
+946, 0.5, 0.707, 0.271, 0,
+947, 0.555, 0.444, 0.216, 0,
+948, 0.472, 0.652, 0.011, 0,
+949, 0.43, 0.453, 0.022, 0,
+950, 0.472, 0.718, 0.153, 0,
+951, 0.5, 0.454, 0.271, 0,
+952, 0.569, 0.707, 0.011, 0,
+953, 0.25, 0.442, 0.01, 0,
+954, 0.528, 0.457, 0.025, 0,
+955, 0.5, 0.697, 0.011, 0,
+956, 0.522, 0.453, 0.266, 0,
+957, 0.472, 0.443, 0.01, 0,
+958, 0.472, 0.718, 0.152, 0,
+959, 0.528, 0.443, 0.011, 0,
+960, 0.514, 0.432, 0.01, 0.009,
+961, 0.472, 0.442, 0.266, 0,
+962, 0.444, 0.443, 0.124, 0,
+963, 0.569, 0.432, 0.01, 0,
+964, 0.458, 0.432, 0.01, 0,
+965, 0.5, 0.457, 0.01, 0,
+966, 0.583, 0.454, 0.272, 0,
+967, 0.555, 0.444, 0.262, 0,
+968, 0.583, 0.717, 0.271, 0,
+969, 0.667, 0.453, 0.011, 0,
+970, 0.25, 0.626, 0.01, 0,
+971, 0.5, 0.626, 0.01, 0,
+972, 0.528, 0.695, 0.011, 0,
+973, 0.5, 0.695, 0.01, 0,
+974, 0.667, 0.695, 0.011, 0,
+984, 0.5, 0.696, 0, 0,
+985, 0.5, 0.601, 0.064, 0,
+986, 0.778, 0.679, 0, 0,
+987, 0.5, 0.454, 0, 0,
+988, 0.569, 0.681, 0, 0,
+989, 0.5, 0.432, 0.249, 0,
+991, 0.389, 0.563, 0.107, 0,
+992, 0.639, 0.683, 0, 0,
+993, 0.722, 0.695, 0, 0,
+7936, 0.5, 0.696, 0.011, 0.045,
+7937, 0.5, 0.696, 0.011, 0.045,
+7938, 0.5, 0.696, 0.011, 0.045,
+7939, 0.5, 0.696, 0.011, 0.045,
+7940, 0.5, 0.696, 0.011, 0.045,
+7941, 0.5, 0.696, 0.011, 0.045,
+7942, 0.5, 0.696, 0.011, 0.045,
+7943, 0.5, 0.696, 0.011, 0.045,
+7952, 0.43, 0.696, 0.022, 0,
+7953, 0.43, 0.696, 0.022, 0,
+7954, 0.43, 0.696, 0.022, 0,
+7955, 0.43, 0.696, 0.022, 0,
+7956, 0.43, 0.696, 0.022, 0,
+7957, 0.43, 0.696, 0.022, 0,
+7968, 0.5, 0.696, 0.271, 0,
+7969, 0.5, 0.696, 0.271, 0,
+7970, 0.5, 0.696, 0.271, 0,
+7971, 0.5, 0.696, 0.271, 0,
+7972, 0.5, 0.696, 0.271, 0,
+7973, 0.5, 0.696, 0.271, 0,
+7974, 0.5, 0.696, 0.271, 0,
+7975, 0.5, 0.696, 0.271, 0,
+7984, 0.25, 0.696, 0.01, 0,
+7985, 0.25, 0.696, 0.01, 0,
+7986, 0.25, 0.696, 0.01, 0.003,
+7987, 0.25, 0.696, 0.01, 0.003,
+7988, 0.25, 0.696, 0.01, 0,
+7989, 0.25, 0.696, 0.01, 0,
+7990, 0.25, 0.695, 0.01, 0.008,
+7991, 0.25, 0.695, 0.01, 0.008,
+8000, 0.528, 0.696, 0.011, 0,
+8001, 0.528, 0.696, 0.011, 0,
+8002, 0.528, 0.696, 0.011, 0,
+8003, 0.528, 0.696, 0.011, 0,
+8004, 0.528, 0.696, 0.011, 0,
+8005, 0.528, 0.696, 0.011, 0,
+8016, 0.5, 0.696, 0.01, 0,
+8017, 0.5, 0.696, 0.01, 0,
+8018, 0.5, 0.696, 0.01, 0,
+8019, 0.5, 0.696, 0.01, 0,
+8020, 0.5, 0.696, 0.01, 0,
+8021, 0.5, 0.696, 0.01, 0,
+8022, 0.5, 0.695, 0.01, 0,
+8023, 0.5, 0.695, 0.01, 0,
+8032, 0.667, 0.696, 0.011, 0,
+8033, 0.667, 0.696, 0.011, 0,
+8034, 0.667, 0.696, 0.011, 0,
+8035, 0.667, 0.696, 0.011, 0,
+8036, 0.667, 0.696, 0.011, 0,
+8037, 0.667, 0.696, 0.011, 0,
+8038, 0.667, 0.695, 0.011, 0,
+8039, 0.667, 0.695, 0.011, 0,
+8048, 0.5, 0.695, 0.011, 0.045,
+8050, 0.43, 0.695, 0.022, 0,
+8052, 0.5, 0.695, 0.271, 0,
+8054, 0.25, 0.695, 0.01, 0,
+8056, 0.528, 0.695, 0.011, 0,
+8058, 0.5, 0.695, 0.01, 0,
+8060, 0.667, 0.695, 0.011, 0,
+8064, 0.5, 0.696, 0.238, 0.045,
+8065, 0.5, 0.696, 0.238, 0.045,
+8066, 0.5, 0.696, 0.238, 0.045,
+8067, 0.5, 0.696, 0.238, 0.045,
+8068, 0.5, 0.696, 0.238, 0.045,
+8069, 0.5, 0.696, 0.238, 0.045,
+8070, 0.5, 0.696, 0.238, 0.045,
+8071, 0.5, 0.696, 0.238, 0.045,
+8080, 0.5, 0.696, 0.271, 0,
+8081, 0.5, 0.696, 0.271, 0,
+8082, 0.5, 0.696, 0.271, 0,
+8083, 0.5, 0.696, 0.271, 0,
+8084, 0.5, 0.696, 0.271, 0,
+8085, 0.5, 0.696, 0.271, 0,
+8086, 0.5, 0.696, 0.271, 0,
+8087, 0.5, 0.696, 0.271, 0,
+8096, 0.667, 0.696, 0.238, 0,
+8097, 0.667, 0.696, 0.238, 0,
+8098, 0.667, 0.696, 0.238, 0,
+8099, 0.667, 0.696, 0.238, 0,
+8100, 0.667, 0.696, 0.238, 0,
+8101, 0.667, 0.696, 0.238, 0,
+8102, 0.667, 0.695, 0.238, 0,
+8103, 0.667, 0.695, 0.238, 0,
+8114, 0.5, 0.695, 0.238, 0.045,
+8115, 0.5, 0.443, 0.238, 0.045,
+8116, 0.5, 0.695, 0.238, 0.045,
+8118, 0.5, 0.627, 0.011, 0.045,
+8119, 0.5, 0.627, 0.238, 0.045,
+8124, 0.667, 0.685, 0.238, 0,
+8126, 0.222, 0.158, 0.156, 0,
+8127, 0.222, 0.696, 0, 0,
+8128, 0.333, 0.626, 0, 0,
+8129, 0.444, 0.696, 0, 0,
+8130, 0.5, 0.695, 0.271, 0,
+8131, 0.5, 0.454, 0.271, 0,
+8132, 0.5, 0.695, 0.271, 0,
+8134, 0.5, 0.627, 0.271, 0,
+8135, 0.5, 0.627, 0.271, 0,
+8140, 0.708, 0.684, 0.238, 0,
+8141, 0.278, 0.696, 0, 0.021,
+8142, 0.278, 0.696, 0, 0.012,
+8143, 0.333, 0.696, 0, 0,
+8146, 0.25, 0.695, 0.01, 0,
+8150, 0.25, 0.628, 0.01, 0.008,
+8151, 0.25, 0.695, 0.01, 0.008,
+8157, 0.278, 0.696, 0, 0.021,
+8158, 0.278, 0.696, 0, 0.012,
+8159, 0.333, 0.696, 0, 0,
+8162, 0.5, 0.695, 0.01, 0,
+8164, 0.472, 0.696, 0.266, 0,
+8165, 0.472, 0.696, 0.266, 0,
+8166, 0.5, 0.626, 0.01, 0,
+8167, 0.5, 0.695, 0.01, 0,
+8173, 0.278, 0.695, 0, 0,
+8175, 0.167, 0.695, 0, 0.009,
+8178, 0.667, 0.695, 0.238, 0,
+8179, 0.667, 0.453, 0.238, 0,
+8180, 0.667, 0.695, 0.238, 0,
+8182, 0.667, 0.626, 0.011, 0,
+8183, 0.667, 0.626, 0.238, 0,
+8188, 0.722, 0.707, 0.238, 0,
+8190, 0.222, 0.696, 0, 0,
+8217, 0.278, 0.696, 0, 0,
+9001, 0.389, 0.751, 0.249, 0,
+9002, 0.389, 0.751, 0.25, 0
+METRICS_END
+
+KERNS_START
+900, 913, -0.111,
+900, 927, -0.056,
+900, 937, -0.028,
+900, 8124, -0.111,
+900, 8188, -0.028,
+912, 947, -0.028,
+912, 951, -0.017,
+912, 952, -0.017,
+912, 957, -0.056,
+912, 959, -0.028,
+912, 962, -0.028,
+912, 963, -0.028,
+912, 964, -0.028,
+912, 967, -0.028,
+913, 920, -0.083,
+913, 927, -0.083,
+913, 932, -0.083,
+913, 933, -0.139,
+913, 934, -0.083,
+913, 936, -0.122,
+913, 939, -0.139,
+915, 913, -0.133,
+915, 916, -0.111,
+915, 923, -0.122,
+915, 8124, -0.133,
+916, 927, -0.033,
+916, 933, -0.139,
+916, 939, -0.139,
+920, 913, -0.083,
+920, 8124, -0.083,
+922, 927, -0.083,
+923, 927, -0.033,
+923, 933, -0.1,
+923, 939, -0.1,
+925, 913, -0.083,
+925, 8124, -0.083,
+927, 913, -0.083,
+927, 931, -0.056,
+927, 8124, -0.083,
+929, 913, -0.167,
+929, 8124, -0.167,
+931, 913, -0.028,
+931, 8124, -0.028,
+932, 913, -0.083,
+932, 8124, -0.083,
+933, 913, -0.139,
+933, 916, -0.139,
+933, 923, -0.139,
+933, 8124, -0.139,
+934, 913, -0.083,
+934, 8124, -0.083,
+936, 913, -0.122,
+936, 8124, -0.122,
+939, 913, -0.139,
+939, 916, -0.139,
+939, 923, -0.139,
+939, 8124, -0.139,
+943, 947, -0.028,
+943, 951, -0.017,
+943, 952, -0.017,
+943, 957, -0.056,
+943, 959, -0.028,
+943, 962, -0.028,
+943, 963, -0.028,
+943, 964, -0.028,
+943, 967, -0.028,
+953, 947, -0.028,
+953, 951, -0.017,
+953, 952, -0.017,
+953, 957, -0.056,
+953, 959, -0.028,
+953, 962, -0.028,
+953, 963, -0.028,
+953, 964, -0.028,
+953, 967, -0.028,
+959, 947, -0.028,
+959, 955, -0.028,
+959, 957, -0.022,
+959, 964, -0.022,
+959, 967, -0.028,
+964, 940, -0.028,
+964, 945, -0.028,
+964, 959, -0.028,
+964, 969, -0.028,
+964, 972, -0.028,
+964, 974, -0.028,
+964, 7936, -0.028,
+964, 7937, -0.028,
+964, 7940, -0.028,
+964, 7941, -0.028,
+964, 7942, -0.028,
+964, 7943, -0.028,
+964, 8000, -0.028,
+964, 8001, -0.028,
+964, 8004, -0.028,
+964, 8005, -0.028,
+964, 8032, -0.028,
+964, 8033, -0.028,
+964, 8036, -0.028,
+964, 8037, -0.028,
+964, 8038, -0.028,
+964, 8039, -0.028,
+964, 8048, -0.028,
+964, 8056, -0.028,
+964, 8060, -0.028,
+964, 8064, -0.028,
+964, 8065, -0.028,
+964, 8068, -0.028,
+964, 8069, -0.028,
+964, 8070, -0.028,
+964, 8071, -0.028,
+964, 8096, -0.028,
+964, 8097, -0.028,
+964, 8100, -0.028,
+964, 8101, -0.028,
+964, 8102, -0.028,
+964, 8103, -0.028,
+964, 8114, -0.028,
+964, 8116, -0.028,
+964, 8118, -0.028,
+964, 8119, -0.028,
+964, 8178, -0.028,
+964, 8180, -0.028,
+964, 8182, -0.028,
+964, 8183, -0.028,
+970, 947, -0.028,
+970, 951, -0.017,
+970, 952, -0.017,
+970, 957, -0.056,
+970, 959, -0.028,
+970, 962, -0.028,
+970, 963, -0.028,
+970, 964, -0.028,
+970, 967, -0.028,
+972, 947, -0.028,
+972, 955, -0.028,
+972, 957, -0.022,
+972, 964, -0.022,
+972, 967, -0.028,
+7984, 947, -0.028,
+7984, 951, -0.017,
+7984, 952, -0.017,
+7984, 957, -0.056,
+7984, 959, -0.028,
+7984, 962, -0.028,
+7984, 963, -0.028,
+7984, 964, -0.028,
+7984, 967, -0.028,
+7985, 947, -0.028,
+7985, 951, -0.017,
+7985, 952, -0.017,
+7985, 957, -0.056,
+7985, 959, -0.028,
+7985, 962, -0.028,
+7985, 963, -0.028,
+7985, 964, -0.028,
+7985, 967, -0.028,
+7988, 947, -0.028,
+7988, 951, -0.017,
+7988, 952, -0.017,
+7988, 957, -0.056,
+7988, 959, -0.028,
+7988, 962, -0.028,
+7988, 963, -0.028,
+7988, 964, -0.028,
+7988, 967, -0.028,
+7989, 947, -0.028,
+7989, 951, -0.017,
+7989, 952, -0.017,
+7989, 957, -0.056,
+7989, 959, -0.028,
+7989, 962, -0.028,
+7989, 963, -0.028,
+7989, 964, -0.028,
+7989, 967, -0.028,
+7990, 947, -0.028,
+7990, 951, -0.017,
+7990, 952, -0.017,
+7990, 957, -0.056,
+7990, 959, -0.028,
+7990, 962, -0.028,
+7990, 963, -0.028,
+7990, 964, -0.028,
+7990, 967, -0.028,
+7991, 947, -0.028,
+7991, 951, -0.017,
+7991, 952, -0.017,
+7991, 957, -0.056,
+7991, 959, -0.028,
+7991, 962, -0.028,
+7991, 963, -0.028,
+7991, 964, -0.028,
+7991, 967, -0.028,
+8000, 947, -0.028,
+8000, 955, -0.028,
+8000, 957, -0.022,
+8000, 964, -0.022,
+8000, 967, -0.028,
+8001, 947, -0.028,
+8001, 955, -0.028,
+8001, 957, -0.022,
+8001, 964, -0.022,
+8001, 967, -0.028,
+8004, 947, -0.028,
+8004, 955, -0.028,
+8004, 957, -0.022,
+8004, 964, -0.022,
+8004, 967, -0.028,
+8005, 947, -0.028,
+8005, 955, -0.028,
+8005, 957, -0.022,
+8005, 964, -0.022,
+8005, 967, -0.028,
+8054, 947, -0.028,
+8054, 951, -0.017,
+8054, 952, -0.017,
+8054, 957, -0.056,
+8054, 959, -0.028,
+8054, 962, -0.028,
+8054, 963, -0.028,
+8054, 964, -0.028,
+8054, 967, -0.028,
+8056, 947, -0.028,
+8056, 955, -0.028,
+8056, 957, -0.022,
+8056, 964, -0.022,
+8056, 967, -0.028,
+8124, 920, -0.083,
+8124, 927, -0.083,
+8124, 932, -0.083,
+8124, 933, -0.139,
+8124, 934, -0.083,
+8124, 936, -0.122,
+8124, 939, -0.139,
+8127, 913, -0.139,
+8127, 927, -0.056,
+8127, 937, -0.028,
+8127, 8124, -0.139,
+8127, 8188, -0.028,
+8128, 913, -0.111,
+8128, 8124, -0.111,
+8141, 913, -0.083,
+8141, 927, -0.028,
+8141, 8124, -0.083,
+8142, 913, -0.083,
+8142, 927, -0.028,
+8142, 8124, -0.083,
+8143, 913, -0.111,
+8143, 8124, -0.111,
+8146, 947, -0.028,
+8146, 951, -0.017,
+8146, 952, -0.017,
+8146, 957, -0.056,
+8146, 959, -0.028,
+8146, 962, -0.028,
+8146, 963, -0.028,
+8146, 964, -0.028,
+8146, 967, -0.028,
+8150, 947, -0.028,
+8150, 951, -0.017,
+8150, 952, -0.017,
+8150, 957, -0.056,
+8150, 959, -0.028,
+8150, 962, -0.028,
+8150, 963, -0.028,
+8150, 964, -0.028,
+8150, 967, -0.028,
+8151, 947, -0.028,
+8151, 951, -0.017,
+8151, 952, -0.017,
+8151, 957, -0.056,
+8151, 959, -0.028,
+8151, 962, -0.028,
+8151, 963, -0.028,
+8151, 964, -0.028,
+8151, 967, -0.028,
+8157, 913, -0.083,
+8157, 927, -0.028,
+8157, 8124, -0.083,
+8158, 913, -0.083,
+8158, 927, -0.028,
+8158, 8124, -0.083,
+8159, 913, -0.111,
+8159, 8124, -0.111,
+8175, 913, -0.111,
+8175, 927, -0.056,
+8175, 937, -0.028,
+8175, 8124, -0.111,
+8175, 8188, -0.028,
+8190, 913, -0.167,
+8190, 927, -0.056,
+8190, 937, -0.028,
+8190, 8124, -0.167,
+8190, 8188, -0.028
+KERNS_END
+
+END
+
+DEF_FONT(fctrpg, greek/fctrpg.ttf, 204)
+
+xHeight(0.438) quad(1) space(0.525)
+
+METRICS_START
+32, 0.525, 0.0, 0, 0,
+168, 0.525, 0.607, 0, 0,
+884, 0.525, 0.613, 0, 0,
+885, 0.525, 0.001, 0.14, 0,
+890, 0.525, -0.053, 0.184, 0,
+900, 0.525, 0.613, 0, 0,
+901, 0.525, 0.613, 0, 0,
+903, 0.525, 0.431, 0, 0,
+912, 0.525, 0.613, 0.006, 0,
+913, 0.525, 0.653, 0, 0,
+914, 0.525, 0.641, 0, 0,
+915, 0.525, 0.641, 0, 0,
+916, 0.525, 0.653, 0, 0,
+917, 0.525, 0.641, 0, 0,
+918, 0.525, 0.64, 0, 0,
+919, 0.525, 0.641, 0, 0,
+920, 0.525, 0.652, 0.011, 0,
+921, 0.525, 0.641, 0, 0,
+922, 0.525, 0.641, 0, 0,
+923, 0.525, 0.653, 0, 0,
+924, 0.525, 0.641, 0, 0,
+925, 0.525, 0.641, 0, 0,
+926, 0.525, 0.641, 0, 0,
+927, 0.525, 0.652, 0.011, 0,
+928, 0.525, 0.641, 0, 0,
+929, 0.525, 0.641, 0, 0,
+931, 0.525, 0.641, 0, 0,
+932, 0.525, 0.641, 0, 0,
+933, 0.525, 0.651, 0, 0,
+934, 0.525, 0.64, 0, 0,
+935, 0.525, 0.641, 0, 0,
+936, 0.525, 0.64, 0, 0,
+937, 0.525, 0.651, 0, 0,
+938, 0.525, 0.783, 0, 0,
+939, 0.525, 0.783, 0, 0,
+940, 0.525, 0.613, 0.006, 0.002,
+941, 0.525, 0.613, 0.011, 0,
+942, 0.525, 0.613, 0.232, 0,
+943, 0.525, 0.613, 0.006, 0,
+944, 0.525, 0.669, 0.006, 0,
+945, 0.525, 0.438, 0.006, 0.002,
+946, 0.525, 0.647, 0.232, 0,
+947, 0.525, 0.438, 0.177, 0,
+948, 0.525, 0.637, 0.005, 0,
+949, 0.525, 0.443, 0.011, 0,
+950, 0.525, 0.651, 0.133, 0,
+951, 0.525, 0.442, 0.232, 0,
+952, 0.525, 0.652, 0.011, 0,
+953, 0.525, 0.437, 0.006, 0,
+954, 0.525, 0.445, 0.013, 0,
+955, 0.525, 0.642, 0.005, 0,
+956, 0.525, 0.442, 0.227, 0,
+957, 0.525, 0.438, 0.005, 0,
+958, 0.525, 0.651, 0.133, 0,
+959, 0.525, 0.438, 0.006, 0,
+960, 0.525, 0.432, 0.006, 0,
+961, 0.525, 0.437, 0.221, 0,
+962, 0.525, 0.437, 0.111, 0,
+963, 0.525, 0.437, 0.005, 0,
+964, 0.525, 0.431, 0.006, 0,
+965, 0.525, 0.443, 0.006, 0,
+966, 0.525, 0.443, 0.232, 0,
+967, 0.525, 0.439, 0.229, 0,
+968, 0.525, 0.651, 0.232, 0,
+969, 0.525, 0.442, 0.006, 0,
+970, 0.525, 0.641, 0.006, 0,
+971, 0.525, 0.64, 0.006, 0,
+972, 0.525, 0.613, 0.006, 0,
+973, 0.525, 0.613, 0.006, 0,
+974, 0.525, 0.613, 0.006, 0,
+984, 0.525, 0.647, 0, 0,
+985, 0.525, 0.609, 0.055, 0,
+986, 0.525, 0.641, 0.028, 0,
+987, 0.525, 0.443, 0.018, 0,
+988, 0.525, 0.641, 0, 0,
+989, 0.525, 0.432, 0.221, 0,
+991, 0.525, 0.542, 0.101, 0,
+992, 0.525, 0.667, 0, 0,
+993, 0.525, 0.64, 0.011, 0,
+7936, 0.525, 0.64, 0.006, 0.002,
+7937, 0.525, 0.64, 0.006, 0.002,
+7938, 0.525, 0.64, 0.006, 0.002,
+7939, 0.525, 0.64, 0.006, 0.002,
+7940, 0.525, 0.64, 0.006, 0.002,
+7941, 0.525, 0.64, 0.006, 0.002,
+7942, 0.525, 0.696, 0.006, 0.002,
+7943, 0.525, 0.696, 0.006, 0.002,
+7952, 0.525, 0.64, 0.011, 0,
+7953, 0.525, 0.64, 0.011, 0,
+7954, 0.525, 0.64, 0.011, 0,
+7955, 0.525, 0.64, 0.011, 0,
+7956, 0.525, 0.64, 0.011, 0,
+7957, 0.525, 0.64, 0.011, 0,
+7968, 0.525, 0.64, 0.232, 0,
+7969, 0.525, 0.64, 0.232, 0,
+7970, 0.525, 0.64, 0.232, 0,
+7971, 0.525, 0.64, 0.232, 0,
+7972, 0.525, 0.64, 0.232, 0,
+7973, 0.525, 0.64, 0.232, 0,
+7974, 0.525, 0.696, 0.232, 0,
+7975, 0.525, 0.696, 0.232, 0,
+7984, 0.525, 0.64, 0.006, 0,
+7985, 0.525, 0.64, 0.006, 0,
+7986, 0.525, 0.64, 0.006, 0,
+7987, 0.525, 0.64, 0.006, 0,
+7988, 0.525, 0.64, 0.006, 0,
+7989, 0.525, 0.64, 0.006, 0,
+7990, 0.525, 0.696, 0.006, 0,
+7991, 0.525, 0.696, 0.006, 0,
+8000, 0.525, 0.64, 0.006, 0,
+8001, 0.525, 0.64, 0.006, 0,
+8002, 0.525, 0.64, 0.006, 0,
+8003, 0.525, 0.64, 0.006, 0,
+8004, 0.525, 0.64, 0.006, 0,
+8005, 0.525, 0.64, 0.006, 0,
+8016, 0.525, 0.64, 0.006, 0,
+8017, 0.525, 0.64, 0.006, 0,
+8018, 0.525, 0.64, 0.006, 0,
+8019, 0.525, 0.64, 0.006, 0,
+8020, 0.525, 0.64, 0.006, 0,
+8021, 0.525, 0.64, 0.006, 0,
+8022, 0.525, 0.696, 0.006, 0,
+8023, 0.525, 0.696, 0.006, 0,
+8032, 0.525, 0.64, 0.006, 0,
+8033, 0.525, 0.64, 0.006, 0,
+8034, 0.525, 0.64, 0.006, 0,
+8035, 0.525, 0.64, 0.006, 0,
+8036, 0.525, 0.64, 0.006, 0,
+8037, 0.525, 0.64, 0.006, 0,
+8038, 0.525, 0.696, 0.006, 0,
+8039, 0.525, 0.696, 0.006, 0,
+8048, 0.525, 0.613, 0.006, 0.002,
+8050, 0.525, 0.614, 0.011, 0,
+8052, 0.525, 0.614, 0.232, 0,
+8054, 0.525, 0.613, 0.006, 0,
+8056, 0.525, 0.614, 0.006, 0,
+8058, 0.525, 0.613, 0.006, 0,
+8060, 0.525, 0.614, 0.006, 0,
+8064, 0.525, 0.64, 0.184, 0.002,
+8065, 0.525, 0.64, 0.184, 0.002,
+8066, 0.525, 0.64, 0.184, 0.002,
+8067, 0.525, 0.64, 0.184, 0.002,
+8068, 0.525, 0.64, 0.184, 0.002,
+8069, 0.525, 0.64, 0.184, 0.002,
+8070, 0.525, 0.696, 0.184, 0.002,
+8071, 0.525, 0.696, 0.184, 0.002,
+8080, 0.525, 0.64, 0.232, 0,
+8081, 0.525, 0.64, 0.232, 0,
+8082, 0.525, 0.64, 0.232, 0,
+8083, 0.525, 0.64, 0.232, 0,
+8084, 0.525, 0.64, 0.232, 0,
+8085, 0.525, 0.64, 0.232, 0,
+8086, 0.525, 0.696, 0.232, 0,
+8087, 0.525, 0.696, 0.232, 0,
+8096, 0.525, 0.64, 0.184, 0,
+8097, 0.525, 0.64, 0.184, 0,
+8098, 0.525, 0.64, 0.184, 0,
+8099, 0.525, 0.64, 0.184, 0,
+8100, 0.525, 0.64, 0.184, 0,
+8101, 0.525, 0.64, 0.184, 0,
+8102, 0.525, 0.696, 0.184, 0,
+8103, 0.525, 0.696, 0.184, 0,
+8114, 0.525, 0.613, 0.184, 0.002,
+8115, 0.525, 0.438, 0.184, 0.002,
+8116, 0.525, 0.613, 0.184, 0.002,
+8118, 0.525, 0.641, 0.006, 0.002,
+8119, 0.525, 0.641, 0.184, 0.002,
+8124, 0.525, 0.653, 0.184, 0,
+8126, 0.525, 0.137, 0.135, 0,
+8127, 0.525, 0.64, 0, 0,
+8128, 0.525, 0.641, 0, 0,
+8129, 0.525, 0.696, 0, 0,
+8130, 0.525, 0.614, 0.232, 0,
+8131, 0.525, 0.442, 0.232, 0,
+8132, 0.525, 0.613, 0.232, 0,
+8134, 0.525, 0.641, 0.232, 0,
+8135, 0.525, 0.641, 0.232, 0,
+8140, 0.525, 0.641, 0.184, 0,
+8141, 0.525, 0.64, 0, 0,
+8142, 0.525, 0.64, 0, 0,
+8143, 0.525, 0.696, 0, 0,
+8146, 0.525, 0.613, 0.006, 0,
+8150, 0.525, 0.641, 0.006, 0,
+8151, 0.525, 0.696, 0.006, 0,
+8157, 0.525, 0.64, 0, 0,
+8158, 0.525, 0.64, 0, 0,
+8159, 0.525, 0.696, 0, 0,
+8162, 0.525, 0.668, 0.006, 0,
+8164, 0.525, 0.64, 0.221, 0,
+8165, 0.525, 0.64, 0.221, 0,
+8166, 0.525, 0.641, 0.006, 0,
+8167, 0.525, 0.696, 0.006, 0,
+8173, 0.525, 0.613, 0, 0,
+8175, 0.525, 0.614, 0, 0,
+8178, 0.525, 0.614, 0.184, 0,
+8179, 0.525, 0.442, 0.184, 0,
+8180, 0.525, 0.613, 0.184, 0,
+8182, 0.525, 0.641, 0.006, 0,
+8183, 0.525, 0.641, 0.184, 0,
+8188, 0.525, 0.651, 0.184, 0,
+8190, 0.525, 0.64, 0, 0,
+8217, 0.525, 0.641, 0, 0,
+9001, 0.525, 0.695, 0.083, 0,
+9002, 0.525, 0.695, 0.083, 0
+METRICS_END
+
+KERNS_START
+8141, 913, -0.087,
+8141, 927, -0.029,
+8141, 8124, -0.087,
+8157, 913, -0.087,
+8157, 927, -0.029,
+8157, 8124, -0.087
+KERNS_END
+
+END
+
+DECL_FONT_SET(Greek)
+
+DEF_FONT_SET(Greek)
+
+REG_FONT(fcmbipg)
+REG_FONT(fcmbpg)
+REG_FONT(fcmripg)
+REG_FONT(fcmrpg)
+REG_FONT(fcsbpg)
+REG_FONT(fcsropg)
+REG_FONT(fcsrpg)
+REG_FONT(fctrpg)
+
+END_DEF_FONT_SET
+
+DEF_ALPHABET(Greek)
+
+SYMBOLS_START
+sym(accent, "\xcd\xb4")
+sym(accent, "\xcd\xb5")
+sym(accent, "\xcd\xba")
+sym(accent, "\xce\x84")
+sym(accent, "\xce\x85")
+sym(accent, "\xce\x87")
+sym(ordinary, "\xce\x90")
+sym(ordinary, "\xce\x91")
+sym(ordinary, "\xce\x92")
+sym(ordinary, "\xce\x93")
+sym(ordinary, "\xce\x94")
+sym(ordinary, "\xce\x95")
+sym(ordinary, "\xce\x96")
+sym(ordinary, "\xce\x97")
+sym(ordinary, "\xce\x98")
+sym(ordinary, "\xce\x99")
+sym(ordinary, "\xce\x9a")
+sym(ordinary, "\xce\x9b")
+sym(ordinary, "\xce\x9c")
+sym(ordinary, "\xce\x9d")
+sym(ordinary, "\xce\x9e")
+sym(ordinary, "\xce\x9f")
+sym(ordinary, "\xce\xa0")
+sym(ordinary, "\xce\xa1")
+sym(ordinary, "\xce\xa3")
+sym(ordinary, "\xce\xa4")
+sym(ordinary, "\xce\xa5")
+sym(ordinary, "\xce\xa6")
+sym(ordinary, "\xce\xa7")
+sym(ordinary, "\xce\xa8")
+sym(ordinary, "\xce\xa9")
+sym(ordinary, "\xce\xaa")
+sym(ordinary, "\xce\xab")
+sym(ordinary, "\xce\xac")
+sym(ordinary, "\xce\xad")
+sym(ordinary, "\xce\xae")
+sym(ordinary, "\xce\xaf")
+sym(ordinary, "\xce\xb0")
+sym(ordinary, "\xce\xb1")
+sym(ordinary, "\xce\xb2")
+sym(ordinary, "\xce\xb3")
+sym(ordinary, "\xce\xb4")
+sym(ordinary, "\xce\xb5")
+sym(ordinary, "\xce\xb6")
+sym(ordinary, "\xce\xb7")
+sym(ordinary, "\xce\xb8")
+sym(ordinary, "\xce\xb9")
+sym(ordinary, "\xce\xba")
+sym(ordinary, "\xce\xbb")
+sym(ordinary, "\xce\xbc")
+sym(ordinary, "\xce\xbd")
+sym(ordinary, "\xce\xbe")
+sym(ordinary, "\xce\xbf")
+sym(ordinary, "\xcf\x80")
+sym(ordinary, "\xcf\x81")
+sym(ordinary, "\xcf\x82")
+sym(ordinary, "\xcf\x83")
+sym(ordinary, "\xcf\x84")
+sym(ordinary, "\xcf\x85")
+sym(ordinary, "\xcf\x86")
+sym(ordinary, "\xcf\x87")
+sym(ordinary, "\xcf\x88")
+sym(ordinary, "\xcf\x89")
+sym(ordinary, "\xcf\x8a")
+sym(ordinary, "\xcf\x8b")
+sym(ordinary, "\xcf\x8c")
+sym(ordinary, "\xcf\x8d")
+sym(ordinary, "\xcf\x8e")
+sym(ordinary, "\xcf\x91")
+sym(ordinary, "\xcf\x98")
+sym(ordinary, "\xcf\x99")
+sym(ordinary, "\xcf\x9a")
+sym(ordinary, "\xcf\x9b")
+sym(ordinary, "\xcf\x9c")
+sym(ordinary, "\xcf\x9d")
+sym(ordinary, "\xcf\x9f")
+sym(ordinary, "\xcf\xa0")
+sym(ordinary, "\xcf\xa1")
+sym(ordinary, "\xe1\xbc\x80")
+sym(ordinary, "\xe1\xbc\x81")
+sym(ordinary, "\xe1\xbc\x82")
+sym(ordinary, "\xe1\xbc\x83")
+sym(ordinary, "\xe1\xbc\x84")
+sym(ordinary, "\xe1\xbc\x85")
+sym(ordinary, "\xe1\xbc\x86")
+sym(ordinary, "\xe1\xbc\x87")
+sym(ordinary, "\xe1\xbc\x90")
+sym(ordinary, "\xe1\xbc\x91")
+sym(ordinary, "\xe1\xbc\x92")
+sym(ordinary, "\xe1\xbc\x93")
+sym(ordinary, "\xe1\xbc\x94")
+sym(ordinary, "\xe1\xbc\x95")
+sym(ordinary, "\xe1\xbc\xa0")
+sym(ordinary, "\xe1\xbc\xa1")
+sym(ordinary, "\xe1\xbc\xa2")
+sym(ordinary, "\xe1\xbc\xa3")
+sym(ordinary, "\xe1\xbc\xa4")
+sym(ordinary, "\xe1\xbc\xa5")
+sym(ordinary, "\xe1\xbc\xa6")
+sym(ordinary, "\xe1\xbc\xa7")
+sym(ordinary, "\xe1\xbc\xb0")
+sym(ordinary, "\xe1\xbc\xb1")
+sym(ordinary, "\xe1\xbc\xb2")
+sym(ordinary, "\xe1\xbc\xb3")
+sym(ordinary, "\xe1\xbc\xb4")
+sym(ordinary, "\xe1\xbc\xb5")
+sym(ordinary, "\xe1\xbc\xb6")
+sym(ordinary, "\xe1\xbc\xb7")
+sym(ordinary, "\xe1\xbd\x80")
+sym(ordinary, "\xe1\xbd\x81")
+sym(ordinary, "\xe1\xbd\x82")
+sym(ordinary, "\xe1\xbd\x83")
+sym(ordinary, "\xe1\xbd\x84")
+sym(ordinary, "\xe1\xbd\x85")
+sym(ordinary, "\xe1\xbd\x90")
+sym(ordinary, "\xe1\xbd\x91")
+sym(ordinary, "\xe1\xbd\x92")
+sym(ordinary, "\xe1\xbd\x93")
+sym(ordinary, "\xe1\xbd\x94")
+sym(ordinary, "\xe1\xbd\x95")
+sym(ordinary, "\xe1\xbd\x96")
+sym(ordinary, "\xe1\xbd\x97")
+sym(ordinary, "\xe1\xbd\xa0")
+sym(ordinary, "\xe1\xbd\xa1")
+sym(ordinary, "\xe1\xbd\xa2")
+sym(ordinary, "\xe1\xbd\xa3")
+sym(ordinary, "\xe1\xbd\xa4")
+sym(ordinary, "\xe1\xbd\xa5")
+sym(ordinary, "\xe1\xbd\xa6")
+sym(ordinary, "\xe1\xbd\xa7")
+sym(ordinary, "\xe1\xbd\xb0")
+sym(ordinary, "\xe1\xbd\xb2")
+sym(ordinary, "\xe1\xbd\xb4")
+sym(ordinary, "\xe1\xbd\xb6")
+sym(ordinary, "\xe1\xbd\xb8")
+sym(ordinary, "\xe1\xbd\xba")
+sym(ordinary, "\xe1\xbd\xbc")
+sym(ordinary, "\xe1\xbe\x80")
+sym(ordinary, "\xe1\xbe\x81")
+sym(ordinary, "\xe1\xbe\x82")
+sym(ordinary, "\xe1\xbe\x83")
+sym(ordinary, "\xe1\xbe\x84")
+sym(ordinary, "\xe1\xbe\x85")
+sym(ordinary, "\xe1\xbe\x86")
+sym(ordinary, "\xe1\xbe\x87")
+sym(ordinary, "\xe1\xbe\x90")
+sym(ordinary, "\xe1\xbe\x91")
+sym(ordinary, "\xe1\xbe\x92")
+sym(ordinary, "\xe1\xbe\x93")
+sym(ordinary, "\xe1\xbe\x94")
+sym(ordinary, "\xe1\xbe\x95")
+sym(ordinary, "\xe1\xbe\x96")
+sym(ordinary, "\xe1\xbe\x97")
+sym(ordinary, "\xe1\xbe\xa0")
+sym(ordinary, "\xe1\xbe\xa1")
+sym(ordinary, "\xe1\xbe\xa2")
+sym(ordinary, "\xe1\xbe\xa3")
+sym(ordinary, "\xe1\xbe\xa4")
+sym(ordinary, "\xe1\xbe\xa5")
+sym(ordinary, "\xe1\xbe\xa6")
+sym(ordinary, "\xe1\xbe\xa7")
+sym(ordinary, "\xe1\xbe\xb2")
+sym(ordinary, "\xe1\xbe\xb3")
+sym(ordinary, "\xe1\xbe\xb4")
+sym(ordinary, "\xe1\xbe\xb6")
+sym(ordinary, "\xe1\xbe\xb7")
+sym(ordinary, "\xe1\xbe\xbc")
+sym(accent, "\xe1\xbe\xbe")
+sym(accent, "\xe1\xbe\xbf")
+sym(accent, "\xe1\xbf\x80")
+sym(accent, "\xe1\xbf\x81")
+sym(ordinary, "\xe1\xbf\x82")
+sym(ordinary, "\xe1\xbf\x83")
+sym(ordinary, "\xe1\xbf\x84")
+sym(ordinary, "\xe1\xbf\x86")
+sym(ordinary, "\xe1\xbf\x87")
+sym(ordinary, "\xe1\xbf\x8c")
+sym(accent, "\xe1\xbf\x8d")
+sym(accent, "\xe1\xbf\x8e")
+sym(accent, "\xe1\xbf\x8f")
+sym(ordinary, "\xe1\xbf\x92")
+sym(ordinary, "\xe1\xbf\x96")
+sym(ordinary, "\xe1\xbf\x97")
+sym(accent, "\xe1\xbf\x9d")
+sym(accent, "\xe1\xbf\x9e")
+sym(accent, "\xe1\xbf\x9f")
+sym(ordinary, "\xe1\xbf\xa2")
+sym(ordinary, "\xe1\xbf\xa4")
+sym(ordinary, "\xe1\xbf\xa5")
+sym(ordinary, "\xe1\xbf\xa6")
+sym(ordinary, "\xe1\xbf\xa7")
+sym(accent, "\xe1\xbf\xad")
+sym(accent, "\xe1\xbf\xaf")
+sym(ordinary, "\xe1\xbf\xb2")
+sym(ordinary, "\xe1\xbf\xb3")
+sym(ordinary, "\xe1\xbf\xb4")
+sym(ordinary, "\xe1\xbf\xb6")
+sym(ordinary, "\xe1\xbf\xb7")
+sym(ordinary, "\xe1\xbf\xbc")
+sym(accent, "\xe1\xbf\xbe")
+sym(accent, "\xe2\x80\x99")
+SYMBOLS_END
+
+SYMBOL_MAPPINGS_START
+M(884, "\xcd\xb4", nullptr)
+M(885, "\xcd\xb5", nullptr)
+M(890, "\xcd\xba", nullptr)
+M(900, "\xce\x84", nullptr)
+M(901, "\xce\x85", nullptr)
+M(903, "\xce\x87", nullptr)
+M(912, "\xce\x90", nullptr)
+M(938, "\xce\xaa", nullptr)
+M(939, "\xce\xab", nullptr)
+M(940, "\xce\xac", nullptr)
+M(941, "\xce\xad", nullptr)
+M(942, "\xce\xae", nullptr)
+M(943, "\xce\xaf", nullptr)
+M(944, "\xce\xb0", nullptr)
+M(970, "\xcf\x8a", nullptr)
+M(971, "\xcf\x8b", nullptr)
+M(972, "\xcf\x8c", nullptr)
+M(973, "\xcf\x8d", nullptr)
+M(974, "\xcf\x8e", nullptr)
+M(984, "\xcf\x98", nullptr)
+M(985, "\xcf\x99", nullptr)
+M(986, "\xcf\x9a", nullptr)
+M(987, "\xcf\x9b", nullptr)
+M(988, "\xcf\x9c", nullptr)
+M(989, "\xcf\x9d", nullptr)
+M(991, "\xcf\x9f", nullptr)
+M(992, "\xcf\xa0", nullptr)
+M(993, "\xcf\xa1", nullptr)
+M(7936, "\xe1\xbc\x80", nullptr)
+M(7937, "\xe1\xbc\x81", nullptr)
+M(7938, "\xe1\xbc\x82", nullptr)
+M(7939, "\xe1\xbc\x83", nullptr)
+M(7940, "\xe1\xbc\x84", nullptr)
+M(7941, "\xe1\xbc\x85", nullptr)
+M(7942, "\xe1\xbc\x86", nullptr)
+M(7943, "\xe1\xbc\x87", nullptr)
+M(7952, "\xe1\xbc\x90", nullptr)
+M(7953, "\xe1\xbc\x91", nullptr)
+M(7954, "\xe1\xbc\x92", nullptr)
+M(7955, "\xe1\xbc\x93", nullptr)
+M(7956, "\xe1\xbc\x94", nullptr)
+M(7957, "\xe1\xbc\x95", nullptr)
+M(7968, "\xe1\xbc\xa0", nullptr)
+M(7969, "\xe1\xbc\xa1", nullptr)
+M(7970, "\xe1\xbc\xa2", nullptr)
+M(7971, "\xe1\xbc\xa3", nullptr)
+M(7972, "\xe1\xbc\xa4", nullptr)
+M(7973, "\xe1\xbc\xa5", nullptr)
+M(7974, "\xe1\xbc\xa6", nullptr)
+M(7975, "\xe1\xbc\xa7", nullptr)
+M(7984, "\xe1\xbc\xb0", nullptr)
+M(7985, "\xe1\xbc\xb1", nullptr)
+M(7986, "\xe1\xbc\xb2", nullptr)
+M(7987, "\xe1\xbc\xb3", nullptr)
+M(7988, "\xe1\xbc\xb4", nullptr)
+M(7989, "\xe1\xbc\xb5", nullptr)
+M(7990, "\xe1\xbc\xb6", nullptr)
+M(7991, "\xe1\xbc\xb7", nullptr)
+M(8000, "\xe1\xbd\x80", nullptr)
+M(8001, "\xe1\xbd\x81", nullptr)
+M(8002, "\xe1\xbd\x82", nullptr)
+M(8003, "\xe1\xbd\x83", nullptr)
+M(8004, "\xe1\xbd\x84", nullptr)
+M(8005, "\xe1\xbd\x85", nullptr)
+M(8016, "\xe1\xbd\x90", nullptr)
+M(8017, "\xe1\xbd\x91", nullptr)
+M(8018, "\xe1\xbd\x92", nullptr)
+M(8019, "\xe1\xbd\x93", nullptr)
+M(8020, "\xe1\xbd\x94", nullptr)
+M(8021, "\xe1\xbd\x95", nullptr)
+M(8022, "\xe1\xbd\x96", nullptr)
+M(8023, "\xe1\xbd\x97", nullptr)
+M(8032, "\xe1\xbd\xa0", nullptr)
+M(8033, "\xe1\xbd\xa1", nullptr)
+M(8034, "\xe1\xbd\xa2", nullptr)
+M(8035, "\xe1\xbd\xa3", nullptr)
+M(8036, "\xe1\xbd\xa4", nullptr)
+M(8037, "\xe1\xbd\xa5", nullptr)
+M(8038, "\xe1\xbd\xa6", nullptr)
+M(8039, "\xe1\xbd\xa7", nullptr)
+M(8048, "\xe1\xbd\xb0", nullptr)
+M(8050, "\xe1\xbd\xb2", nullptr)
+M(8052, "\xe1\xbd\xb4", nullptr)
+M(8054, "\xe1\xbd\xb6", nullptr)
+M(8056, "\xe1\xbd\xb8", nullptr)
+M(8058, "\xe1\xbd\xba", nullptr)
+M(8060, "\xe1\xbd\xbc", nullptr)
+M(8064, "\xe1\xbe\x80", nullptr)
+M(8065, "\xe1\xbe\x81", nullptr)
+M(8066, "\xe1\xbe\x82", nullptr)
+M(8067, "\xe1\xbe\x83", nullptr)
+M(8068, "\xe1\xbe\x84", nullptr)
+M(8069, "\xe1\xbe\x85", nullptr)
+M(8070, "\xe1\xbe\x86", nullptr)
+M(8071, "\xe1\xbe\x87", nullptr)
+M(8080, "\xe1\xbe\x90", nullptr)
+M(8081, "\xe1\xbe\x91", nullptr)
+M(8082, "\xe1\xbe\x92", nullptr)
+M(8083, "\xe1\xbe\x93", nullptr)
+M(8084, "\xe1\xbe\x94", nullptr)
+M(8085, "\xe1\xbe\x95", nullptr)
+M(8086, "\xe1\xbe\x96", nullptr)
+M(8087, "\xe1\xbe\x97", nullptr)
+M(8096, "\xe1\xbe\xa0", nullptr)
+M(8097, "\xe1\xbe\xa1", nullptr)
+M(8098, "\xe1\xbe\xa2", nullptr)
+M(8099, "\xe1\xbe\xa3", nullptr)
+M(8100, "\xe1\xbe\xa4", nullptr)
+M(8101, "\xe1\xbe\xa5", nullptr)
+M(8102, "\xe1\xbe\xa6", nullptr)
+M(8103, "\xe1\xbe\xa7", nullptr)
+M(8114, "\xe1\xbe\xb2", nullptr)
+M(8115, "\xe1\xbe\xb3", nullptr)
+M(8116, "\xe1\xbe\xb4", nullptr)
+M(8118, "\xe1\xbe\xb6", nullptr)
+M(8119, "\xe1\xbe\xb7", nullptr)
+M(8124, "\xe1\xbe\xbc", nullptr)
+M(8125, "\xe1\xbe\xbf", nullptr)
+M(8126, "\xe1\xbe\xbe", nullptr)
+M(8127, "\xe1\xbe\xbf", nullptr)
+M(8128, "\xe1\xbf\x80", nullptr)
+M(8129, "\xe1\xbf\x81", nullptr)
+M(8130, "\xe1\xbf\x82", nullptr)
+M(8131, "\xe1\xbf\x83", nullptr)
+M(8132, "\xe1\xbf\x84", nullptr)
+M(8134, "\xe1\xbf\x86", nullptr)
+M(8135, "\xe1\xbf\x87", nullptr)
+M(8140, "\xe1\xbf\x8c", nullptr)
+M(8141, "\xe1\xbf\x8d", nullptr)
+M(8142, "\xe1\xbf\x8e", nullptr)
+M(8143, "\xe1\xbf\x8f", nullptr)
+M(8146, "\xe1\xbf\x92", nullptr)
+M(8150, "\xe1\xbf\x96", nullptr)
+M(8151, "\xe1\xbf\x97", nullptr)
+M(8157, "\xe1\xbf\x9d", nullptr)
+M(8158, "\xe1\xbf\x9e", nullptr)
+M(8159, "\xe1\xbf\x9f", nullptr)
+M(8162, "\xe1\xbf\xa2", nullptr)
+M(8164, "\xe1\xbf\xa4", nullptr)
+M(8165, "\xe1\xbf\xa5", nullptr)
+M(8166, "\xe1\xbf\xa6", nullptr)
+M(8167, "\xe1\xbf\xa7", nullptr)
+M(8173, "\xe1\xbf\xad", nullptr)
+M(8174, "\xce\x85", nullptr)
+M(8175, "\xe1\xbf\xaf", nullptr)
+M(8178, "\xe1\xbf\xb2", nullptr)
+M(8179, "\xe1\xbf\xb3", nullptr)
+M(8180, "\xe1\xbf\xb4", nullptr)
+M(8182, "\xe1\xbf\xb6", nullptr)
+M(8183, "\xe1\xbf\xb7", nullptr)
+M(8188, "\xe1\xbf\xbc", nullptr)
+M(8189, "\xcd\xb4", nullptr)
+M(8190, "\xe1\xbf\xbe", nullptr)
+M(8217, "\xe2\x80\x99", nullptr)
+SYMBOL_MAPPINGS_END
+
+FORMULA_MAPPINGS_START
+M(902, "\\grkaccent{\xcd\xb4}{\\phantom{\xce\xb9}}\\!\\!A", nullptr)
+M(904, "\\grkaccent{\xcd\xb4}{\\phantom{\xce\xb9}}\xce\x95", nullptr)
+M(905, "\\grkaccent{\xcd\xb4}{\\phantom{\xce\xb9}}H", nullptr)
+M(906, "\\grkaccent{\xcd\xb4}{\\phantom{\xce\xb9}}\xce\x99", nullptr)
+M(908, "\\grkaccent{\xcd\xb4}{\\phantom{\xce\xb9}}\\!\xce\x9f", nullptr)
+M(910, "\\grkaccent{\xcd\xb4}{\\phantom{\xce\xb9}}\xce\xa5", nullptr)
+M(911, "\\grkaccent{\xcd\xb4}{\\phantom{\xce\xb9}}\\!\xce\xa9", nullptr)
+M(7944, "\xe2\x80\x99\xce\x91", nullptr)
+M(7945, "\xe1\xbf\xbe\xce\x91", nullptr)
+M(7946, "\xe1\xbf\x8d\xce\x91", nullptr)
+M(7947, "\xe1\xbf\x9d\xce\x91", nullptr)
+M(7948, "\xe1\xbf\x8e\xce\x91", nullptr)
+M(7949, "\xe1\xbf\x9e\xce\x91", nullptr)
+M(7950, "\xe1\xbf\x8f\xce\x91", nullptr)
+M(7951, "\xe1\xbf\x9f\xce\x91", nullptr)
+M(7960, "\xe2\x80\x99\xce\x95", nullptr)
+M(7961, "\xe1\xbf\xbe\xce\x95", nullptr)
+M(7962, "\xe1\xbf\x8d\xce\x95", nullptr)
+M(7963, "\xe1\xbf\x9d\xce\x95", nullptr)
+M(7964, "\xe1\xbf\x8e\xce\x95", nullptr)
+M(7965, "\xe1\xbf\x9e\xce\x95", nullptr)
+M(7976, "\xe2\x80\x99\xce\x97", nullptr)
+M(7977, "\xe1\xbf\xbe\xce\x97", nullptr)
+M(7978, "\xe1\xbf\x8d\xce\x97", nullptr)
+M(7979, "\xe1\xbf\x9d\xce\x97", nullptr)
+M(7980, "\xe1\xbf\x8e\xce\x97", nullptr)
+M(7981, "\xe1\xbf\x9e\xce\x97", nullptr)
+M(7982, "\xe1\xbf\x8f\xce\x97", nullptr)
+M(7983, "\xe1\xbf\x9f\xce\x97", nullptr)
+M(7992, "\xe2\x80\x99\xce\x99", nullptr)
+M(7993, "\xe1\xbf\xbe\xce\x99", nullptr)
+M(7994, "\xe1\xbf\x8d\xce\x99", nullptr)
+M(7995, "\xe1\xbf\x9d\xce\x99", nullptr)
+M(7996, "\xe1\xbf\x8e\xce\x99", nullptr)
+M(7997, "\xe1\xbf\x9e\xce\x99", nullptr)
+M(7998, "\xe1\xbf\x8f\xce\x99", nullptr)
+M(7999, "\xe1\xbf\x9f\xce\x99", nullptr)
+M(8008, "\xe2\x80\x99\xce\x9f", nullptr)
+M(8009, "\xe1\xbf\xbe\xce\x9f", nullptr)
+M(8010, "\xe1\xbf\x8d\xce\x9f", nullptr)
+M(8011, "\xe1\xbf\x9d\xce\x9f", nullptr)
+M(8012, "\xe1\xbf\x8e\xce\x9f", nullptr)
+M(8013, "\xe1\xbf\x9e\xce\x9f", nullptr)
+M(8025, "\xe1\xbf\xbe\xce\xa5", nullptr)
+M(8026, "\xe1\xbf\x9d\xce\xa5", nullptr)
+M(8027, "\xe1\xbf\x9e\xce\xa5", nullptr)
+M(8028, "\xe1\xbf\x9f\xce\xa5", nullptr)
+M(8040, "\xe2\x80\x99\xce\xa9", nullptr)
+M(8041, "\xe1\xbf\xbe\xce\xa9", nullptr)
+M(8042, "\xe1\xbf\x8d\xce\xa9", nullptr)
+M(8043, "\xe1\xbf\x9d\xce\xa9", nullptr)
+M(8044, "\xe1\xbf\x8e\xce\xa9", nullptr)
+M(8045, "\xe1\xbf\x9e\xce\xa9", nullptr)
+M(8046, "\xe1\xbf\x8f\xce\xa9", nullptr)
+M(8047, "\xe1\xbf\x9f\xce\xa9", nullptr)
+M(8049, "\\grkaccent{\xce\x84}\xce\xb1", nullptr)
+M(8051, "\\grkaccent{\xce\x84}\xce\xb5", nullptr)
+M(8053, "\\grkaccent{\xce\x84}\xce\xb7", nullptr)
+M(8055, "\\grkaccent{\xce\x84}\xce\xb9", nullptr)
+M(8057, "\\grkaccent{\xce\x84}\xce\xbf", nullptr)
+M(8059, "\\grkaccent{\xce\x84}\xcf\x85", nullptr)
+M(8061, "\\grkaccent{\xce\x84}\xcf\x89", nullptr)
+M(8072, "\xe2\x80\x99\xe1\xbe\xbc", nullptr)
+M(8073, "\xe1\xbf\xbe\xe1\xbe\xbc", nullptr)
+M(8074, "\xe1\xbf\x8d\xe1\xbe\xbc", nullptr)
+M(8075, "\xe1\xbf\x9d\xe1\xbe\xbc", nullptr)
+M(8076, "\xe1\xbf\x8e\xe1\xbe\xbc", nullptr)
+M(8077, "\xe1\xbf\x9e\xe1\xbe\xbc", nullptr)
+M(8078, "\xe1\xbf\x8f\xe1\xbe\xbc", nullptr)
+M(8079, "\xe1\xbf\x9f\xe1\xbe\xbc", nullptr)
+M(8088, "\xe2\x80\x99\xe1\xbf\x8c", nullptr)
+M(8089, "\xe1\xbf\xbe\xe1\xbf\x8c", nullptr)
+M(8090, "\xe1\xbf\x8d\xe1\xbf\x8c", nullptr)
+M(8091, "\xe1\xbf\x9d\xe1\xbf\x8c", nullptr)
+M(8092, "\xe1\xbf\x8e\xe1\xbf\x8c", nullptr)
+M(8093, "\xe1\xbf\x9e\xe1\xbf\x8c", nullptr)
+M(8094, "\xe1\xbf\x8f\xe1\xbf\x8c", nullptr)
+M(8095, "\xe1\xbf\x9f\xe1\xbf\x8c", nullptr)
+M(8100, "\\grkaccent{\xe1\xbf\x8e}\xe1\xbf\xb3", nullptr)
+M(8104, "\xe2\x80\x99\xe1\xbf\xbc", nullptr)
+M(8105, "\xe1\xbf\xbe\xe1\xbf\xbc", nullptr)
+M(8106, "\xe1\xbf\x8d\xe1\xbf\xbc", nullptr)
+M(8107, "\xe1\xbf\x9d\xe1\xbf\xbc", nullptr)
+M(8108, "\xe1\xbf\x8e\xe1\xbf\xbc", nullptr)
+M(8109, "\xe1\xbf\x9e\xe1\xbf\xbc", nullptr)
+M(8110, "\xe1\xbf\x8f\xe1\xbf\xbc", nullptr)
+M(8111, "\xe1\xbf\x9f\xe1\xbf\xbc", nullptr)
+M(8112, "\\u \xce\xb1", nullptr)
+M(8113, "\\= \xce\xb1", nullptr)
+M(8120, "\\u \xce\x91", nullptr)
+M(8121, "\\= \xce\x91", nullptr)
+M(8122, "\\grkaccent{\xe1\xbf\xaf}{\\vphantom{\xce\xb9}}\xce\x91", nullptr)
+M(8123, "\\grkaccent{\xcd\xb4}{\\vphantom{\xce\xb9}}\\!\\!\xce\x91", nullptr)
+M(8136, "\\grkaccent{\xe1\xbf\xaf}{\\vphantom{\xce\xb9}}\xce\x95", nullptr)
+M(8137, "\\grkaccent{\xcd\xb4}{\\vphantom{\xce\xb9}}\xce\x95", nullptr)
+M(8138, "\\grkaccent{\xe1\xbf\xaf}{\\vphantom{\xce\xb9}}\xce\x97", nullptr)
+M(8139, "\\grkaccent{\xcd\xb4}{\\vphantom{\xce\xb9}}\xce\x97", nullptr)
+M(8144, "\\u \xce\xb9", nullptr)
+M(8145, "\\= \xce\xb9", nullptr)
+M(8147, "\\grkaccent{\xce\x85}\xce\xb9", nullptr)
+M(8152, "\\u \xce\x99", nullptr)
+M(8153, "\\= \xce\x99", nullptr)
+M(8154, "\\grkaccent{\xe1\xbf\xaf}{\\phantom{\xce\xb9}}\xce\x99", nullptr)
+M(8155, "\\grkaccent{\xcd\xb4}{\\phantom{\xce\xb9}}\xce\x99", nullptr)
+M(8160, "\\u \xcf\x85", nullptr)
+M(8161, "\\= \xcf\x85", nullptr)
+M(8163, "\\grkaccent{\xce\x85}\xcf\x85", nullptr)
+M(8168, "\\u \xce\xa5", nullptr)
+M(8169, "\\= \xce\xa5", nullptr)
+M(8170, "\\grkaccent{\xe1\xbf\xaf}{\\phantom{\xce\xb9}}\xce\xa5", nullptr)
+M(8171, "\\grkaccent{\xcd\xb4}{\\phantom{\xce\xb9}}\xce\xa5", nullptr)
+M(8184, "\\grkaccent{\xe1\xbf\xaf}{\\vphantom{\xce\xb9}}\xce\x9f", nullptr)
+M(8185, "\\grkaccent{\xcd\xb4}{\\vphantom{\xce\xb9}}\\!\xce\x9f", nullptr)
+M(8186, "\\grkaccent{\xe1\xbf\xaf}{\\vphantom{\xce\xb9}}\xce\xa9", nullptr)
+M(8187, "\\grkaccent{\xcd\xb4}{\\vphantom{\xce\xb9}}\\!\xce\xa9", nullptr)
+FORMULA_MAPPINGS_END
+
+FONT_ID(fcmrpg)
+
+CHARS_START
+E(fcmrpg, 884, "\xcd\xb4")
+E(fcmrpg, 885, "\xcd\xb5")
+E(fcmrpg, 890, "\xcd\xba")
+E(fcmrpg, 900, "\xce\x84")
+E(fcmrpg, 901, "\xce\x85")
+E(fcmrpg, 903, "\xce\x87")
+E(fcmrpg, 912, "\xce\x90")
+E(fcmrpg, 913, "\xce\x91")
+E(fcmrpg, 914, "\xce\x92")
+E(fcmrpg, 915, "\xce\x93")
+E(fcmrpg, 916, "\xce\x94")
+E(fcmrpg, 917, "\xce\x95")
+E(fcmrpg, 918, "\xce\x96")
+E(fcmrpg, 919, "\xce\x97")
+E(fcmrpg, 920, "\xce\x98")
+E(fcmrpg, 921, "\xce\x99")
+E(fcmrpg, 922, "\xce\x9a")
+E(fcmrpg, 923, "\xce\x9b")
+E(fcmrpg, 924, "\xce\x9c")
+E(fcmrpg, 925, "\xce\x9d")
+E(fcmrpg, 926, "\xce\x9e")
+E(fcmrpg, 927, "\xce\x9f")
+E(fcmrpg, 928, "\xce\xa0")
+E(fcmrpg, 929, "\xce\xa1")
+E(fcmrpg, 931, "\xce\xa3")
+E(fcmrpg, 932, "\xce\xa4")
+E(fcmrpg, 933, "\xce\xa5")
+E(fcmrpg, 934, "\xce\xa6")
+E(fcmrpg, 935, "\xce\xa7")
+E(fcmrpg, 936, "\xce\xa8")
+E(fcmrpg, 937, "\xce\xa9")
+E(fcmrpg, 938, "\xce\xaa")
+E(fcmrpg, 939, "\xce\xab")
+E(fcmrpg, 940, "\xce\xac")
+E(fcmrpg, 941, "\xce\xad")
+E(fcmrpg, 942, "\xce\xae")
+E(fcmrpg, 943, "\xce\xaf")
+E(fcmrpg, 944, "\xce\xb0")
+E(fcmrpg, 945, "\xce\xb1")
+E(fcmrpg, 946, "\xce\xb2")
+E(fcmrpg, 947, "\xce\xb3")
+E(fcmrpg, 948, "\xce\xb4")
+E(fcmrpg, 949, "\xce\xb5")
+E(fcmrpg, 950, "\xce\xb6")
+E(fcmrpg, 951, "\xce\xb7")
+E(fcmrpg, 952, "\xce\xb8")
+E(fcmrpg, 953, "\xce\xb9")
+E(fcmrpg, 954, "\xce\xba")
+E(fcmrpg, 955, "\xce\xbb")
+E(fcmrpg, 956, "\xce\xbc")
+E(fcmrpg, 957, "\xce\xbd")
+E(fcmrpg, 958, "\xce\xbe")
+E(fcmrpg, 959, "\xce\xbf")
+E(fcmrpg, 960, "\xcf\x80")
+E(fcmrpg, 961, "\xcf\x81")
+E(fcmrpg, 962, "\xcf\x82")
+E(fcmrpg, 963, "\xcf\x83")
+E(fcmrpg, 964, "\xcf\x84")
+E(fcmrpg, 965, "\xcf\x85")
+E(fcmrpg, 966, "\xcf\x86")
+E(fcmrpg, 967, "\xcf\x87")
+E(fcmrpg, 968, "\xcf\x88")
+E(fcmrpg, 969, "\xcf\x89")
+E(fcmrpg, 970, "\xcf\x8a")
+E(fcmrpg, 971, "\xcf\x8b")
+E(fcmrpg, 972, "\xcf\x8c")
+E(fcmrpg, 973, "\xcf\x8d")
+E(fcmrpg, 974, "\xcf\x8e")
+E(fcmrpg, 977, "\xcf\x91")
+E(fcmrpg, 984, "\xcf\x98")
+E(fcmrpg, 985, "\xcf\x99")
+E(fcmrpg, 986, "\xcf\x9a")
+E(fcmrpg, 987, "\xcf\x9b")
+E(fcmrpg, 988, "\xcf\x9c")
+E(fcmrpg, 989, "\xcf\x9d")
+E(fcmrpg, 991, "\xcf\x9f")
+E(fcmrpg, 992, "\xcf\xa0")
+E(fcmrpg, 993, "\xcf\xa1")
+E(fcmrpg, 7936, "\xe1\xbc\x80")
+E(fcmrpg, 7937, "\xe1\xbc\x81")
+E(fcmrpg, 7938, "\xe1\xbc\x82")
+E(fcmrpg, 7939, "\xe1\xbc\x83")
+E(fcmrpg, 7940, "\xe1\xbc\x84")
+E(fcmrpg, 7941, "\xe1\xbc\x85")
+E(fcmrpg, 7942, "\xe1\xbc\x86")
+E(fcmrpg, 7943, "\xe1\xbc\x87")
+E(fcmrpg, 7952, "\xe1\xbc\x90")
+E(fcmrpg, 7953, "\xe1\xbc\x91")
+E(fcmrpg, 7954, "\xe1\xbc\x92")
+E(fcmrpg, 7955, "\xe1\xbc\x93")
+E(fcmrpg, 7956, "\xe1\xbc\x94")
+E(fcmrpg, 7957, "\xe1\xbc\x95")
+E(fcmrpg, 7968, "\xe1\xbc\xa0")
+E(fcmrpg, 7969, "\xe1\xbc\xa1")
+E(fcmrpg, 7970, "\xe1\xbc\xa2")
+E(fcmrpg, 7971, "\xe1\xbc\xa3")
+E(fcmrpg, 7972, "\xe1\xbc\xa4")
+E(fcmrpg, 7973, "\xe1\xbc\xa5")
+E(fcmrpg, 7974, "\xe1\xbc\xa6")
+E(fcmrpg, 7975, "\xe1\xbc\xa7")
+E(fcmrpg, 7984, "\xe1\xbc\xb0")
+E(fcmrpg, 7985, "\xe1\xbc\xb1")
+E(fcmrpg, 7986, "\xe1\xbc\xb2")
+E(fcmrpg, 7987, "\xe1\xbc\xb3")
+E(fcmrpg, 7988, "\xe1\xbc\xb4")
+E(fcmrpg, 7989, "\xe1\xbc\xb5")
+E(fcmrpg, 7990, "\xe1\xbc\xb6")
+E(fcmrpg, 7991, "\xe1\xbc\xb7")
+E(fcmrpg, 8000, "\xe1\xbd\x80")
+E(fcmrpg, 8001, "\xe1\xbd\x81")
+E(fcmrpg, 8002, "\xe1\xbd\x82")
+E(fcmrpg, 8003, "\xe1\xbd\x83")
+E(fcmrpg, 8004, "\xe1\xbd\x84")
+E(fcmrpg, 8005, "\xe1\xbd\x85")
+E(fcmrpg, 8016, "\xe1\xbd\x90")
+E(fcmrpg, 8017, "\xe1\xbd\x91")
+E(fcmrpg, 8018, "\xe1\xbd\x92")
+E(fcmrpg, 8019, "\xe1\xbd\x93")
+E(fcmrpg, 8020, "\xe1\xbd\x94")
+E(fcmrpg, 8021, "\xe1\xbd\x95")
+E(fcmrpg, 8022, "\xe1\xbd\x96")
+E(fcmrpg, 8023, "\xe1\xbd\x97")
+E(fcmrpg, 8032, "\xe1\xbd\xa0")
+E(fcmrpg, 8033, "\xe1\xbd\xa1")
+E(fcmrpg, 8034, "\xe1\xbd\xa2")
+E(fcmrpg, 8035, "\xe1\xbd\xa3")
+E(fcmrpg, 8036, "\xe1\xbd\xa4")
+E(fcmrpg, 8037, "\xe1\xbd\xa5")
+E(fcmrpg, 8038, "\xe1\xbd\xa6")
+E(fcmrpg, 8039, "\xe1\xbd\xa7")
+E(fcmrpg, 8048, "\xe1\xbd\xb0")
+E(fcmrpg, 8050, "\xe1\xbd\xb2")
+E(fcmrpg, 8052, "\xe1\xbd\xb4")
+E(fcmrpg, 8054, "\xe1\xbd\xb6")
+E(fcmrpg, 8056, "\xe1\xbd\xb8")
+E(fcmrpg, 8058, "\xe1\xbd\xba")
+E(fcmrpg, 8060, "\xe1\xbd\xbc")
+E(fcmrpg, 8064, "\xe1\xbe\x80")
+E(fcmrpg, 8065, "\xe1\xbe\x81")
+E(fcmrpg, 8066, "\xe1\xbe\x82")
+E(fcmrpg, 8067, "\xe1\xbe\x83")
+E(fcmrpg, 8068, "\xe1\xbe\x84")
+E(fcmrpg, 8069, "\xe1\xbe\x85")
+E(fcmrpg, 8070, "\xe1\xbe\x86")
+E(fcmrpg, 8071, "\xe1\xbe\x87")
+E(fcmrpg, 8080, "\xe1\xbe\x90")
+E(fcmrpg, 8081, "\xe1\xbe\x91")
+E(fcmrpg, 8082, "\xe1\xbe\x92")
+E(fcmrpg, 8083, "\xe1\xbe\x93")
+E(fcmrpg, 8084, "\xe1\xbe\x94")
+E(fcmrpg, 8085, "\xe1\xbe\x95")
+E(fcmrpg, 8086, "\xe1\xbe\x96")
+E(fcmrpg, 8087, "\xe1\xbe\x97")
+E(fcmrpg, 8096, "\xe1\xbe\xa0")
+E(fcmrpg, 8097, "\xe1\xbe\xa1")
+E(fcmrpg, 8098, "\xe1\xbe\xa2")
+E(fcmrpg, 8099, "\xe1\xbe\xa3")
+E(fcmrpg, 8100, "\xe1\xbe\xa4")
+E(fcmrpg, 8101, "\xe1\xbe\xa5")
+E(fcmrpg, 8102, "\xe1\xbe\xa6")
+E(fcmrpg, 8103, "\xe1\xbe\xa7")
+E(fcmrpg, 8114, "\xe1\xbe\xb2")
+E(fcmrpg, 8115, "\xe1\xbe\xb3")
+E(fcmrpg, 8116, "\xe1\xbe\xb4")
+E(fcmrpg, 8118, "\xe1\xbe\xb6")
+E(fcmrpg, 8119, "\xe1\xbe\xb7")
+E(fcmrpg, 8124, "\xe1\xbe\xbc")
+E(fcmrpg, 8126, "\xe1\xbe\xbe")
+E(fcmrpg, 8127, "\xe1\xbe\xbf")
+E(fcmrpg, 8128, "\xe1\xbf\x80")
+E(fcmrpg, 8129, "\xe1\xbf\x81")
+E(fcmrpg, 8130, "\xe1\xbf\x82")
+E(fcmrpg, 8131, "\xe1\xbf\x83")
+E(fcmrpg, 8132, "\xe1\xbf\x84")
+E(fcmrpg, 8134, "\xe1\xbf\x86")
+E(fcmrpg, 8135, "\xe1\xbf\x87")
+E(fcmrpg, 8140, "\xe1\xbf\x8c")
+E(fcmrpg, 8141, "\xe1\xbf\x8d")
+E(fcmrpg, 8142, "\xe1\xbf\x8e")
+E(fcmrpg, 8143, "\xe1\xbf\x8f")
+E(fcmrpg, 8146, "\xe1\xbf\x92")
+E(fcmrpg, 8150, "\xe1\xbf\x96")
+E(fcmrpg, 8151, "\xe1\xbf\x97")
+E(fcmrpg, 8157, "\xe1\xbf\x9d")
+E(fcmrpg, 8158, "\xe1\xbf\x9e")
+E(fcmrpg, 8159, "\xe1\xbf\x9f")
+E(fcmrpg, 8162, "\xe1\xbf\xa2")
+E(fcmrpg, 8164, "\xe1\xbf\xa4")
+E(fcmrpg, 8165, "\xe1\xbf\xa5")
+E(fcmrpg, 8166, "\xe1\xbf\xa6")
+E(fcmrpg, 8167, "\xe1\xbf\xa7")
+E(fcmrpg, 8173, "\xe1\xbf\xad")
+E(fcmrpg, 8175, "\xe1\xbf\xaf")
+E(fcmrpg, 8178, "\xe1\xbf\xb2")
+E(fcmrpg, 8179, "\xe1\xbf\xb3")
+E(fcmrpg, 8180, "\xe1\xbf\xb4")
+E(fcmrpg, 8182, "\xe1\xbf\xb6")
+E(fcmrpg, 8183, "\xe1\xbf\xb7")
+E(fcmrpg, 8188, "\xe1\xbf\xbc")
+E(fcmrpg, 8190, "\xe1\xbf\xbe")
+E(fcmrpg, 8217, "\xe2\x80\x99")
+CHARS_END
+
+END_DEF_ALPHABET
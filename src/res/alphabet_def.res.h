@@ -0,0 +1,119 @@
+#ifndef ALPHABET_DEF_RES_H_INCLUDED
+#define ALPHABET_DEF_RES_H_INCLUDED
+
+#include <memory>
+
+#include "atom/atom_char.h"
+#include "core/formula.h"
+#include "fonts/alphabet.h"
+#include "fonts/fonts.h"
+
+// must be the last one, it defines the lowercase macros like 'it' and 'ss'
+#include "res/font_def.res.h"
+
+/**
+ * The version of the format generated by prebuilt/alphabet_def.py, the
+ * generated files must be regenerated once it changes.
+ */
+#define ALPHABET_DEF_VERSION 1
+
+#define CHECK_ALPHABET_DEF_VERSION(v) \
+  static_assert(v == ALPHABET_DEF_VERSION, "regenerate the alphabet with prebuilt/alphabet_def.py");
+
+/**
+ * Define the registration function of an alphabet, the fonts of the alphabet
+ * must be defined before as the font set with the same name.
+ */
+#define DEF_ALPHABET(name)         \
+  void __alphabet_reg(name)() {    \
+    tex::FontInfo::__register(FontSet##name());
+
+#define END_DEF_ALPHABET }
+
+/** Resolve the id of a font used by the symbol-to-character mappings */
+#define FONT_ID(name) \
+  const int __font_##name = tex::FontInfo::__id(#name);
+
+/**
+ * Define the symbols of this alphabet.
+ *
+ * There 2 components for each item:
+ *
+ *      [atom-type, symbol-name]
+ */
+#define SYMBOLS_START                   \
+  {                                     \
+    static const struct {               \
+      const char* name;                 \
+      tex::AtomType type;               \
+      bool del;                         \
+    } x[] = {
+#define SYMBOLS_END                                       \
+  }                                                       \
+  ;                                                       \
+  for (const auto& s : x) {                               \
+    tex::SymbolAtom::addSymbolAtom(                       \
+      std::make_shared<tex::SymbolAtom>(s.name, s.type, s.del)); \
+  }                                                       \
+  }
+
+#define sym(type, name) {name, tex::AtomType::type, false},
+#define del(type, name) {name, tex::AtomType::type, true},
+
+/**
+ * Define the characters of the symbols.
+ *
+ * There 3 components for each item:
+ *
+ *      [font-id, code, symbol-name]
+ */
+#define CHARS_START \
+  {                 \
+    const tex::__symbol_component x[] = {
+#define CHARS_END                                       \
+  }                                                     \
+  ;                                                     \
+  tex::DefaultTeXFont::__push_symbols(x, __len(x));     \
+  }
+
+#define E(fontId, code, name) {__font_##fontId, code, name},
+
+#define __start_mappings     \
+  {                          \
+    static const struct {    \
+      int ch;                \
+      const char* to;        \
+      const char* text;      \
+    } x[] = {
+#define __end_mappings(m)                                                     \
+  }                                                                           \
+  ;                                                                           \
+  for (const auto& c : x) {                                                   \
+    tex::Formula::m[c.ch] = c.to;                                             \
+    if (c.text != nullptr) tex::Formula::_symbolTextMappings[c.ch] = c.text;  \
+  }                                                                           \
+  }
+
+/**
+ * Define the character-to-symbol mappings.
+ *
+ * There 3 components for each item:
+ *
+ *      [code, symbol-name, text-symbol-name or nullptr]
+ */
+#define SYMBOL_MAPPINGS_START __start_mappings
+#define SYMBOL_MAPPINGS_END   __end_mappings(_symbolMappings)
+
+/**
+ * Define the character-to-formula mappings.
+ *
+ * There 3 components for each item:
+ *
+ *      [code, formula, text-formula or nullptr]
+ */
+#define FORMULA_MAPPINGS_START __start_mappings
+#define FORMULA_MAPPINGS_END   __end_mappings(_symbolFormulaMappings)
+
+#define M(code, to, text) {code, to, text},
+
+#endif
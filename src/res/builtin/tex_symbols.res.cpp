@@ -1,10 +1,13 @@
 #include "atom/atom_basic.h"
+#include "utils/perfect_hash.h"
+
+#include <string_view>
 
 #define sym(type, name) \
-  { #name, sptr < SymbolAtom>(new SymbolAtom(#name, type, false)) }
+  { #name, type, false }
 
 #define del(type, name) \
-  { #name, sptr < SymbolAtom>(new SymbolAtom(#name, type, true)) }
+  { #name, type, true }
 
 #define ord   AtomType::ordinary
 #define rel   AtomType::relation
@@ -18,11 +21,21 @@
 using namespace std;
 using namespace tex;
 
+namespace {
+
+struct BuiltinSymbol {
+  string_view _name;
+  AtomType _type;
+  bool _isDelimiter;
+};
+
+}  // namespace
+
 /**
  * BUILTIN SYMBOLS
  * Page 445 in the [The TeXBook]
  */
-map<string, sptr<SymbolAtom>> SymbolAtom::_symbols = {
+static constexpr BuiltinSymbol builtinSymbols[]{
     sym(ord, ae),
     sym(ord, AE),
     sym(ord, OE),
@@ -174,13 +187,10 @@ map<string, sptr<SymbolAtom>> SymbolAtom::_symbols = {
     sym(rel, unrhd),
     sym(ord, Box),
 
-    sym(bin, boxdot),
     sym(bin, boxplus),
     sym(bin, boxtimes),
-    sym(ord, square),
     sym(ord, blacksquare),
     sym(bin, centerdot),
-    sym(ord, lozenge),
     sym(ord, blacklozenge),
     sym(rel, circlearrowright),
     sym(rel, circlearrowleft),
@@ -206,7 +216,6 @@ map<string, sptr<SymbolAtom>> SymbolAtom::_symbols = {
     sym(rel, rightleftarrows),
     sym(rel, Lsh),
     sym(rel, Rsh),
-    sym(rel, rightsquigarrow),
     sym(rel, leftrightsquigarrow),
     sym(rel, looparrowleft),
     sym(rel, looparrowright),
@@ -237,10 +246,6 @@ map<string, sptr<SymbolAtom>> SymbolAtom::_symbols = {
     sym(rel, geqq),
     sym(rel, geqslant),
     sym(rel, gtrless),
-    sym(rel, vartriangleright),
-    sym(rel, vartriangleleft),
-    sym(rel, trianglerighteq),
-    sym(rel, trianglelefteq),
     sym(ord, bigstar),
     sym(rel, between),
     sym(ord, blacktriangledown),
@@ -422,7 +427,6 @@ map<string, sptr<SymbolAtom>> SymbolAtom::_symbols = {
     sym(acc, doubleacute),
     sym(acc, tilde),
     sym(acc, mathring),
-    sym(acc, mathring),
     sym(acc, bar),
     sym(acc, breve),
     sym(acc, check),
@@ -666,3 +670,32 @@ map<string, sptr<SymbolAtom>> SymbolAtom::_symbols = {
     sym(ord, varparalleleq),
     sym(ord, parallelogram),
 };
+
+#undef sym
+#undef del
+
+static constexpr size_t SYMBOL_COUNT = std::size(builtinSymbols);
+
+static constexpr array<string_view, SYMBOL_COUNT> symbolNames() {
+  array<string_view, SYMBOL_COUNT> names{};
+  for (size_t i = 0; i < SYMBOL_COUNT; i++) names[i] = builtinSymbols[i]._name;
+  return names;
+}
+
+static constexpr StaticPerfectHash<char, SYMBOL_COUNT> symbolTable(symbolNames());
+
+map<string, sptr<SymbolAtom>> SymbolAtom::_symbols;
+
+sptr<SymbolAtom> SymbolAtom::__builtin(string_view name) {
+  // indexed by the table, created by the first lookup
+  static const auto atoms = [] {
+    vector<sptr<SymbolAtom>> v;
+    v.reserve(SYMBOL_COUNT);
+    for (const auto& s : builtinSymbols) {
+      v.push_back(sptr<SymbolAtom>(new SymbolAtom(string(s._name), s._type, s._isDelimiter)));
+    }
+    return v;
+  }();
+  const int i = symbolTable.find(name);
+  return i < 0 ? nullptr : atoms[i];
+}
@@ -284,7 +284,6 @@ KERNS_START
 104, 119, -0.031944,
 104, 121, -0.031944,
 107, 97, -0.063889,
-107, 97, -0.031944,
 107, 99, -0.031944,
 107, 101, -0.031944,
 107, 111, -0.031944,
@@ -323,7 +322,6 @@ KERNS_START
 116, 119, -0.031944,
 116, 121, -0.031944,
 117, 119, -0.031944,
-118, 97, -0.063889,
 118, 97, -0.031944,
 118, 99, -0.031944,
 118, 101, -0.031944,
@@ -189,7 +189,6 @@ KERNS_START
 77, 196, 0.083336,
 78, 58, -0.055555,
 78, 59, -0.055555,
-78, 61, -0.083334,
 78, 61, -0.027779,
 78, 196, 0.083336,
 79, 196, 0.083336,
@@ -220,7 +219,6 @@ KERNS_START
 88, 58, -0.055555,
 88, 59, -0.055555,
 88, 61, -0.083334,
-88, 61, -0.027779,
 88, 196, 0.083336,
 89, 58, -0.166667,
 89, 59, -0.166667,
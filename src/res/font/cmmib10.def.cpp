@@ -189,7 +189,6 @@ KERNS_START
 77, 196, 0.095833,
 78, 58, -0.063889,
 78, 59, -0.063889,
-78, 61, -0.095833,
 78, 61, -0.031944,
 78, 196, 0.095833,
 79, 196, 0.095833,
@@ -220,7 +219,6 @@ KERNS_START
 88, 58, -0.063889,
 88, 59, -0.063889,
 88, 61, -0.095833,
-88, 61, -0.031944,
 88, 196, 0.095833,
 89, 58, -0.191666,
 89, 59, -0.191666,
@@ -284,7 +284,6 @@ KERNS_START
 104, 119, -0.027779,
 104, 121, -0.027779,
 107, 97, -0.055555,
-107, 97, -0.027779,
 107, 99, -0.027779,
 107, 101, -0.027779,
 107, 111, -0.027779,
@@ -323,7 +322,6 @@ KERNS_START
 116, 119, -0.027779,
 116, 121, -0.027779,
 117, 119, -0.027779,
-118, 97, -0.055555,
 118, 97, -0.027779,
 118, 99, -0.027779,
 118, 101, -0.027779,
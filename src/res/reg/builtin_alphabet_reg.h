@@ -0,0 +1,13 @@
+#ifndef BUILTIN_ALPHABET_REG_H_INCLUDED
+#define BUILTIN_ALPHABET_REG_H_INCLUDED
+
+#include "fonts/alphabet.h"
+
+/**
+ * The alphabets compiled from the XML descriptions under the resources
+ * directory, see prebuilt/alphabet_def.py
+ */
+DECL_ALPHABET_REG(Cyrillic);
+DECL_ALPHABET_REG(Greek);
+
+#endif
@@ -0,0 +1,124 @@
+#include "config.h"
+
+#if defined(BUILD_HEADLESS) && !defined(MEM_CHECK)
+
+#include "latex.h"
+#include "platform/headless/graphic_headless.h"
+#include "platform/headless/graphic_svg.h"
+#include "samples.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+using namespace tex;
+
+static const int PADDING = 10;
+
+/** Render the formula into a new buffer, return false if failed to parse */
+static bool render(const wstring& code, float textSize, int& width, int& height, vector<u8>& pixels) {
+  TeXRender* r = nullptr;
+  try {
+    r = LaTeX::parse(code, 720, textSize, textSize / 3.f, black);
+  } catch (const ex_tex& e) {
+    cerr << e.what() << endl;
+    return false;
+  }
+  width = r->getWidth() + PADDING * 2;
+  height = r->getHeight() + PADDING * 2;
+  pixels.assign((size_t) width * height, 0);
+  Graphics2D_headless g2(pixels.data(), width, height, width);
+  r->draw(g2, PADDING, PADDING);
+  delete r;
+  return true;
+}
+
+/** Render the formulas into one HTML page, the glyphs are shared by all the formulas */
+static void renderSvg(const vector<wstring>& codes, float textSize, const string& file) {
+  ofstream out(file, ios::binary);
+  out << "<!DOCTYPE html>\n<html><body>\n";
+  {
+    SvgDocument doc([&](const char* data, size_t len) { out.write(data, (streamsize) len); });
+    for (const auto& code : codes) {
+      TeXRender* r = nullptr;
+      try {
+        r = LaTeX::parse(code, 720, textSize, textSize / 3.f, black);
+      } catch (const ex_tex& e) {
+        cerr << e.what() << endl;
+        continue;
+      }
+      doc.begin((float) r->getWidth() + PADDING * 2, (float) r->getHeight() + PADDING * 2);
+      Graphics2D_svg g2(doc);
+      r->draw(g2, PADDING, PADDING);
+      doc.end();
+      out << "<br/>\n";
+      delete r;
+    }
+    cout << doc.symbols() << " glyphs defined" << endl;
+  }
+  out << "</body></html>\n";
+}
+
+/** Write the buffer as binary PGM, black on white */
+static void writePgm(const string& file, int width, int height, const vector<u8>& pixels) {
+  ofstream out(file, ios::binary);
+  out << "P5\n" << width << " " << height << "\n255\n";
+  for (u8 p : pixels) out.put((char) (255 - p));
+}
+
+int main(int argc, char* argv[]) {
+  LaTeX::init();
+  float textSize = 30;
+  string prefix = "formula";
+  bool svg = false;
+  wstring code;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      textSize = (float) atof(argv[++i]);
+    } else if (strcmp(argv[i], "-svg") == 0) {
+      svg = true;
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      prefix = argv[++i];
+    } else {
+      code = utf82wide(argv[i]);
+    }
+  }
+
+  int width, height;
+  vector<u8> pixels;
+  if (svg) {
+    vector<wstring> codes;
+    if (code.empty()) {
+      Samples samples;
+      for (int i = 0; i < samples.count(); i++) codes.push_back(samples.next());
+    } else {
+      codes.push_back(code);
+    }
+    renderSvg(codes, textSize, prefix + ".html");
+  } else if (!code.empty()) {
+    // render the given formula
+    if (render(code, textSize, width, height, pixels)) {
+      writePgm(prefix + ".pgm", width, height, pixels);
+    }
+  } else {
+    // render all the samples
+    Samples samples;
+    const auto start = chrono::steady_clock::now();
+    for (int i = 0; i < samples.count(); i++) {
+      if (render(samples.next(), textSize, width, height, pixels)) {
+        writePgm(prefix + "_" + to_string(i) + ".pgm", width, height, pixels);
+      }
+    }
+    const auto end = chrono::steady_clock::now();
+    cout << "rendered " << samples.count() << " samples in "
+         << chrono::duration<double, milli>(end - start).count() << " ms" << endl;
+  }
+
+  LaTeX::release();
+  Graphics2D_headless::release();
+  return 0;
+}
+
+#endif
@@ -30,7 +30,11 @@ public:
   virtual ~Font_none() {}
 };
 
+/** Count of the fonts created from files, for benchmark purpose */
+static int fontsCreated = 0;
+
 Font* Font::create(const string& file, float size) {
+  fontsCreated++;
   return new Font_none();
 }
 
@@ -147,10 +151,502 @@ Font* Graphics2D_none::_default_font = new Font_none();
 }  // namespace tex
 
 #include "samples/samples.h"
+#include "box/box_factory.h"
+#include "box/box_single.h"
+#include "core/core.h"
+#include "core/formula.h"
+#include "fonts/fonts.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <new>
+
+/** Count of the heap allocations, for benchmark purpose */
+static std::atomic<size_t> allocations(0);
+
+void* operator new(size_t size) {
+  allocations++;
+  void* p = malloc(size);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
 
-int main(int argc, char* argv[]) {
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+/**
+ * Measure the time taken by LaTeX::init and then to parse and draw a trivial
+ * formula, must be the first thing of the process
+ */
+static void benchStartup() {
+  const auto start = std::chrono::steady_clock::now();
   LaTeX::init();
+  const auto init = std::chrono::steady_clock::now();
+  auto r = LaTeX::parse(L"x^2 + 1", 720, 20, 20 / 3.f, black);
+  Graphics2D_none g2;
+  r->draw(g2, 0, 0);
+  delete r;
+  const auto end = std::chrono::steady_clock::now();
+  const auto ms = [](auto a, auto b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+  printf(
+    "startup: init %.3f ms, first render %.3f ms, total %.3f ms, %d fonts created\n",
+    ms(start, init), ms(init, end), ms(start, end), tex::fontsCreated
+  );
+}
+
+/**
+ * Measure the heap allocations and the time taken to retrieve the metrics of
+ * a glyph and to box it, the allocations per glyph should be 0
+ */
+static void benchGlyph(int n) {
+  tex::DefaultTeXFont tf(20);
+  // warm up
+  tf.getDefaultChar(L'a', tex::TexStyle::display);
+  float width = 0;
+  const size_t before = allocations;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; i++) {
+    const tex::Char c = tf.getDefaultChar(L'a' + i % 26, tex::TexStyle::display);
+    tex::CharBox box(c);
+    width += box._width;
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+  printf(
+    "glyph: %d glyphs, %.3f allocations/glyph, %.1f ns/glyph (total width %.1f)\n",
+    n, (double) (allocations - before) / n, ns / n, width
+  );
+}
+
+/**
+ * Measure the time taken to create the delimiters with heights from 1 to 256
+ * times of the smallest variant, the time should not grow with the height
+ */
+static void benchDelimiter(int n) {
+  auto tf = tex::sptrOf<tex::DefaultTeXFont>(20);
+  tex::Environment env(tex::TexStyle::display, tf);
+  const tex::Char c = tf->getChar("lbrace", tex::TexStyle::display);
+  const float unit = c.getHeight() + c.getDepth();
+  for (int times = 1; times <= 256; times *= 4) {
+    size_t children = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+      const auto box = tex::DelimiterFactory::create("lbrace", env, unit * times);
+      children += box->descendants().size();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double us = std::chrono::duration<double, std::micro>(end - start).count();
+    printf("delimiter: %3dx height, %4zu parts, %.3f us/delimiter\n", times, children / n, us / n);
+  }
+}
+
+/**
+ * Measure the time taken to parse and layout (without the render cache) the
+ * samples for n passes
+ */
+static void benchLayout(int n) {
+  tex::Samples samples;
+  std::vector<std::wstring> all;
+  for (int i = 0; i < samples.count(); i++) all.push_back(samples.next());
+  auto& ctx = tex::Context::current();
+  const size_t budget = ctx.cache().getBudget();
+  ctx.cache().setBudget(0);
+  const auto start = std::chrono::steady_clock::now();
+  for (int k = 0; k < n; k++) {
+    for (const auto& s : all) delete LaTeX::parse(s, 720, 20, 20 / 3.f, black);
+  }
+  const auto end = std::chrono::steady_clock::now();
+  ctx.cache().setBudget(budget);
+  const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+  printf("layout: %d passes of %zu samples, %.3f ms/pass\n", n, all.size(), ms / n);
+}
+
+/**
+ * Measure the time taken to parse and layout arrays from 10x10 up to 200x200
+ * cells n times, with the cells laid out serially and concurrently
+ */
+static void benchMatrix(int n) {
+  auto& ctx = tex::Context::current();
+  const size_t budget = ctx.cache().getBudget();
+  const size_t threshold = ctx._parallelCells;
+  ctx.cache().setBudget(0);
+  for (int size : {10, 25, 50, 100, 200}) {
+    std::wstring src = L"\\begin{array}{" + std::wstring(size, L'c') + L"}";
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        if (j > 0) src += L"&";
+        src += L"\\frac{a_{" + std::to_wstring(i) + L"}}{b^{" + std::to_wstring(j) + L"}}";
+      }
+      src += L"\\\\";
+    }
+    src += L"\\end{array}";
+    const auto measure = [&](const char* name, size_t cells) {
+      ctx._parallelCells = cells;
+      // the first layout loads the fonts and the symbols, it is not measured
+      auto r = LaTeX::parse(src, 720, 20, 20 / 3.f, black);
+      const int width = r->getWidth(), height = r->getHeight();
+      delete r;
+      const auto start = std::chrono::steady_clock::now();
+      for (int k = 0; k < n; k++) delete LaTeX::parse(src, 720, 20, 20 / 3.f, black);
+      const auto end = std::chrono::steady_clock::now();
+      const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+      printf("matrix: %3dx%-3d %-8s %9.3f ms/layout (%dx%d)\n", size, size, name, ms / n, width, height);
+    };
+    measure("serial", 0);
+    measure("parallel", 1);
+  }
+  ctx._parallelCells = threshold;
+  ctx.cache().setBudget(budget);
+}
+
+/**
+ * Measure the time taken to build a long inline formula into lines of several
+ * widths n times, with the lines broken greedily and optimally
+ */
+static void benchSplit(int n) {
+  std::wstring src;
+  for (int i = 0; i < 300; i++) {
+    if (i > 0) src += i % 3 == 0 ? L"=" : L"+";
+    src += L"a_{" + std::to_wstring(i) + L"}x^{" + std::to_wstring(i % 7) + L"}";
+  }
+  tex::Formula f(src);
+  for (int width : {120, 240, 480}) {
+    const auto measure = [&](const char* name, bool optimal) {
+      tex::TeXRenderBuilder builder;
+      builder.setStyle(tex::TexStyle::text)
+        .setTextSize(20)
+        .setWidth(tex::UnitType::pixel, width, tex::Alignment::left)
+        .setIsMaxWidth(true)
+        .setLineSpace(tex::UnitType::pixel, 20 / 3.f)
+        .setOptimalBreak(optimal);
+      auto r = builder.build(f);
+      const int height = r->getHeight();
+      delete r;
+      const auto start = std::chrono::steady_clock::now();
+      for (int k = 0; k < n; k++) delete builder.build(f);
+      const auto end = std::chrono::steady_clock::now();
+      const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+      printf("split: width %-4d %-8s %9.3f ms/build (height %d)\n", width, name, ms / n, height);
+    };
+    measure("greedy", false);
+    measure("optimal", true);
+  }
+}
+
+/**
+ * Measure the time taken to fit the samples into the widths from 720 to 120
+ * pixels for n passes, by parsing them again (without the render cache) and
+ * by breaking the renders into lines again
+ */
+static void benchRelayout(int n) {
+  tex::Samples samples;
+  std::vector<std::wstring> all;
+  for (int i = 0; i < samples.count(); i++) all.push_back(samples.next());
+  auto& ctx = tex::Context::current();
+  const size_t budget = ctx.cache().getBudget();
+  ctx.cache().setBudget(0);
+  static const int widths[] = {720, 600, 480, 360, 240, 120};
+  long sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int k = 0; k < n; k++) {
+    for (const auto& s : all) {
+      for (int w : widths) {
+        auto r = LaTeX::parse(s, w, 20, 20 / 3.f, black);
+        sum += r->getWidth() + r->getHeight();
+        delete r;
+      }
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  const double parse = std::chrono::duration<double, std::milli>(end - start).count();
+  printf("relayout: %-8s %d passes of %zu samples, %.3f ms/pass (sum %ld)\n", "parse", n, all.size(), parse / n, sum);
+  std::vector<TeXRender*> renders;
+  for (const auto& s : all) renders.push_back(LaTeX::parse(s, 720, 20, 20 / 3.f, black));
+  sum = 0;
+  start = std::chrono::steady_clock::now();
+  for (int k = 0; k < n; k++) {
+    for (auto* r : renders) {
+      for (int w : widths) {
+        r->relayout(w, tex::Alignment::left, 20 / 3.f);
+        sum += r->getWidth() + r->getHeight();
+      }
+    }
+  }
+  end = std::chrono::steady_clock::now();
+  for (auto* r : renders) delete r;
+  ctx.cache().setBudget(budget);
+  const double relayout = std::chrono::duration<double, std::milli>(end - start).count();
+  printf("relayout: %-8s %d passes of %zu samples, %.3f ms/pass (sum %ld)\n", "relayout", n, all.size(), relayout / n, sum);
+}
+
+/**
+ * Measure the time taken to get the sizes of the samples for n passes, by
+ * parsing them into renders (without the render cache) and by measuring them,
+ * no font should be created by the measures
+ */
+static void benchMeasure(int n) {
+  tex::Samples samples;
+  std::vector<std::wstring> all;
+  for (int i = 0; i < samples.count(); i++) all.push_back(samples.next());
+  auto& ctx = tex::Context::current();
+  const size_t budget = ctx.cache().getBudget();
+  ctx.cache().setBudget(0);
+  const int fonts = tex::fontsCreated;
+  long sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int k = 0; k < n; k++) {
+    for (const auto& s : all) {
+      const auto m = LaTeX::measure(s, 720, 20, 20 / 3.f);
+      sum += m.width + m.height + m.depth;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  const double measure = std::chrono::duration<double, std::milli>(end - start).count();
+  printf(
+    "measure: %-6s %d passes of %zu samples, %.3f ms/pass, %d fonts created (sum %ld)\n",
+    "metrics", n, all.size(), measure / n, tex::fontsCreated - fonts, sum
+  );
+  sum = 0;
+  start = std::chrono::steady_clock::now();
+  for (int k = 0; k < n; k++) {
+    for (const auto& s : all) {
+      auto r = LaTeX::parse(s, 720, 20, 20 / 3.f, black);
+      sum += r->getWidth() + r->getHeight() + r->getDepth();
+      delete r;
+    }
+  }
+  end = std::chrono::steady_clock::now();
+  ctx.cache().setBudget(budget);
+  const double parse = std::chrono::duration<double, std::milli>(end - start).count();
+  printf(
+    "measure: %-6s %d passes of %zu samples, %.3f ms/pass, %d fonts created (sum %ld)\n",
+    "render", n, all.size(), parse / n, tex::fontsCreated - fonts, sum
+  );
+}
 
+/**
+ * Measure the time taken to draw the samples n times by walking the box trees
+ * and by replaying the display lists recorded by the repeated draws
+ */
+static void benchDraw(int n) {
+  tex::Samples samples;
+  std::vector<TeXRender*> renders;
+  for (int i = 0; i < samples.count(); i++) {
+    renders.push_back(LaTeX::parse(samples.next(), 720, 20, 20 / 3.f, black));
+  }
+  Graphics2D_none g2;
+  const auto measure = [&](const char* name, bool replay) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int k = 0; k < n; k++) {
+      for (auto r : renders) {
+        // the foreground drops the display list, the next draw walks the tree
+        if (!replay) r->setForeground(black);
+        r->draw(g2, 0, 0);
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    printf("draw: %-6s %d passes of %zu samples, %.3f ms/pass\n", name, n, renders.size(), ms / n);
+  };
+  measure("tree", false);
+  measure("replay", true);
+  for (auto r : renders) delete r;
+}
+
+/**
+ * Measure the time taken to parse and layout a formula with n terms after an
+ * edit in its last term, with and without the incremental mode. The time of
+ * the incremental mode should grow much slower with the size of the formula.
+ */
+static void benchIncremental(int edits) {
+  auto& ctx = tex::Context::current();
+  const size_t budget = ctx.cache().getBudget();
+  ctx.cache().setBudget(0);
+  for (int n = 16; n <= 1024; n *= 4) {
+    std::wstring src;
+    for (int i = 0; i < n; i++) {
+      if (i > 0) src += L" + ";
+      src += L"{\\frac{a_{" + std::to_wstring(i) + L"}+b^{2}}{\\sqrt{c+d_{" + std::to_wstring(i) + L"}}}}";
+    }
+    // type a character in the last numerator and remove it
+    const size_t pos = src.rfind(L"+b^{2}");
+    const std::wstring edited = std::wstring(src).insert(pos, L"x");
+    for (const bool incremental : {false, true}) {
+      ctx.enableIncremental(incremental);
+      delete LaTeX::parse(src, 720, 20, 20 / 3.f, black);
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < edits; i++) {
+        delete LaTeX::parse(i % 2 == 0 ? edited : src, 720, 20, 20 / 3.f, black);
+      }
+      const auto end = std::chrono::steady_clock::now();
+      const double us = std::chrono::duration<double, std::micro>(end - start).count();
+      printf(
+        "incremental: %4d terms, %6zu chars, %-11s %9.1f us/edit\n",
+        n, src.length(), incremental ? "incremental" : "full", us / edits
+      );
+    }
+  }
+  ctx.enableIncremental(false);
+  ctx.cache().setBudget(budget);
+}
+
+/**
+ * Measure the time taken to find the metrics and the kerns of the glyphs in
+ * tables shaped like the ones of the builtin fonts, with the direct index and
+ * with the binary search
+ */
+static void benchMetrics(int n) {
+  // 128 glyphs with 4 metrics, and 8 kerning pairs for every glyph
+  std::vector<float> metrics, kerns;
+  for (int c = 0; c < 128; c++) {
+    metrics.insert(metrics.end(), {(float) c, c * 0.1f, c * 0.2f, c * 0.3f, c * 0.4f});
+    for (int k = 0; k < 8; k++) kerns.insert(kerns.end(), {(float) c, (float) (k * 16), c * 0.01f});
+  }
+  const tex::IndexedArray<float, 5, 1> m(metrics.data(), (int) metrics.size());
+  const tex::IndexedArray<float, 3, 2> kern(kerns.data(), (int) kerns.size());
+
+  const auto measure = [n](const char* name, const std::function<float(int)>& f) {
+    float sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) sum += f(i);
+    const auto end = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    printf("metrics: %-16s %.2f ns/lookup (sum %.1f)\n", name, ns / n, sum);
+  };
+  measure("metrics/index", [&](int i) { return m((float) (i & 127))[1]; });
+  measure("metrics/search", [&](int i) { return m.search((float) (i & 127))[1]; });
+  measure("kern/index", [&](int i) {
+    const float* r = kern((float) (i & 127), (float) (i & 0x70));
+    return r == nullptr ? 0.f : r[2];
+  });
+  measure("kern/search", [&](int i) {
+    const float* r = kern.search((float) (i & 127), (float) (i & 0x70));
+    return r == nullptr ? 0.f : r[2];
+  });
+}
+
+/**
+ * Measure the time taken to preprocess inputs from 1KB to 1MB full of comments,
+ * degree signs and user-defined macros, the time per KB should be constant
+ */
+static void benchPreprocess() {
+  const std::wstring chunk = L"x_1 + \\R^2 % a comment\n + 30\u00b0 + \\half{y} ";
+  for (size_t size = 1 << 10; size <= (1 << 20); size <<= 2) {
+    std::wstring src = L"\\newcommand{\\R}{\\mathbb{R}}\\newcommand{\\half}[1]{\\frac{#1}{2}}";
+    while (src.length() < size) src += chunk;
+    tex::Formula formula;
+    const auto start = std::chrono::steady_clock::now();
+    tex::TeXParser parser(true, src, &formula, true);
+    const auto end = std::chrono::steady_clock::now();
+    const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    printf("preprocess: %7zu chars, %9.3f ms, %.4f ms/KB\n", src.length(), ms, ms * 1024 / src.length());
+  }
+}
+
+/**
+ * Parse and draw the samples (without the render cache) and print the stats of
+ * every phase summed over all the renders, requires the flag HAVE_PROFILE
+ */
+static void profile() {
+#ifndef HAVE_PROFILE
+  printf("profile: compile with the flag HAVE_PROFILE to record the stats\n");
+#endif
+  static const char* phases[] = {"parse", "macro", "layout", "split", "draw"};
+  tex::RenderStats total;
+  tex::Profiler::setSink([&total](const tex::RenderStats& s) {
+    // every draw reports the stats of its render again, take the draws only
+    const auto& draw = s[tex::RenderPhase::draw];
+    if (draw._calls == 0) return;
+    for (int i = 0; i < tex::RENDER_PHASE_COUNT; i++) {
+      total._phases[i]._calls += s._phases[i]._calls;
+      total._phases[i]._nanos += s._phases[i]._nanos;
+      total._phases[i]._allocations += s._phases[i]._allocations;
+    }
+    total._atoms += s._atoms;
+    total._boxes += s._boxes;
+    total._glyphs += s._glyphs;
+    total._macros += s._macros;
+  });
+  tex::Samples samples;
+  auto& ctx = tex::Context::current();
+  const size_t budget = ctx.cache().getBudget();
+  ctx.cache().setBudget(0);
+  for (int i = 0; i < samples.count(); i++) {
+    auto r = LaTeX::parse(samples.next(), 720, 20, 20 / 3.f, black);
+    Graphics2D_none g2;
+    r->draw(g2, 0, 0);
+    delete r;
+  }
+  ctx.cache().setBudget(budget);
+  tex::Profiler::setSink(nullptr);
+  for (int i = 0; i < tex::RENDER_PHASE_COUNT; i++) {
+    const auto& p = total._phases[i];
+    printf(
+      "profile: %-6s %6u calls, %10.3f ms, %8llu allocations\n",
+      phases[i], p._calls, p._nanos / 1e6, (unsigned long long) p._allocations
+    );
+  }
+  printf(
+    "profile: %u atoms, %u boxes, %u glyph lookups, %u macro expansions\n",
+    total._atoms, total._boxes, total._glyphs, total._macros
+  );
+}
+
+/** A benchmark run by "--bench <name> [n]", n is the count of its iterations */
+struct Bench {
+  const char* name;
+  void (*run)(int n);
+  int n;
+};
+
+/** The benchmarks, the first one initializes the library itself */
+static const Bench benches[] = {
+  {"startup",     [](int) { benchStartup(); },    0},
+  {"glyph",       benchGlyph,                     1000000},
+  {"metrics",     benchMetrics,                   10000000},
+  {"preprocess",  [](int) { benchPreprocess(); }, 0},
+  {"delimiter",   benchDelimiter,                 10000},
+  {"incremental", benchIncremental,               100},
+  {"measure",     benchMeasure,                   100},
+  {"draw",        benchDraw,                      1000},
+  {"matrix",      benchMatrix,                    10},
+  {"split",       benchSplit,                     100},
+  {"relayout",    benchRelayout,                  100},
+  {"layout",      benchLayout,                    100},
+};
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+    const Bench* bench = nullptr;
+    for (const auto& b : benches) {
+      if (argc > 2 && strcmp(argv[2], b.name) == 0) bench = &b;
+    }
+    if (bench == nullptr) {
+      printf("usage: %s --bench <name> [n], the names are:", argv[0]);
+      for (const auto& b : benches) printf(" %s", b.name);
+      printf("\n");
+      return 1;
+    }
+    if (bench != &benches[0]) LaTeX::init();
+    bench->run(argc > 3 ? atoi(argv[3]) : bench->n);
+    LaTeX::release();
+    Graphics2D_none::release();
+    return 0;
+  }
+  LaTeX::init();
+  if (argc > 1 && strcmp(argv[1], "--profile") == 0) {
+    profile();
+    LaTeX::release();
+    Graphics2D_none::release();
+    return 0;
+  }
   tex::Samples samples;
   for (int i = 0; i < samples.count(); i++) {
     auto r = LaTeX::parse(samples.next(), 720, 20, 20 / 3.f, black);
@@ -0,0 +1,30 @@
+#include "utils/arena.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace tex;
+
+const size_t Arena::MIN_BLOCK_SIZE = 8 << 10;
+const size_t Arena::MAX_BLOCK_SIZE = 256 << 10;
+
+thread_local Arena* Arena::_current = nullptr;
+thread_local uint64_t Arena::_heapAllocations = 0;
+
+void* Arena::grow(size_t size, size_t align) {
+  // double the block size every time to keep the count of blocks small
+  size_t blockSize = _blocks.empty() ? MIN_BLOCK_SIZE : min(MAX_BLOCK_SIZE, MIN_BLOCK_SIZE << _blocks.size());
+  blockSize = max(blockSize, size + align);
+  char* block = new char[blockSize];
+  _blocks.push_back(block);
+  _reserved += blockSize;
+  _ptr = block;
+  _left = blockSize;
+  // the allocation was counted already
+  _allocations--;
+  return allocate(size, align);
+}
+
+Arena::~Arena() {
+  for (auto block : _blocks) delete[] block;
+}
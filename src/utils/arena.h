@@ -0,0 +1,162 @@
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+#include <cinttypes>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace tex {
+
+/**
+ * A monotonic memory arena, the memory is taken from a few contiguous blocks
+ * and returned to the heap block by block when the arena is destroyed.
+ * <p>
+ * While an arena is made current on a thread (see ArenaScope), the objects
+ * created by sptrOf on that thread are allocated from it. Every object holds
+ * a reference to its arena, so the arena lives until the last object allocated
+ * from it is destroyed, the objects can be released on any thread.
+ * <p>
+ * The arena lowers the cost of the allocations only. The nodes of the trees
+ * have virtual destructors and hold shared pointers to their children, none of
+ * them is trivially destructible, so they are still destroyed one by one
+ * through their shared pointers when they are released, and releasing a tree
+ * is linear in the count of its nodes.
+ */
+class Arena : public std::enable_shared_from_this<Arena> {
+private:
+  static const size_t MIN_BLOCK_SIZE;
+  static const size_t MAX_BLOCK_SIZE;
+  static thread_local Arena* _current;
+  static thread_local std::uint64_t _heapAllocations;
+
+  std::vector<char*> _blocks;
+  char* _ptr = nullptr;
+  size_t _left = 0;
+  size_t _allocations = 0;
+  size_t _bytes = 0;
+  size_t _reserved = 0;
+
+  void* grow(size_t size, size_t align);
+
+  friend class ArenaScope;
+
+public:
+  Arena() = default;
+
+  Arena(const Arena&) = delete;
+
+  void operator=(const Arena&) = delete;
+
+  /** Allocate memory with given size and alignment */
+  inline void* allocate(size_t size, size_t align) {
+    auto p = reinterpret_cast<std::uintptr_t>(_ptr);
+    const size_t pad = (align - (p & (align - 1))) & (align - 1);
+    _allocations++;
+    if (pad + size > _left) return grow(size, align);
+    _ptr += pad + size;
+    _left -= pad + size;
+    _bytes += size;
+    return reinterpret_cast<void*>(p + pad);
+  }
+
+  /**
+   * Create a shared object from the arena current on the calling thread, or
+   * from the heap if no arena is current, see sptrOf.
+   */
+  template<typename T, typename... Args>
+  static std::shared_ptr<T> make(Args&& ... args);
+
+  /** Get the arena current on the calling thread, nullptr if none */
+  inline static Arena* current() { return _current; }
+
+  /** Get the count of the allocations made from this arena */
+  inline size_t allocations() const { return _allocations; }
+
+  /** Get the count of the blocks taken from the heap */
+  inline size_t blocks() const { return _blocks.size(); }
+
+  /** Get the bytes allocated from this arena */
+  inline size_t bytes() const { return _bytes; }
+
+  /** Get the bytes of the blocks taken from the heap */
+  inline size_t reserved() const { return _reserved; }
+
+  /**
+   * Get the count of the objects created by sptrOf from the heap (i.e. no arena
+   * is current) on the calling thread
+   */
+  inline static std::uint64_t heapAllocations() { return _heapAllocations; }
+
+  ~Arena();
+};
+
+/** Allocator that takes memory from an arena, the deallocation does nothing */
+template<typename T>
+class ArenaAllocator {
+private:
+  std::shared_ptr<Arena> _arena;
+
+  template<typename U>
+  friend class ArenaAllocator;
+
+public:
+  using value_type = T;
+
+  explicit ArenaAllocator(std::shared_ptr<Arena> arena) : _arena(std::move(arena)) {}
+
+  template<typename U>
+  ArenaAllocator(const ArenaAllocator<U>& a) : _arena(a._arena) {}
+
+  inline T* allocate(size_t n) {
+    return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  inline void deallocate(T*, size_t) {}
+
+  template<typename U>
+  inline bool operator==(const ArenaAllocator<U>& a) const { return _arena == a._arena; }
+
+  template<typename U>
+  inline bool operator!=(const ArenaAllocator<U>& a) const { return _arena != a._arena; }
+};
+
+template<typename T, typename... Args>
+std::shared_ptr<T> Arena::make(Args&& ... args) {
+  if (_current != nullptr) {
+    return std::allocate_shared<T>(
+      ArenaAllocator<T>(_current->shared_from_this()),
+      std::forward<Args>(args)...
+    );
+  }
+  _heapAllocations++;
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+/**
+ * Make the given arena current on the calling thread during the lifetime of the
+ * scope, the previous one is restored when the scope is destroyed. A scope with
+ * nullptr suspends the current arena.
+ */
+class ArenaScope {
+private:
+  Arena* const _prev;
+
+public:
+  explicit ArenaScope(Arena* arena) : _prev(Arena::_current) {
+    Arena::_current = arena;
+  }
+
+  ArenaScope(const ArenaScope&) = delete;
+
+  void operator=(const ArenaScope&) = delete;
+
+  ~ArenaScope() {
+    Arena::_current = _prev;
+  }
+};
+
+}  // namespace tex
+
+#endif  // ARENA_H_INCLUDED
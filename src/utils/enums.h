@@ -96,6 +96,35 @@ enum class TexStyle : i8 {
   scriptScript1
 };
 
+/** General parameters used in the TeX algorithms, see DefaultTeXFont::getParameter */
+enum class TeXParam : i8 {
+  num1,
+  num2,
+  num3,
+  denom1,
+  denom2,
+  sup1,
+  sup2,
+  sup3,
+  sub1,
+  sub2,
+  supdrop,
+  subdrop,
+  axisheight,
+  defaultrulethickness,
+  bigopspacing1,
+  bigopspacing2,
+  bigopspacing3,
+  bigopspacing4,
+  bigopspacing5
+};
+
+/** Count of the TeXParam */
+const int TEX_PARAM_COUNT = static_cast<int>(TeXParam::bigopspacing5) + 1;
+
+/** Count of the TexStyle */
+const int TEX_STYLE_COUNT = static_cast<int>(TexStyle::scriptScript1) + 1;
+
 enum class UnitType : i8 {
   /** 1 em = the width of the capital 'M' in the current font */
   em,
@@ -1,18 +1,35 @@
 #ifndef INDEXED_ARR_H_INCLUDED
 #define INDEXED_ARR_H_INCLUDED
 
+#include <vector>
+
+#include "utils/utils.h"
+
 namespace tex {
 
 /**
  * Template to represents 2 dimensions array with N element(s) for each item and
  * sorted by the first M element(s).
+ * <p>
+ * If the first keys are dense non-negative integers (e.g. the char codes of a
+ * font), an index from the first key to its rows is built, thus finding an item
+ * is a direct indexed load (M = 1) or a scan over the few rows sharing the same
+ * first key (M > 1), instead of a binary search over the whole array.
  */
 template <typename T, size_t N, size_t M>
 class IndexedArray {
 private:
+  // the index is built only if the first keys are in [0, MAX_INDEXED_KEY)
+  // and the index is not much larger than the array
+  static const long MAX_INDEXED_KEY = 0x10000;
+  static const long MAX_SPARSITY = 64;
+
   const T* _raw;
   size_t   _rows;
   bool     _auto_delete;
+  // _index[k] is the first row whose first key is not less than k, the rows
+  // of first key k are in [_index[k], _index[k + 1])
+  std::vector<u16> _index;
 
   int compare(const T a[M], const T b[M]) const {
     for (size_t i = 0; i < M; i++) {
@@ -22,6 +39,25 @@ private:
     return 0;
   }
 
+  void buildIndex() {
+    _index.clear();
+    if (_raw == nullptr || _rows == 0 || _rows >= 0xffff) return;
+    const T first = _raw[0], last = _raw[(_rows - 1) * N];
+    if (first < 0 || (long) last != last || last >= MAX_INDEXED_KEY) return;
+    const long count = (long) last + 1;
+    if (count > MAX_SPARSITY * (long) _rows) return;
+    for (size_t i = 0; i < _rows; i++) {
+      const T k = _raw[i * N];
+      if ((long) k != k) return;
+    }
+    _index.resize(count + 1);
+    size_t row = 0;
+    for (long k = 0; k <= count; k++) {
+      while (row < _rows && (long) _raw[row * N] < k) row++;
+      _index[k] = (u16) row;
+    }
+  }
+
 public:
   IndexedArray(const IndexedArray& arr) = delete;
 
@@ -30,24 +66,43 @@ public:
   IndexedArray() : _raw(nullptr), _rows(0), _auto_delete(false) {}
 
   IndexedArray(const T* arr, int len, bool auto_delete = false)
-      : _raw(arr), _rows(len / N), _auto_delete(auto_delete) {}
+      : _raw(arr), _rows(len / N), _auto_delete(auto_delete) {
+    buildIndex();
+  }
 
   void operator=(IndexedArray&& o) {
     _raw         = o._raw;
     _rows        = o._rows;
     _auto_delete = o._auto_delete;
+    _index       = std::move(o._index);
     // reset o
     o._raw         = nullptr;
     o._rows        = 0;
     o._auto_delete = false;
+    o._index.clear();
   }
 
   /** Find the item by the given keys, return nullptr if not found */
   template <typename... Ks>
   const T* operator()(const Ks&... keys) const {
+    if (_raw == nullptr) return nullptr;
+    if (_index.empty()) return search(keys...);
+    const T k[] = {keys...};
+    const long first = (long) k[0];
+    if (first != k[0] || first < 0 || first + 1 >= (long) _index.size()) return nullptr;
+    for (size_t i = _index[first], end = _index[first + 1]; i < end; i++) {
+      const T* r = _raw + (i * N);
+      if (compare(k, r) == 0) return r;
+    }
+    return nullptr;
+  }
+
+  /** Find the item by the given keys with binary search, return nullptr if not found */
+  template <typename... Ks>
+  const T* search(const Ks&... keys) const {
     if (_raw == nullptr) return nullptr;
     const T k[] = {keys...};
-    int     l = 0, h = _rows;
+    int     l = 0, h = (int) _rows - 1;
     while (l <= h) {
       const int  m   = l + ((h - l) >> 1);
       const T*   r   = _raw + (m * N);
@@ -0,0 +1,176 @@
+#ifndef PERFECT_HASH_H_INCLUDED
+#define PERFECT_HASH_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "utils/exceptions.h"
+#include "utils/utils.h"
+
+namespace tex {
+
+/** FNV-1a hash of the given string mixed with the given seed */
+template<typename C>
+constexpr u32 __phash(std::basic_string_view<C> key, u32 seed) {
+  u32 h = 2166136261u ^ (seed * 0x9e3779b9u);
+  for (size_t i = 0; i < key.size(); i++) {
+    h ^= static_cast<u32>(key[i]);
+    h *= 16777619u;
+  }
+  // the low bits are taken, mix the high bits into them
+  h ^= h >> 15;
+  h *= 0x2c1b3c6du;
+  h ^= h >> 12;
+  return h;
+}
+
+/** Get the table size (power of 2) for the given count of keys */
+constexpr size_t __phash_size(size_t n) {
+  size_t size = 2;
+  while (size < n + n / 4) size <<= 1;
+  return size;
+}
+
+/**
+ * Build a perfect hash with the "hash and displace" scheme: the keys are
+ * distributed to the buckets by the hash with seed 0, then for every bucket
+ * (the largest first) a seed is searched to place all its keys to the free
+ * slots by the hash with that seed.
+ *
+ * @param keys the keys, must be distinct
+ * @param n the count of the keys
+ * @param seeds the seed of every bucket, the count must be power of 2
+ * @param slots index + 1 of the key in every slot (0 if free), the count must
+ *     be power of 2
+ * @param work the working memory with 2 * n + buckets + 1 elements
+ * @return false if failed (e.g. duplicate keys)
+ */
+template<typename C>
+constexpr bool __phash_build(
+  const std::basic_string_view<C>* keys, size_t n,
+  u32* seeds, size_t buckets,
+  u16* slots, size_t size,
+  u32* work
+) {
+  u32* const bucketOf = work;
+  u32* const order = work + n;
+  u32* const start = work + 2 * n;
+  for (size_t i = 0; i <= buckets; i++) start[i] = 0;
+  for (size_t i = 0; i < n; i++) {
+    bucketOf[i] = __phash(keys[i], 0) & (buckets - 1);
+    start[bucketOf[i] + 1]++;
+  }
+  // the keys sorted by bucket, the keys of bucket b are order[start[b], start[b + 1])
+  size_t maxSize = 0;
+  for (size_t b = 0; b < buckets; b++) {
+    maxSize = start[b + 1] > maxSize ? start[b + 1] : maxSize;
+    start[b + 1] += start[b];
+  }
+  for (size_t i = 0; i < n; i++) order[start[bucketOf[i]]++] = i;
+  for (size_t b = buckets; b > 0; b--) start[b] = start[b - 1];
+  start[0] = 0;
+
+  for (size_t i = 0; i < size; i++) slots[i] = 0;
+  for (size_t s = maxSize; s > 0; s--) {
+    for (size_t b = 0; b < buckets; b++) {
+      if (start[b + 1] - start[b] != s) continue;
+      bool placed = false;
+      for (u32 seed = 1; !placed && seed < (1u << 20); seed++) {
+        size_t j = start[b];
+        for (; j < start[b + 1]; j++) {
+          const size_t slot = __phash(keys[order[j]], seed) & (size - 1);
+          if (slots[slot] != 0) break;
+          slots[slot] = static_cast<u16>(order[j] + 1);
+        }
+        if (j == start[b + 1]) {
+          seeds[b] = seed;
+          placed = true;
+          break;
+        }
+        // roll back the keys placed by this seed
+        for (size_t k = start[b]; k < j; k++) {
+          slots[__phash(keys[order[k]], seed) & (size - 1)] = 0;
+        }
+      }
+      if (!placed) return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * A perfect hash table of N string keys built at compile time, map a key to its
+ * index in the given keys (or -1 if not found) with 2 hashes and 1 comparison.
+ * The table is immutable, thus safe for concurrent readers.
+ */
+template<typename C, size_t N>
+class StaticPerfectHash {
+private:
+  static constexpr size_t SIZE = __phash_size(N);
+  static constexpr size_t BUCKETS = SIZE / 2;
+
+  std::array<std::basic_string_view<C>, N> _keys;
+  std::array<u32, BUCKETS> _seeds{};
+  std::array<u16, SIZE> _slots{};
+
+  static_assert(N < 0xffff, "too many keys");
+
+public:
+  constexpr explicit StaticPerfectHash(const std::array<std::basic_string_view<C>, N>& keys)
+    : _keys(keys) {
+    std::array<u32, 2 * N + BUCKETS + 1> work{};
+    if (!__phash_build(_keys.data(), N, _seeds.data(), BUCKETS, _slots.data(), SIZE, work.data())) {
+      throw ex_invalid_param("failed to build the perfect hash, duplicate keys?");
+    }
+  }
+
+  constexpr int find(std::basic_string_view<C> key) const {
+    const u32 seed = _seeds[__phash(key, 0) & (BUCKETS - 1)];
+    const int i = static_cast<int>(_slots[__phash(key, seed) & (SIZE - 1)]) - 1;
+    return i >= 0 && _keys[i] == key ? i : -1;
+  }
+
+  constexpr size_t size() const { return N; }
+};
+
+/**
+ * A perfect hash table of string keys built at runtime, see StaticPerfectHash.
+ * The table refers to the given keys, they must live as long as the table.
+ */
+template<typename C>
+class PerfectHash {
+private:
+  std::vector<std::basic_string_view<C>> _keys;
+  std::vector<u32> _seeds;
+  std::vector<u16> _slots;
+
+public:
+  PerfectHash() = default;
+
+  explicit PerfectHash(std::vector<std::basic_string_view<C>> keys) : _keys(std::move(keys)) {
+    const size_t n = _keys.size();
+    if (n >= 0xffff) throw ex_invalid_param("too many keys");
+    const size_t size = __phash_size(n);
+    _seeds.resize(size / 2);
+    _slots.resize(size);
+    std::vector<u32> work(2 * n + _seeds.size() + 1);
+    if (!__phash_build(_keys.data(), n, _seeds.data(), _seeds.size(), _slots.data(), size, work.data())) {
+      throw ex_invalid_param("failed to build the perfect hash, duplicate keys?");
+    }
+  }
+
+  int find(std::basic_string_view<C> key) const {
+    if (_keys.empty()) return -1;
+    const u32 seed = _seeds[__phash(key, 0) & (_seeds.size() - 1)];
+    const int i = static_cast<int>(_slots[__phash(key, seed) & (_slots.size() - 1)]) - 1;
+    return i >= 0 && _keys[i] == key ? i : -1;
+  }
+
+  size_t size() const { return _keys.size(); }
+};
+
+}  // namespace tex
+
+#endif  // PERFECT_HASH_H_INCLUDED
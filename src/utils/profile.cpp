@@ -0,0 +1,58 @@
+#include "utils/profile.h"
+
+#include <memory>
+#include <mutex>
+
+#include "utils/arena.h"
+
+using namespace std;
+using namespace tex;
+
+thread_local RenderStats* Profiler::_current = nullptr;
+thread_local bool Profiler::_running[RENDER_PHASE_COUNT]{};
+
+static mutex sinkMutex;
+static sptr<ProfileSink> sink;
+
+void Profiler::setSink(const ProfileSink& s) {
+  auto ptr = s ? sptrOf<ProfileSink>(s) : nullptr;
+  lock_guard<mutex> lock(sinkMutex);
+  sink = ptr;
+}
+
+void Profiler::report(const RenderStats& stats) {
+  sptr<ProfileSink> s;
+  {
+    lock_guard<mutex> lock(sinkMutex);
+    s = sink;
+  }
+  // call out of the lock, the sink may be replaced meanwhile
+  if (s != nullptr) (*s)(stats);
+}
+
+uint64_t PhaseScope::allocations() {
+  const Arena* arena = Arena::current();
+  return Arena::heapAllocations() + (arena == nullptr ? 0 : arena->allocations());
+}
+
+PhaseScope::PhaseScope(RenderPhase phase) : _phase(phase) {
+  RenderStats* stats = Profiler::_current;
+  bool& running = Profiler::_running[static_cast<u8>(phase)];
+  if (stats == nullptr || running) return;
+  running = true;
+  _stats = stats;
+  _allocations = allocations();
+  _start = chrono::steady_clock::now();
+}
+
+PhaseScope::~PhaseScope() {
+  if (_stats == nullptr) return;
+  const auto nanos = chrono::duration_cast<chrono::nanoseconds>(
+    chrono::steady_clock::now() - _start
+  ).count();
+  PhaseStats& p = (*_stats)[_phase];
+  p._calls++;
+  p._nanos += nanos;
+  p._allocations += allocations() - _allocations;
+  Profiler::_running[static_cast<u8>(_phase)] = false;
+}
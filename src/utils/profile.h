@@ -0,0 +1,177 @@
+#ifndef PROFILE_H_INCLUDED
+#define PROFILE_H_INCLUDED
+
+#include <chrono>
+#include <cinttypes>
+#include <functional>
+
+#include "utils/utils.h"
+
+namespace tex {
+
+/** The phases of a render */
+enum class RenderPhase : u8 {
+  // parse the TeX source into atoms, includes the macro expansions
+  parse,
+  // expand the macros, nested in the parse phase
+  macro,
+  // create the box tree from the atoms
+  layout,
+  // split the box tree into lines
+  split,
+  // draw the box tree
+  draw,
+};
+
+static constexpr int RENDER_PHASE_COUNT = 5;
+
+/** The stats of a phase */
+struct PhaseStats {
+  // count of the calls
+  u32 _calls = 0;
+  // wall time in nanoseconds
+  std::uint64_t _nanos = 0;
+  // count of the objects created by sptrOf
+  std::uint64_t _allocations = 0;
+};
+
+/**
+ * The stats of a render, the phases and the counters are recorded only if
+ * compiled with the flag HAVE_PROFILE, otherwise they are all zero.
+ */
+struct RenderStats {
+  PhaseStats _phases[RENDER_PHASE_COUNT];
+  // count of the atoms created
+  u32 _atoms = 0;
+  // count of the boxes created
+  u32 _boxes = 0;
+  // count of the glyph lookups
+  u32 _glyphs = 0;
+  // count of the macro expansions
+  u32 _macros = 0;
+  // if the render is taken from the cache of the context
+  bool _cacheHit = false;
+
+  inline const PhaseStats& operator[](RenderPhase phase) const {
+    return _phases[static_cast<u8>(phase)];
+  }
+
+  inline PhaseStats& operator[](RenderPhase phase) {
+    return _phases[static_cast<u8>(phase)];
+  }
+};
+
+using ProfileSink = std::function<void(const RenderStats&)>;
+
+class ProfileScope;
+
+class PhaseScope;
+
+/**
+ * Collect the stats of the renders. The stats are recorded into the stats made
+ * current on the calling thread by a ProfileScope, nothing is recorded if none
+ * is current.
+ */
+class Profiler {
+private:
+  static thread_local RenderStats* _current;
+  // the phases running on the calling thread
+  static thread_local bool _running[RENDER_PHASE_COUNT];
+
+  friend class ProfileScope;
+
+  friend class PhaseScope;
+
+public:
+  /** Get the stats current on the calling thread, nullptr if none */
+  inline static RenderStats* current() { return _current; }
+
+  /**
+   * Set the sink to receive the stats every time a parse (LaTeX::parse or
+   * TeXRenderBuilder::build) or a draw (TeXRender::draw) is done. The sink is
+   * called on the thread that does the work, so it must be thread-safe if the
+   * renders are parsed or drawn on multiple threads. Set an empty function to
+   * remove the sink.
+   */
+  static void setSink(const ProfileSink& sink);
+
+  /** Send the given stats to the sink if any */
+  static void report(const RenderStats& stats);
+};
+
+/**
+ * Make a stats current on the calling thread during the lifetime of the scope.
+ * A scope created without stats joins the stats current already (e.g. a build
+ * called by a parse), or collects into its own if none is current.
+ */
+class ProfileScope {
+private:
+  RenderStats _own;
+  RenderStats* const _prev;
+  RenderStats& _stats;
+
+public:
+  explicit ProfileScope(RenderStats* stats = nullptr)
+    : _prev(Profiler::_current),
+      _stats(stats != nullptr ? *stats : (_prev != nullptr ? *_prev : _own)) {
+    Profiler::_current = &_stats;
+  }
+
+  no_copy_assign(ProfileScope);
+
+  inline RenderStats& stats() { return _stats; }
+
+  /** Test if no stats was current when the scope was created */
+  inline bool isOutermost() const { return _prev == nullptr; }
+
+  ~ProfileScope() { Profiler::_current = _prev; }
+};
+
+/**
+ * Record the wall time and the allocations of a phase into the current stats
+ * during the lifetime of the scope. Only the outermost scope of a phase is
+ * recorded if the phase is reentered (e.g. a macro expands to another macro).
+ */
+class PhaseScope {
+private:
+  RenderStats* _stats = nullptr;
+  RenderPhase _phase;
+  std::chrono::steady_clock::time_point _start;
+  std::uint64_t _allocations = 0;
+
+  static std::uint64_t allocations();
+
+public:
+  explicit PhaseScope(RenderPhase phase);
+
+  no_copy_assign(PhaseScope);
+
+  ~PhaseScope();
+};
+
+#ifdef HAVE_PROFILE
+
+#define __profile_cat(a, b) a##b
+#define __profile_var(line) __profile_cat(__phase_, line)
+
+/** Record the given phase until the end of the enclosing block */
+#define profile_phase(phase) \
+  tex::PhaseScope __profile_var(__LINE__)(tex::RenderPhase::phase)
+
+/** Increase the given counter of the current stats */
+#define profile_count(field)                               \
+  do {                                                     \
+    tex::RenderStats* __stats = tex::Profiler::current();  \
+    if (__stats != nullptr) __stats->field++;              \
+  } while (false)
+
+#else
+
+#define profile_phase(phase)
+#define profile_count(field)
+
+#endif  // HAVE_PROFILE
+
+}  // namespace tex
+
+#endif  // PROFILE_H_INCLUDED
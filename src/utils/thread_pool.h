@@ -0,0 +1,157 @@
+#ifndef THREAD_POOL_H_INCLUDED
+#define THREAD_POOL_H_INCLUDED
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utils/utils.h"
+
+namespace tex {
+
+/**
+ * A fork-join pool that distributes the indices of a loop over a fixed number
+ * of workers. Every worker owns a queue of indices, it takes the indices from
+ * the front of its own queue and steals from the back of the others' queues
+ * when its own queue is empty, thus the workers keep busy even if the tasks
+ * have very different costs.
+ * <p>
+ * The calling thread takes part in the work as the worker 0, the other
+ * workers are threads started by the first run and kept alive for the later
+ * runs until the pool is destroyed. A pool must be run by one thread at a
+ * time, and not from its own tasks.
+ */
+class WorkStealingPool {
+private:
+  struct Worker {
+    std::mutex _mutex;
+    std::deque<size_t> _tasks;
+  };
+
+  const size_t _size;
+  std::vector<std::thread> _threads;
+  // the run in progress, guarded by _mutex
+  std::mutex _mutex;
+  std::condition_variable _wake, _done;
+  const std::function<void(size_t)>* _work = nullptr;
+  size_t _round = 0, _running = 0;
+  bool _stop = false;
+
+  static bool pop(Worker& w, size_t& index, bool front) {
+    std::lock_guard<std::mutex> lock(w._mutex);
+    if (w._tasks.empty()) return false;
+    if (front) {
+      index = w._tasks.front();
+      w._tasks.pop_front();
+    } else {
+      index = w._tasks.back();
+      w._tasks.pop_back();
+    }
+    return true;
+  }
+
+  static bool& inWorkerFlag() {
+    static thread_local bool flag = false;
+    return flag;
+  }
+
+  /** The loop of the thread of the worker with the given id */
+  void loop(size_t id) {
+    inWorkerFlag() = true;
+    size_t round = 0;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+      _wake.wait(lock, [&] { return _stop || _round != round; });
+      if (_stop) return;
+      round = _round;
+      const auto* work = _work;
+      lock.unlock();
+      (*work)(id);
+      lock.lock();
+      if (--_running == 0) _done.notify_one();
+    }
+  }
+
+public:
+  no_copy_assign(WorkStealingPool);
+
+  /**
+   * Create a pool with given number of workers
+   *
+   * @param threads the number of workers, 0 means the number of the hardware
+   * threads
+   */
+  explicit WorkStealingPool(size_t threads = 0)
+    : _size(threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency())) {}
+
+  ~WorkStealingPool() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _wake.notify_all();
+    for (auto& t : _threads) t.join();
+  }
+
+  /** Get the number of workers */
+  inline size_t size() const { return _size; }
+
+  /** Test if the calling thread runs the tasks of a pool */
+  static bool inWorker() { return inWorkerFlag(); }
+
+  /**
+   * Run the given task for every index in [0, count), blocks until all the
+   * tasks are done. The task MUST NOT throw.
+   *
+   * @param count the number of the tasks
+   * @param task the task to run, with the index of the worker that runs it
+   * and the index of the task
+   */
+  void run(size_t count, const std::function<void(size_t, size_t)>& task) {
+    if (count == 0) return;
+    const size_t n = std::min(_size, count);
+    std::unique_ptr<Worker[]> workers(new Worker[n]);
+    // split the indices into contiguous ranges to keep the input order locality
+    for (size_t i = 0; i < count; i++) workers[i * n / count]._tasks.push_back(i);
+
+    const std::function<void(size_t)> work = [&](size_t id) {
+      // the workers more than the tasks have nothing to do
+      if (id >= n) return;
+      size_t index;
+      while (pop(workers[id], index, true)) task(id, index);
+      for (size_t k = 1; k < n; k++) {
+        Worker& victim = workers[(id + k) % n];
+        while (pop(victim, index, false)) task(id, index);
+      }
+    };
+
+    const bool nested = inWorkerFlag();
+    inWorkerFlag() = true;
+    if (n > 1) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for (size_t i = _threads.size() + 1; i < _size; i++) {
+        _threads.emplace_back(&WorkStealingPool::loop, this, i);
+      }
+      _work = &work;
+      _running = _threads.size();
+      _round++;
+      _wake.notify_all();
+    }
+    work(0);
+    if (n > 1) {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _done.wait(lock, [&] { return _running == 0; });
+      _work = nullptr;
+    }
+    inWorkerFlag() = nested;
+  }
+};
+
+}  // namespace tex
+
+#endif  // THREAD_POOL_H_INCLUDED
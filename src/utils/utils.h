@@ -6,6 +6,8 @@
 #include <memory>
 #include <vector>
 
+#include "utils/arena.h"
+
 #define no_copy_assign(T) \
   T(const T&) = delete;   \
   void operator=(const T&) = delete
@@ -18,15 +20,17 @@ using i16 = std::int16_t;
 using u16 = std::uint16_t;
 using i32 = std::int32_t;
 using u32 = std::uint32_t;
+using u64 = std::uint64_t;
 using c32 = char32_t;
 
 /** Type alias shared_ptr<T> to sptr<T> */
 template<typename T>
 using sptr = std::shared_ptr<T>;
 
+/** Create a shared object, from the current arena if any, see Arena */
 template<typename T, typename... Args>
 inline sptr<T> sptrOf(Args&& ... args) {
-  return std::make_shared<T>(std::forward<Args>(args)...);
+  return Arena::make<T>(std::forward<Args>(args)...);
 }
 
 /** Find the position of a value in the vector, return -1 if not found */
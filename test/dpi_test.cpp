@@ -0,0 +1,48 @@
+#include <cstdlib>
+
+#include "graphics_log.h"
+#include "samples/samples.h"
+#include "test.h"
+
+using namespace tex;
+using namespace tex::test;
+
+/** Parse the given latex at the given DPI, the width and the line space are in pixels */
+static TeXRender* parse(const std::wstring& latex, float dpi, int width, float lineSpace) {
+  auto& ctx = Context::current();
+  ctx.setDPITarget(dpi);
+  auto r = LaTeX::parse(latex, width, 20, lineSpace, black);
+  r->setInsets({0, 0, 0, 0}, true);
+  return r;
+}
+
+/** Get the draws of the given render drawn with the given scale */
+static std::vector<std::string> drawsOf(TeXRender* r, float scale) {
+  Graphics2D_log g2;
+  r->draw(g2, 5, 7, scale);
+  return g2._ops;
+}
+
+int main() {
+  return run([] {
+    Context::current().cache().setBudget(0);
+    Samples samples;
+    for (int i = 0; i < samples.count(); i++) {
+      const std::wstring& latex = samples.next();
+      // a render at 144 DPI is a render at 72 DPI drawn at 2x
+      TeXRender* r144 = parse(latex, 144, 1440, 40 / 3.f);
+      TeXRender* r72 = parse(latex, 72, 720, 20 / 3.f);
+      const auto draws = drawsOf(r72, 2);
+      if (!CHECK(drawsOf(r144, 1) == draws)) std::fprintf(stderr, "  sample %d\n", i);
+      // the sizes are rounded up to pixels
+      CHECK(std::abs(r144->getWidth() - 2 * r72->getWidth()) <= 1);
+      CHECK(std::abs(r144->getHeight() - 2 * r72->getHeight()) <= 1);
+      // the scale of a draw does not stay in the render
+      drawsOf(r72, 1);
+      CHECK(drawsOf(r72, 2) == draws);
+      delete r144;
+      delete r72;
+    }
+    Context::current().setDPITarget(72);
+  });
+}
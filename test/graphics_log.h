@@ -0,0 +1,129 @@
+#ifndef GRAPHICS_LOG_H_INCLUDED
+#define GRAPHICS_LOG_H_INCLUDED
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "graphic/graphic.h"
+
+namespace tex {
+
+namespace test {
+
+/**
+ * Graphics that logs the draws instead of showing them. Every draw is logged
+ * with its points in the device space, the linear part of the transformation
+ * it is drawn with and the size of its font, so two draws of the same formula compare
+ * equal however they reach the same device coordinates (e.g. a DPI or a scale
+ * of the draw).
+ */
+class Graphics2D_log : public Graphics2D {
+private:
+  // the transformation, x' = a * x + c * y + e, y' = b * x + d * y + f
+  double _a = 1, _b = 0, _c = 0, _d = 1, _e = 0, _f = 0;
+  float _sx = 1, _sy = 1;
+  color _color = black;
+  Stroke _stroke;
+  const Font* _font = nullptr;
+
+  void log(const std::string& name, std::initializer_list<float> coords) {
+    char buf[128];
+    std::snprintf(
+      buf, sizeof(buf), " color=%x stroke=%.3f font=%.3f [%.3f %.3f %.3f %.3f]",
+      _color, _stroke.lineWidth * std::sqrt(std::abs(_a * _d - _b * _c)),
+      _font == nullptr ? 0.f : _font->getSize(), _a, _b, _c, _d
+    );
+    std::string op = name + buf;
+    for (auto it = coords.begin(); it != coords.end(); it += 2) {
+      const float x = *it, y = *(it + 1);
+      std::snprintf(buf, sizeof(buf), " (%.2f, %.2f)", _a * x + _c * y + _e, _b * x + _d * y + _f);
+      op += buf;
+    }
+    _ops.push_back(op);
+  }
+
+public:
+  /** The draws logged, in draw order */
+  std::vector<std::string> _ops;
+
+  void setColor(color c) override { _color = c; }
+
+  color getColor() const override { return _color; }
+
+  void setStroke(const Stroke& s) override { _stroke = s; }
+
+  const Stroke& getStroke() const override { return _stroke; }
+
+  void setStrokeWidth(float w) override { _stroke.lineWidth = w; }
+
+  const Font* getFont() const override { return _font; }
+
+  void setFont(const Font* font) override { _font = font; }
+
+  void translate(float dx, float dy) override {
+    _e += _a * dx + _c * dy;
+    _f += _b * dx + _d * dy;
+  }
+
+  void scale(float sx, float sy) override {
+    _a *= sx;
+    _b *= sx;
+    _c *= sy;
+    _d *= sy;
+    _sx *= sx;
+    _sy *= sy;
+  }
+
+  void rotate(float angle) override {
+    const double cos = std::cos(angle), sin = std::sin(angle);
+    const double a = _a * cos + _c * sin, b = _b * cos + _d * sin;
+    _c = _c * cos - _a * sin;
+    _d = _d * cos - _b * sin;
+    _a = a;
+    _b = b;
+  }
+
+  void rotate(float angle, float px, float py) override {
+    translate(px, py);
+    rotate(angle);
+    translate(-px, -py);
+  }
+
+  void reset() override {
+    _a = _d = 1;
+    _b = _c = _e = _f = 0;
+    _sx = _sy = 1;
+  }
+
+  float sx() const override { return _sx; }
+
+  float sy() const override { return _sy; }
+
+  void drawChar(wchar_t c, float x, float y) override { log("char " + std::to_string(c), {x, y}); }
+
+  void drawText(const std::wstring& t, float x, float y) override {
+    log("text " + std::to_string(t.length()), {x, y});
+  }
+
+  void drawLine(float x1, float y1, float x2, float y2) override { log("line", {x1, y1, x2, y2}); }
+
+  void drawRect(float x, float y, float w, float h) override { log("rect", {x, y, x + w, y + h}); }
+
+  void fillRect(float x, float y, float w, float h) override { log("fillRect", {x, y, x + w, y + h}); }
+
+  void drawRoundRect(float x, float y, float w, float h, float rx, float ry) override {
+    log("roundRect", {x, y, x + w, y + h, x + rx, y + ry});
+  }
+
+  void fillRoundRect(float x, float y, float w, float h, float rx, float ry) override {
+    log("fillRoundRect", {x, y, x + w, y + h, x + rx, y + ry});
+  }
+};
+
+}  // namespace test
+
+}  // namespace tex
+
+#endif  // GRAPHICS_LOG_H_INCLUDED
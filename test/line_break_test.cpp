@@ -0,0 +1,68 @@
+#include "box/box_group.h"
+#include "box/box_single.h"
+#include "core/core.h"
+#include "core/formula.h"
+#include "render.h"
+#include "test.h"
+
+using namespace tex;
+using namespace tex::test;
+
+/** Collect the leaves of the given box, the horizontal boxes are flattened */
+static void leaves(const sptr<Box>& box, std::vector<Box*>& out) {
+  if (auto hb = std::dynamic_pointer_cast<HBox>(box)) {
+    for (auto& child : hb->_children) leaves(child, out);
+    return;
+  }
+  out.push_back(box.get());
+}
+
+/** Get the lines of the given split box */
+static std::vector<sptr<Box>> linesOf(const sptr<Box>& box) {
+  auto vb = std::dynamic_pointer_cast<VBox>(box);
+  if (vb == nullptr) return {box};
+  std::vector<sptr<Box>> lines;
+  for (auto& child : vb->_children) {
+    if (std::dynamic_pointer_cast<StrutBox>(child) == nullptr) lines.push_back(child);
+  }
+  return lines;
+}
+
+int main() {
+  return run([] {
+    std::wstring sum, fractions, words = L"\\breakEverywhere{true}";
+    for (int i = 0; i < 120; i++) {
+      if (i > 0) sum += i % 3 ? L"+" : L"=";
+      sum += L"a_{" + std::to_wstring(i) + L"}x^{" + std::to_wstring(i % 7) + L"}";
+    }
+    for (int i = 0; i < 60; i++) {
+      if (i > 0) fractions += L"+";
+      fractions += L"{(x_{" + std::to_wstring(i) + L"}+y)}\\cdot\\frac{1}{" + std::to_wstring(i) + L"}";
+    }
+    for (int i = 0; i < 80; i++) words += L"abc+{de\\-fg}+\\sqrt{x}-";
+    const std::wstring srcs[] = {sum, fractions, words, L"a+b", L"\\frac{aaaaaaaaaaaaaaaaaaaaaaaaaa}{b}+c"};
+
+    sptr<TeXFont> font(TeXRenderBuilder::createFont(20, 0));
+    for (const auto& src : srcs) {
+      Formula formula(src);
+      for (float width : {3.f, 5.f, 8.f, 12.f, 20.f, 40.f}) {
+        Environment env(TexStyle::text, font);
+        auto box = formula._root->createBox(env);
+        std::vector<Box*> expected;
+        leaves(box, expected);
+        int overfull[2] = {0, 0};
+        for (bool optimal : {false, true}) {
+          // the split moves the boxes to the lines, it never drops or adds one
+          std::vector<Box*> got;
+          for (auto& line : linesOf(BoxSplitter::split(box, width, 0.5f, optimal))) {
+            leaves(line, got);
+            if (line->_width > width + 1e-4f) overfull[optimal]++;
+          }
+          CHECK(got == expected);
+        }
+        // the optimal split is never more overfull than the greedy one
+        CHECK(overfull[1] <= overfull[0]);
+      }
+    }
+  });
+}
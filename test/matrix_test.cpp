@@ -0,0 +1,159 @@
+#include <algorithm>
+
+#include "atom/atom_matrix.h"
+#include "core/formula.h"
+#include "graphics_log.h"
+#include "render.h"
+#include "samples/samples.h"
+#include "test.h"
+
+using namespace tex;
+using namespace tex::test;
+
+/** Get a n x n array of fractions with some spanned and nested cells */
+static std::wstring grid(int n, const std::wstring& nested) {
+  std::wstring latex = L"\\begin{array}{|" + std::wstring(n, L'c') + L"|}\\hline ";
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      if (j > 0) latex += L"&";
+      if (i == 3 && j == 2) {
+        latex += L"\\multicolumn{2}{c}{wide cell here}";
+        j++;
+      } else if (i == 5 && j == 1) {
+        latex += L"\\hspace{2ex}\\begin{smallmatrix}a&b\\\\c&d\\end{smallmatrix}";
+      } else if (i == 7 && j == 3) {
+        latex += L"\\begin{pmatrix}x_1 & " + nested + L"\\\\ \\sqrt{y} & z\\end{pmatrix}";
+      } else {
+        latex += L"\\frac{a_{" + std::to_wstring(i) + L"}}{b^{" + std::to_wstring(j) + L"}}";
+      }
+    }
+    latex += L"\\\\";
+    if (i % 4 == 0) latex += L"\\hline ";
+  }
+  return latex + L"\\end{array}";
+}
+
+/** Get a n x n array of the cells that change the font or the color in place */
+static std::wstring styles(int n) {
+  const std::wstring cells[] = {
+    L"\\lim_{x\\to 0} x", L"a\\cdots b", L"x\\iff y", L"\\sin^2\\theta", L"\\varinjlim",
+    L"\\color{red}{q+1}", L"\\phantom{xy}z", L"\\mathrm{abc}", L"\\mathsf{abc}", L"\\text{ab cd}",
+    L"\\sqrt[3]{x}", L"\\overline{ab}", L"\\left(\\frac{1}{2}\\right)",
+  };
+  std::wstring latex = L"\\begin{array}{" + std::wstring(n, L'c') + L"}";
+  for (int k = 0; k < n * n; k++) {
+    latex += cells[k % (sizeof(cells) / sizeof(cells[0]))];
+    latex += k % n == n - 1 ? L"\\\\" : L"&";
+  }
+  return latex + L"\\end{array}";
+}
+
+/** Get an array of the samples */
+static std::wstring samplesGrid() {
+  Samples samples;
+  std::wstring latex = L"\\begin{array}{cccc}";
+  for (int k = 0; k < samples.count(); k++) {
+    latex += L"{\\begin{array}{l}" + samples.next() + L"\\end{array}}";
+    latex += k % 4 == 3 ? L"\\\\" : L"&";
+  }
+  return latex + L"\\end{array}";
+}
+
+/** Parse the given latex, get its draws or its error */
+static std::vector<std::string> parse(const std::wstring& latex) {
+  try {
+    auto r = LaTeX::parse(latex, 720, 20, 20 / 3.f, black);
+    Graphics2D_log g2;
+    r->draw(g2, 0, 0);
+    g2._ops.push_back(std::to_string(r->getWidth()) + "x" + std::to_string(r->getHeight()));
+    delete r;
+    return g2._ops;
+  } catch (std::exception& e) {
+    return {e.what()};
+  }
+}
+
+/** An atom that fails to lay out, with the given message */
+class ErrorAtom : public Atom {
+private:
+  std::string _message;
+
+public:
+  explicit ErrorAtom(std::string message) : _message(std::move(message)) {}
+
+  sptr<Box> createBox(Environment& env) override { throw ex_invalid_state(_message); }
+
+  __decl_clone(ErrorAtom)
+};
+
+/**
+ * Lay out a n x n matrix of "a", the cells of the given indices fail to lay
+ * out, get the message of the error thrown
+ */
+static std::string layoutError(int n, const std::vector<int>& failures) {
+  auto arr = sptrOf<ArrayFormula>();
+  for (int k = 0; k < n * n; k++) {
+    const bool fails = std::find(failures.begin(), failures.end(), k) != failures.end();
+    arr->_root = fails ? sptrOf<ErrorAtom>("cell " + std::to_string(k)) : Formula(L"a")._root;
+    if (k % n == n - 1) {
+      arr->addRow();
+    } else {
+      arr->addCol();
+    }
+  }
+  arr->checkDimensions();
+  MatrixAtom matrix(false, arr, std::wstring(n, L'c'));
+  sptr<TeXFont> font(TeXRenderBuilder::createFont(20, 0));
+  Environment env(TexStyle::display, font);
+  try {
+    matrix.createBox(env);
+  } catch (std::exception& e) {
+    return e.what();
+  }
+  return "";
+}
+
+int main() {
+  return run([] {
+    auto& ctx = Context::current();
+    ctx.cache().setBudget(0);
+    ctx._cellThreads = 4;
+    const std::wstring srcs[] = {
+      grid(4, L"q"),
+      grid(12, L"q"),
+      grid(40, L"{1 \\over 2}"),
+      grid(12, L"\\undefinedcommand"),
+      L"\\begin{align}" + grid(10, L"w") + L"&=" + grid(10, L"v") + L"\\\\ x &= y\\end{align}",
+      styles(36),
+      samplesGrid(),
+      L"\\begin{array}{cc}\\multirow{3}{*}{tall}&a\\\\&b\\\\&c\\\\ \\hdotsfor{2}\\\\ p&q\\end{array}",
+    };
+    for (const auto& latex : srcs) {
+      ctx._parallelCells = 0;
+      const auto serial = parse(latex);
+      ctx._parallelCells = 1;
+      if (!CHECK(parse(latex) == serial)) std::fprintf(stderr, "  latex: %s\n", wide2utf8(latex).substr(0, 80).c_str());
+    }
+
+    // the dots of \ddots and \iddots are predefined formulas cached by the
+    // context, the workers lay them out before any serial layout caches them
+    std::wstring dots = L"\\begin{array}{" + std::wstring(20, L'c') + L"}";
+    for (int k = 0; k < 400; k++) dots += std::wstring(k % 2 ? L"a\\ddots b" : L"\\iddots") + (k % 20 == 19 ? L"\\\\" : L"&");
+    dots += L"\\end{array}";
+    std::vector<std::string> draws[2];
+    for (size_t cells : {1, 0}) {
+      auto forked = ctx.fork();
+      ContextScope scope(*forked);
+      forked->_parallelCells = cells;
+      draws[cells] = parse(dots);
+    }
+    CHECK(draws[1] == draws[0]);
+
+    // the error of the first cell that fails to lay out is thrown
+    for (size_t cells : {0, 1}) {
+      ctx._parallelCells = cells;
+      CHECK_EQ(layoutError(20, {7, 300}), "cell 7");
+      CHECK_EQ(layoutError(20, {399, 0}), "cell 0");
+    }
+  });
+}
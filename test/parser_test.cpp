@@ -0,0 +1,28 @@
+#include "test.h"
+
+using namespace tex;
+using namespace tex::test;
+
+/** Get the position reported by the error of the given latex, e.g. "0:27" */
+static std::string errorPos(const std::wstring& latex) {
+  const std::string err = errorOf(latex);
+  const auto start = err.find(" at position ");
+  if (start == std::string::npos) return err;
+  const auto end = err.find_first_not_of("-0123456789:", start + 13);
+  return err.substr(start + 13, end - start - 13);
+}
+
+int main() {
+  return run([] {
+    // the position is just after the command that reports the error
+    CHECK_EQ(errorPos(L"\\definecolor{c}{xyz}{0,0,0}"), "0:27");
+    CHECK_EQ(errorPos(L"abc\\definecolor{c}{xyz}{0,0,0}x"), "0:30");
+    CHECK_EQ(errorPos(L"a\nbc\\definecolor{c}{xyz}{0,0,0}"), "1:29");
+    // the line break skipped by the argument is counted
+    CHECK_EQ(errorPos(L"\\frac{1}{\n"), "1:0");
+    // the comments removed by the preprocess are counted
+    CHECK_EQ(errorPos(L"% comment\n\\definecolor{c}{xyz}{0,0,0}"), "1:27");
+    // the expansion of a macro is at the position where the macro is used
+    CHECK_EQ(errorPos(L"\\newcommand{\\dc}{\\definecolor{c}{xyz}{0,0,0}}\nx+\\dc y"), "1:6");
+  });
+}
@@ -0,0 +1,40 @@
+#include "graphics_log.h"
+#include "samples/samples.h"
+#include "test.h"
+
+using namespace tex;
+using namespace tex::test;
+
+/** Get the size and the draws of the given render */
+static std::vector<std::string> drawsOf(TeXRender* r) {
+  Graphics2D_log g2;
+  r->draw(g2, 0, 0);
+  g2._ops.push_back(
+    std::to_string(r->getWidth()) + "x" + std::to_string(r->getHeight()) + "+" + std::to_string(r->getDepth())
+  );
+  return g2._ops;
+}
+
+int main() {
+  return run([] {
+    Context::current().cache().setBudget(0);
+    const float lineSpace = 20 / 3.f;
+    Samples samples;
+    for (int i = 0; i < samples.count(); i++) {
+      const std::wstring& latex = samples.next();
+      // the align environment is laid out in the text width of the build, see
+      // relayout
+      if (latex.find(L"{align}") != std::wstring::npos) continue;
+      const Alignment align =
+        latex.rfind(L"$$", 0) == 0 || latex.rfind(L"\\[", 0) == 0 ? Alignment::center : Alignment::left;
+      TeXRender* r = LaTeX::parse(latex, 720, 20, lineSpace, black);
+      for (int width : {300, 150, 80, 1000, 720}) {
+        TeXRender* expected = LaTeX::parse(latex, width, 20, lineSpace, black);
+        r->relayout(width, align, lineSpace);
+        if (!CHECK(drawsOf(r) == drawsOf(expected))) std::fprintf(stderr, "  sample %d, width %d\n", i, width);
+        delete expected;
+      }
+      delete r;
+    }
+  });
+}
@@ -0,0 +1,48 @@
+#include "context.h"
+#include "render_cache.h"
+#include "test.h"
+#include "utils/arena.h"
+
+using namespace tex;
+using namespace tex::test;
+
+/** Get the key of the given latex */
+static RenderCache::Key keyOf(const std::wstring& latex) {
+  return {latex, 720, 20, 20 / 3.f, black, TexStyle::display, 1, 0};
+}
+
+int main() {
+  return run([] {
+    auto ctx = Context::current().fork();
+    ContextScope scope(*ctx);
+    ctx->cache().setBudget(0);
+    TeXRender* r = ctx->parse(L"x^{2}+\\frac{1}{2}", 720, 20, 20 / 3.f, black);
+    const auto arena = ctx->getLastArena();
+    if (!CHECK(arena != nullptr)) return;
+
+    // the arena kept alive by a render is charged
+    RenderCache cache(1 << 20);
+    cache.put(keyOf(L"a"), *r, arena);
+    const size_t one = cache.bytes();
+    CHECK(one > arena->reserved());
+    // and charged once for all the renders allocated from it
+    cache.put(keyOf(L"b"), *r, arena);
+    CHECK_EQ(cache.bytes() - one, one - arena->reserved());
+    cache.put(keyOf(L"b"), *r, arena);
+    CHECK_EQ(cache.size(), 2u);
+    CHECK(cache.bytes() < 2 * one);
+    // the charge is removed with the last render
+    cache.setBudget(one);
+    CHECK_EQ(cache.size(), 1u);
+    CHECK(cache.bytes() <= one);
+    cache.setBudget(1 << 20);
+    cache.put(keyOf(L"c"), *r);
+    cache.clear();
+    CHECK_EQ(cache.bytes(), 0u);
+    // a render larger than the budget with its arena is not cached
+    cache.setBudget(arena->reserved());
+    cache.put(keyOf(L"a"), *r, arena);
+    CHECK_EQ(cache.size(), 0u);
+    delete r;
+  });
+}
@@ -0,0 +1,82 @@
+#ifndef TEST_H_INCLUDED
+#define TEST_H_INCLUDED
+
+#include <cstdio>
+#include <exception>
+#include <string>
+
+#include "latex.h"
+
+namespace tex {
+
+namespace test {
+
+/** Get the count of the failed checks */
+inline int& failures() {
+  static int count = 0;
+  return count;
+}
+
+/** Report a failed check, return false */
+inline bool fail(const char* file, int line, const std::string& msg) {
+  failures()++;
+  std::fprintf(stderr, "%s:%d: %s\n", file, line, msg.c_str());
+  return false;
+}
+
+inline std::string str(const std::string& s) { return '"' + s + '"'; }
+
+inline std::string str(const char* s) { return str(std::string(s)); }
+
+template <typename T>
+std::string str(const T& v) {
+  return std::to_string(v);
+}
+
+template <typename A, typename B>
+bool checkEq(const A& a, const B& b, const char* expr, const char* file, int line) {
+  if (a == b) return true;
+  return fail(file, line, std::string("check failed: ") + expr + " (" + str(a) + " vs " + str(b) + ")");
+}
+
+/**
+ * Get the message of the error thrown by the parse of the given latex, empty
+ * if the parse succeeds
+ */
+inline std::string errorOf(const std::wstring& latex) {
+  try {
+    delete LaTeX::parse(latex, 720, 20, 20 / 3.f, black);
+  } catch (std::exception& e) {
+    return e.what();
+  }
+  return "";
+}
+
+/**
+ * Run the given test with the resources in the working directory, return the
+ * exit code of the test
+ */
+template <typename F>
+int run(F&& test) {
+  LaTeX::init();
+  try {
+    test();
+  } catch (std::exception& e) {
+    fail(__FILE__, __LINE__, std::string("unexpected error: ") + e.what());
+  }
+  LaTeX::release();
+  if (failures() > 0) std::fprintf(stderr, "%d check(s) failed\n", failures());
+  return failures() == 0 ? 0 : 1;
+}
+
+}  // namespace test
+
+}  // namespace tex
+
+/** Check the given condition, report the failure and go on if false */
+#define CHECK(cond) ((cond) ? true : tex::test::fail(__FILE__, __LINE__, "check failed: " #cond))
+
+/** Check the given values are equal, report the failure and go on if not */
+#define CHECK_EQ(a, b) tex::test::checkEq((a), (b), #a " == " #b, __FILE__, __LINE__)
+
+#endif  // TEST_H_INCLUDED
@@ -0,0 +1,44 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "test.h"
+#include "utils/thread_pool.h"
+
+using namespace tex;
+using namespace tex::test;
+
+int main() {
+  return run([] {
+    WorkStealingPool pool(4);
+    CHECK(!WorkStealingPool::inWorker());
+    // every index is run once whatever the count of the tasks
+    for (size_t count : {0, 1, 3, 1000}) {
+      std::vector<std::atomic<int>> runs(count);
+      std::atomic<bool> inWorker(true), workerInRange(true);
+      pool.run(count, [&](size_t worker, size_t i) {
+        runs[i]++;
+        inWorker = inWorker && WorkStealingPool::inWorker();
+        workerInRange = workerInRange && worker < pool.size();
+      });
+      for (auto& n : runs) CHECK_EQ(n.load(), 1);
+      CHECK(inWorker);
+      CHECK(workerInRange);
+    }
+    CHECK(!WorkStealingPool::inWorker());
+
+    // the threads are kept alive for the later runs, every worker runs one of
+    // the tasks that wait for each other and counts its runs in its thread
+    for (int round = 1; round <= 2; round++) {
+      std::atomic<size_t> arrived(0);
+      std::atomic<bool> reused(true);
+      pool.run(pool.size(), [&](size_t, size_t) {
+        static thread_local int runs = 0;
+        arrived++;
+        while (arrived < pool.size()) std::this_thread::yield();
+        reused = reused && ++runs == round;
+      });
+      CHECK(reused);
+    }
+  });
+}